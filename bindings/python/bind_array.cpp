@@ -15,6 +15,7 @@
  ******************************************************************************/
 
 #include <asnumpy/array/basic.hpp>
+#include <asnumpy/array/manipulation.hpp>
 #include <algorithm>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
@@ -36,4 +37,12 @@ void bind_array(pybind11::module_& array) {
     array.def("identity", &Identity, py::arg("n"), py::arg("dtype"));
     array.def("linspace", &Linspace, py::arg("start"), py::arg("end"), py::arg("steps") = 50,
               py::arg("dtype") = py::none());
+    array.def("reshape", &Reshape, py::arg("a"), py::arg("newshape"));
+    array.def("transpose", &Transpose, py::arg("a"), py::arg("axes") = py::none());
+    array.def("expand_dims", &ExpandDims, py::arg("a"), py::arg("axis"));
+    array.def("squeeze", &Squeeze, py::arg("a"), py::arg("axis") = py::none());
+    array.def("ravel", &Ravel, py::arg("a"));
+    array.def("getitem", &GetItem, py::arg("a"), py::arg("key"));
+    array.def("ascontiguousarray", &AscontiguousArray, py::arg("a"));
+    array.def("may_share_memory", &MayShareMemory, py::arg("a"), py::arg("b"));
 }
@@ -14,16 +14,303 @@
  * limitations under the License.
  ******************************************************************************/
 
+#include <asnumpy/cann/allocator.hpp>
 #include <asnumpy/cann/driver.hpp>
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/executor_cache.hpp>
+#include <asnumpy/cann/graph.hpp>
+#include <asnumpy/cann/pinned.hpp>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/cann/workspace.hpp>
+#include <asnumpy/dtypes/promote.hpp>
+#include <asnumpy/utils/donation.hpp>
+#include <asnumpy/utils/npu_array.hpp>
+#include <asnumpy/utils/status_handler.hpp>
 #include <acl/acl.h>
 #include <algorithm>
+#include <cstdint>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
+namespace {
+
+// Python handle of a pooled stream. Entering makes it the thread's current stream; entries nest.
+class PyStream {
+  public:
+    PyStream() : stream_(asnumpy::cann::StreamPool::Instance().Acquire()) {}
+
+    void Enter() { previous_.push_back(asnumpy::cann::ExchangeCurrentStream(stream_)); }
+
+    void Exit() {
+        asnumpy::cann::ExchangeCurrentStream(previous_.back());
+        previous_.pop_back();
+    }
+
+    void Synchronize() const { asnumpy::cann::SynchronizeStream(stream_, __FILE__, "Stream.synchronize"); }
+
+  private:
+    aclrtStream stream_;
+    std::vector<aclrtStream> previous_;
+};
+
+// Python handle of a captured graph. `inputs` are the arrays replay() refills before launching.
+class PyGraph {
+  public:
+    explicit PyGraph(std::vector<pybind11::object> inputs) : inputs_(std::move(inputs)) {
+        for (size_t i = 0; i < inputs_.size(); ++i) {
+            if (!pybind11::isinstance<NPUArray>(inputs_[i])) {
+                throw pybind11::type_error(fmt::format("[bind_cann.cpp](Graph) input {} is not an ndarray", i));
+            }
+        }
+    }
+
+    void Begin() {
+        // Replays must refill the very buffers the graph reads.
+        for (auto& input : inputs_) {
+            input.cast<NPUArray&>().MakeExclusive();
+        }
+        graph_->BeginCapture();
+    }
+
+    void End(bool keep) { graph_->EndCapture(keep); }
+
+    void Replay(const std::vector<pybind11::object>& inputs) {
+        if (!inputs.empty() && inputs.size() != inputs_.size()) {
+            throw std::invalid_argument(fmt::format(
+                "[bind_cann.cpp](Graph.replay) expected {} inputs, got {}", inputs_.size(), inputs.size()));
+        }
+        // Check every input before copying any, so a rejected replay leaves the graph untouched.
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (!pybind11::isinstance<NPUArray>(inputs[i])) {
+                throw pybind11::type_error(fmt::format("[bind_cann.cpp](Graph.replay) input {} is not an ndarray", i));
+            }
+            const auto& given = inputs[i].cast<const NPUArray&>();
+            const auto& captured = inputs_[i].cast<const NPUArray&>();
+            if (given.shape != captured.shape || given.aclDtype != captured.aclDtype) {
+                throw std::invalid_argument(fmt::format(
+                    "[bind_cann.cpp](Graph.replay) input {} has shape ({}) and dtype {}, but the graph was captured "
+                    "with shape ({}) and dtype {}",
+                    i, fmt::join(given.shape, ", "), asnumpy::AclDtypeName(given.aclDtype),
+                    fmt::join(captured.shape, ", "), asnumpy::AclDtypeName(captured.aclDtype)));
+            }
+        }
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            if (!inputs[i].is(inputs_[i])) {
+                inputs_[i].cast<NPUArray&>().Assign(inputs[i].cast<const NPUArray&>());
+            }
+        }
+        graph_->Replay();
+    }
+
+    void SetOutputs(std::vector<pybind11::object> outputs) {
+        for (size_t i = 0; i < outputs.size(); ++i) {
+            if (!pybind11::isinstance<NPUArray>(outputs[i])) {
+                throw pybind11::type_error(fmt::format("[bind_cann.cpp](Graph) output {} is not an ndarray", i));
+            }
+        }
+        outputs_ = std::move(outputs);
+    }
+
+    // Replay, then hand out fresh copies of the outputs: the graph overwrites its own on every replay.
+    // Captured buffers are aliased, so each copy is an eager device copy rather than copy-on-write.
+    pybind11::tuple Run(const std::vector<pybind11::object>& inputs) {
+        Replay(inputs);
+        pybind11::tuple results(outputs_.size());
+        for (size_t i = 0; i < outputs_.size(); ++i) {
+            results[i] = pybind11::cast(NPUArray(outputs_[i].cast<const NPUArray&>()));
+        }
+        return results;
+    }
+
+    size_t LaunchCount() const { return graph_->launchCount(); }
+    bool Captured() const { return graph_->captured(); }
+
+  private:
+    std::vector<pybind11::object> inputs_;
+    std::vector<pybind11::object> outputs_;
+    std::unique_ptr<asnumpy::cann::Graph> graph_ = std::make_unique<asnumpy::cann::Graph>();
+};
+
+// HostWaitScope hooks: a thread blocked on the device lets the other Python threads run.
+void* ReleaseGil() {
+    if (!Py_IsInitialized() || !PyGILState_Check()) {
+        return nullptr;
+    }
+    return PyEval_SaveThread();
+}
+
+void RestoreGil(void* state) { PyEval_RestoreThread(static_cast<PyThreadState*>(state)); }
+
+} // anonymous namespace
+
 void bind_cann(pybind11::module_& cann) {
     cann.doc() = "cann module of asnumpy";
-    cann.def("set_device", &aclrtSetDevice, pybind11::arg("device_id"));
-    cann.def("reset_device", &aclrtResetDevice, pybind11::arg("device_id"));
+    asnumpy::cann::SetHostWaitHooks(&ReleaseGil, &RestoreGil);
+    cann.def(
+        "set_device",
+        [](int32_t device_id) {
+            auto error = aclrtSetDevice(device_id);
+            aclrtContext context = nullptr;
+            if (error == ACL_SUCCESS && aclrtGetCurrentContext(&context) == ACL_SUCCESS) {
+                // Threads that never call set_device launch in this context.
+                asnumpy::cann::SetSharedContext(context);
+            }
+            return error;
+        },
+        pybind11::arg("device_id"));
+    cann.def(
+        "reset_device",
+        [](int32_t device_id) {
+            asnumpy::cann::SetSharedContext(nullptr);
+            // Cached segments and executors belong to the device being reset; hand them back first.
+            asnumpy::cann::ExecutorCache::Instance().Clear();
+            asnumpy::cann::WorkspaceArena::ReleaseAll();
+            asnumpy::cann::CachingAllocator::Instance().EmptyCache();
+            return aclrtResetDevice(device_id);
+        },
+        pybind11::arg("device_id"));
     cann.def("reset_device_force", &aclrtResetDeviceForce, pybind11::arg("device_id"));
     cann.def("init", &asnumpy::cann::init);
     cann.def("finalize", &asnumpy::cann::finalize);
+    cann.def("memory_stats", []() {
+        auto stats = asnumpy::cann::CachingAllocator::Instance().Stats();
+        pybind11::dict result;
+        result["reserved_bytes"] = stats.reserved_bytes;
+        result["allocated_bytes"] = stats.allocated_bytes;
+        result["peak_reserved_bytes"] = stats.peak_reserved_bytes;
+        result["peak_allocated_bytes"] = stats.peak_allocated_bytes;
+        result["device_malloc_count"] = stats.device_malloc_count;
+        result["device_free_count"] = stats.device_free_count;
+        return result;
+    });
+    cann.def("empty_cache", []() { asnumpy::cann::CachingAllocator::Instance().EmptyCache(); });
+    cann.def("reset_peak_memory_stats", []() { asnumpy::cann::CachingAllocator::Instance().ResetPeakStats(); });
+    cann.def(
+        "workspace_stats",
+        [](bool currentStream) {
+            auto stats = currentStream
+                             ? asnumpy::cann::WorkspaceArena::ForStream(asnumpy::cann::CurrentStream()).ArenaStats()
+                             : asnumpy::cann::WorkspaceArena::Stats();
+            pybind11::dict result;
+            result["capacity_bytes"] = stats.capacity_bytes;
+            result["high_water_bytes"] = stats.high_water_bytes;
+            result["grow_count"] = stats.grow_count;
+            result["lease_count"] = stats.lease_count;
+            return result;
+        },
+        pybind11::arg("current_stream") = false);
+    cann.def(
+        "reserve_workspace",
+        [](uint64_t nbytes) {
+            asnumpy::cann::WorkspaceArena::ForStream(asnumpy::cann::CurrentStream()).Reserve(nbytes);
+        },
+        pybind11::arg("nbytes"));
+    cann.def(
+        "pinned_empty",
+        [](const std::vector<int64_t>& shape, pybind11::object dtype) {
+            auto dt = pybind11::dtype::from_args(dtype);
+            size_t nbytes = static_cast<size_t>(dt.itemsize());
+            for (auto dim : shape) {
+                if (dim < 0) {
+                    throw std::invalid_argument("[bind_cann.cpp](pinned_empty) negative dimensions are not allowed");
+                }
+                nbytes *= static_cast<size_t>(dim);
+            }
+            // The capsule owns the block: numpy frees it through the pool when the array dies.
+            void* ptr = asnumpy::cann::PinnedHostPool::Instance().Allocate(std::max<size_t>(nbytes, 1));
+            pybind11::capsule owner(ptr, [](void* p) { asnumpy::cann::PinnedHostPool::Instance().Free(p); });
+            return pybind11::array(dt, shape, ptr, owner);
+        },
+        pybind11::arg("shape"), pybind11::arg("dtype"));
+    cann.def("pinned_memory_stats", []() {
+        auto stats = asnumpy::cann::PinnedHostPool::Instance().Stats();
+        pybind11::dict result;
+        result["reserved_bytes"] = stats.reserved_bytes;
+        result["allocated_bytes"] = stats.allocated_bytes;
+        result["host_malloc_count"] = stats.host_malloc_count;
+        result["host_free_count"] = stats.host_free_count;
+        return result;
+    });
+    cann.def("transfer_stats", []() {
+        auto stats = asnumpy::cann::GetTransferStats();
+        pybind11::dict result;
+        result["transfer_count"] = stats.transfer_count;
+        result["bytes"] = stats.bytes;
+        result["seconds"] = stats.seconds;
+        result["last_bytes"] = stats.last_bytes;
+        result["last_seconds"] = stats.last_seconds;
+        result["last_direction"] = stats.last_host_to_device ? "host_to_device" : "device_to_host";
+        return result;
+    });
+    cann.def("executor_cache_stats", []() {
+        auto stats = asnumpy::cann::ExecutorCache::Instance().Stats();
+        pybind11::dict result;
+        result["hits"] = stats.hits;
+        result["misses"] = stats.misses;
+        result["evictions"] = stats.evictions;
+        result["uncacheable"] = stats.uncacheable;
+        result["entries"] = stats.entries;
+        result["capacity"] = stats.capacity;
+        return result;
+    });
+    cann.def("cast_stats", []() {
+        auto stats = asnumpy::GetCastStats();
+        pybind11::dict result;
+        result["avoided"] = stats.avoided;
+        result["materialized"] = stats.materialized;
+        return result;
+    });
+    cann.def("donation_stats", []() {
+        auto stats = asnumpy::GetDonationStats();
+        pybind11::dict result;
+        result["elided"] = stats.elided;
+        result["declined"] = stats.declined;
+        return result;
+    });
+    // Used by lazy plans for intermediates whose last reader is the next call; see NPUArray::Donate.
+    cann.def("_donate", [](NPUArray& array) { return array.Donate(); }, pybind11::arg("array"));
+    cann.def("_reclaim", [](const NPUArray& array) { array.Reclaim(); }, pybind11::arg("array"));
+    cann.def("clear_executor_cache", []() { asnumpy::cann::ExecutorCache::Instance().Clear(); });
+    cann.def(
+        "set_executor_cache_capacity",
+        [](size_t capacity) { asnumpy::cann::ExecutorCache::Instance().SetCapacity(capacity); },
+        pybind11::arg("capacity"));
+    cann.def("empty_pinned_cache", []() { asnumpy::cann::PinnedHostPool::Instance().EmptyCache(); });
+    cann.def("synchronize", []() { asnumpy::cann::Synchronize(__FILE__, "synchronize"); });
+    cann.def(
+        "set_execution_mode",
+        [](const std::string& mode) {
+            if (mode == "blocking") {
+                asnumpy::cann::SetExecutionMode(asnumpy::cann::ExecutionMode::Blocking);
+            } else if (mode == "async") {
+                asnumpy::cann::SetExecutionMode(asnumpy::cann::ExecutionMode::Async);
+            } else {
+                throw std::invalid_argument("[bind_cann.cpp](set_execution_mode) unknown execution mode '" + mode +
+                                            "', expected 'blocking' or 'async'");
+            }
+        },
+        pybind11::arg("mode"));
+    pybind11::class_<PyStream>(cann, "Stream")
+        .def(pybind11::init<>())
+        .def("enter", &PyStream::Enter)
+        .def("exit", &PyStream::Exit)
+        .def("synchronize", &PyStream::Synchronize);
+    pybind11::class_<PyGraph>(cann, "Graph")
+        .def(pybind11::init<std::vector<pybind11::object>>(), pybind11::arg("inputs"))
+        .def("begin", &PyGraph::Begin)
+        .def("end", &PyGraph::End, pybind11::arg("keep"))
+        .def("replay", &PyGraph::Replay, pybind11::arg("inputs"))
+        .def("set_outputs", &PyGraph::SetOutputs, pybind11::arg("outputs"))
+        .def("run", &PyGraph::Run, pybind11::arg("inputs"))
+        .def_property_readonly("launch_count", &PyGraph::LaunchCount)
+        .def_property_readonly("captured", &PyGraph::Captured);
+    cann.def("get_execution_mode", []() {
+        return asnumpy::cann::GetExecutionMode() == asnumpy::cann::ExecutionMode::Async ? "async" : "blocking";
+    });
 }
@@ -0,0 +1,39 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include <asnumpy/math/foreach.hpp>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+namespace asnumpy {
+
+void bind_foreach(py::module_& foreach) {
+    foreach.doc() = "multi-tensor (aclnnForeach) operators over lists of arrays";
+    foreach.def("add", &ForeachAdd, py::arg("x1"), py::arg("x2"));
+    foreach.def("sub", &ForeachSubtract, py::arg("x1"), py::arg("x2"));
+    foreach.def("mul", &ForeachMultiply, py::arg("x1"), py::arg("x2"));
+    foreach.def("div", &ForeachDivide, py::arg("x1"), py::arg("x2"));
+    foreach.def("add_scalar", &ForeachAddScalar, py::arg("x"), py::arg("value"));
+    foreach.def("mul_scalar", &ForeachMultiplyScalar, py::arg("x"), py::arg("value"));
+    foreach.def("exp", &ForeachExp, py::arg("x"));
+    foreach.def("sqrt", &ForeachSqrt, py::arg("x"));
+    foreach.def("neg", &ForeachNegative, py::arg("x"));
+    foreach.def("norm", &ForeachNorm, py::arg("x"), py::arg("ord") = 2.0);
+}
+
+} // namespace asnumpy
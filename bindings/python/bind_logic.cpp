@@ -45,13 +45,16 @@ void bind_logic(py::module_& logic) {
     logic.def("logical_not", &LogicalNot, py::arg("x"));
     logic.def("logical_xor", &LogicalXor, py::arg("x1"), py::arg("x2"));
 
-    // Comparisons (array-array / array-scalar), dtype optional
+    // Comparisons (array-array / array-scalar / scalar-array), dtype optional
     logic.def("greater", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&greater),
               py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
 
     logic.def("greater", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&greater),
               py::arg("x1"), py::arg("scalar"), py::arg("dtype") = py::none());
 
+    logic.def("greater", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&greater),
+              py::arg("scalar"), py::arg("x2"), py::arg("dtype") = py::none());
+
     logic.def("greater_equal",
               py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&greater_equal),
               py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
@@ -60,6 +63,10 @@ void bind_logic(py::module_& logic) {
               py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&greater_equal),
               py::arg("x1"), py::arg("scalar"), py::arg("dtype") = py::none());
 
+    logic.def("greater_equal",
+              py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&greater_equal),
+              py::arg("scalar"), py::arg("x2"), py::arg("dtype") = py::none());
+
     // Less comparisons
     logic.def("less", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&less),
               py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
@@ -67,6 +74,9 @@ void bind_logic(py::module_& logic) {
     logic.def("less", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&less),
               py::arg("x1"), py::arg("scalar"), py::arg("dtype") = py::none());
 
+    logic.def("less", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&less),
+              py::arg("scalar"), py::arg("x2"), py::arg("dtype") = py::none());
+
     logic.def("less_equal", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&less_equal),
               py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
 
@@ -74,6 +84,10 @@ void bind_logic(py::module_& logic) {
               py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&less_equal),
               py::arg("x1"), py::arg("scalar"), py::arg("dtype") = py::none());
 
+    logic.def("less_equal",
+              py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&less_equal),
+              py::arg("scalar"), py::arg("x2"), py::arg("dtype") = py::none());
+
     // Equal / Not equal comparisons
     logic.def("equal", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&equal),
               py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
@@ -81,9 +95,15 @@ void bind_logic(py::module_& logic) {
     logic.def("equal", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&equal),
               py::arg("x1"), py::arg("scalar"), py::arg("dtype") = py::none());
 
+    logic.def("equal", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&equal),
+              py::arg("scalar"), py::arg("x2"), py::arg("dtype") = py::none());
+
     logic.def("not_equal", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&not_equal),
               py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
 
     logic.def("not_equal", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&not_equal),
               py::arg("x1"), py::arg("scalar"), py::arg("dtype") = py::none());
+
+    logic.def("not_equal", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&not_equal),
+              py::arg("scalar"), py::arg("x2"), py::arg("dtype") = py::none());
 }
@@ -18,6 +18,7 @@
 #include <asnumpy/math/exponents_and_logarithms.hpp>
 #include <asnumpy/math/extrema_finding.hpp>
 #include <asnumpy/math/floating_point_routines.hpp>
+#include <asnumpy/math/fused_operations.hpp>
 #include <asnumpy/math/handling_complex_numbers.hpp>
 #include <asnumpy/math/hyperbolic_functions.hpp>
 #include <asnumpy/math/miscellaneous.hpp>
@@ -47,6 +48,7 @@ void bind_arithmetic_operations(py::module_& math);
 void bind_handling_complex_numbers(py::module_& math);
 void bind_miscellaneous(py::module_& math);
 void bind_extrema_finding(py::module_& math);
+void bind_fused_operations(py::module_& math);
 
 } // namespace asnumpy
 
@@ -64,6 +66,7 @@ void bind_math(py::module_& math) {
     bind_handling_complex_numbers(math);
     bind_miscellaneous(math);
     bind_extrema_finding(math);
+    bind_fused_operations(math);
 }
 
 namespace asnumpy {
@@ -103,14 +106,51 @@ void bind_miscellaneous(py::module_& math) {
 }
 
 void bind_arithmetic_operations(py::module_& math) {
-    math.def("add", &Add, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("add", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&Add),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("add", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>, NPUArray*>(&Add),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("add", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&Add),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
     math.def("reciprocal", &Reciprocal, py::arg("x"), py::arg("dtype") = py::none());
     math.def("positive", &Positive, py::arg("x"), py::arg("dtype") = py::none());
-    math.def("negative", &Negative, py::arg("x"), py::arg("dtype") = py::none());
-    math.def("multiply", &Multiply, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
-    math.def("divide", &Divide, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
-    math.def("true_divide", &TrueDivide, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
-    math.def("subtract", &Subtract, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("negative", &Negative, py::arg("x"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("multiply",
+             py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&Multiply),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("multiply",
+             py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>, NPUArray*>(&Multiply),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("multiply",
+             py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&Multiply),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("divide",
+             py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&Divide),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("divide",
+             py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>, NPUArray*>(&Divide),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("divide",
+             py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&Divide),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("true_divide",
+             py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&TrueDivide),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("true_divide",
+             py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>, NPUArray*>(&TrueDivide),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("true_divide",
+             py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&TrueDivide),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("subtract",
+             py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&Subtract),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("subtract",
+             py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>, NPUArray*>(&Subtract),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
+    math.def("subtract",
+             py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>, NPUArray*>(&Subtract),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none(), py::arg("out") = py::none());
     math.def("floor_divide", &FloorDivide, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
     math.def("float_power", &FloatPower, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
     math.def("fmod", &Fmod, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
@@ -127,17 +167,27 @@ void bind_arithmetic_operations(py::module_& math) {
 }
 
 void bind_sums_products_differences(py::module_& math) {
-    math.def("prod", py::overload_cast<const NPUArray&, int64_t, bool, std::optional<py::dtype>>(&Prod), py::arg("a"),
-             py::arg("axis"), py::arg("keepdims"), py::arg("dtype") = py::none());
+    using Axes = std::optional<std::vector<int64_t>>;
+    using Mask = std::optional<NPUArray>;
+    math.def("prod",
+             py::overload_cast<const NPUArray&, const Axes&, bool, std::optional<py::dtype>, const Mask&>(&Prod),
+             py::arg("a"), py::arg("axis"), py::arg("keepdims") = false, py::arg("dtype") = py::none(),
+             py::arg("where") = py::none());
     math.def("prod", py::overload_cast<const NPUArray&>(&Prod), py::arg("a"));
-    math.def("sum", py::overload_cast<const NPUArray&, int64_t, bool, std::optional<py::dtype>>(&Sum), py::arg("a"),
-             py::arg("axis"), py::arg("keepdims"), py::arg("dtype") = py::none());
+    math.def("sum",
+             py::overload_cast<const NPUArray&, const Axes&, bool, std::optional<py::dtype>, const Mask&>(&Sum),
+             py::arg("a"), py::arg("axis"), py::arg("keepdims") = false, py::arg("dtype") = py::none(),
+             py::arg("where") = py::none());
     math.def("sum", py::overload_cast<const NPUArray&>(&Sum), py::arg("a"));
-    math.def("nanprod", py::overload_cast<const NPUArray&, int64_t, bool, std::optional<py::dtype>>(&Nanprod),
-             py::arg("a"), py::arg("axis"), py::arg("keepdims"), py::arg("dtype") = py::none());
+    math.def("nanprod",
+             py::overload_cast<const NPUArray&, const Axes&, bool, std::optional<py::dtype>, const Mask&>(&Nanprod),
+             py::arg("a"), py::arg("axis"), py::arg("keepdims") = false, py::arg("dtype") = py::none(),
+             py::arg("where") = py::none());
     math.def("nanprod", py::overload_cast<const NPUArray&>(&Nanprod), py::arg("a"));
-    math.def("nansum", py::overload_cast<const NPUArray&, int64_t, bool, std::optional<py::dtype>>(&Nansum),
-             py::arg("a"), py::arg("axis"), py::arg("keepdims"), py::arg("dtype") = py::none());
+    math.def("nansum",
+             py::overload_cast<const NPUArray&, const Axes&, bool, std::optional<py::dtype>, const Mask&>(&Nansum),
+             py::arg("a"), py::arg("axis"), py::arg("keepdims") = false, py::arg("dtype") = py::none(),
+             py::arg("where") = py::none());
     math.def("nansum", py::overload_cast<const NPUArray&>(&Nansum), py::arg("a"));
     math.def("cumprod", &Cumprod, py::arg("a"), py::arg("axis"), py::arg("dtype") = py::none());
     math.def("cumsum", &Cumsum, py::arg("a"), py::arg("axis"), py::arg("dtype") = py::none());
@@ -195,25 +245,52 @@ void bind_rounding(py::module_& math) {
 }
 
 void bind_extrema_finding(py::module_& math) {
-    math.def("maximum", &Maximum, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
-    math.def("minimum", &Minimum, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
-    math.def("fmax", &Fmax, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
-    math.def("fmin", &Fmin, py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
-    math.def("max", py::overload_cast<const NPUArray&, int64_t, bool>(&Max), py::arg("a"), py::arg("axis"),
-             py::arg("keepdims"));
+    using Axes = std::optional<std::vector<int64_t>>;
+    math.def("maximum", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&Maximum),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("maximum", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&Maximum),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("maximum", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&Maximum),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("minimum", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&Minimum),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("minimum", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&Minimum),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("minimum", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&Minimum),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("fmax", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&Fmax),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("fmax", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&Fmax),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("fmax", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&Fmax),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("fmin", py::overload_cast<const NPUArray&, const NPUArray&, std::optional<py::dtype>>(&Fmin),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("fmin", py::overload_cast<const NPUArray&, const py::object&, std::optional<py::dtype>>(&Fmin),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("fmin", py::overload_cast<const py::object&, const NPUArray&, std::optional<py::dtype>>(&Fmin),
+             py::arg("x1"), py::arg("x2"), py::arg("dtype") = py::none());
+    math.def("max", py::overload_cast<const NPUArray&, const Axes&, bool>(&Max), py::arg("a"), py::arg("axis"),
+             py::arg("keepdims") = false);
     math.def("max", py::overload_cast<const NPUArray&>(&Max), py::arg("a"));
-    math.def("amax", py::overload_cast<const NPUArray&, int64_t, bool>(&Max), py::arg("a"), py::arg("axis"),
-             py::arg("keepdims"));
+    math.def("amax", py::overload_cast<const NPUArray&, const Axes&, bool>(&Max), py::arg("a"), py::arg("axis"),
+             py::arg("keepdims") = false);
     math.def("amax", py::overload_cast<const NPUArray&>(&Max), py::arg("a"));
-    math.def("nanmax", py::overload_cast<const NPUArray&, int64_t, bool>(&Nanmax), py::arg("a"), py::arg("axis"),
-             py::arg("keepdims"));
+    math.def("nanmax", py::overload_cast<const NPUArray&, const Axes&, bool>(&Nanmax), py::arg("a"), py::arg("axis"),
+             py::arg("keepdims") = false);
     math.def("nanmax", py::overload_cast<const NPUArray&>(&Nanmax), py::arg("a"));
-    math.def("min", py::overload_cast<const NPUArray&, int64_t, bool>(&Min), py::arg("a"), py::arg("axis"),
-             py::arg("keepdims"));
+    math.def("min", py::overload_cast<const NPUArray&, const Axes&, bool>(&Min), py::arg("a"), py::arg("axis"),
+             py::arg("keepdims") = false);
     math.def("min", py::overload_cast<const NPUArray&>(&Min), py::arg("a"));
-    math.def("amin", py::overload_cast<const NPUArray&, int64_t, bool>(&Min), py::arg("a"), py::arg("axis"),
-             py::arg("keepdims"));
+    math.def("amin", py::overload_cast<const NPUArray&, const Axes&, bool>(&Min), py::arg("a"), py::arg("axis"),
+             py::arg("keepdims") = false);
     math.def("amin", py::overload_cast<const NPUArray&>(&Min), py::arg("a"));
 }
 
+void bind_fused_operations(py::module_& math) {
+    math.def("addcmul", &Addcmul, py::arg("input"), py::arg("tensor1"), py::arg("tensor2"), py::arg("value") = 1.0);
+    math.def("lerp", &Lerp, py::arg("start"), py::arg("end"), py::arg("weight"));
+    math.def("axpy", &Axpy, py::arg("x"), py::arg("y"), py::arg("alpha"), py::arg("subtract") = false);
+}
+
 } // namespace asnumpy
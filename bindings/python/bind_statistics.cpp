@@ -25,8 +25,11 @@ namespace asnumpy {
 
 void bind_statistics(py::module_& statistics) {
     statistics.doc() = "statistics module of asnumpy";
-    statistics.def("mean", py::overload_cast<const NPUArray&, int64_t, bool, std::optional<py::dtype>>(&Mean),
-                   py::arg("a"), py::arg("axis"), py::arg("keepdims"), py::arg("dtype") = py::none());
+    statistics.def("mean",
+                   py::overload_cast<const NPUArray&, const std::optional<std::vector<int64_t>>&, bool,
+                                     std::optional<py::dtype>, const std::optional<NPUArray>&>(&Mean),
+                   py::arg("a"), py::arg("axis"), py::arg("keepdims") = false, py::arg("dtype") = py::none(),
+                   py::arg("where") = py::none());
     statistics.def("mean", py::overload_cast<const NPUArray&, std::optional<py::dtype>>(&Mean), py::arg("a"),
                    py::arg("dtype") = py::none());
 }
@@ -14,7 +14,23 @@
  * limitations under the License.
  ******************************************************************************/
 
+#include <asnumpy/dtypes/dtype_table.hpp>
+#include <asnumpy/dtypes/promote.hpp>
 #include <algorithm>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 
-void bind_testing(pybind11::module_& testing) { testing.doc() = "testing module of asnumpy"; }
+namespace py = pybind11;
+
+void bind_testing(py::module_& testing) {
+    testing.doc() = "testing module of asnumpy";
+
+    // Exposes the compiled promotion table so the tests can hold it against numpy.result_type.
+    testing.def(
+        "promote_types",
+        [](const py::dtype& a, const py::dtype& b) {
+            using namespace asnumpy;
+            return dtypes::NumpyFromAcl(ResultType(dtypes::AclFromNumpy(a), dtypes::AclFromNumpy(b)));
+        },
+        py::arg("a"), py::arg("b"));
+}
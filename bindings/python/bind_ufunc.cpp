@@ -0,0 +1,369 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include <asnumpy/utils/npu_array.hpp>
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <fmt/format.h>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+namespace {
+
+// The module's exception translator turns every std::runtime_error -- py::type_error included --
+// into RuntimeError, so TypeErrors are raised through the Python error indicator instead.
+[[noreturn]] void RaiseTypeError(const std::string& message) {
+    PyErr_SetString(PyExc_TypeError, message.c_str());
+    throw py::error_already_set();
+}
+
+// Kind score for weak-scalar coercion: bool=0, integers=1, floating/complex=2, anything else=3.
+int Kind(const py::dtype& dtype) {
+    switch (dtype.kind()) {
+    case 'b':
+        return 0;
+    case 'i':
+    case 'u':
+        return 1;
+    case 'f':
+    case 'c':
+        return 2;
+    default:
+        return 3;
+    }
+}
+
+// Loop-matching key: NumPy's normalized type number, so dtypes equal under == (int64 and
+// longlong) match the same loop. Non-native byte orders compare unequal to every loop type.
+int MatchKey(const py::dtype& dtype) {
+    return dtype.byteorder() == '>' ? -1 : dtype.normalized_num();
+}
+
+// Key slot for "no dtype= given": matches a loop of any output type.
+constexpr int kAnyOutput = -2;
+
+struct Loop {
+    std::vector<int> in;
+    std::vector<int> out;
+    py::object routine;
+    bool acceptsDtype;
+};
+
+/**
+ * Dispatcher behind every registered asnumpy ufunc (see src/asnumpy/_ufunc.py).
+ *
+ * Built once from a loop table; a call then runs in here from keyword parsing to the returned
+ * array. It defers to a LazyArray when lazy evaluation asks for it, resolves the operand dtypes
+ * (weak Python scalars take the widest array dtype, as NumPy 2 does), finds the first loop with
+ * exactly those dtypes (cached per dtype tuple), calls its routine with the operands as given,
+ * wraps the result in asnumpy.ndarray and writes it to `out`. Dtypes with no loop go to the
+ * fallback.
+ */
+class PyUfunc {
+  public:
+    PyUfunc(std::string name, py::object ops, py::object fallback, bool acceptsOut, std::string defaultCasting,
+            py::object lazyEnabled, py::object lazyArray, py::object materialize, py::object wrapper)
+        : name_(std::move(name)), ops_(std::move(ops)), fallback_(std::move(fallback)), acceptsOut_(acceptsOut),
+          defaultCasting_(std::move(defaultCasting)), lazyEnabled_(std::move(lazyEnabled)),
+          lazyArray_(std::move(lazyArray)), materialize_(std::move(materialize)), wrapper_(std::move(wrapper)) {
+        nin_ = ops_.attr("nin").cast<int>();
+        nout_ = ops_.attr("nout").cast<int>();
+        for (py::handle op : ops_.attr("ops")) {
+            Loop loop{{}, {}, op.attr("routine"), op.attr("accepts_dtype").cast<bool>()};
+            for (py::handle dtype : op.attr("in_types")) {
+                loop.in.push_back(MatchKey(py::dtype::from_args(py::reinterpret_borrow<py::object>(dtype))));
+            }
+            for (py::handle dtype : op.attr("out_types")) {
+                loop.out.push_back(MatchKey(py::dtype::from_args(py::reinterpret_borrow<py::object>(dtype))));
+            }
+            loops_.push_back(std::move(loop));
+        }
+        auto numpy = py::module_::import("numpy");
+        numpyGeneric_ = numpy.attr("generic");
+        asarray_ = numpy.attr("asarray");
+        coreInit_ = py::type::of<NPUArray>().attr("__init__");
+    }
+
+    py::object Call(const py::object& self, const py::args& args, const py::kwargs& kwargs) {
+        py::object out = kwargs.contains("out") ? py::object(kwargs["out"]) : py::object(py::none());
+        bool lazyOperand = false;
+        for (py::handle arg : args) {
+            lazyOperand = lazyOperand || py::isinstance(arg, lazyArray_);
+        }
+        for (auto item : kwargs) {
+            lazyOperand = lazyOperand || py::isinstance(item.second, lazyArray_);
+        }
+        if (out.is_none() && (lazyOperand || LazyEnabled())) {
+            return lazyArray_(self, args, kwargs);
+        }
+
+        py::tuple operands = args;
+        py::dict options = kwargs;
+        if (lazyOperand) {
+            py::tuple evaluated = materialize_(args, kwargs);
+            operands = evaluated[0].cast<py::tuple>();
+            options = evaluated[1].cast<py::dict>();
+        }
+
+        py::object dtype = py::none();
+        std::string unexpected;
+        for (auto item : options) {
+            const auto key = item.first.cast<std::string>();
+            if (key == "dtype") {
+                dtype = py::reinterpret_borrow<py::object>(item.second);
+            } else if (key == "out") {
+                out = py::reinterpret_borrow<py::object>(item.second);
+            } else {
+                unexpected += (unexpected.empty() ? "" : ", ") + key;
+            }
+        }
+        if (!unexpected.empty()) {
+            RaiseTypeError(fmt::format("ufunc '{}' got unexpected keyword argument(s): {}", name_, unexpected));
+        }
+        if (!dtype.is_none()) {
+            dtype = py::dtype::from_args(dtype);
+        }
+        if (py::isinstance<py::tuple>(out) && py::len(out) == 1) {
+            // NumPy's __array_ufunc__ protocol always passes out= as a tuple.
+            out = out[py::int_(0)];
+        }
+        // Routines that take an output array write into it directly (or update it in place when
+        // it is also the first operand) instead of producing a temporary for WriteOut to copy.
+        const bool directOut = acceptsOut_ && py::isinstance(out, wrapper_);
+
+        std::vector<py::dtype> dtypes = OperandDtypes(operands);
+        const int index = FindLoop(dtypes, dtype.is_none() ? nullptr : &dtype);
+        if (index < 0) {
+            if (fallback_.is_none()) {
+                std::string names;
+                for (const auto& d : dtypes) {
+                    names += fmt::format("{}'{}'", names.empty() ? "" : ", ", py::str(d).cast<std::string>());
+                }
+                RaiseTypeError(fmt::format("ufunc '{}' has no matching loop for input dtypes [{}]", name_, names));
+            }
+            if (directOut) {
+                fallback_(*operands, py::arg("dtype") = dtype, py::arg("out") = out);
+                return out;
+            }
+            return WriteOut(out, fallback_(*operands, py::arg("dtype") = dtype));
+        }
+
+        // Copied out of loops_: the routine may release the GIL, and another thread may then
+        // dispatch through this ufunc.
+        py::object routine = loops_[index].routine;
+        const bool acceptsDtype = loops_[index].acceptsDtype;
+        if (!dtype.is_none() && !acceptsDtype) {
+            RaiseTypeError(fmt::format("ufunc '{}' does not support the 'dtype' parameter", name_));
+        }
+        if (directOut && acceptsDtype) {
+            routine(*operands, dtype, out);
+            return out;
+        }
+        py::object result = acceptsDtype ? routine(*operands, dtype) : routine(*operands);
+        if (py::isinstance<py::tuple>(result)) {
+            py::tuple parts(py::len(result));
+            for (size_t i = 0; i < parts.size(); ++i) {
+                parts[i] = Wrap(result[py::int_(i)]);
+            }
+            result = std::move(parts);
+        } else {
+            result = Wrap(result);
+        }
+        return WriteOut(out, result);
+    }
+
+    const std::string& Name() const { return name_; }
+    int Nin() const { return nin_; }
+    int Nout() const { return nout_; }
+    const py::object& Ops() const { return ops_; }
+    const py::object& Fallback() const { return fallback_; }
+    bool AcceptsOut() const { return acceptsOut_; }
+    const std::string& DefaultCasting() const { return defaultCasting_; }
+
+  private:
+    bool LazyEnabled() const {
+        PyObject* value = nullptr;
+        if (PyContextVar_Get(lazyEnabled_.ptr(), nullptr, &value) < 0) {
+            throw py::error_already_set();
+        }
+        auto enabled = py::reinterpret_steal<py::object>(value);
+        return enabled && PyObject_IsTrue(enabled.ptr()) == 1;
+    }
+
+    // Operand dtypes as the loop table sees them: arrays and NumPy scalars by their dtype, Python
+    // scalars by their type -- except int/float/complex, which are weak and adopt the widest array
+    // dtype when their kind does not exceed it (a complex scalar next to real arrays: complex128).
+    std::vector<py::dtype> OperandDtypes(const py::tuple& operands) const {
+        std::vector<py::dtype> dtypes;
+        dtypes.reserve(operands.size());
+        std::vector<bool> weak(operands.size(), false);
+        int widest = -1;
+        for (size_t i = 0; i < operands.size(); ++i) {
+            py::handle arg = operands[i];
+            bool isArray = true;
+            if (py::isinstance<NPUArray>(arg)) {
+                dtypes.push_back(arg.cast<const NPUArray&>().dtype);
+            } else if (py::isinstance<py::array>(arg)) {
+                dtypes.push_back(py::reinterpret_borrow<py::array>(arg).dtype());
+            } else if (PyBool_Check(arg.ptr())) {
+                dtypes.push_back(py::dtype::of<bool>());
+                isArray = false;
+            } else if (py::isinstance(arg, numpyGeneric_)) {
+                dtypes.push_back(py::dtype::from_args(arg.attr("dtype")));
+            } else if (PyLong_Check(arg.ptr()) || PyFloat_Check(arg.ptr()) || PyComplex_Check(arg.ptr())) {
+                dtypes.push_back(PyLong_Check(arg.ptr())    ? py::dtype::of<int64_t>()
+                                 : PyFloat_Check(arg.ptr()) ? py::dtype::of<double>()
+                                                            : py::dtype::of<std::complex<double>>());
+                weak[i] = true;
+                isArray = false;
+            } else {
+                dtypes.push_back(py::dtype::from_args(asarray_(arg).attr("dtype")));
+                isArray = py::hasattr(arg, "dtype");
+            }
+            if (isArray && (widest < 0 || std::make_pair(Kind(dtypes[i]), dtypes[i].itemsize()) >
+                                              std::make_pair(Kind(dtypes[widest]), dtypes[widest].itemsize()))) {
+                widest = static_cast<int>(i);
+            }
+        }
+        if (widest >= 0) {
+            const py::dtype target = dtypes[widest];
+            for (size_t i = 0; i < operands.size(); ++i) {
+                if (weak[i] && Kind(dtypes[i]) <= Kind(target)) {
+                    const bool promotesToComplex = PyComplex_Check(operands[i].ptr()) && target.kind() != 'c';
+                    dtypes[i] = promotesToComplex ? py::dtype::of<std::complex<double>>() : target;
+                }
+            }
+        }
+        return dtypes;
+    }
+
+    // Index of the first loop whose input types equal `dtypes` (and whose single output type is
+    // `requested`, if given), or -1.
+    int FindLoop(const std::vector<py::dtype>& dtypes, const py::object* requested) {
+        std::vector<int> key;
+        key.reserve(dtypes.size() + 1);
+        for (const auto& dtype : dtypes) {
+            key.push_back(MatchKey(dtype));
+        }
+        key.push_back(requested ? MatchKey(py::reinterpret_borrow<py::dtype>(*requested)) : kAnyOutput);
+        if (auto cached = cache_.find(key); cached != cache_.end()) {
+            return cached->second;
+        }
+        int found = -1;
+        for (size_t i = 0; i < loops_.size() && found < 0; ++i) {
+            const Loop& loop = loops_[i];
+            if (requested && (loop.out.size() != 1 || loop.out[0] != key.back())) {
+                continue;
+            }
+            if (std::equal(loop.in.begin(), loop.in.end(), key.begin(), key.end() - 1)) {
+                found = static_cast<int>(i);
+            }
+        }
+        cache_.emplace(std::move(key), found);
+        return found;
+    }
+
+    // A routine returns a private core array; it is moved into a new asnumpy.ndarray without
+    // running the Python-level constructor.
+    py::object Wrap(const py::object& result) const {
+        if (py::isinstance(result, wrapper_)) {
+            return result;
+        }
+        if (!py::isinstance<NPUArray>(result)) {
+            return wrapper_(result);
+        }
+        auto* type = reinterpret_cast<PyTypeObject*>(wrapper_.ptr());
+        auto wrapped = py::reinterpret_steal<py::object>(type->tp_new(type, py::tuple().ptr(), nullptr));
+        if (!wrapped) {
+            throw py::error_already_set();
+        }
+        coreInit_(wrapped, result, py::arg("_move") = true);
+        return wrapped;
+    }
+
+    static py::object WriteOut(const py::object& out, const py::object& result) {
+        if (out.is_none()) {
+            return result;
+        }
+        py::tuple targets = py::isinstance<py::tuple>(out) ? py::tuple(out) : py::make_tuple(out);
+        py::tuple results = py::isinstance<py::tuple>(result) ? py::tuple(result) : py::make_tuple(result);
+        if (targets.size() != results.size()) {
+            throw std::invalid_argument(fmt::format("[bind_ufunc.cpp](WriteOut) {} output(s) given for {} result(s)",
+                                                    targets.size(), results.size()));
+        }
+        for (size_t i = 0; i < targets.size(); ++i) {
+            py::object dst = targets[i];
+            py::object src = results[i];
+            py::object dtype = dst.attr("dtype");
+            if (!src.attr("dtype").equal(dtype)) {
+                src = src.attr("astype")(dtype);
+            }
+            dst.attr("_assign")(src);
+        }
+        return out;
+    }
+
+    std::string name_;
+    int nin_ = 0;
+    int nout_ = 0;
+    py::object ops_;
+    py::object fallback_;
+    bool acceptsOut_;
+    std::string defaultCasting_;
+    std::vector<Loop> loops_;
+    std::map<std::vector<int>, int> cache_;
+
+    py::object lazyEnabled_;
+    py::object lazyArray_;
+    py::object materialize_;
+    py::object wrapper_;
+    py::object numpyGeneric_;
+    py::object asarray_;
+    py::object coreInit_;
+};
+
+} // anonymous namespace
+
+void bind_ufunc(pybind11::module_& module) {
+    // dynamic_attr: create_ufunc sets each instance's __doc__.
+    py::class_<PyUfunc>(module, "ufunc", py::dynamic_attr())
+        .def(py::init<std::string, py::object, py::object, bool, std::string, py::object, py::object, py::object,
+                      py::object>(),
+             py::arg("name"), py::arg("ops"), py::arg("fallback"), py::arg("accepts_out"), py::arg("default_casting"),
+             py::arg("lazy_enabled"), py::arg("lazy_array"), py::arg("materialize"), py::arg("wrapper"),
+             "Compile a loop table (a _ufunc.Ops) into a ufunc; see asnumpy._ufunc.create_ufunc")
+        .def("__call__",
+             [](const py::object& self, const py::args& args, const py::kwargs& kwargs) {
+                 return self.cast<PyUfunc&>().Call(self, args, kwargs);
+             })
+        .def("__repr__", [](const PyUfunc& self) { return fmt::format("<ufunc '{}'>", self.Name()); })
+        .def_property_readonly("name", &PyUfunc::Name)
+        .def_property_readonly("__name__", &PyUfunc::Name)
+        .def_property_readonly("nin", &PyUfunc::Nin)
+        .def_property_readonly("nout", &PyUfunc::Nout)
+        .def_property_readonly("_ops", &PyUfunc::Ops)
+        .def_property_readonly("_fallback", &PyUfunc::Fallback)
+        .def_property_readonly("_accepts_out", &PyUfunc::AcceptsOut)
+        .def_property_readonly("_default_casting", &PyUfunc::DefaultCasting);
+}
@@ -14,19 +14,136 @@
  * limitations under the License.
  ******************************************************************************/
 
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/utils/cast.hpp>
 #include <asnumpy/utils/npu_array.hpp>
+#include <asnumpy/utils/status_handler.hpp>
 #include <algorithm>
+#include <cstring>
+#include <memory>
+#include <optional>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <stdexcept>
 #include <utility>
 
+namespace {
+
+// Python handle of a copy started by from_numpy_async / to_numpy_async. Holds the host array the
+// copy reads from or writes to until the copy is known to be done.
+class PyTransfer {
+  public:
+    PyTransfer(py::object value, py::object host, std::shared_ptr<asnumpy::cann::StreamMarker> done)
+        : value_(std::move(value)), host_(std::move(host)), done_(std::move(done)) {}
+
+    bool Done() {
+        if (done_ && done_->IsComplete()) {
+            Release();
+        }
+        return !done_;
+    }
+
+    void Wait() {
+        if (!done_) {
+            return;
+        }
+        {
+            // Let other Python threads (e.g. an asyncio loop) run while the device finishes.
+            py::gil_scoped_release release;
+            asnumpy::cann::WaitForMarker(*done_, __FILE__, "Transfer.wait");
+        }
+        Release();
+    }
+
+    py::object Result() {
+        Wait();
+        return value_;
+    }
+
+    const py::object& Value() const { return value_; }
+
+  private:
+    void Release() {
+        done_.reset();
+        host_ = py::none();
+    }
+
+    py::object value_;
+    py::object host_;
+    std::shared_ptr<asnumpy::cann::StreamMarker> done_;
+};
+
+// (device type, device id) of every array: the current NPU.
+std::pair<int32_t, int32_t> DlpackDevice() {
+    int32_t device = 0;
+    auto error = aclrtGetDevice(&device);
+    ACL_RT_CHECK(error, "aclrtGetDevice");
+    return {asnumpy::dlpack::kDLExtDev, device};
+}
+
+// Iterator behind ndarray.iter_numpy_chunks: yields row blocks of the array as NumPy arrays.
+class PyChunkIterator {
+  public:
+    PyChunkIterator(py::object array, size_t chunkBytes) : owner_(std::move(array)) {
+        const auto& self = owner_.cast<const NPUArray&>();
+        if (!self.IsContiguous()) {
+            contiguous_ = std::make_unique<NPUArray>(self.Contiguous());
+        }
+        const NPUArray& source = contiguous_ ? *contiguous_ : self;
+        dtype_ = source.dtype;
+        rowShape_.assign(source.shape.begin() + std::min<size_t>(source.shape.size(), 1), source.shape.end());
+        rowBytes_ = NPUArray::GetDataTypeSize(source.aclDtype);
+        for (auto dim : rowShape_) {
+            rowBytes_ *= static_cast<size_t>(dim);
+        }
+        // Whole rows per chunk, at least one. A 0-d array is a single chunk.
+        scalar_ = source.shape.empty();
+        size_t rows = rowBytes_ > 0 ? std::max<size_t>(chunkBytes / rowBytes_, 1) : 1;
+        size_t chunk = scalar_ ? rowBytes_ : rows * rowBytes_;
+        reader_ = source.ReadChunks(chunk);
+    }
+
+    py::array Next() {
+        size_t n = 0;
+        const void* chunk = reader_->Next(&n);
+        if (!chunk) {
+            throw py::stop_iteration();
+        }
+        std::vector<int64_t> shape;
+        if (!scalar_) {
+            shape.push_back(static_cast<int64_t>(n / rowBytes_));
+            shape.insert(shape.end(), rowShape_.begin(), rowShape_.end());
+        }
+        py::array result(dtype_, shape);
+        std::memcpy(result.mutable_data(), chunk, n);
+        return result;
+    }
+
+  private:
+    py::object owner_; // keeps the source array alive while chunks are read from it
+    std::unique_ptr<NPUArray> contiguous_;
+    py::dtype dtype_;
+    std::vector<int64_t> rowShape_;
+    size_t rowBytes_ = 0;
+    bool scalar_ = false;
+    std::unique_ptr<asnumpy::cann::ChunkedDeviceToHost> reader_;
+};
+
+} // anonymous namespace
+
 void bind_utils(pybind11::module_& utils) {
+    pybind11::class_<PyChunkIterator>(utils, "ChunkIterator")
+        .def("__iter__", [](PyChunkIterator& self) -> PyChunkIterator& { return self; })
+        .def("__next__", &PyChunkIterator::Next);
+    pybind11::class_<PyTransfer>(utils, "Transfer")
+        .def("done", &PyTransfer::Done, "Whether the copy has finished, without blocking")
+        .def("wait", &PyTransfer::Wait, "Block until the copy has finished; raises if the device failed")
+        .def("result", &PyTransfer::Result, "Wait, then return the destination array")
+        .def_property_readonly("value", &PyTransfer::Value, "Destination array, possibly still being written");
     pybind11::class_<NPUArray>(utils, "ndarray")
         .def(py::init<const std::vector<int64_t>&, py::dtype>(), py::arg("shape"), py::arg("dtype"),
              "Constructs an empty NPUArray with the given shape and dtype.")
-        // One-argument construction must remain a deep copy.
+        // One-argument construction must remain a copy (copy-on-write, so it is cheap until written).
         .def(py::init<const NPUArray&>(), "Copy constructor for NPUArray")
         // Keep _move required and keyword-only: ndarray(other) selects the copy constructor, while
         // ndarray(other, _move=True) selects this consuming constructor.
@@ -41,8 +158,40 @@ void bind_utils(pybind11::module_& utils) {
             }),
             py::arg("other"), py::kw_only(), py::arg("_move"),
             "Internal consuming constructor; the source must not be used afterwards")
-        .def("to_numpy", &NPUArray::ToNumpy)
+        .def(
+            "to_numpy",
+            [](const NPUArray& self, py::object out) {
+                if (out.is_none()) {
+                    return self.ToNumpy();
+                }
+                // Not py::array::ensure: converting a list would write into a temporary.
+                if (!py::isinstance<py::array>(out)) {
+                    throw std::invalid_argument("[bind_utils.cpp](to_numpy) out must be a numpy.ndarray");
+                }
+                return self.ToNumpy(out.cast<py::array>());
+            },
+            py::arg("out") = py::none())
         .def_static("from_numpy", &NPUArray::FromNumpy, py::arg("host_data"))
+        .def_static(
+            "from_numpy_async",
+            [](py::array host_data) {
+                std::shared_ptr<asnumpy::cann::StreamMarker> done;
+                auto result = NPUArray::FromNumpyAsync(host_data, done);
+                return PyTransfer(py::cast(std::move(result)), host_data, std::move(done));
+            },
+            py::arg("host_data"))
+        .def(
+            "iter_numpy_chunks",
+            [](py::object self, size_t chunk_bytes) {
+                return std::make_unique<PyChunkIterator>(std::move(self), chunk_bytes);
+            },
+            py::arg("chunk_bytes") = asnumpy::cann::kStagingChunk)
+        .def("to_numpy_async",
+             [](const NPUArray& self) {
+                 std::shared_ptr<asnumpy::cann::StreamMarker> done;
+                 auto result = self.ToNumpyAsync(done);
+                 return PyTransfer(result, py::none(), std::move(done));
+             })
         .def(
             "astype",
             // Takes py::object, not py::dtype: py::dtype's caster is a strict isinstance check with
@@ -53,6 +202,42 @@ void bind_utils(pybind11::module_& utils) {
                 return asnumpy::CastTo(self, NPUArray::GetACLDataType(py::dtype::from_args(dtype)));
             },
             py::arg("dtype"), "Cast the array to the given dtype on device, returning a new array.")
+        // Backs ufunc out= for operators that cannot write into an existing array themselves.
+        .def("_assign", &NPUArray::Assign, py::arg("other"),
+             "Copy other (same shape and dtype) into this array's storage on device.")
+        .def(
+            "__dlpack__",
+            [](NPUArray& self, py::object stream, py::object max_version, py::object dl_device, py::object copy) {
+                (void)max_version; // only the unversioned "dltensor" capsule is produced
+                if (!dl_device.is_none()) {
+                    if (dl_device.cast<std::pair<int32_t, int32_t>>() != DlpackDevice()) {
+                        throw std::invalid_argument("[bind_utils.cpp](__dlpack__) cannot export to another device");
+                    }
+                }
+                // None or -1: no consumer stream to order against, so the host waits for pending writes.
+                std::optional<aclrtStream> consumer;
+                if (!stream.is_none() && stream.cast<int64_t>() != -1) {
+                    consumer = reinterpret_cast<aclrtStream>(stream.cast<uintptr_t>());
+                }
+                asnumpy::dlpack::DLManagedTensor* managed = nullptr;
+                if (!copy.is_none() && copy.cast<bool>()) {
+                    NPUArray duplicate(self);
+                    managed = duplicate.ToDlpack(consumer);
+                } else {
+                    managed = self.ToDlpack(consumer);
+                }
+                return py::capsule(managed, "dltensor", [](PyObject* capsule) {
+                    // Still named "dltensor": never consumed, so releasing the tensor is up to us.
+                    if (PyCapsule_IsValid(capsule, "dltensor")) {
+                        auto* tensor =
+                            static_cast<asnumpy::dlpack::DLManagedTensor*>(PyCapsule_GetPointer(capsule, "dltensor"));
+                        tensor->deleter(tensor);
+                    }
+                });
+            },
+            py::kw_only(), py::arg("stream") = py::none(), py::arg("max_version") = py::none(),
+            py::arg("dl_device") = py::none(), py::arg("copy") = py::none())
+        .def("__dlpack_device__", [](const NPUArray&) { return DlpackDevice(); })
         .def_property_readonly("shape",
                                [](const NPUArray& self) {
                                    py::tuple shape_tuple(self.shape.size());
@@ -77,4 +262,17 @@ void bind_utils(pybind11::module_& utils) {
             return byte_strides;
         });
     utils.def("broadcast_shape", &GetBroadcastShape, py::arg("a"), py::arg("b"));
+    utils.def(
+        "from_dlpack",
+        [](py::capsule capsule) {
+            if (!PyCapsule_IsValid(capsule.ptr(), "dltensor")) {
+                throw std::invalid_argument("[bind_utils.cpp](from_dlpack) expected an unconsumed DLPack capsule");
+            }
+            auto* managed =
+                static_cast<asnumpy::dlpack::DLManagedTensor*>(PyCapsule_GetPointer(capsule.ptr(), "dltensor"));
+            // Consumed: the capsule's destructor must no longer release the tensor.
+            PyCapsule_SetName(capsule.ptr(), "used_dltensor");
+            return NPUArray::FromDlpack(managed);
+        },
+        py::arg("capsule"));
 }
@@ -14,6 +14,7 @@
  * limitations under the License.
  ******************************************************************************/
 
+#include <asnumpy/dtypes/promote.hpp>
 #include <algorithm>
 #include <pybind11/detail/common.h>
 #include <pybind11/pybind11.h>
@@ -31,9 +32,11 @@ void bind_random(pybind11::module_& random);
 void bind_sorting(pybind11::module_& sorting);
 void bind_testing(pybind11::module_& testing);
 void bind_utils(pybind11::module_& utils);
+void bind_ufunc(pybind11::module_& module);
 namespace asnumpy {
 void bind_statistics(pybind11::module_& statistics);
 void bind_nn(pybind11::module_& nn);
+void bind_foreach(pybind11::module_& foreach);
 } // namespace asnumpy
 
 // Global storage for CannError exception class (used by translator)
@@ -50,6 +53,8 @@ PYBIND11_MODULE(_core, module) {
         try {
             if (p)
                 std::rethrow_exception(p);
+        } catch (const asnumpy::CastingError& e) {
+            PyErr_SetString(PyExc_TypeError, e.what());
         } catch (const std::invalid_argument& e) {
             PyErr_SetString(PyExc_ValueError, e.what());
         } catch (const std::out_of_range& e) {
@@ -77,6 +82,7 @@ PYBIND11_MODULE(_core, module) {
     auto sorting = module.def_submodule("sorting");
     auto statistics = module.def_submodule("statistics");
     auto nn = module.def_submodule("nn");
+    auto foreach = module.def_submodule("foreach");
     auto testing = module.def_submodule("testing");
     // auto utils = module.def_submodule("utils");
 
@@ -91,6 +97,8 @@ PYBIND11_MODULE(_core, module) {
     bind_sorting(sorting);
     asnumpy::bind_statistics(statistics);
     asnumpy::bind_nn(nn);
+    asnumpy::bind_foreach(foreach);
     bind_testing(testing);
     bind_utils(module);
+    bind_ufunc(module);
 }
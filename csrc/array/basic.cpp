@@ -15,6 +15,8 @@
  *****************************************************************************/
 
 #include <asnumpy/array/basic.hpp>
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
 #include <asnumpy/utils/npu_array.hpp>
@@ -62,13 +64,12 @@ NPUArray Zeros(const std::vector<int64_t>& shape, py::dtype dtype) {
     auto array = NPUArray(shape, dtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnInplaceZeroGetWorkspaceSize(array.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnInplaceZeroGetWorkspaceSize(array.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnInplaceZeroGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnInplaceZero(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnInplaceZero(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceZero");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceZero");
     LOG_INFO("aclnnInplaceZero completed");
     return array;
 }
@@ -79,13 +80,12 @@ NPUArray Zeros_like(const NPUArray& other, py::dtype dtype) {
     auto array = NPUArray(other.shape, dtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnInplaceZeroGetWorkspaceSize(array.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnInplaceZeroGetWorkspaceSize(array.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnInplaceZeroGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnInplaceZero(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnInplaceZero(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceZero");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceZero");
     LOG_INFO("aclnnInplaceZero completed");
     return array;
 }
@@ -105,23 +105,19 @@ NPUArray Full(const std::vector<int64_t>& shape, const py::object& value, py::dt
     aclScalar* scalar = CreateScalar(valueDouble, array.aclDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnInplaceFillScalarGetWorkspaceSize(array.tensorPtr, scalar, &workspaceSize, &executor);
+    auto error = aclnnInplaceFillScalarGetWorkspaceSize(array.tensor(), scalar, &workspaceSize, &executor);
     if (error != ACL_SUCCESS) {
         aclDestroyScalar(scalar);
         ACLNN_CHECK(error, "aclnnInplaceFillScalarGetWorkspaceSize");
     }
     AclWorkspace workspace(workspaceSize);
-    error = aclnnInplaceFillScalar(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnInplaceFillScalar(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     if (error != ACL_SUCCESS) {
         aclDestroyScalar(scalar);
         ACLNN_CHECK(error, "aclnnInplaceFillScalar");
     }
-    error = aclrtSynchronizeDevice();
-    if (error != ACL_SUCCESS) {
-        aclDestroyScalar(scalar);
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    }
     aclDestroyScalar(scalar);
+    ACL_OP_LAUNCHED("aclnnInplaceFillScalar");
     LOG_INFO("aclnnInplaceFillScalar completed");
     return array;
 }
@@ -142,23 +138,19 @@ NPUArray Full_like(const NPUArray& other, const py::object& value, py::dtype dty
     aclScalar* scalar = CreateScalar(valueDouble, array.aclDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnInplaceFillScalarGetWorkspaceSize(array.tensorPtr, scalar, &workspaceSize, &executor);
+    auto error = aclnnInplaceFillScalarGetWorkspaceSize(array.tensor(), scalar, &workspaceSize, &executor);
     if (error != ACL_SUCCESS) {
         aclDestroyScalar(scalar);
         ACLNN_CHECK(error, "aclnnInplaceFillScalarGetWorkspaceSize");
     }
     AclWorkspace workspace(workspaceSize);
-    error = aclnnInplaceFillScalar(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnInplaceFillScalar(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     if (error != ACL_SUCCESS) {
         aclDestroyScalar(scalar);
         ACLNN_CHECK(error, "aclnnInplaceFillScalar");
     }
-    error = aclrtSynchronizeDevice();
-    if (error != ACL_SUCCESS) {
-        aclDestroyScalar(scalar);
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    }
     aclDestroyScalar(scalar);
+    ACL_OP_LAUNCHED("aclnnInplaceFillScalar");
     LOG_INFO("aclnnInplaceFillScalar completed");
     return array;
 }
@@ -168,13 +160,12 @@ NPUArray Eye(int64_t n, py::dtype dtype) {
     auto array = NPUArray({n, n}, dtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnEyeGetWorkspaceSize(n, n, array.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnEyeGetWorkspaceSize(n, n, array.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnEyeGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnEye(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnEye(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnEye");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnEye");
     LOG_INFO("aclnnEye completed");
     return array;
 }
@@ -184,13 +175,12 @@ NPUArray Ones(const std::vector<int64_t>& shape, py::dtype dtype) {
     auto array = NPUArray(shape, dtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnInplaceOneGetWorkspaceSize(array.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnInplaceOneGetWorkspaceSize(array.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnInplaceOneGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnInplaceOne(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnInplaceOne(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceOne");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceOne");
     LOG_INFO("aclnnInplaceOne completed");
     return array;
 }
@@ -201,16 +191,15 @@ NPUArray Identity(int64_t n, py::dtype dtype) {
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
 
-    auto error = aclnnEyeGetWorkspaceSize(n, n, array.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnEyeGetWorkspaceSize(n, n, array.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnEyeGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnEye(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnEye(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnEye");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnEye");
 
     LOG_INFO("aclnnEye completed");
     return array;
@@ -222,13 +211,12 @@ NPUArray ones_like(const NPUArray& other, py::dtype dtype) {
     auto array = NPUArray(other.shape, dtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnInplaceOneGetWorkspaceSize(array.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnInplaceOneGetWorkspaceSize(array.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnInplaceOneGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnInplaceOne(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnInplaceOne(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceOne");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceOne");
     LOG_INFO("aclnnInplaceOne completed");
     return array;
 }
@@ -320,7 +308,7 @@ NPUArray Linspace(const py::object& start, const py::object& end, const py::obje
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor = nullptr;
 
-    auto error = aclnnLinspaceGetWorkspaceSize(acl_start, acl_end, steps_val, out.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnLinspaceGetWorkspaceSize(acl_start, acl_end, steps_val, out.tensor(), &workspaceSize, &executor);
 
     if (error != ACL_SUCCESS) {
         scalarGuard();
@@ -329,19 +317,14 @@ NPUArray Linspace(const py::object& start, const py::object& end, const py::obje
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnLinspace(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnLinspace(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     if (error != ACL_SUCCESS) {
         scalarGuard();
         ACLNN_CHECK(error, "aclnnLinspace");
     }
 
-    error = aclrtSynchronizeDevice();
-    if (error != ACL_SUCCESS) {
-        scalarGuard();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    }
-
     scalarGuard();
+    ACL_OP_LAUNCHED("aclnnLinspace");
     LOG_INFO("aclnnLinspace completed");
     return out;
 }
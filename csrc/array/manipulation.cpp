@@ -0,0 +1,372 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <asnumpy/array/manipulation.hpp>
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/utils/acl_executor.hpp>
+#include <asnumpy/utils/acl_resource.hpp>
+#include <asnumpy/utils/npu_array.hpp>
+#include <asnumpy/utils/status_handler.hpp>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+#include <aclnnop/aclnn_flip.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace asnumpy {
+namespace {
+
+std::vector<int64_t> ContiguousStrides(const std::vector<int64_t>& shape) {
+    std::vector<int64_t> strides(shape.size());
+    int64_t stride = 1;
+    for (int64_t i = static_cast<int64_t>(shape.size()) - 1; i >= 0; i--) {
+        strides[i] = stride;
+        stride *= shape[i];
+    }
+    return strides;
+}
+
+int64_t NormalizeAxis(int64_t axis, int64_t ndim, const char* func) {
+    if (axis < -ndim || axis >= ndim) {
+        throw std::out_of_range(fmt::format("[manipulation.cpp]({}) axis {} is out of bounds for array of dimension {}",
+                                            func, axis, ndim));
+    }
+    return axis < 0 ? axis + ndim : axis;
+}
+
+/**
+ * Stride for a size-1 dimension at `i`: whatever keeps a contiguous array contiguous to kernels
+ * that compare strides strictly rather than skipping size-1 dimensions.
+ */
+void FillUnitStrides(const std::vector<int64_t>& shape, std::vector<int64_t>& strides, const std::vector<bool>& unit) {
+    for (int64_t i = static_cast<int64_t>(shape.size()) - 1; i >= 0; i--) {
+        if (unit[i]) {
+            strides[i] = (i + 1 < static_cast<int64_t>(shape.size())) ? strides[i + 1] * shape[i + 1] : 1;
+        }
+    }
+}
+
+/**
+ * Resolve a single -1 in `newshape` against `size`.
+ */
+std::vector<int64_t> InferShape(const std::vector<int64_t>& newshape, int64_t size) {
+    std::vector<int64_t> shape = newshape;
+    int64_t known = 1;
+    int64_t unknown = -1;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (shape[i] == -1) {
+            if (unknown >= 0) {
+                throw std::invalid_argument("[manipulation.cpp](Reshape) can only specify one unknown dimension");
+            }
+            unknown = static_cast<int64_t>(i);
+        } else if (shape[i] < 0) {
+            throw std::invalid_argument("[manipulation.cpp](Reshape) negative dimensions not allowed");
+        } else {
+            known *= shape[i];
+        }
+    }
+    if (unknown >= 0 && known != 0 && size % known == 0) {
+        shape[unknown] = size / known;
+    }
+    if ((unknown >= 0 && (known == 0 || size % known != 0)) || NPUArray::GetShapeSize(shape) != size) {
+        throw std::invalid_argument(fmt::format("[manipulation.cpp](Reshape) cannot reshape array of size {} into "
+                                                "shape ({})",
+                                                size, fmt::join(newshape, ", ")));
+    }
+    return shape;
+}
+
+/**
+ * Strides that let `newshape` view `a`'s elements in C order without a copy, if any exist.
+ *
+ * Port of NumPy's _attempt_nocopy_reshape: groups of old and new dimensions with equal products
+ * are matched, and each old group must itself be contiguous.
+ */
+bool NoCopyReshapeStrides(const NPUArray& a, const std::vector<int64_t>& newshape, std::vector<int64_t>& newstrides) {
+    std::vector<int64_t> olddims;
+    std::vector<int64_t> oldstrides;
+    for (size_t i = 0; i < a.shape.size(); ++i) {
+        if (a.shape[i] != 1) {
+            olddims.push_back(a.shape[i]);
+            oldstrides.push_back(a.strides[i]);
+        }
+    }
+    int64_t oldnd = static_cast<int64_t>(olddims.size());
+    int64_t newnd = static_cast<int64_t>(newshape.size());
+    newstrides.assign(newnd, 1);
+
+    int64_t oi = 0, oj = 1, ni = 0, nj = 1;
+    while (ni < newnd && oi < oldnd) {
+        int64_t np = newshape[ni];
+        int64_t op = olddims[oi];
+        while (np != op) {
+            if (np < op) {
+                np *= newshape[nj++];
+            } else {
+                op *= olddims[oj++];
+            }
+        }
+        for (int64_t ok = oi; ok < oj - 1; ok++) {
+            if (oldstrides[ok] != olddims[ok + 1] * oldstrides[ok + 1]) {
+                return false;
+            }
+        }
+        newstrides[nj - 1] = oldstrides[oj - 1];
+        for (int64_t nk = nj - 1; nk > ni; nk--) {
+            newstrides[nk - 1] = newstrides[nk] * newshape[nk];
+        }
+        ni = nj++;
+        oi = oj++;
+    }
+
+    std::vector<bool> unit(newnd, false);
+    for (int64_t i = ni; i < newnd; i++) {
+        unit[i] = true;
+    }
+    FillUnitStrides(newshape, newstrides, unit);
+    return true;
+}
+
+/**
+ * Materialize `a` reversed along `dims`.
+ */
+NPUArray Flip(const NPUArray& a, const std::vector<int64_t>& dims) {
+    LOG_DEBUG("aclnnFlip start: input_shape={}, aclDtype={}", detail::FormatShape(a.shape), AclDtypeName(a.aclDtype));
+    auto result = NPUArray(a.shape, a.aclDtype);
+    if (result.tensorSize == 0) {
+        return result;
+    }
+    std::unique_ptr<aclIntArray, decltype(&aclDestroyIntArray)> dimArray(aclCreateIntArray(dims.data(), dims.size()),
+                                                                         aclDestroyIntArray);
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor = nullptr;
+    auto error = aclnnFlipGetWorkspaceSize(a.tensor(), dimArray.get(), result.tensor(), &workspaceSize, &executor);
+    ACLNN_CHECK(error, "aclnnFlipGetWorkspaceSize");
+
+    AclWorkspace workspace(workspaceSize);
+    error = aclnnFlip(workspace.get(), workspaceSize, executor, cann::CurrentStream());
+    ACLNN_CHECK(error, "aclnnFlip");
+
+    ACL_OP_LAUNCHED("aclnnFlip");
+    LOG_INFO("aclnnFlip completed");
+    return result;
+}
+
+} // namespace
+
+NPUArray Reshape(const NPUArray& a, const std::vector<int64_t>& newshape) {
+    auto shape = InferShape(newshape, static_cast<int64_t>(a.tensorSize));
+    if (a.IsContiguous()) {
+        return a.AsStrided(shape, ContiguousStrides(shape), a.storageOffset);
+    }
+    std::vector<int64_t> strides;
+    if (NoCopyReshapeStrides(a, shape, strides)) {
+        return a.AsStrided(shape, strides, a.storageOffset);
+    }
+    LOG_DEBUG("Reshape of a strided view needs a copy: input_shape={}, new_shape={}", detail::FormatShape(a.shape),
+              detail::FormatShape(shape));
+    auto dense = a.Contiguous();
+    return dense.AsStrided(shape, ContiguousStrides(shape), 0);
+}
+
+NPUArray Transpose(const NPUArray& a, const std::optional<std::vector<int64_t>>& axes) {
+    int64_t ndim = static_cast<int64_t>(a.shape.size());
+    std::vector<int64_t> perm(ndim);
+    if (!axes.has_value()) {
+        for (int64_t i = 0; i < ndim; i++) {
+            perm[i] = ndim - 1 - i;
+        }
+    } else {
+        if (static_cast<int64_t>(axes->size()) != ndim) {
+            throw std::invalid_argument("[manipulation.cpp](Transpose) axes don't match array");
+        }
+        std::vector<bool> seen(ndim, false);
+        for (int64_t i = 0; i < ndim; i++) {
+            perm[i] = NormalizeAxis((*axes)[i], ndim, "Transpose");
+            if (seen[perm[i]]) {
+                throw std::invalid_argument("[manipulation.cpp](Transpose) repeated axis in transpose");
+            }
+            seen[perm[i]] = true;
+        }
+    }
+    std::vector<int64_t> shape(ndim);
+    std::vector<int64_t> strides(ndim);
+    for (int64_t i = 0; i < ndim; i++) {
+        shape[i] = a.shape[perm[i]];
+        strides[i] = a.strides[perm[i]];
+    }
+    return a.AsStrided(shape, strides, a.storageOffset);
+}
+
+NPUArray ExpandDims(const NPUArray& a, const std::vector<int64_t>& axis) {
+    int64_t ndim = static_cast<int64_t>(a.shape.size() + axis.size());
+    std::vector<bool> unit(ndim, false);
+    for (auto ax : axis) {
+        auto normalized = NormalizeAxis(ax, ndim, "ExpandDims");
+        if (unit[normalized]) {
+            throw std::invalid_argument("[manipulation.cpp](ExpandDims) repeated axis");
+        }
+        unit[normalized] = true;
+    }
+    std::vector<int64_t> shape(ndim);
+    std::vector<int64_t> strides(ndim);
+    size_t src = 0;
+    for (int64_t i = 0; i < ndim; i++) {
+        if (unit[i]) {
+            shape[i] = 1;
+        } else {
+            shape[i] = a.shape[src];
+            strides[i] = a.strides[src];
+            src++;
+        }
+    }
+    FillUnitStrides(shape, strides, unit);
+    return a.AsStrided(shape, strides, a.storageOffset);
+}
+
+NPUArray Squeeze(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis) {
+    int64_t ndim = static_cast<int64_t>(a.shape.size());
+    std::vector<bool> drop(ndim, false);
+    if (!axis.has_value()) {
+        for (int64_t i = 0; i < ndim; i++) {
+            drop[i] = a.shape[i] == 1;
+        }
+    } else {
+        for (auto ax : *axis) {
+            auto normalized = NormalizeAxis(ax, ndim, "Squeeze");
+            if (a.shape[normalized] != 1) {
+                throw std::invalid_argument(
+                    "[manipulation.cpp](Squeeze) cannot select an axis to squeeze out which has size not equal to one");
+            }
+            drop[normalized] = true;
+        }
+    }
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    for (int64_t i = 0; i < ndim; i++) {
+        if (!drop[i]) {
+            shape.push_back(a.shape[i]);
+            strides.push_back(a.strides[i]);
+        }
+    }
+    return a.AsStrided(shape, strides, a.storageOffset);
+}
+
+NPUArray Ravel(const NPUArray& a) { return Reshape(a, {-1}); }
+
+NPUArray GetItem(const NPUArray& a, const py::object& key) {
+    py::tuple items = py::isinstance<py::tuple>(key) ? key.cast<py::tuple>() : py::make_tuple(key);
+
+    // Validate every index and count the dimensions they consume before building anything, so
+    // Ellipsis knows how many dimensions it stands for.
+    int64_t ndim = static_cast<int64_t>(a.shape.size());
+    int64_t consumed = 0;
+    bool sawEllipsis = false;
+    for (auto item : items) {
+        if (item.is_none()) {
+            continue;
+        }
+        if (item.ptr() == Py_Ellipsis) {
+            if (sawEllipsis) {
+                throw std::out_of_range("[manipulation.cpp](GetItem) an index can only have a single ellipsis ('...')");
+            }
+            sawEllipsis = true;
+            continue;
+        }
+        bool isInteger = !py::isinstance<py::bool_>(item) && !py::isinstance<py::array>(item) &&
+                         PyIndex_Check(item.ptr());
+        if (!isInteger && !py::isinstance<py::slice>(item)) {
+            throw std::out_of_range("[manipulation.cpp](GetItem) only integers, slices (`:`), ellipsis (`...`) and "
+                                    "numpy.newaxis (`None`) are valid indices");
+        }
+        consumed++;
+    }
+    if (consumed > ndim) {
+        throw std::out_of_range(fmt::format("[manipulation.cpp](GetItem) too many indices for array: array is "
+                                            "{}-dimensional, but {} were indexed",
+                                            ndim, consumed));
+    }
+
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    std::vector<bool> unit;
+    std::vector<int64_t> flipDims;
+    int64_t offset = a.storageOffset;
+    int64_t dim = 0;
+    auto keep = [&](int64_t size, int64_t stride, bool isNewAxis) {
+        shape.push_back(size);
+        strides.push_back(stride);
+        unit.push_back(isNewAxis);
+    };
+    for (auto item : items) {
+        if (item.is_none()) {
+            keep(1, 0, true);
+        } else if (item.ptr() == Py_Ellipsis) {
+            for (int64_t n = ndim - consumed; n > 0; n--, dim++) {
+                keep(a.shape[dim], a.strides[dim], false);
+            }
+        } else if (py::isinstance<py::slice>(item)) {
+            py::ssize_t start = 0, stop = 0, step = 0, length = 0;
+            if (!item.cast<py::slice>().compute(a.shape[dim], &start, &stop, &step, &length)) {
+                throw py::error_already_set();
+            }
+            if (step < 0 && length > 0) {
+                // Describe the same elements in ascending order and flip them afterwards.
+                start += (length - 1) * step;
+                flipDims.push_back(static_cast<int64_t>(shape.size()));
+            }
+            if (length > 0) {
+                offset += start * a.strides[dim];
+            }
+            keep(length, a.strides[dim] * (step < 0 ? -step : step), false);
+            dim++;
+        } else {
+            auto index = PyNumber_AsSsize_t(item.ptr(), PyExc_IndexError);
+            if (index == -1 && PyErr_Occurred()) {
+                throw py::error_already_set();
+            }
+            if (index < -a.shape[dim] || index >= a.shape[dim]) {
+                throw std::out_of_range(fmt::format(
+                    "[manipulation.cpp](GetItem) index {} is out of bounds for axis {} with size {}", index, dim,
+                    a.shape[dim]));
+            }
+            offset += (index < 0 ? index + a.shape[dim] : index) * a.strides[dim];
+            dim++;
+        }
+    }
+    // Indices that stop short of the last dimension leave the rest whole, as if followed by `...`.
+    for (; dim < ndim; dim++) {
+        keep(a.shape[dim], a.strides[dim], false);
+    }
+    FillUnitStrides(shape, strides, unit);
+
+    auto view = a.AsStrided(shape, strides, offset);
+    if (flipDims.empty()) {
+        return view;
+    }
+    LOG_DEBUG("GetItem with a negative step needs a copy: view_shape={}", detail::FormatShape(shape));
+    return Flip(view, flipDims);
+}
+
+NPUArray AscontiguousArray(const NPUArray& a) { return a.Contiguous(); }
+
+bool MayShareMemory(const NPUArray& a, const NPUArray& b) { return a.SharesStorage(b); }
+
+} // namespace asnumpy
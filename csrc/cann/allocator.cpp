@@ -0,0 +1,278 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "asnumpy/cann/allocator.hpp"
+#include <algorithm>
+#include <fmt/format.h>
+#include <stdexcept>
+#include <tuple>
+#include "asnumpy/cann/execution.hpp"
+#include "asnumpy/cann/stream.hpp"
+#include "asnumpy/utils/status_handler.hpp"
+
+namespace asnumpy {
+namespace cann {
+
+namespace {
+
+constexpr size_t kMinBlockSize = 512;              // every request is rounded to this
+constexpr size_t kSmallSize = 1048576;             // largest request served by the small pool
+constexpr size_t kSmallBuffer = 2097152;           // segment size of the small pool
+constexpr size_t kLargeBuffer = 20971520;          // segment size for large requests below kMinLargeAlloc
+constexpr size_t kMinLargeAlloc = 10485760;        // requests above this get their own segment
+constexpr size_t kRoundLarge = 2097152;            // segment rounding for such requests
+
+size_t RoundSize(size_t size) {
+    if (size < kMinBlockSize)
+        return kMinBlockSize;
+    return kMinBlockSize * ((size + kMinBlockSize - 1) / kMinBlockSize);
+}
+
+size_t SegmentSize(size_t size) {
+    if (size <= kSmallSize)
+        return kSmallBuffer;
+    if (size < kMinLargeAlloc)
+        return kLargeBuffer;
+    return kRoundLarge * ((size + kRoundLarge - 1) / kRoundLarge);
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// CachingAllocator
+// ============================================================================
+
+bool CachingAllocator::BlockComparator::operator()(const Block* a, const Block* b) const {
+    return std::make_tuple(reinterpret_cast<uintptr_t>(a->stream), a->size, reinterpret_cast<uintptr_t>(a->ptr)) <
+           std::make_tuple(reinterpret_cast<uintptr_t>(b->stream), b->size, reinterpret_cast<uintptr_t>(b->ptr));
+}
+
+CachingAllocator& CachingAllocator::Instance() {
+    static CachingAllocator* instance = new CachingAllocator();
+    return *instance;
+}
+
+void* CachingAllocator::Allocate(size_t size, aclrtStream stream) {
+    if (size == 0)
+        return nullptr;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!deferredFrees_.empty()) {
+        ProcessDeferredFreesLocked();
+    }
+    size = RoundSize(size);
+    const bool small = size <= kSmallSize;
+
+    Block* block = FindFreeBlock(size, stream, small);
+    if (!block) {
+        block = MallocSegment(lock, SegmentSize(size), stream, small);
+    }
+
+    // Split off the tail when it is big enough to serve another request from the same pool.
+    const size_t remaining = block->size - size;
+    if (small ? remaining >= kMinBlockSize : remaining > kSmallSize) {
+        auto* rest = new Block{stream, remaining, static_cast<char*>(block->ptr) + size, false, small};
+        rest->prev = block;
+        rest->next = block->next;
+        if (rest->next)
+            rest->next->prev = rest;
+        block->next = rest;
+        block->size = size;
+        PoolFor(small).insert(rest);
+    }
+
+    block->allocated = true;
+    activeBlocks_.emplace(block->ptr, block);
+    stats_.allocated_bytes += block->size;
+    UpdatePeaks();
+    return block->ptr;
+}
+
+void CachingAllocator::Free(void* ptr) {
+    if (!ptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = activeBlocks_.find(ptr);
+    if (it == activeBlocks_.end()) {
+        throw std::invalid_argument(
+            fmt::format("[allocator.cpp](Free) pointer {} was not allocated by the caching allocator", ptr));
+    }
+    Block* block = it->second;
+    activeBlocks_.erase(it);
+    if (block->streamUses.empty()) {
+        FreeBlockLocked(block);
+        return;
+    }
+
+    // Kernels on other streams may still use the block; reuse it only after they caught up.
+    DeferredFree deferred{block, {}};
+    for (aclrtStream stream : block->streamUses) {
+        try {
+            deferred.markers.push_back(StreamMarker::Record(stream));
+        } catch (const std::exception& e) {
+            // Free runs from destructors and must not throw; fall back to waiting on the host.
+            LOG_WARN("could not record a stream marker for a freed block ({}), synchronizing", e.what());
+            aclrtSynchronizeStream(stream);
+        }
+    }
+    block->streamUses.clear();
+    deferredFrees_.push_back(std::move(deferred));
+}
+
+void CachingAllocator::RecordStream(void* ptr, aclrtStream stream) {
+    if (!ptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = activeBlocks_.find(ptr);
+    if (it == activeBlocks_.end()) {
+        throw std::invalid_argument(
+            fmt::format("[allocator.cpp](RecordStream) pointer {} was not allocated by the caching allocator", ptr));
+    }
+    Block* block = it->second;
+    if (stream != block->stream &&
+        std::find(block->streamUses.begin(), block->streamUses.end(), stream) == block->streamUses.end()) {
+        block->streamUses.push_back(stream);
+    }
+}
+
+void CachingAllocator::EmptyCache() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    ReleaseCachedSegments(lock);
+}
+
+MemoryStats CachingAllocator::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void CachingAllocator::ResetPeakStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.peak_reserved_bytes = stats_.reserved_bytes;
+    stats_.peak_allocated_bytes = stats_.allocated_bytes;
+}
+
+CachingAllocator::Block* CachingAllocator::FindFreeBlock(size_t size, aclrtStream stream, bool small) {
+    auto& pool = PoolFor(small);
+    Block key{stream, size, nullptr};
+    auto it = pool.lower_bound(&key);
+    if (it == pool.end() || (*it)->stream != stream)
+        return nullptr;
+    Block* block = *it;
+    pool.erase(it);
+    return block;
+}
+
+CachingAllocator::Block* CachingAllocator::MallocSegment(std::unique_lock<std::mutex>& lock, size_t size,
+                                                         aclrtStream stream, bool small) {
+    void* ptr = nullptr;
+    auto error = aclrtMalloc(&ptr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    if (error != ACL_SUCCESS) {
+        // Out of memory is the common failure: give the cached segments back and try once more.
+        ReleaseCachedSegments(lock);
+        error = aclrtMalloc(&ptr, size, ACL_MEM_MALLOC_HUGE_FIRST);
+    }
+    if (error != ACL_SUCCESS) {
+        const char* message = aclGetRecentErrMsg();
+        throw std::runtime_error(fmt::format("[allocator.cpp](Allocate) aclrtMalloc error = {} - failed to allocate "
+                                             "{} bytes ({} bytes reserved, {} bytes allocated){}",
+                                             error, size, stats_.reserved_bytes, stats_.allocated_bytes,
+                                             message ? std::string(" - ") + message : ""));
+    }
+    LOG_DEBUG("new {} segment of {} bytes", small ? "small" : "large", size);
+    stats_.reserved_bytes += size;
+    stats_.device_malloc_count++;
+    return new Block{stream, size, ptr, false, small};
+}
+
+void CachingAllocator::FreeBlockLocked(Block* block) {
+    block->allocated = false;
+    stats_.allocated_bytes -= block->size;
+
+    auto& pool = PoolFor(block->small);
+    if (Block* prev = block->prev; prev && !prev->allocated) {
+        pool.erase(prev);
+        prev->size += block->size;
+        prev->next = block->next;
+        if (prev->next)
+            prev->next->prev = prev;
+        delete block;
+        block = prev;
+    }
+    if (Block* next = block->next; next && !next->allocated) {
+        pool.erase(next);
+        block->size += next->size;
+        block->next = next->next;
+        if (block->next)
+            block->next->prev = block;
+        delete next;
+    }
+    pool.insert(block);
+}
+
+void CachingAllocator::ProcessDeferredFreesLocked() {
+    auto done = [](const DeferredFree& deferred) {
+        return std::all_of(deferred.markers.begin(), deferred.markers.end(),
+                           [](const std::shared_ptr<StreamMarker>& marker) { return marker->IsComplete(); });
+    };
+    for (auto it = deferredFrees_.begin(); it != deferredFrees_.end();) {
+        if (done(*it)) {
+            FreeBlockLocked(it->block);
+            it = deferredFrees_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void CachingAllocator::ReleaseCachedSegments(std::unique_lock<std::mutex>& lock) {
+    auto isSegment = [](const Block* block) { return !block->prev && !block->next; };
+    if (deferredFrees_.empty() && std::none_of(smallBlocks_.begin(), smallBlocks_.end(), isSegment) &&
+        std::none_of(largeBlocks_.begin(), largeBlocks_.end(), isSegment)) {
+        return;
+    }
+    // In async mode queued kernels may still touch cached blocks; aclrtFree must wait for them.
+    // The wait ends by retaking the GIL, so it runs unlocked: a thread holding the GIL may be
+    // blocked on mutex_ in Allocate. The pools are scanned only after relocking.
+    lock.unlock();
+    Synchronize(__FILE__, __func__);
+    lock.lock();
+    ProcessDeferredFreesLocked();
+
+    for (auto* pool : {&smallBlocks_, &largeBlocks_}) {
+        for (auto it = pool->begin(); it != pool->end();) {
+            Block* block = *it;
+            // Only a free block with no neighbours spans a whole segment returned by aclrtMalloc.
+            if (!isSegment(block)) {
+                ++it;
+                continue;
+            }
+            aclrtFree(block->ptr);
+            stats_.reserved_bytes -= block->size;
+            stats_.device_free_count++;
+            it = pool->erase(it);
+            delete block;
+        }
+    }
+}
+
+void CachingAllocator::UpdatePeaks() {
+    stats_.peak_reserved_bytes = std::max(stats_.peak_reserved_bytes, stats_.reserved_bytes);
+    stats_.peak_allocated_bytes = std::max(stats_.peak_allocated_bytes, stats_.allocated_bytes);
+}
+
+} // namespace cann
+} // namespace asnumpy
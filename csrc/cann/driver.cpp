@@ -17,18 +17,23 @@
 #include "asnumpy/cann/driver.hpp"
 #include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 #include <stdexcept>
+#include "asnumpy/cann/execution.hpp"
 #include "asnumpy/utils/status_handler.hpp"
 #include "fmt/format.h"
 
 namespace {
+// Guards g_logger; the logger itself is thread-safe (its sinks are the _mt variants).
+std::mutex g_loggerMutex;
 spdlog::logger* g_logger = nullptr;
-}
+} // namespace
 
 void asnumpy::cann::init_logging() {
+    std::lock_guard<std::mutex> lock(g_loggerMutex);
     if (g_logger)
         return;
 
@@ -62,9 +67,11 @@ void asnumpy::cann::init_logging() {
 }
 
 void asnumpy::cann::shutdown_logging() {
+    std::lock_guard<std::mutex> lock(g_loggerMutex);
+    // Flushed but not dropped: other threads, and destructors that run after finalize, still log
+    // through the default logger, and spdlog::shutdown would leave them a dangling pointer. g_logger
+    // stays set, so a later init keeps using it.
     spdlog::default_logger()->flush();
-    spdlog::shutdown();
-    g_logger = nullptr;
 }
 
 void asnumpy::cann::init() {
@@ -78,6 +85,13 @@ void asnumpy::cann::init() {
         throw std::runtime_error(fmt::format("[driver.cpp](init) aclInit error = {}{}", ret, detail));
     }
     LOG_INFO("CANN backend initialized successfully");
+
+    // ASNUMPY_EXECUTION_MODE=async enqueues operators without waiting for each one
+    const char* mode_env = std::getenv("ASNUMPY_EXECUTION_MODE");
+    if (mode_env && std::string(mode_env) == "async") {
+        SetExecutionMode(ExecutionMode::Async);
+        LOG_INFO("Asynchronous execution mode enabled");
+    }
 }
 
 void asnumpy::cann::finalize() {
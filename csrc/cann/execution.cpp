@@ -0,0 +1,231 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "asnumpy/cann/execution.hpp"
+#include <atomic>
+#include <deque>
+#include <fmt/format.h>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "asnumpy/cann/graph.hpp"
+#include "asnumpy/cann/pinned.hpp"
+#include "asnumpy/cann/stream.hpp"
+#include "asnumpy/utils/status_handler.hpp"
+
+namespace asnumpy {
+namespace cann {
+
+namespace {
+
+constexpr size_t kReapThreshold = 256; // start recycling markers of finished ops past this
+constexpr size_t kMaxPending = 4096;   // past this the host waits for the oldest op
+
+struct PendingOp {
+    std::shared_ptr<StreamMarker> marker;
+    std::string opName;
+    const char* file;
+    const char* func;
+};
+
+struct PendingQueue {
+    std::mutex mutex;
+    std::deque<PendingOp> ops;
+};
+
+std::atomic<ExecutionMode> g_mode{ExecutionMode::Blocking};
+
+std::atomic<HostWaitEnterHook> g_waitEnter{nullptr};
+std::atomic<HostWaitExitHook> g_waitExit{nullptr};
+
+// Leaked on purpose: markers must not be destroyed after aclFinalize.
+PendingQueue& Queue() {
+    static PendingQueue* queue = new PendingQueue();
+    return *queue;
+}
+
+void ReapCompletedLocked(PendingQueue& queue) {
+    while (!queue.ops.empty() && queue.ops.front().marker->IsComplete()) {
+        queue.ops.pop_front();
+    }
+}
+
+// Throws for a failed synchronization, naming the first queued op (on `stream` unless
+// `anyStream`) that never completed: that is the op that took the stream down.
+void ReportFailureLocked(PendingQueue& queue, aclError error, aclrtStream stream, bool anyStream,
+                         const char* file, const char* func, const char* syncApi) {
+    std::string apiName = syncApi;
+    for (auto& op : queue.ops) {
+        if ((anyStream || op.marker->stream() == stream) && !op.marker->IsComplete()) {
+            apiName = fmt::format("{} (launched from [{}]({})): {}", op.opName, detail::LogBasename(op.file), op.func,
+                                  syncApi);
+            break;
+        }
+    }
+    for (auto& op : queue.ops) {
+        op.marker->Discard();
+    }
+    queue.ops.clear();
+    CheckAclRuntimeStatus(error, file, func, apiName);
+}
+
+} // anonymous namespace
+
+void SetExecutionMode(ExecutionMode mode) {
+    if (mode == ExecutionMode::Blocking && g_mode.load() == ExecutionMode::Async) {
+        Synchronize(__FILE__, __func__);
+    }
+    g_mode.store(mode);
+    LOG_DEBUG("execution mode set to {}", mode == ExecutionMode::Async ? "async" : "blocking");
+}
+
+ExecutionMode GetExecutionMode() { return g_mode.load(); }
+
+void SetHostWaitHooks(HostWaitEnterHook enter, HostWaitExitHook exit) {
+    g_waitExit.store(exit);
+    g_waitEnter.store(enter);
+}
+
+HostWaitScope::HostWaitScope() : exit_(g_waitExit.load()) {
+    if (auto enter = g_waitEnter.load(); enter && exit_) {
+        state_ = enter();
+    }
+}
+
+HostWaitScope::~HostWaitScope() {
+    if (state_) {
+        exit_(state_);
+    }
+}
+
+void NotifyLaunched(const char* op_name, const char* file, const char* func) {
+    if (auto* graph = CapturingGraph()) {
+        // Recorded, not run: there is nothing to wait for until the graph is replayed.
+        graph->RecordLaunch(op_name);
+        return;
+    }
+    aclrtStream stream = CurrentStream();
+    if (g_mode.load() == ExecutionMode::Blocking) {
+        aclError error;
+        {
+            HostWaitScope wait;
+            error = aclrtSynchronizeStream(stream);
+        }
+        CheckAclRuntimeStatus(error, file, func, std::string(op_name) + ": aclrtSynchronizeStream");
+        return;
+    }
+
+    auto marker = StreamMarker::Record(stream);
+    CommitTracked(marker);
+
+    auto& queue = Queue();
+    std::shared_ptr<StreamMarker> oldest;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.ops.push_back({std::move(marker), op_name, file, func});
+
+        if (queue.ops.size() > kReapThreshold) {
+            ReapCompletedLocked(queue);
+        }
+        if (queue.ops.size() > kMaxPending) {
+            oldest = queue.ops.front().marker;
+        }
+    }
+    if (oldest) {
+        // Bound the queue. A failure here is left for the next Synchronize to report.
+        {
+            HostWaitScope wait;
+            aclrtSynchronizeEvent(oldest->event());
+        }
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        ReapCompletedLocked(queue);
+    }
+}
+
+void Synchronize(const char* file, const char* func) {
+    ThrowIfCapturing(file, func);
+    aclError error;
+    {
+        HostWaitScope wait;
+        error = aclrtSynchronizeDevice();
+    }
+
+    auto& queue = Queue();
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (error != ACL_SUCCESS) {
+        ReportFailureLocked(queue, error, nullptr, true, file, func, "aclrtSynchronizeDevice");
+    }
+    queue.ops.clear();
+}
+
+void SynchronizeStream(aclrtStream stream, const char* file, const char* func) {
+    ThrowIfCapturing(file, func);
+    aclError error;
+    {
+        HostWaitScope wait;
+        error = aclrtSynchronizeStream(stream);
+    }
+
+    auto& queue = Queue();
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (error != ACL_SUCCESS) {
+        ReportFailureLocked(queue, error, stream, false, file, func, "aclrtSynchronizeStream");
+    }
+    ReapCompletedLocked(queue);
+}
+
+void MemcpyHostToDevice(void* dst, const void* src, size_t bytes, const std::shared_ptr<BufferUsage>& dstUsage) {
+    if (CapturingGraph()) {
+        // Nothing captured has run yet, so `dst` is not in use: upload once, now, not on every replay.
+        aclError error;
+        {
+            HostWaitScope wait;
+            error = aclrtMemcpy(dst, bytes, src, bytes, ACL_MEMCPY_HOST_TO_DEVICE);
+        }
+        ACL_RT_CHECK(error, "aclrtMemcpy");
+        return;
+    }
+    bool pinned = PinnedHostPool::Instance().Contains(src, bytes);
+    if (pinned || bytes >= kStagingThreshold) {
+        // Queued behind the work on the current stream, which is all `dst` can be waiting for.
+        TrackWrite(dstUsage);
+        if (pinned) {
+            auto error = aclrtMemcpyAsync(dst, bytes, src, bytes, ACL_MEMCPY_HOST_TO_DEVICE, CurrentStream());
+            ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+        } else {
+            StagedCopyHostToDevice(dst, src, bytes, CurrentStream());
+        }
+        ACL_OP_LAUNCHED("aclrtMemcpyAsync");
+        if (pinned) {
+            // DMA'd straight out of the caller's buffer: finish before the caller may touch it.
+            SynchronizeStream(CurrentStream(), __FILE__, __func__);
+        }
+        return;
+    }
+    // `dst` was allocated on the current stream; a cached block is only reused behind the work
+    // already queued there, so that is all the copy has to wait for.
+    if (g_mode.load() == ExecutionMode::Async) {
+        SynchronizeStream(CurrentStream(), __FILE__, __func__);
+    }
+    aclError error;
+    {
+        HostWaitScope wait;
+        error = aclrtMemcpy(dst, bytes, src, bytes, ACL_MEMCPY_HOST_TO_DEVICE);
+    }
+    ACL_RT_CHECK(error, "aclrtMemcpy");
+}
+
+} // namespace cann
+} // namespace asnumpy
@@ -0,0 +1,183 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "asnumpy/cann/executor_cache.hpp"
+
+#include "asnumpy/utils/status_handler.hpp"
+
+namespace asnumpy {
+namespace cann {
+
+namespace {
+
+void AppendBytes(std::string& key, const void* data, size_t size) {
+    key.append(static_cast<const char*>(data), size);
+}
+
+void AppendDims(std::string& key, const std::vector<int64_t>& dims) {
+    uint64_t count = dims.size();
+    AppendBytes(key, &count, sizeof(count));
+    AppendBytes(key, dims.data(), dims.size() * sizeof(int64_t));
+}
+
+// Byte string identifying a signature; lengths are encoded, so distinct signatures never collide.
+std::string MakeKey(const std::string& op, const std::vector<TensorLayout>& layouts) {
+    std::string key = op;
+    key.push_back('\0');
+    for (const auto& layout : layouts) {
+        AppendBytes(key, &layout.dtype, sizeof(layout.dtype));
+        AppendDims(key, layout.shape);
+        AppendDims(key, layout.strides);
+        AppendBytes(key, &layout.offset, sizeof(layout.offset));
+        AppendDims(key, layout.storageDims);
+    }
+    return key;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// CachedExecutor
+// ============================================================================
+
+CachedExecutor::~CachedExecutor() {
+    if (repeatable_ && executor_) {
+        // A queued launch may still use the executor's state.
+        if (launched_) {
+            aclrtSynchronizeStream(lastStream_);
+        }
+        aclDestroyAclOpExecutor(executor_);
+    }
+    for (auto* tensor : tensors_) {
+        aclDestroyTensor(tensor);
+    }
+}
+
+aclnnStatus CachedExecutor::Rebind(const std::vector<void*>& addresses) {
+    for (size_t i = 0; i < tensors_.size(); ++i) {
+        if (addresses[i] == addresses_[i]) {
+            continue;
+        }
+        auto status = i < numInputs_ ? aclSetInputTensorAddr(executor_, i, tensors_[i], addresses[i])
+                                     : aclSetOutputTensorAddr(executor_, i - numInputs_, tensors_[i], addresses[i]);
+        if (status != ACL_SUCCESS) {
+            return status;
+        }
+        addresses_[i] = addresses[i];
+    }
+    return ACL_SUCCESS;
+}
+
+// ============================================================================
+// ExecutorCache
+// ============================================================================
+
+ExecutorCache& ExecutorCache::Instance() {
+    static auto* instance = new ExecutorCache();
+    return *instance;
+}
+
+std::shared_ptr<CachedExecutor> ExecutorCache::Find(const std::string& op, const std::vector<TensorLayout>& layouts) {
+    auto key = MakeKey(op, layouts);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        stats_.misses++;
+        return nullptr;
+    }
+    stats_.hits++;
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->second;
+}
+
+std::shared_ptr<CachedExecutor> ExecutorCache::Build(const std::string& op, const std::vector<TensorLayout>& layouts,
+                                                     size_t numInputs, const std::vector<void*>& addresses,
+                                                     const BuildFunc& build, aclnnStatus* status) {
+    std::shared_ptr<CachedExecutor> entry(new CachedExecutor());
+    entry->numInputs_ = numInputs;
+    entry->addresses_ = addresses;
+    for (size_t i = 0; i < layouts.size(); ++i) {
+        const auto& layout = layouts[i];
+        entry->tensors_.push_back(aclCreateTensor(layout.shape.data(), layout.shape.size(), layout.dtype,
+                                                  layout.strides.data(), layout.offset, ACL_FORMAT_ND,
+                                                  layout.storageDims.data(), layout.storageDims.size(), addresses[i]));
+    }
+
+    *status = build(entry->tensors_, &entry->workspaceSize_, &entry->executor_);
+    if (*status != ACL_SUCCESS) {
+        entry->executor_ = nullptr;
+        return nullptr;
+    }
+    if (aclSetAclOpExecutorRepeatable(entry->executor_) != ACL_SUCCESS) {
+        LOG_DEBUG("{} executor is not repeatable; running uncached", op);
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.uncacheable++;
+        return entry;
+    }
+    entry->repeatable_ = true;
+
+    auto key = MakeKey(op, layouts);
+    LruList dropped; // declared before the lock, so destroyed after it is released
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+        // Another thread built the same signature meanwhile; keep the newer one.
+        dropped.splice(dropped.end(), lru_, it->second);
+        entries_.erase(it);
+    }
+    lru_.emplace_front(key, entry);
+    entries_[key] = lru_.begin();
+    EvictLocked(dropped, capacity_.load(std::memory_order_relaxed));
+    return entry;
+}
+
+void ExecutorCache::EvictLocked(LruList& dropped, size_t capacity) {
+    while (lru_.size() > capacity) {
+        entries_.erase(lru_.back().first);
+        dropped.splice(dropped.end(), lru_, std::prev(lru_.end()));
+        stats_.evictions++;
+    }
+}
+
+void ExecutorCache::Clear() {
+    LruList dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dropped.swap(lru_);
+        entries_.clear();
+    }
+    // Destroyed outside the lock: each may wait for its stream.
+}
+
+void ExecutorCache::SetCapacity(size_t capacity) {
+    LruList dropped;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_.store(capacity, std::memory_order_relaxed);
+        EvictLocked(dropped, capacity);
+    }
+}
+
+ExecutorCacheStats ExecutorCache::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto stats = stats_;
+    stats.entries = lru_.size();
+    stats.capacity = capacity_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace cann
+} // namespace asnumpy
@@ -0,0 +1,201 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "asnumpy/cann/graph.hpp"
+
+#include <fmt/format.h>
+#include <mutex>
+#include <stdexcept>
+#include "asnumpy/cann/allocator.hpp"
+#include "asnumpy/cann/execution.hpp"
+#include "asnumpy/cann/stream.hpp"
+#include "asnumpy/utils/status_handler.hpp"
+
+namespace asnumpy {
+namespace cann {
+
+namespace {
+
+thread_local Graph* t_capturing = nullptr;
+
+// Capture streams are never shared with StreamPool users (a capture takes in everything enqueued
+// on its stream) and never destroyed, so memory cached for them stays reusable by later graphs.
+struct CaptureStreams {
+    std::mutex mutex;
+    std::vector<aclrtStream> idle;
+};
+
+// Leaked on purpose, like the StreamPool.
+CaptureStreams& Streams() {
+    static CaptureStreams* streams = new CaptureStreams();
+    return *streams;
+}
+
+aclrtStream AcquireCaptureStream() {
+    auto& streams = Streams();
+    {
+        std::lock_guard<std::mutex> lock(streams.mutex);
+        if (!streams.idle.empty()) {
+            aclrtStream stream = streams.idle.back();
+            streams.idle.pop_back();
+            return stream;
+        }
+    }
+    aclrtStream stream = nullptr;
+    auto error = aclrtCreateStream(&stream);
+    ACL_RT_CHECK(error, "aclrtCreateStream");
+    return stream;
+}
+
+void ReleaseCaptureStream(aclrtStream stream) {
+    auto& streams = Streams();
+    std::lock_guard<std::mutex> lock(streams.mutex);
+    streams.idle.push_back(stream);
+}
+
+} // anonymous namespace
+
+Graph* CapturingGraph() { return t_capturing; }
+
+void ThrowIfCapturing(const char* file, const char* func) {
+    if (t_capturing) {
+        throw std::runtime_error(fmt::format("[{}]({}) cannot wait for the device while capturing a graph; captured "
+                                             "operators only run on replay",
+                                             detail::LogBasename(file), func));
+    }
+}
+
+// ============================================================================
+// Graph
+// ============================================================================
+
+Graph::~Graph() {
+    if (t_capturing == this) {
+        try {
+            EndCapture(false);
+        } catch (const std::exception& e) {
+            LOG_WARN("could not end an abandoned graph capture: {}", e.what());
+        }
+    }
+    ReleaseResources();
+}
+
+void Graph::BeginCapture() {
+    if (t_capturing) {
+        throw std::runtime_error("[graph.cpp](BeginCapture) cannot capture a graph inside another capture");
+    }
+    if (stream_) {
+        throw std::runtime_error("[graph.cpp](BeginCapture) graph has already been captured");
+    }
+    // Captured launches must not depend on work still queued on other streams.
+    Synchronize(__FILE__, __func__);
+
+    aclrtStream stream = AcquireCaptureStream();
+    auto error = aclmdlRICaptureBegin(stream, ACL_MODEL_RI_CAPTURE_MODE_RELAXED);
+    if (error != ACL_SUCCESS) {
+        ReleaseCaptureStream(stream);
+        ACL_RT_CHECK(error, "aclmdlRICaptureBegin");
+    }
+    stream_ = stream;
+    previous_ = ExchangeCurrentStream(stream_);
+    t_capturing = this;
+}
+
+void Graph::EndCapture(bool keep) {
+    if (t_capturing != this) {
+        throw std::runtime_error("[graph.cpp](EndCapture) graph is not being captured by this thread");
+    }
+    t_capturing = nullptr;
+    ExchangeCurrentStream(previous_);
+
+    aclmdlRI model = nullptr;
+    auto error = aclmdlRICaptureEnd(stream_, &model);
+    if (error != ACL_SUCCESS || !keep) {
+        if (model) {
+            aclmdlRIDestroy(model);
+        }
+        LOG_DEBUG("graph capture of {} launches discarded", ops_.size());
+        ReleaseResources();
+        ops_.clear();
+        ACL_RT_CHECK(error, "aclmdlRICaptureEnd");
+        return;
+    }
+    model_ = model;
+    LOG_INFO("captured graph of {} launches over {} buffers", ops_.size(), buffers_.size());
+}
+
+void Graph::Replay() {
+    if (!model_) {
+        throw std::runtime_error("[graph.cpp](Replay) graph has not been captured");
+    }
+    ThrowIfCapturing(__FILE__, __func__);
+    for (auto& [usage, write] : buffers_) {
+        if (write) {
+            TrackWrite(usage);
+        } else {
+            TrackRead(usage);
+        }
+    }
+    aclrtStream stream = CurrentStream();
+    auto error = aclmdlRIExecuteAsync(model_, stream);
+    ACL_RT_CHECK(error, "aclmdlRIExecuteAsync");
+    ACL_OP_LAUNCHED("aclmdlRIExecuteAsync");
+    if (GetExecutionMode() == ExecutionMode::Async) {
+        lastReplay_ = StreamMarker::Record(stream);
+    }
+}
+
+void Graph::Pin(const std::shared_ptr<BufferUsage>& usage, bool write) {
+    auto [it, inserted] = bufferIndex_.emplace(usage.get(), buffers_.size());
+    if (inserted) {
+        // Replays write it behind the back of copy-on-write.
+        usage->aliased.store(true, std::memory_order_release);
+        buffers_.emplace_back(usage, write);
+    } else if (write) {
+        buffers_[it->second].second = true;
+    }
+}
+
+void* Graph::AllocateWorkspace(uint64_t size) {
+    void* ptr = CachingAllocator::Instance().Allocate(size, stream_);
+    workspaces_.push_back(ptr);
+    return ptr;
+}
+
+void Graph::ReleaseResources() noexcept {
+    // Replays may still be running on whatever stream they were launched on.
+    if (lastReplay_) {
+        aclrtSynchronizeEvent(lastReplay_->event());
+        lastReplay_.reset();
+    }
+    if (model_) {
+        aclmdlRIDestroy(model_);
+        model_ = nullptr;
+    }
+    for (void* ptr : workspaces_) {
+        CachingAllocator::Instance().Free(ptr);
+    }
+    workspaces_.clear();
+    buffers_.clear();
+    bufferIndex_.clear();
+    if (stream_) {
+        ReleaseCaptureStream(stream_);
+        stream_ = nullptr;
+    }
+}
+
+} // namespace cann
+} // namespace asnumpy
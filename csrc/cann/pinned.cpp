@@ -0,0 +1,374 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include "asnumpy/cann/pinned.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <fmt/format.h>
+#include <stdexcept>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include "asnumpy/cann/execution.hpp"
+#include "asnumpy/cann/stream.hpp"
+#include "asnumpy/utils/status_handler.hpp"
+
+namespace asnumpy {
+namespace cann {
+
+namespace {
+
+constexpr size_t kMinClass = 65536; // smallest size class
+
+size_t SizeClass(size_t size) {
+    size_t cls = kMinClass;
+    while (cls < size) {
+        cls <<= 1;
+    }
+    return cls;
+}
+
+int CurrentNumaNode() {
+    unsigned cpu = 0;
+    unsigned node = 0;
+    // getcpu has no glibc wrapper before 2.29; the raw syscall works everywhere.
+    if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0) {
+        return 0;
+    }
+    return static_cast<int>(node);
+}
+
+void WaitMarker(const std::shared_ptr<StreamMarker>& marker) {
+    if (!marker) {
+        return;
+    }
+    aclError error;
+    {
+        HostWaitScope wait;
+        error = aclrtSynchronizeEvent(marker->event());
+    }
+    ACL_RT_CHECK(error, "aclrtSynchronizeEvent");
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// PinnedHostPool
+// ============================================================================
+
+PinnedHostPool& PinnedHostPool::Instance() {
+    static auto* instance = new PinnedHostPool();
+    return *instance;
+}
+
+void* PinnedHostPool::Allocate(size_t size) {
+    size_t cls = SizeClass(size);
+    int node = CurrentNumaNode();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (void* ptr = TakeCachedLocked(node, cls)) {
+        return ptr;
+    }
+
+    void* ptr = nullptr;
+    auto error = aclrtMallocHost(&ptr, cls);
+    if (error != ACL_SUCCESS) {
+        ReleaseCachedLocked();
+        error = aclrtMallocHost(&ptr, cls);
+    }
+    if (error != ACL_SUCCESS) {
+        const char* message = aclGetRecentErrMsg();
+        throw std::runtime_error(fmt::format("[pinned.cpp](Allocate) aclrtMallocHost error = {} - failed to allocate "
+                                             "{} bytes ({} bytes reserved){}",
+                                             error, cls, stats_.reserved_bytes,
+                                             message ? std::string(" - ") + message : ""));
+    }
+    // First touch from this thread, so the pages land on its NUMA node.
+    std::memset(ptr, 0, cls);
+    LOG_DEBUG("new pinned buffer of {} bytes on NUMA node {}", cls, node);
+
+    blocks_[reinterpret_cast<uintptr_t>(ptr)] = Block{cls, node, true, nullptr};
+    stats_.reserved_bytes += cls;
+    stats_.allocated_bytes += cls;
+    stats_.host_malloc_count++;
+    return ptr;
+}
+
+void* PinnedHostPool::TakeCachedLocked(int node, size_t cls) {
+    auto it = free_.find({node, cls});
+    if (it == free_.end()) {
+        return nullptr;
+    }
+    auto& list = it->second;
+    for (auto candidate = list.begin(); candidate != list.end(); ++candidate) {
+        Block& block = blocks_.at(reinterpret_cast<uintptr_t>(*candidate));
+        if (block.pending && !block.pending->IsComplete()) {
+            continue;
+        }
+        void* ptr = *candidate;
+        list.erase(candidate);
+        block.pending.reset();
+        block.allocated = true;
+        stats_.allocated_bytes += block.size;
+        return ptr;
+    }
+    return nullptr;
+}
+
+void PinnedHostPool::Free(void* ptr, std::shared_ptr<StreamMarker> pending) {
+    if (!ptr) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = blocks_.find(reinterpret_cast<uintptr_t>(ptr));
+    if (it == blocks_.end() || !it->second.allocated) {
+        throw std::invalid_argument("[pinned.cpp](Free) pointer was not allocated by the pinned host pool");
+    }
+    Block& block = it->second;
+    block.allocated = false;
+    block.pending = std::move(pending);
+    stats_.allocated_bytes -= block.size;
+    free_[{block.node, block.size}].push_back(ptr);
+}
+
+bool PinnedHostPool::Contains(const void* ptr, size_t size) const {
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = blocks_.upper_bound(address);
+    if (it == blocks_.begin()) {
+        return false;
+    }
+    --it;
+    return it->second.allocated && address + size <= it->first + it->second.size;
+}
+
+void PinnedHostPool::EmptyCache() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ReleaseCachedLocked();
+}
+
+void PinnedHostPool::ReleaseCachedLocked() {
+    for (auto& [key, list] : free_) {
+        auto keep = list.begin();
+        for (void* ptr : list) {
+            auto it = blocks_.find(reinterpret_cast<uintptr_t>(ptr));
+            if (it->second.pending && !it->second.pending->IsComplete()) {
+                *keep++ = ptr;
+                continue;
+            }
+            auto error = aclrtFreeHost(ptr);
+            if (error != ACL_SUCCESS) {
+                LOG_WARN("aclrtFreeHost error = {}", error);
+            }
+            stats_.reserved_bytes -= it->second.size;
+            stats_.host_free_count++;
+            blocks_.erase(it);
+        }
+        list.erase(keep, list.end());
+    }
+}
+
+PinnedMemoryStats PinnedHostPool::Stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+// ============================================================================
+// Transfer throughput
+// ============================================================================
+
+namespace {
+
+struct PendingTransfer {
+    bool toDevice;
+    size_t bytes;
+    std::shared_ptr<StreamMarker> start;
+    std::shared_ptr<StreamMarker> end;
+};
+
+struct TransferLog {
+    std::mutex mutex;
+    std::deque<PendingTransfer> pending;
+    TransferStats stats;
+};
+
+// Leaked on purpose: the markers must not be destroyed after aclFinalize.
+TransferLog& Log() {
+    static auto* log = new TransferLog();
+    return *log;
+}
+
+// Folds finished transfers into the counters, oldest first.
+void SettleLocked(TransferLog& log) {
+    while (!log.pending.empty() && log.pending.front().end->IsComplete()) {
+        const auto& transfer = log.pending.front();
+        float ms = 0;
+        if (aclrtEventElapsedTime(&ms, transfer.start->event(), transfer.end->event()) == ACL_SUCCESS) {
+            double seconds = ms / 1000.0;
+            log.stats.transfer_count++;
+            log.stats.bytes += transfer.bytes;
+            log.stats.seconds += seconds;
+            log.stats.last_bytes = transfer.bytes;
+            log.stats.last_seconds = seconds;
+            log.stats.last_host_to_device = transfer.toDevice;
+            LOG_DEBUG("{} transfer of {} bytes took {:.3f} ms ({:.2f} GB/s)", transfer.toDevice ? "H2D" : "D2H",
+                      transfer.bytes, ms, seconds > 0 ? transfer.bytes / seconds / 1e9 : 0.0);
+        }
+        log.pending.pop_front();
+    }
+}
+
+void RecordTransfer(bool toDevice, size_t bytes, std::shared_ptr<StreamMarker> start,
+                    std::shared_ptr<StreamMarker> end) {
+    auto& log = Log();
+    std::lock_guard<std::mutex> lock(log.mutex);
+    log.pending.push_back({toDevice, bytes, std::move(start), std::move(end)});
+    SettleLocked(log);
+}
+
+} // anonymous namespace
+
+TransferStats GetTransferStats() {
+    auto& log = Log();
+    std::lock_guard<std::mutex> lock(log.mutex);
+    SettleLocked(log);
+    return log.stats;
+}
+
+// ============================================================================
+// Staged transfers
+// ============================================================================
+
+void StagedCopyHostToDevice(void* dst, const void* src, size_t bytes, aclrtStream stream) {
+    auto& pool = PinnedHostPool::Instance();
+    size_t chunk = std::min(bytes, kStagingChunk);
+    size_t chunks = (bytes + chunk - 1) / chunk;
+    std::vector<void*> slots;
+    std::vector<std::shared_ptr<StreamMarker>> inFlight(std::min(chunks, kStagingDepth));
+    try {
+        for (size_t i = 0; i < inFlight.size(); ++i) {
+            slots.push_back(pool.Allocate(chunk));
+        }
+        auto start = StreamMarker::Record(stream);
+        for (size_t index = 0; index < chunks; ++index) {
+            size_t slot = index % slots.size();
+            size_t offset = index * chunk;
+            size_t n = std::min(chunk, bytes - offset);
+            // The previous DMA out of this buffer must be done before it is refilled.
+            WaitMarker(inFlight[slot]);
+            std::memcpy(slots[slot], static_cast<const char*>(src) + offset, n);
+            auto error = aclrtMemcpyAsync(static_cast<char*>(dst) + offset, n, slots[slot], n,
+                                          ACL_MEMCPY_HOST_TO_DEVICE, stream);
+            ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+            inFlight[slot] = StreamMarker::Record(stream);
+        }
+        RecordTransfer(true, bytes, std::move(start), inFlight[(chunks - 1) % slots.size()]);
+    } catch (...) {
+        // Nothing more will be queued; wait out what was, so the buffers can go back to the pool.
+        aclrtSynchronizeStream(stream);
+        for (void* slot : slots) {
+            pool.Free(slot);
+        }
+        throw;
+    }
+    // All buffers go back at once, each reusable when its last DMA is done.
+    for (size_t i = 0; i < slots.size(); ++i) {
+        pool.Free(slots[i], std::move(inFlight[i]));
+    }
+}
+
+void StagedCopyDeviceToHost(void* dst, const void* src, size_t bytes, aclrtStream stream) {
+    ChunkedDeviceToHost reader(src, bytes, kStagingChunk, stream);
+    size_t offset = 0;
+    size_t n = 0;
+    while (const void* chunk = reader.Next(&n)) {
+        std::memcpy(static_cast<char*>(dst) + offset, chunk, n);
+        offset += n;
+    }
+}
+
+// ============================================================================
+// ChunkedDeviceToHost
+// ============================================================================
+
+ChunkedDeviceToHost::ChunkedDeviceToHost(const void* src, size_t bytes, size_t chunk, aclrtStream stream)
+    : src_(static_cast<const char*>(src)), bytes_(bytes), chunk_(std::max<size_t>(std::min(chunk, bytes), 1)),
+      chunks_((bytes + chunk_ - 1) / chunk_), stream_(stream) {
+    auto& pool = PinnedHostPool::Instance();
+    try {
+        for (size_t i = 0; i < std::min(chunks_, kStagingDepth); ++i) {
+            slots_.push_back(pool.Allocate(chunk_));
+        }
+        inFlight_.resize(slots_.size());
+        if (chunks_ > 0) {
+            start_ = StreamMarker::Record(stream_);
+        }
+        // Fill the ring; each handed-out chunk frees a slot for the next one.
+        for (size_t index = 0; index < slots_.size(); ++index) {
+            Issue(index);
+        }
+    } catch (...) {
+        Release();
+        throw;
+    }
+}
+
+ChunkedDeviceToHost::~ChunkedDeviceToHost() { Release(); }
+
+const void* ChunkedDeviceToHost::Next(size_t* size) {
+    if (next_ > 0 && next_ - 1 + slots_.size() < chunks_) {
+        // The caller is done with the previous chunk; its buffer takes the next chunk not yet queued.
+        Issue(next_ - 1 + slots_.size());
+    }
+    if (next_ == chunks_) {
+        *size = 0;
+        return nullptr;
+    }
+    size_t slot = next_ % slots_.size();
+    WaitMarker(inFlight_[slot]);
+    *size = std::min(chunk_, bytes_ - next_ * chunk_);
+    ++next_;
+    return slots_[slot];
+}
+
+void ChunkedDeviceToHost::Issue(size_t index) {
+    size_t slot = index % slots_.size();
+    size_t offset = index * chunk_;
+    size_t n = std::min(chunk_, bytes_ - offset);
+    auto error = aclrtMemcpyAsync(slots_[slot], n, src_ + offset, n, ACL_MEMCPY_DEVICE_TO_HOST, stream_);
+    ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+    inFlight_[slot] = StreamMarker::Record(stream_);
+    if (index + 1 == chunks_) {
+        RecordTransfer(false, bytes_, start_, inFlight_[slot]);
+    }
+}
+
+void ChunkedDeviceToHost::Release() {
+    auto& pool = PinnedHostPool::Instance();
+    for (size_t i = 0; i < slots_.size(); ++i) {
+        // A DMA still writing the buffer may also still read `src`, which the caller frees next.
+        if (i < inFlight_.size() && inFlight_[i]) {
+            aclrtSynchronizeEvent(inFlight_[i]->event());
+        }
+        pool.Free(slots_[i]);
+    }
+    slots_.clear();
+    inFlight_.clear();
+}
+
+} // namespace cann
+} // namespace asnumpy
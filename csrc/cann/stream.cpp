@@ -0,0 +1,249 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "asnumpy/cann/stream.hpp"
+#include <algorithm>
+#include <utility>
+#include "asnumpy/cann/allocator.hpp"
+#include "asnumpy/cann/execution.hpp"
+#include "asnumpy/cann/graph.hpp"
+#include "asnumpy/utils/status_handler.hpp"
+
+namespace asnumpy {
+namespace cann {
+
+namespace {
+
+thread_local aclrtStream t_currentStream = nullptr;
+
+std::atomic<aclrtContext> g_sharedContext{nullptr};
+
+// Whether the calling thread has a context, of its own or adopted; checked on every launch.
+thread_local bool t_hasContext = false;
+
+// Buffers the calling thread's next launch touches; `second` is true for writes.
+thread_local std::vector<std::pair<std::shared_ptr<BufferUsage>, bool>> t_tracked;
+
+struct EventPool {
+    std::mutex mutex;
+    std::vector<aclrtEvent> events;
+};
+
+// Leaked on purpose: events must not be destroyed after aclFinalize.
+EventPool& Events() {
+    static EventPool* pool = new EventPool();
+    return *pool;
+}
+
+void WaitOnOtherStream(const std::shared_ptr<StreamMarker>& marker, aclrtStream stream) {
+    if (!marker || marker->stream() == stream)
+        return;
+    auto error = aclrtStreamWaitEvent(stream, marker->event());
+    ACL_RT_CHECK(error, "aclrtStreamWaitEvent");
+}
+
+void RecordUse(const BufferUsage& usage, aclrtStream stream) {
+    if (usage.ptr && usage.pooled && usage.stream != stream) {
+        CachingAllocator::Instance().RecordStream(usage.ptr, stream);
+    }
+}
+
+void AdoptSharedContext() {
+    aclrtContext context = nullptr;
+    if (aclrtGetCurrentContext(&context) == ACL_SUCCESS && context) {
+        t_hasContext = true;
+        return;
+    }
+    context = g_sharedContext.load(std::memory_order_acquire);
+    if (!context) {
+        // No device set yet; the launch will report that, and the next call tries again.
+        return;
+    }
+    auto error = aclrtSetCurrentContext(context);
+    ACL_RT_CHECK(error, "aclrtSetCurrentContext");
+    t_hasContext = true;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// Current stream
+// ============================================================================
+
+aclrtStream CurrentStream() {
+    if (!t_hasContext) {
+        AdoptSharedContext();
+    }
+    return t_currentStream;
+}
+
+void SetSharedContext(aclrtContext context) {
+    g_sharedContext.store(context, std::memory_order_release);
+    if (context) {
+        t_hasContext = true;
+    }
+}
+
+aclrtStream ExchangeCurrentStream(aclrtStream stream) { return std::exchange(t_currentStream, stream); }
+
+// ============================================================================
+// StreamPool
+// ============================================================================
+
+StreamPool& StreamPool::Instance() {
+    static StreamPool* instance = new StreamPool();
+    return *instance;
+}
+
+aclrtStream StreamPool::Acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const size_t index = next_++ % kPoolSize;
+    if (index == streams_.size()) {
+        aclrtStream stream = nullptr;
+        auto error = aclrtCreateStream(&stream);
+        ACL_RT_CHECK(error, "aclrtCreateStream");
+        streams_.push_back(stream);
+        LOG_DEBUG("stream pool created stream {} of {}", streams_.size(), kPoolSize);
+    }
+    return streams_[index];
+}
+
+// ============================================================================
+// StreamMarker
+// ============================================================================
+
+std::shared_ptr<StreamMarker> StreamMarker::Record(aclrtStream stream) {
+    aclrtEvent event = nullptr;
+    {
+        auto& pool = Events();
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        if (!pool.events.empty()) {
+            event = pool.events.back();
+            pool.events.pop_back();
+        }
+    }
+    if (!event) {
+        auto error = aclrtCreateEvent(&event);
+        ACL_RT_CHECK(error, "aclrtCreateEvent");
+    }
+    std::shared_ptr<StreamMarker> marker(new StreamMarker(event, stream));
+    auto error = aclrtRecordEvent(event, stream);
+    ACL_RT_CHECK(error, "aclrtRecordEvent");
+    return marker;
+}
+
+StreamMarker::~StreamMarker() {
+    if (!recyclable_) {
+        aclrtDestroyEvent(event_);
+        return;
+    }
+    auto& pool = Events();
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    pool.events.push_back(event_);
+}
+
+bool StreamMarker::IsComplete() const {
+    aclrtEventRecordedStatus status = ACL_EVENT_RECORDED_STATUS_NOT_READY;
+    return aclrtQueryEventStatus(event_, &status) == ACL_SUCCESS && status == ACL_EVENT_RECORDED_STATUS_COMPLETE;
+}
+
+// ============================================================================
+// Buffer dependencies
+// ============================================================================
+
+void TrackRead(const std::shared_ptr<BufferUsage>& usage) {
+    if (usage && CapturingGraph()) {
+        // Capture began with the device idle and stays on one stream; just keep the buffer alive.
+        CapturingGraph()->Pin(usage, false);
+        return;
+    }
+    if (!usage || GetExecutionMode() != ExecutionMode::Async)
+        return;
+    aclrtStream stream = CurrentStream();
+    WaitOnOtherStream(usage->lastWrite, stream);
+    RecordUse(*usage, stream);
+    t_tracked.emplace_back(usage, false);
+}
+
+void TrackWrite(const std::shared_ptr<BufferUsage>& usage) {
+    if (usage && CapturingGraph()) {
+        CapturingGraph()->Pin(usage, true);
+        return;
+    }
+    if (!usage || GetExecutionMode() != ExecutionMode::Async)
+        return;
+    aclrtStream stream = CurrentStream();
+    WaitOnOtherStream(usage->lastWrite, stream);
+    for (auto& read : usage->reads) {
+        WaitOnOtherStream(read, stream);
+    }
+    RecordUse(*usage, stream);
+    t_tracked.emplace_back(usage, true);
+}
+
+void CommitTracked(const std::shared_ptr<StreamMarker>& marker) {
+    // Writes first: a buffer both read and written by the launch only needs the write.
+    for (auto& [usage, write] : t_tracked) {
+        if (write) {
+            usage->lastWrite = marker;
+            usage->reads.clear();
+        }
+    }
+    for (auto& [usage, write] : t_tracked) {
+        if (write || usage->lastWrite == marker)
+            continue;
+        auto sameStream = [&](const std::shared_ptr<StreamMarker>& read) { return read->stream() == marker->stream(); };
+        auto it = std::find_if(usage->reads.begin(), usage->reads.end(), sameStream);
+        if (it != usage->reads.end()) {
+            *it = marker;
+        } else {
+            usage->reads.push_back(marker);
+        }
+    }
+    t_tracked.clear();
+}
+
+NestedLaunchScope::NestedLaunchScope() { saved_.swap(t_tracked); }
+
+NestedLaunchScope::~NestedLaunchScope() {
+    // Anything the nested launch left uncommitted stays pending after the enclosing operator's buffers.
+    saved_.insert(saved_.end(), t_tracked.begin(), t_tracked.end());
+    t_tracked.swap(saved_);
+}
+
+void WaitForMarker(const StreamMarker& marker, const char* file, const char* func) {
+    ThrowIfCapturing(file, func);
+    aclError error;
+    {
+        HostWaitScope wait;
+        error = aclrtSynchronizeEvent(marker.event());
+    }
+    if (error != ACL_SUCCESS) {
+        // Let Synchronize find and name the operator that failed.
+        Synchronize(file, func);
+        CheckAclRuntimeStatus(error, file, func, "aclrtSynchronizeEvent");
+    }
+}
+
+void WaitForWriter(const BufferUsage& usage, const char* file, const char* func) {
+    ThrowIfCapturing(file, func);
+    auto marker = usage.lastWrite;
+    if (!marker)
+        return;
+    WaitForMarker(*marker, file, func);
+}
+
+} // namespace cann
+} // namespace asnumpy
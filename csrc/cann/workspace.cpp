@@ -0,0 +1,141 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#include "asnumpy/cann/workspace.hpp"
+#include <algorithm>
+#include <memory>
+#include <unordered_map>
+#include "asnumpy/cann/allocator.hpp"
+#include "asnumpy/utils/status_handler.hpp"
+
+namespace asnumpy {
+namespace cann {
+
+namespace {
+
+struct ArenaRegistry {
+    std::mutex mutex;
+    std::unordered_map<aclrtStream, std::unique_ptr<WorkspaceArena>> arenas;
+};
+
+// Leaked for the same reason as the CachingAllocator: static destruction runs after aclFinalize.
+ArenaRegistry& Registry() {
+    static ArenaRegistry* registry = new ArenaRegistry();
+    return *registry;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// WorkspaceArena
+// ============================================================================
+
+WorkspaceArena& WorkspaceArena::ForStream(aclrtStream stream) {
+    auto& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    auto& arena = registry.arenas[stream];
+    if (!arena) {
+        arena.reset(new WorkspaceArena(stream));
+    }
+    return *arena;
+}
+
+WorkspaceStats WorkspaceArena::Stats() {
+    WorkspaceStats stats;
+    auto& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& [stream, arena] : registry.arenas) {
+        std::lock_guard<std::mutex> arenaLock(arena->mutex_);
+        stats.capacity_bytes += arena->capacity_;
+        stats.high_water_bytes = std::max(stats.high_water_bytes, arena->highWater_);
+        stats.grow_count += arena->growCount_;
+        stats.lease_count += arena->leaseCount_;
+    }
+    return stats;
+}
+
+WorkspaceStats WorkspaceArena::ArenaStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return WorkspaceStats{capacity_, highWater_, growCount_, leaseCount_};
+}
+
+void WorkspaceArena::ReleaseAll() {
+    auto& registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (auto& [stream, arena] : registry.arenas) {
+        std::lock_guard<std::mutex> arenaLock(arena->mutex_);
+        if (arena->activeLeases_ > 0) {
+            LOG_WARN("workspace arena still has {} live lease(s); keeping its buffer", arena->activeLeases_);
+            continue;
+        }
+        CachingAllocator::Instance().Free(arena->ptr_);
+        arena->ptr_ = nullptr;
+        arena->capacity_ = 0;
+        arena->FreeRetiredLocked();
+    }
+}
+
+void* WorkspaceArena::Acquire(uint64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    highWater_ = std::max(highWater_, size);
+    if (size > capacity_) {
+        GrowLocked(size);
+    }
+    activeLeases_++;
+    leaseCount_++;
+    return ptr_;
+}
+
+void WorkspaceArena::Release() noexcept {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--activeLeases_ == 0) {
+        FreeRetiredLocked();
+    }
+}
+
+void WorkspaceArena::Reserve(uint64_t size) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (size > capacity_) {
+        GrowLocked(size);
+    }
+}
+
+void WorkspaceArena::GrowLocked(uint64_t size) {
+    // Allocate first so a failed grow leaves the current buffer in place.
+    void* grown = CachingAllocator::Instance().Allocate(size, stream_);
+    if (ptr_) {
+        if (activeLeases_ > 0) {
+            retired_.push_back(ptr_);
+        } else {
+            // Kernels that used the old buffer were queued on stream_, and the allocator only
+            // reuses it for stream_, so it can go back right away.
+            CachingAllocator::Instance().Free(ptr_);
+        }
+    }
+    ptr_ = grown;
+    capacity_ = size;
+    growCount_++;
+    LOG_DEBUG("workspace arena grown to {} bytes", size);
+}
+
+void WorkspaceArena::FreeRetiredLocked() noexcept {
+    for (void* ptr : retired_) {
+        CachingAllocator::Instance().Free(ptr);
+    }
+    retired_.clear();
+}
+
+} // namespace cann
+} // namespace asnumpy
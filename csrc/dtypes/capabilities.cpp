@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include <asnumpy/dtypes/capabilities.hpp>
+
+#include <asnumpy/dtypes/promote.hpp>
+
+#include <cstdint>
+
+namespace asnumpy::dtypes {
+
+namespace {
+
+constexpr uint64_t Bit(aclDataType acl) { return uint64_t{1} << static_cast<unsigned>(acl); }
+
+constexpr uint64_t kIntegers = Bit(ACL_INT8) | Bit(ACL_INT16) | Bit(ACL_INT32) | Bit(ACL_INT64) | Bit(ACL_UINT8);
+constexpr uint64_t kFloats = Bit(ACL_FLOAT16) | Bit(ACL_FLOAT) | Bit(ACL_DOUBLE);
+constexpr uint64_t kRealNumbers = kIntegers | kFloats;
+constexpr uint64_t kRealOrBool = kRealNumbers | Bit(ACL_BOOL);
+
+struct Capability {
+    std::string_view aclnn_api;
+    uint64_t inputs; // dtypes the kernel accepts on either input, mixed freely
+};
+
+// Kept to kernels that document mixed-dtype promotion for their tensor-tensor form. uint16/32/64
+// and complex are left out: several kernels reject them even unmixed.
+constexpr Capability kMixedInputKernels[] = {
+    {"aclnnAdd", kRealOrBool},       {"aclnnSub", kRealNumbers},       {"aclnnMul", kRealOrBool},
+    {"aclnnMaximum", kRealOrBool},   {"aclnnMinimum", kRealOrBool},    {"aclnnEqTensor", kRealOrBool},
+    {"aclnnNeTensor", kRealOrBool},  {"aclnnGtTensor", kRealOrBool},   {"aclnnGeTensor", kRealOrBool},
+    {"aclnnLtTensor", kRealOrBool},  {"aclnnLeTensor", kRealOrBool},
+};
+
+bool Contains(uint64_t set, aclDataType acl) {
+    return static_cast<unsigned>(acl) < 64 && (set & Bit(acl)) != 0;
+}
+
+/// The dtype an aclnn kernel computes (a, b) in. Over the dtypes of the table this is NumPy's rule
+/// except that a float operand wins over any integer.
+aclDataType KernelResultType(aclDataType a, aclDataType b) {
+    if (Contains(kIntegers, a) && Contains(kFloats, b))
+        return b;
+    if (Contains(kFloats, a) && Contains(kIntegers, b))
+        return a;
+    return ResultType(a, b);
+}
+
+} // namespace
+
+bool KernelPromotes(std::string_view aclnn_api, aclDataType a, aclDataType b, aclDataType common) {
+    for (const auto& capability : kMixedInputKernels) {
+        if (capability.aclnn_api == aclnn_api) {
+            return Contains(capability.inputs, a) && Contains(capability.inputs, b) &&
+                   KernelResultType(a, b) == common;
+        }
+    }
+    return false;
+}
+
+} // namespace asnumpy::dtypes
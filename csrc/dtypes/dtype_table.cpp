@@ -19,6 +19,7 @@
 #include <array>
 #include <complex>
 #include <fmt/core.h>
+#include <pybind11/gil_safe_call_once.h>
 #include <stdexcept>
 
 namespace asnumpy::dtypes {
@@ -34,30 +35,35 @@ struct Entry {
 
 /**
  * The table. Built on first use rather than at static-init time because py::dtype needs a live
- * interpreter.
+ * interpreter. Not a plain function-local static: building it may import NumPy, which can drop the
+ * GIL while a second thread is blocked on the static's guard holding it.
  *
  * Keyed on normalized_num() rather than dtype identity: pybind11 normalizes equivalent types that
  * carry different type numbers, so np.int64 and np.longlong (both 8-byte signed on LP64) resolve
  * to the same entry. The previous identity-based chain rejected np.longlong outright.
  */
 const std::array<Entry, 14>& Table() {
-    static const std::array<Entry, 14> table = {{
-        {ACL_BOOL, py::dtype::of<bool>().normalized_num(), 1, "bool"},
-        {ACL_INT8, py::dtype::of<int8_t>().normalized_num(), 1, "int8"},
-        {ACL_INT16, py::dtype::of<int16_t>().normalized_num(), 2, "int16"},
-        {ACL_INT32, py::dtype::of<int32_t>().normalized_num(), 4, "int32"},
-        {ACL_INT64, py::dtype::of<int64_t>().normalized_num(), 8, "int64"},
-        {ACL_UINT8, py::dtype::of<uint8_t>().normalized_num(), 1, "uint8"},
-        {ACL_UINT16, py::dtype::of<uint16_t>().normalized_num(), 2, "uint16"},
-        {ACL_UINT32, py::dtype::of<uint32_t>().normalized_num(), 4, "uint32"},
-        {ACL_UINT64, py::dtype::of<uint64_t>().normalized_num(), 8, "uint64"},
-        {ACL_FLOAT16, py::dtype("float16").normalized_num(), 2, "float16"},
-        {ACL_FLOAT, py::dtype::of<float>().normalized_num(), 4, "float32"},
-        {ACL_DOUBLE, py::dtype::of<double>().normalized_num(), 8, "float64"},
-        {ACL_COMPLEX64, py::dtype::of<std::complex<float>>().normalized_num(), 8, "complex64"},
-        {ACL_COMPLEX128, py::dtype::of<std::complex<double>>().normalized_num(), 16, "complex128"},
-    }};
-    return table;
+    PYBIND11_CONSTINIT static py::gil_safe_call_once_and_store<std::array<Entry, 14>> storage;
+    return storage
+        .call_once_and_store_result([]() {
+            return std::array<Entry, 14>{{
+                {ACL_BOOL, py::dtype::of<bool>().normalized_num(), 1, "bool"},
+                {ACL_INT8, py::dtype::of<int8_t>().normalized_num(), 1, "int8"},
+                {ACL_INT16, py::dtype::of<int16_t>().normalized_num(), 2, "int16"},
+                {ACL_INT32, py::dtype::of<int32_t>().normalized_num(), 4, "int32"},
+                {ACL_INT64, py::dtype::of<int64_t>().normalized_num(), 8, "int64"},
+                {ACL_UINT8, py::dtype::of<uint8_t>().normalized_num(), 1, "uint8"},
+                {ACL_UINT16, py::dtype::of<uint16_t>().normalized_num(), 2, "uint16"},
+                {ACL_UINT32, py::dtype::of<uint32_t>().normalized_num(), 4, "uint32"},
+                {ACL_UINT64, py::dtype::of<uint64_t>().normalized_num(), 8, "uint64"},
+                {ACL_FLOAT16, py::dtype("float16").normalized_num(), 2, "float16"},
+                {ACL_FLOAT, py::dtype::of<float>().normalized_num(), 4, "float32"},
+                {ACL_DOUBLE, py::dtype::of<double>().normalized_num(), 8, "float64"},
+                {ACL_COMPLEX64, py::dtype::of<std::complex<float>>().normalized_num(), 8, "complex64"},
+                {ACL_COMPLEX128, py::dtype::of<std::complex<double>>().normalized_num(), 16, "complex128"},
+            }};
+        })
+        .get_stored();
 }
 
 const Entry* FindByAcl(aclDataType acl) {
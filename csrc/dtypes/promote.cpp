@@ -16,56 +16,193 @@
 
 #include <asnumpy/dtypes/promote.hpp>
 
+#include <asnumpy/dtypes/capabilities.hpp>
 #include <asnumpy/dtypes/dtype_table.hpp>
 #include <asnumpy/utils/cast.hpp>
 
+#include <array>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
-#include <pybind11/gil_safe_call_once.h>
-#include <unordered_map>
+#include <fmt/format.h>
+#include <stdexcept>
 
 namespace asnumpy {
 
 namespace {
 
-/**
- * numpy.result_type, imported once.
- *
- * gil_safe_call_once_and_store rather than a plain function-local static, for two reasons. A bare
- * `static py::object` is destroyed during static destruction, which runs *after* the interpreter
- * finalizes, so its decref touches freed state and segfaults on exit; this utility never destroys
- * the stored object. And the magic-static guard of a bare static would be held across an import
- * that can release the GIL, so two threads first reaching this concurrently could deadlock -- one
- * holding the guard while blocked on the GIL, the other holding the GIL while blocked on the
- * guard. This is exactly what the utility exists to prevent.
- */
-const py::object& NumpyResultType() {
-    PYBIND11_CONSTINIT static py::gil_safe_call_once_and_store<py::object> storage;
-    return storage.call_once_and_store_result([]() { return py::module_::import("numpy").attr("result_type"); })
-        .get_stored();
+// The promotion table, generated from numpy.result_type over the 14 dtypes of dtype_table.cpp and
+// checked against it pair by pair in tests/asnumpy_tests/dtype_tests/test_dtype_layer.py. Rows
+// and columns follow kDtypes.
+constexpr aclDataType b1 = ACL_BOOL, i8 = ACL_INT8, i16 = ACL_INT16, i32 = ACL_INT32, i64 = ACL_INT64;
+constexpr aclDataType u8 = ACL_UINT8, u16 = ACL_UINT16, u32 = ACL_UINT32, u64 = ACL_UINT64;
+constexpr aclDataType f16 = ACL_FLOAT16, f32 = ACL_FLOAT, f64 = ACL_DOUBLE, c64 = ACL_COMPLEX64, c128 = ACL_COMPLEX128;
+
+constexpr size_t kNumDtypes = 14;
+constexpr std::array<aclDataType, kNumDtypes> kDtypes = {
+    b1, i8, i16, i32, i64, u8, u16, u32, u64, f16, f32, f64, c64, c128,
+};
+
+// clang-format off
+constexpr aclDataType kPromotion[kNumDtypes][kNumDtypes] = {
+    //  b1    i8    i16   i32   i64   u8    u16   u32   u64   f16   f32   f64   c64   c128
+    {   b1,   i8,   i16,  i32,  i64,  u8,   u16,  u32,  u64,  f16,  f32,  f64,  c64,  c128 }, // b1
+    {   i8,   i8,   i16,  i32,  i64,  i16,  i32,  i64,  f64,  f16,  f32,  f64,  c64,  c128 }, // i8
+    {   i16,  i16,  i16,  i32,  i64,  i16,  i32,  i64,  f64,  f32,  f32,  f64,  c64,  c128 }, // i16
+    {   i32,  i32,  i32,  i32,  i64,  i32,  i32,  i64,  f64,  f64,  f64,  f64,  c128, c128 }, // i32
+    {   i64,  i64,  i64,  i64,  i64,  i64,  i64,  i64,  f64,  f64,  f64,  f64,  c128, c128 }, // i64
+    {   u8,   i16,  i16,  i32,  i64,  u8,   u16,  u32,  u64,  f16,  f32,  f64,  c64,  c128 }, // u8
+    {   u16,  i32,  i32,  i32,  i64,  u16,  u16,  u32,  u64,  f32,  f32,  f64,  c64,  c128 }, // u16
+    {   u32,  i64,  i64,  i64,  i64,  u32,  u32,  u32,  u64,  f64,  f64,  f64,  c128, c128 }, // u32
+    {   u64,  f64,  f64,  f64,  f64,  u64,  u64,  u64,  u64,  f64,  f64,  f64,  c128, c128 }, // u64
+    {   f16,  f16,  f32,  f64,  f64,  f16,  f32,  f64,  f64,  f16,  f32,  f64,  c64,  c128 }, // f16
+    {   f32,  f32,  f32,  f64,  f64,  f32,  f32,  f64,  f64,  f32,  f32,  f64,  c64,  c128 }, // f32
+    {   f64,  f64,  f64,  f64,  f64,  f64,  f64,  f64,  f64,  f64,  f64,  f64,  c128, c128 }, // f64
+    {   c64,  c64,  c64,  c128, c128, c64,  c64,  c128, c128, c64,  c64,  c128, c64,  c128 }, // c64
+    {   c128, c128, c128, c128, c128, c128, c128, c128, c128, c128, c128, c128, c128, c128 }, // c128
+};
+// clang-format on
+
+constexpr size_t kSlotMapSize = static_cast<size_t>(ACL_COMPLEX128) + 1;
+
+/// aclDataType value -> row of kPromotion, or -1 for a type NumPy cannot name.
+constexpr std::array<int8_t, kSlotMapSize> MakeSlots() {
+    std::array<int8_t, kSlotMapSize> slots{};
+    for (auto& slot : slots)
+        slot = -1;
+    for (size_t i = 0; i < kNumDtypes; ++i)
+        slots[static_cast<size_t>(kDtypes[i])] = static_cast<int8_t>(i);
+    return slots;
+}
+
+constexpr std::array<int8_t, kSlotMapSize> kSlots = MakeSlots();
+
+// The structural laws of NumPy's lattice, so a mistyped cell fails the build and not just the tests.
+constexpr bool IsCommutativeWithIdentityDiagonal() {
+    for (size_t i = 0; i < kNumDtypes; ++i) {
+        if (kPromotion[i][i] != kDtypes[i] || kPromotion[0][i] != kDtypes[i])
+            return false;
+        for (size_t j = 0; j < kNumDtypes; ++j) {
+            if (kPromotion[i][j] != kPromotion[j][i] || kSlots[static_cast<size_t>(kPromotion[i][j])] < 0)
+                return false;
+        }
+    }
+    return true;
+}
+static_assert(IsCommutativeWithIdentityDiagonal(), "promotion table must be symmetric, closed, with bool as identity");
+
+int Slot(aclDataType acl, const char* which) {
+    const auto index = static_cast<size_t>(acl);
+    const int slot = index < kSlotMapSize ? kSlots[index] : -1;
+    if (slot < 0) {
+        // A type NumPy cannot name is a type NumPy cannot promote.
+        throw std::invalid_argument(fmt::format(
+            "[promote.cpp](ResultType) {} ACL type {} has no NumPy equivalent", which, static_cast<int>(acl)));
+    }
+    return slot;
+}
+
+// NEP 50 kind order. A weak scalar only changes the result dtype when it outranks the array.
+enum class Kind { kBool, kInteger, kFloating, kComplex };
+
+Kind KindOf(aclDataType acl) {
+    switch (acl) {
+    case ACL_BOOL:
+        return Kind::kBool;
+    case ACL_FLOAT16:
+    case ACL_BF16:
+    case ACL_FLOAT:
+    case ACL_DOUBLE:
+        return Kind::kFloating;
+    case ACL_COMPLEX32:
+    case ACL_COMPLEX64:
+    case ACL_COMPLEX128:
+        return Kind::kComplex;
+    default:
+        return Kind::kInteger;
+    }
 }
 
-uint64_t CacheKey(aclDataType a, aclDataType b) { return (static_cast<uint64_t>(a) << 32) | static_cast<uint32_t>(b); }
+// NumPy's "same_kind" order, b < u < i < f < c. Unlike Kind it splits the integers: uint8 may be
+// stored into int8, int8 may not be stored into uint8.
+enum class CastKind { kBool, kUnsigned, kSigned, kFloating, kComplex };
+
+CastKind CastKindOf(aclDataType acl) {
+    switch (acl) {
+    case ACL_UINT8:
+    case ACL_UINT16:
+    case ACL_UINT32:
+    case ACL_UINT64:
+        return CastKind::kUnsigned;
+    default:
+        break;
+    }
+    switch (KindOf(acl)) {
+    case Kind::kBool:
+        return CastKind::kBool;
+    case Kind::kInteger:
+        return CastKind::kSigned;
+    case Kind::kFloating:
+        return CastKind::kFloating;
+    default:
+        return CastKind::kComplex;
+    }
+}
+
+std::atomic<uint64_t> g_castsAvoided{0};
+std::atomic<uint64_t> g_castsMaterialized{0};
 
 } // namespace
 
 aclDataType ResultType(aclDataType a, aclDataType b) {
+    // Same-type pairs pass through untouched, so device-only types such as bf16 still promote with themselves.
     if (a == b)
         return a;
+    return kPromotion[Slot(a, "first")][Slot(b, "second")];
+}
 
-    // Memoized on the dtype pair. Guarded by the GIL, which every caller holds: these run inside
-    // pybind11-bound operators, and nothing here releases it.
-    static std::unordered_map<uint64_t, aclDataType> cache;
-    const uint64_t key = CacheKey(a, b);
-    if (auto it = cache.find(key); it != cache.end())
-        return it->second;
+aclDataType WeakScalarResultType(aclDataType array, const py::handle& scalar) {
+    // NumPy scalars (and 0-d arrays) are strong. Checked first: np.float64 subclasses float and
+    // np.bool_ does not subclass bool, so the builtin checks below would misclassify both.
+    if (py::hasattr(scalar, "dtype")) {
+        const auto ndim = scalar.attr("ndim").cast<int64_t>();
+        if (ndim != 0) {
+            throw std::invalid_argument(
+                fmt::format("[promote.cpp](WeakScalarResultType) expected a scalar operand, got a {}-d array", ndim));
+        }
+        return ResultType(array, dtypes::AclFromNumpy(scalar.attr("dtype").cast<py::dtype>()));
+    }
+
+    Kind kind;
+    if (PyBool_Check(scalar.ptr())) {
+        kind = Kind::kBool;
+    } else if (PyLong_Check(scalar.ptr())) {
+        kind = Kind::kInteger;
+    } else if (PyFloat_Check(scalar.ptr())) {
+        kind = Kind::kFloating;
+    } else if (PyComplex_Check(scalar.ptr())) {
+        kind = Kind::kComplex;
+    } else {
+        throw std::invalid_argument(fmt::format("[promote.cpp](WeakScalarResultType) expected a scalar operand, got {}",
+                                                Py_TYPE(scalar.ptr())->tp_name));
+    }
+
+    if (kind <= KindOf(array))
+        return array;
+    switch (kind) {
+    case Kind::kInteger:
+        return ACL_INT64;
+    case Kind::kFloating:
+        return ACL_DOUBLE;
+    default:
+        return (array == ACL_FLOAT16 || array == ACL_FLOAT) ? ACL_COMPLEX64 : ACL_COMPLEX128;
+    }
+}
 
-    // dtypes::NumpyFromAcl throws for ACL types with no NumPy equivalent, which is what we want:
-    // a type NumPy cannot name is a type NumPy cannot promote.
-    py::object promoted = NumpyResultType()(dtypes::NumpyFromAcl(a), dtypes::NumpyFromAcl(b));
-    const aclDataType result = dtypes::AclFromNumpy(promoted.cast<py::dtype>());
+bool CanCastSameKind(aclDataType from, aclDataType to) { return CastKindOf(from) <= CastKindOf(to); }
 
-    cache.emplace(key, result);
-    return result;
+CastStats GetCastStats() {
+    return {g_castsAvoided.load(std::memory_order_relaxed), g_castsMaterialized.load(std::memory_order_relaxed)};
 }
 
 PromotedOperands::PromotedOperands(const NPUArray& x1, const NPUArray& x2)
@@ -73,13 +210,29 @@ PromotedOperands::PromotedOperands(const NPUArray& x1, const NPUArray& x2)
     Materialize(x1, x2);
 }
 
+PromotedOperands::PromotedOperands(const NPUArray& x1, const NPUArray& x2, std::string_view aclnn_api)
+    : common_(ResultType(x1.aclDtype, x2.aclDtype)) {
+    Materialize(x1, x2, dtypes::KernelPromotes(aclnn_api, x1.aclDtype, x2.aclDtype, common_));
+}
+
 PromotedOperands::PromotedOperands(const NPUArray& x1, const NPUArray& x2, aclDataType common) : common_(common) {
     Materialize(x1, x2);
 }
 
-void PromotedOperands::Materialize(const NPUArray& x1, const NPUArray& x2) {
-    // Cast only on mismatch. CastTo would deep-copy on a match, and paying two device copies plus
-    // two device-wide syncs on every same-dtype op would dwarf the cost of the op itself.
+void PromotedOperands::Materialize(const NPUArray& x1, const NPUArray& x2, bool kernelPromotes) {
+    const uint64_t mismatched = (x1.aclDtype != common_) + (x2.aclDtype != common_);
+    if (kernelPromotes) {
+        // The kernel reads both dtypes and computes in common_: no cast kernel, no temporary.
+        g_castsAvoided.fetch_add(mismatched, std::memory_order_relaxed);
+        x1_ = &x1;
+        x2_ = &x2;
+        return;
+    }
+    if (mismatched > 0)
+        g_castsMaterialized.fetch_add(mismatched, std::memory_order_relaxed);
+
+    // Cast only on mismatch. On a match CastTo would return a copy-on-write copy: cheap, but still a
+    // descriptor and a refcount per operand that referencing the caller's array avoids.
     if (x1.aclDtype == common_) {
         x1_ = &x1;
     } else {
@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/linalg/decompositions.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -66,14 +68,13 @@ py::object Linalg_Qr(const NPUArray& a, const std::string& mode) {
         aclTensor* emptyQ =
             aclCreateTensor(&emptyShape, 1, a.aclDtype, &emptyStride, 0, ACL_FORMAT_ND, &emptyShape, 1, nullptr);
 
-        error = aclnnLinalgQrGetWorkspaceSize(a.tensorPtr, num, emptyQ, resultR.tensorPtr, &workspaceSize, &executor);
+        error = aclnnLinalgQrGetWorkspaceSize(a.tensor(), num, emptyQ, resultR.tensor(), &workspaceSize, &executor);
         ACLNN_CHECK(error, "aclnnLinalgQrGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
-        error = aclnnLinalgQr(workspace.get(), workspaceSize, executor, nullptr);
+        error = aclnnLinalgQr(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(error, "aclnnLinalgQr");
-        error = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnLinalgQr");
 
         aclDestroyTensor(emptyQ);
         LOG_INFO("aclnnLinalgQr completed");
@@ -89,15 +90,14 @@ py::object Linalg_Qr(const NPUArray& a, const std::string& mode) {
 
         auto resultQ = NPUArray(shapeQ, a.aclDtype);
 
-        error = aclnnLinalgQrGetWorkspaceSize(a.tensorPtr, num, resultQ.tensorPtr, resultR.tensorPtr, &workspaceSize,
+        error = aclnnLinalgQrGetWorkspaceSize(a.tensor(), num, resultQ.tensor(), resultR.tensor(), &workspaceSize,
                                               &executor);
         ACLNN_CHECK(error, "aclnnLinalgQrGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
-        error = aclnnLinalgQr(workspace.get(), workspaceSize, executor, nullptr);
+        error = aclnnLinalgQr(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(error, "aclnnLinalgQr");
-        error = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnLinalgQr");
 
         LOG_INFO("aclnnLinalgQr completed");
         return py::make_tuple(py::cast(std::move(resultQ)), py::cast(std::move(resultR)));
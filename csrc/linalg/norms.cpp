@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/linalg/norms.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -60,14 +62,13 @@ NPUArray Linalg_Norm(const NPUArray& a, double ord, const std::vector<int64_t>&
     auto result = NPUArray(shape, ACL_FLOAT);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnNormGetWorkspaceSize(a.tensorPtr, ord_scalar, axis_array, keepdims, result.tensorPtr,
+    auto error = aclnnNormGetWorkspaceSize(a.tensor(), ord_scalar, axis_array, keepdims, result.tensor(),
                                            &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnNormGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnNorm(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnNorm(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnNorm");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnNorm");
     LOG_INFO("aclnnNorm completed");
     return result;
 }
@@ -79,20 +80,19 @@ NPUArray Linalg_Det(const NPUArray& a) {
     shape.erase(shape.end() - 2, shape.end());
 
     // Cast input to double for numerical stability in LU decomposition
-    NPUArray aDouble = (a.aclDtype != ACL_DOUBLE) ? CastToDtype(a, ACL_DOUBLE) : a;
+    const NPUArray aDouble = (a.aclDtype != ACL_DOUBLE) ? CastToDtype(a, ACL_DOUBLE) : a;
 
     auto sign = NPUArray(shape, ACL_DOUBLE);
     auto logdet = NPUArray(shape, ACL_DOUBLE);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnSlogdetGetWorkspaceSize(aDouble.tensorPtr, sign.tensorPtr, logdet.tensorPtr, &workspaceSize, &executor);
+        aclnnSlogdetGetWorkspaceSize(aDouble.tensor(), sign.tensor(), logdet.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnSlogdetGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnSlogdet(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnSlogdet(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnSlogdet");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnSlogdet");
 
     auto absDet = EXECUTE_UNARY_OP(
         logdet, NPUArray::GetPyDtype(ACL_DOUBLE),
@@ -100,7 +100,7 @@ NPUArray Linalg_Det(const NPUArray& a) {
             return aclnnExpGetWorkspaceSize(in, out, ws, exec);
         },
         [](void* ws, uint64_t wsSize, aclOpExecutor* exec, void* stream) {
-            return aclnnExp(ws, wsSize, exec, nullptr);
+            return aclnnExp(ws, wsSize, exec, stream);
         },
         "Linalg_Det_Exp", "aclnnExp");
 
@@ -110,7 +110,7 @@ NPUArray Linalg_Det(const NPUArray& a) {
             return aclnnMulGetWorkspaceSize(in1, in2, out, ws, exec);
         },
         [](void* ws, uint64_t wsSize, aclOpExecutor* exec, void* stream) {
-            return aclnnMul(ws, wsSize, exec, nullptr);
+            return aclnnMul(ws, wsSize, exec, stream);
         },
         "Linalg_Det_Mul", "aclnnMul");
 
@@ -126,20 +126,19 @@ std::pair<NPUArray, NPUArray> Linalg_Slogdet(const NPUArray& a) {
     shape.erase(shape.end() - 2, shape.end());
 
     // Cast input to double for numerical stability in LU decomposition
-    NPUArray aDouble = (a.aclDtype != ACL_DOUBLE) ? CastToDtype(a, ACL_DOUBLE) : a;
+    const NPUArray aDouble = (a.aclDtype != ACL_DOUBLE) ? CastToDtype(a, ACL_DOUBLE) : a;
 
     auto signout = NPUArray(shape, ACL_DOUBLE);
     auto logout = NPUArray(shape, ACL_DOUBLE);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnSlogdetGetWorkspaceSize(aDouble.tensorPtr, signout.tensorPtr, logout.tensorPtr, &workspaceSize, &executor);
+        aclnnSlogdetGetWorkspaceSize(aDouble.tensor(), signout.tensor(), logout.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnSlogdetGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnSlogdet(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnSlogdet(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnSlogdet");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnSlogdet");
 
     // Cast results back to input dtype
     if (a.aclDtype != ACL_DOUBLE) {
@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/linalg/product.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -25,6 +27,7 @@
 #include <fmt/core.h>
 #include <fmt/format.h>
 #include <stdexcept>
+#include <utility>
 #include "aclnnop/aclnn_dot.h"
 #include "aclnnop/aclnn_flatten.h"
 #include "aclnnop/aclnn_mm.h"
@@ -43,13 +46,12 @@ NPUArray Matmul(const NPUArray& x1, const NPUArray& x2) {
         NPUArray out({}, x1.aclDtype);
         uint64_t ws = 0;
         aclOpExecutor* exec = nullptr;
-        auto err = aclnnDotGetWorkspaceSize(x1.tensorPtr, x2.tensorPtr, out.tensorPtr, &ws, &exec);
+        auto err = aclnnDotGetWorkspaceSize(x1.tensor(), x2.tensor(), out.tensor(), &ws, &exec);
         ACLNN_CHECK(err, "aclnnDotGetWorkspaceSize");
         AclWorkspace workspace(ws);
-        err = aclnnDot(workspace.get(), ws, exec, nullptr);
+        err = aclnnDot(workspace.get(), ws, exec, cann::CurrentStream());
         ACLNN_CHECK(err, "aclnnDot");
-        err = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(err, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnDot");
         LOG_INFO("aclnnMatmul completed");
         return out;
     }
@@ -75,13 +77,12 @@ NPUArray Matmul(const NPUArray& x1, const NPUArray& x2) {
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnMatmulGetWorkspaceSize(x1.tensorPtr, x2.tensorPtr, result.tensorPtr, use_fp16, &workspaceSize, &executor);
+        aclnnMatmulGetWorkspaceSize(x1.tensor(), x2.tensor(), result.tensor(), use_fp16, &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnMatmulGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnMatmul(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnMatmul(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnMatmul");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnMatmul");
     LOG_INFO("aclnnMatmul completed");
     return result;
 }
@@ -91,7 +92,7 @@ NPUArray Einsum(const char* subscripts, const std::vector<NPUArray>& operands) {
               detail::FormatShape(operands[0].shape), detail::FormatShape(operands[1].shape),
               AclDtypeName(operands[0].aclDtype));
     // aclnnEinsum currently supports only 'abcd,abced->abce' and 'a,b->ab'(outer); implement as two operands
-    std::vector<aclTensor*> tmp{operands[0].tensorPtr, operands[1].tensorPtr};
+    std::vector<aclTensor*> tmp{operands[0].tensor(), operands[1].tensor()};
     auto input = aclCreateTensorList(tmp.data(), tmp.size());
     // einsum output shape handling
     std::vector<int64_t> shape;
@@ -103,13 +104,12 @@ NPUArray Einsum(const char* subscripts, const std::vector<NPUArray>& operands) {
     auto result = NPUArray(shape, operands[0].dtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnEinsumGetWorkspaceSize(input, subscripts, result.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnEinsumGetWorkspaceSize(input, subscripts, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnEinsumGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnEinsum(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnEinsum(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnEinsum");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnEinsum");
     LOG_INFO("aclnnEinsum completed");
     return result;
 }
@@ -125,13 +125,12 @@ NPUArray Matrix_power(const NPUArray& a, int64_t n) {
     if (n == 0) {
         uint64_t workspaceSize = 0;
         aclOpExecutor* executor;
-        auto error = aclnnEyeGetWorkspaceSize(shape[0], shape[1], result.tensorPtr, &workspaceSize, &executor);
+        auto error = aclnnEyeGetWorkspaceSize(shape[0], shape[1], result.tensor(), &workspaceSize, &executor);
         ACLNN_CHECK(error, "aclnnEyeGetWorkspaceSize");
         AclWorkspace workspace(workspaceSize);
-        error = aclnnEye(workspace.get(), workspaceSize, executor, nullptr);
+        error = aclnnEye(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(error, "aclnnEye");
-        error = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnEye");
         LOG_INFO("aclnnMatmul completed");
         return result;
     }
@@ -140,13 +139,12 @@ NPUArray Matrix_power(const NPUArray& a, int64_t n) {
         absn = -n;
         uint64_t workspaceSize1 = 0;
         aclOpExecutor* executor1;
-        auto error1 = aclnnInverseGetWorkspaceSize(a.tensorPtr, temp.tensorPtr, &workspaceSize1, &executor1);
+        auto error1 = aclnnInverseGetWorkspaceSize(a.tensor(), temp.tensor(), &workspaceSize1, &executor1);
         ACLNN_CHECK(error1, "aclnnInverseGetWorkspaceSize");
         AclWorkspace workspace1(workspaceSize1);
-        error1 = aclnnInverse(workspace1.get(), workspaceSize1, executor1, nullptr);
+        error1 = aclnnInverse(workspace1.get(), workspaceSize1, executor1, cann::CurrentStream());
         ACLNN_CHECK(error1, "aclnnInverse");
-        error1 = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnInverse");
         ax = NPUArray(temp);
     } else {
         absn = n;
@@ -164,28 +162,27 @@ NPUArray Matrix_power(const NPUArray& a, int64_t n) {
         int8_t use_fp16 = 2;
         uint64_t workspaceSize2 = 0;
         aclOpExecutor* executor2;
-        auto error2 = aclnnMatmulGetWorkspaceSize(temp.tensorPtr, ax.tensorPtr, x.tensorPtr, use_fp16, &workspaceSize2,
-                                                  &executor2);
+        // std::as_const: temp and ax may be copy-on-write copies of `a`, and are only read here.
+        auto error2 = aclnnMatmulGetWorkspaceSize(std::as_const(temp).tensor(), std::as_const(ax).tensor(), x.tensor(),
+                                                  use_fp16, &workspaceSize2, &executor2);
         ACLNN_CHECK(error2, "aclnnMatmulGetWorkspaceSize");
         AclWorkspace workspace2(workspaceSize2);
-        error2 = aclnnMatmul(workspace2.get(), workspaceSize2, executor2, nullptr);
+        error2 = aclnnMatmul(workspace2.get(), workspaceSize2, executor2, cann::CurrentStream());
         ACLNN_CHECK(error2, "aclnnMatmul");
-        error2 = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error2, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnMatmul");
         temp = std::move(x);
     }
 
     int8_t use_fp16 = 2;
     uint64_t workspaceSize2 = 0;
     aclOpExecutor* executor2;
-    auto error2 = aclnnMatmulGetWorkspaceSize(temp.tensorPtr, ax.tensorPtr, result.tensorPtr, use_fp16, &workspaceSize2,
-                                              &executor2);
+    auto error2 = aclnnMatmulGetWorkspaceSize(std::as_const(temp).tensor(), std::as_const(ax).tensor(), result.tensor(),
+                                              use_fp16, &workspaceSize2, &executor2);
     ACLNN_CHECK(error2, "aclnnMatmulGetWorkspaceSize");
     AclWorkspace workspace2(workspaceSize2);
-    error2 = aclnnMatmul(workspace2.get(), workspaceSize2, executor2, nullptr);
+    error2 = aclnnMatmul(workspace2.get(), workspaceSize2, executor2, cann::CurrentStream());
     ACLNN_CHECK(error2, "aclnnMatmul");
-    error2 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error2, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnMatmul");
     LOG_INFO("aclnnMatmul completed");
     return result;
 }
@@ -206,7 +203,7 @@ NPUArray dot(const NPUArray& a, const NPUArray& b) {
                 return aclnnDotGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
             },
             [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-                return aclnnDot(workspace, workspaceSize, executor, nullptr);
+                return aclnnDot(workspace, workspaceSize, executor, stream);
             },
             "dot", "aclnnDot");
     }
@@ -216,16 +213,15 @@ NPUArray dot(const NPUArray& a, const NPUArray& b) {
         auto out = NPUArray({}, a.dtype);
         uint64_t workspaceSize = 0;
         aclOpExecutor* executor = nullptr;
-        auto error = aclnnDotGetWorkspaceSize(a.tensorPtr, b.tensorPtr, out.tensorPtr, &workspaceSize, &executor);
+        auto error = aclnnDotGetWorkspaceSize(a.tensor(), b.tensor(), out.tensor(), &workspaceSize, &executor);
         ACLNN_CHECK(error, "aclnnDotGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
 
-        error = aclnnDot(workspace.get(), workspaceSize, executor, nullptr);
+        error = aclnnDot(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(error, "aclnnDot");
 
-        error = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnDot");
 
         LOG_INFO("aclnnDot completed");
         return out;
@@ -240,16 +236,15 @@ NPUArray dot(const NPUArray& a, const NPUArray& b) {
         aclOpExecutor* executor = nullptr;
         int8_t cubeMathType = 0; // KEEP_DTYPE
         auto error =
-            aclnnMmGetWorkspaceSize(a.tensorPtr, b.tensorPtr, out.tensorPtr, cubeMathType, &workspaceSize, &executor);
+            aclnnMmGetWorkspaceSize(a.tensor(), b.tensor(), out.tensor(), cubeMathType, &workspaceSize, &executor);
         ACLNN_CHECK(error, "aclnnMmGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
 
-        error = aclnnMm(workspace.get(), workspaceSize, executor, nullptr);
+        error = aclnnMm(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(error, "aclnnMm");
 
-        error = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnMm");
 
         LOG_INFO("aclnnDot completed");
         return out;
@@ -281,13 +276,13 @@ NPUArray vdot(const NPUArray& a, const NPUArray& b) {
     {
         uint64_t workspaceSize = 0;
         aclOpExecutor* executor = nullptr;
-        ret = aclnnFlattenGetWorkspaceSize(a.tensorPtr, 0, a_flat.tensorPtr, &workspaceSize, &executor);
+        ret = aclnnFlattenGetWorkspaceSize(a.tensor(), 0, a_flat.tensor(), &workspaceSize, &executor);
         ACLNN_CHECK(ret, "aclnnFlattenGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
 
         // Pass nullptr for the stream, as in the dot function
-        ret = aclnnFlatten(workspace.get(), workspaceSize, executor, nullptr);
+        ret = aclnnFlatten(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(ret, "aclnnFlatten");
     }
 
@@ -295,13 +290,13 @@ NPUArray vdot(const NPUArray& a, const NPUArray& b) {
     {
         uint64_t workspaceSize = 0;
         aclOpExecutor* executor = nullptr;
-        ret = aclnnFlattenGetWorkspaceSize(b.tensorPtr, 0, b_flat.tensorPtr, &workspaceSize, &executor);
+        ret = aclnnFlattenGetWorkspaceSize(b.tensor(), 0, b_flat.tensor(), &workspaceSize, &executor);
         ACLNN_CHECK(ret, "aclnnFlattenGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
 
         // Pass nullptr for the stream
-        ret = aclnnFlatten(workspace.get(), workspaceSize, executor, nullptr);
+        ret = aclnnFlatten(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(ret, "aclnnFlatten");
     }
 
@@ -334,13 +329,13 @@ NPUArray vdot(const NPUArray& a, const NPUArray& b) {
     {
         uint64_t workspaceSize = 0;
         aclOpExecutor* executor = nullptr;
-        ret = aclnnDotGetWorkspaceSize(a_1d_view, b_1d_view, out.tensorPtr, &workspaceSize, &executor);
+        ret = aclnnDotGetWorkspaceSize(a_1d_view, b_1d_view, out.tensor(), &workspaceSize, &executor);
         ACLNN_CHECK(ret, "aclnnDotGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
 
         // Pass nullptr for the stream
-        ret = aclnnDot(workspace.get(), workspaceSize, executor, nullptr);
+        ret = aclnnDot(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(ret, "aclnnDot");
     }
 
@@ -349,8 +344,7 @@ NPUArray vdot(const NPUArray& a, const NPUArray& b) {
     aclDestroyTensor(b_1d_view);
 
     // Synchronize the device to wait for computation to complete, as in the dot function
-    ret = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(ret, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnDot");
     LOG_INFO("aclnnDot completed");
     return out;
 }
@@ -368,16 +362,15 @@ NPUArray inner(const NPUArray& a, const NPUArray& b) {
 
         uint64_t workspaceSize = 0;
         aclOpExecutor* executor = nullptr;
-        auto error = aclnnDotGetWorkspaceSize(a.tensorPtr, b.tensorPtr, out.tensorPtr, &workspaceSize, &executor);
+        auto error = aclnnDotGetWorkspaceSize(a.tensor(), b.tensor(), out.tensor(), &workspaceSize, &executor);
         ACLNN_CHECK(error, "aclnnDotGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
 
-        error = aclnnDot(workspace.get(), workspaceSize, executor, nullptr);
+        error = aclnnDot(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(error, "aclnnDot");
 
-        error = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnDot");
         LOG_INFO("aclnnDot completed");
         return out;
     }
@@ -391,16 +384,15 @@ NPUArray inner(const NPUArray& a, const NPUArray& b) {
         aclOpExecutor* executor = nullptr;
         int8_t cubeMathType = 0; // KEEP_DTYPE
         auto error =
-            aclnnMmGetWorkspaceSize(a.tensorPtr, b.tensorPtr, out.tensorPtr, cubeMathType, &workspaceSize, &executor);
+            aclnnMmGetWorkspaceSize(a.tensor(), b.tensor(), out.tensor(), cubeMathType, &workspaceSize, &executor);
         ACLNN_CHECK(error, "aclnnMmGetWorkspaceSize");
 
         AclWorkspace workspace(workspaceSize);
 
-        error = aclnnMm(workspace.get(), workspaceSize, executor, nullptr);
+        error = aclnnMm(workspace.get(), workspaceSize, executor, cann::CurrentStream());
         ACLNN_CHECK(error, "aclnnMm");
 
-        error = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+        ACL_OP_LAUNCHED("aclnnMm");
         LOG_INFO("aclnnDot completed");
         return out;
     }
@@ -421,12 +413,12 @@ NPUArray outer(const NPUArray& a, const NPUArray& b) {
     {
         uint64_t ws = 0;
         aclOpExecutor* exec = nullptr;
-        auto err = aclnnFlattenGetWorkspaceSize(a.tensorPtr, 1, a_flat.tensorPtr, &ws, &exec);
+        auto err = aclnnFlattenGetWorkspaceSize(a.tensor(), 1, a_flat.tensor(), &ws, &exec);
         ACLNN_CHECK(err, "aclnnFlattenGetWorkspaceSize");
 
         AclWorkspace workspace(ws);
 
-        err = aclnnFlatten(workspace.get(), ws, exec, nullptr);
+        err = aclnnFlatten(workspace.get(), ws, exec, cann::CurrentStream());
         ACLNN_CHECK(err, "aclnnFlatten");
     }
 
@@ -435,12 +427,12 @@ NPUArray outer(const NPUArray& a, const NPUArray& b) {
     {
         uint64_t ws = 0;
         aclOpExecutor* exec = nullptr;
-        auto err = aclnnFlattenGetWorkspaceSize(b.tensorPtr, 0, b_flat.tensorPtr, &ws, &exec);
+        auto err = aclnnFlattenGetWorkspaceSize(b.tensor(), 0, b_flat.tensor(), &ws, &exec);
         ACLNN_CHECK(err, "aclnnFlattenGetWorkspaceSize");
 
         AclWorkspace workspace(ws);
 
-        err = aclnnFlatten(workspace.get(), ws, exec, nullptr);
+        err = aclnnFlatten(workspace.get(), ws, exec, cann::CurrentStream());
         ACLNN_CHECK(err, "aclnnFlatten");
     }
 
@@ -452,17 +444,16 @@ NPUArray outer(const NPUArray& a, const NPUArray& b) {
     {
         uint64_t ws = 0;
         aclOpExecutor* exec = nullptr;
-        auto err = aclnnMulGetWorkspaceSize(a_flat.tensorPtr, b_flat.tensorPtr, out.tensorPtr, &ws, &exec);
+        auto err = aclnnMulGetWorkspaceSize(a_flat.tensor(), b_flat.tensor(), out.tensor(), &ws, &exec);
         ACLNN_CHECK(err, "aclnnMulGetWorkspaceSize");
 
         AclWorkspace workspace(ws);
 
-        err = aclnnMul(workspace.get(), ws, exec, nullptr);
+        err = aclnnMul(workspace.get(), ws, exec, cann::CurrentStream());
         ACLNN_CHECK(err, "aclnnMul");
     }
 
-    auto err = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(err, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnMul");
 
     LOG_INFO("aclnnMul completed");
     return out;
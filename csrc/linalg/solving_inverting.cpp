@@ -76,7 +76,7 @@ NPUArray Linalg_Inv(const NPUArray& a) {
             return aclnnInverseGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnInverse(workspace, workspaceSize, executor, nullptr);
+            return aclnnInverse(workspace, workspaceSize, executor, stream);
         },
         "Linalg_Inv", "aclnnInverse");
 }
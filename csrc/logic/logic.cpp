@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/logic/logic.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -46,31 +48,6 @@
 
 namespace asnumpy {
 
-/**
- * @brief Create aclScalar object for scalar comparison operations
- *
- * Determine the target scalar dtype from the input array dtype and an optional
- * output dtype, then create an aclScalar using CreateScalar.
- *
- * @param x1 Input array
- * @param scalar Python scalar object
- * @param dtype Optional output data type
- * @return aclScalar* Created scalar object
- */
-static aclScalar* CreateScalarForComparison(const NPUArray& x1, const py::object& scalar,
-                                            std::optional<py::dtype> dtype) {
-
-    // determine scalar dtype: use specified dtype if provided, otherwise use input array dtype
-    aclDataType scalar_dtype;
-    if (dtype.has_value()) {
-        scalar_dtype = NPUArray::GetACLDataType(*dtype);
-    } else {
-        scalar_dtype = x1.aclDtype;
-    }
-
-    return CreateScalar(scalar, scalar_dtype);
-}
-
 /// Reduce array by logical AND operation over all elements.
 NPUArray All(const NPUArray& x) {
     LOG_DEBUG("aclnnAll start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(x.shape), x.tensorSize,
@@ -87,18 +64,17 @@ NPUArray All(const NPUArray& x) {
         throw std::runtime_error(fmt::format("[logic.cpp]({}) failed to create empty aclIntArray", __func__));
     }
 
-    auto error = aclnnAllGetWorkspaceSize(x.tensorPtr, aclDim,
+    auto error = aclnnAllGetWorkspaceSize(x.tensor(), aclDim,
                                           false, // keepdims = false
-                                          result.tensorPtr, &workspaceSize, &executor);
+                                          result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnAllGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnAll(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnAll(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnAll");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnAll");
     aclDestroyIntArray(aclDim);
 
     LOG_INFO("aclnnAll completed");
@@ -133,16 +109,15 @@ NPUArray All(const NPUArray& x, const std::vector<int64_t>& dim, bool keepdims)
         throw std::runtime_error(fmt::format("[logic.cpp]({}) failed to create aclIntArray", __func__));
     }
 
-    auto error = aclnnAllGetWorkspaceSize(x.tensorPtr, aclDim, keepdims, result.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnAllGetWorkspaceSize(x.tensor(), aclDim, keepdims, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnAllGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnAll(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnAll(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnAll");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnAll");
     aclDestroyIntArray(aclDim);
 
     LOG_INFO("aclnnAll completed");
@@ -165,18 +140,17 @@ NPUArray Any(const NPUArray& x) {
         throw std::runtime_error("[logic.cpp](Any) failed to create empty aclIntArray");
     }
 
-    auto error = aclnnAnyGetWorkspaceSize(x.tensorPtr, aclDim,
+    auto error = aclnnAnyGetWorkspaceSize(x.tensor(), aclDim,
                                           false, // keepdims = false
-                                          result.tensorPtr, &workspaceSize, &executor);
+                                          result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnAnyGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnAny(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnAny(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnAny");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnAny");
     aclDestroyIntArray(aclDim);
 
     LOG_INFO("aclnnAny completed");
@@ -211,16 +185,15 @@ NPUArray Any(const NPUArray& x, const std::vector<int64_t>& dim, bool keepdims)
         throw std::runtime_error(fmt::format("[logic.cpp]({}) failed to create aclIntArray", __func__));
     }
 
-    auto error = aclnnAnyGetWorkspaceSize(x.tensorPtr, aclDim, keepdims, result.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnAnyGetWorkspaceSize(x.tensor(), aclDim, keepdims, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnAnyGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnAny(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnAny(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnAny");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnAny");
     aclDestroyIntArray(aclDim);
 
     LOG_INFO("aclnnAny completed");
@@ -237,7 +210,7 @@ NPUArray IsFinite(const NPUArray& x) {
             return aclnnIsFiniteGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnIsFinite(workspace, workspaceSize, executor, nullptr);
+            return aclnnIsFinite(workspace, workspaceSize, executor, stream);
         },
         "IsFinite", "aclnnIsFinite");
 }
@@ -251,7 +224,7 @@ NPUArray IsInf(const NPUArray& x) {
             return aclnnIsInfGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnIsInf(workspace, workspaceSize, executor, nullptr);
+            return aclnnIsInf(workspace, workspaceSize, executor, stream);
         },
         "IsInf", "aclnnIsInf");
 }
@@ -265,7 +238,7 @@ NPUArray IsNegInf(const NPUArray& x) {
             return aclnnIsNegInfGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnIsNegInf(workspace, workspaceSize, executor, nullptr);
+            return aclnnIsNegInf(workspace, workspaceSize, executor, stream);
         },
         "IsNegInf", "aclnnIsNegInf");
 }
@@ -279,7 +252,7 @@ NPUArray IsPosInf(const NPUArray& x) {
             return aclnnIsPosInfGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnIsPosInf(workspace, workspaceSize, executor, nullptr);
+            return aclnnIsPosInf(workspace, workspaceSize, executor, stream);
         },
         "IsPosInf", "aclnnIsPosInf");
 }
@@ -293,7 +266,7 @@ NPUArray LogicalAnd(const NPUArray& x, const NPUArray& y) {
             return aclnnLogicalAndGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLogicalAnd(workspace, workspaceSize, executor, nullptr);
+            return aclnnLogicalAnd(workspace, workspaceSize, executor, stream);
         },
         "LogicalAnd", "aclnnLogicalAnd");
 }
@@ -307,7 +280,7 @@ NPUArray LogicalOr(const NPUArray& x, const NPUArray& y) {
             return aclnnLogicalOrGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLogicalOr(workspace, workspaceSize, executor, nullptr);
+            return aclnnLogicalOr(workspace, workspaceSize, executor, stream);
         },
         "LogicalOr", "aclnnLogicalOr");
 }
@@ -321,7 +294,7 @@ NPUArray LogicalNot(const NPUArray& x) {
             return aclnnLogicalNotGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLogicalNot(workspace, workspaceSize, executor, nullptr);
+            return aclnnLogicalNot(workspace, workspaceSize, executor, stream);
         },
         "LogicalNot", "aclnnLogicalNot");
 }
@@ -335,7 +308,7 @@ NPUArray LogicalXor(const NPUArray& x, const NPUArray& y) {
             return aclnnLogicalXorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLogicalXor(workspace, workspaceSize, executor, nullptr);
+            return aclnnLogicalXor(workspace, workspaceSize, executor, stream);
         },
         "LogicalXor", "aclnnLogicalXor");
 }
@@ -349,33 +322,27 @@ NPUArray greater(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype
             return aclnnGtTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnGtTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnGtTensor(workspace, workspaceSize, executor, stream);
         },
         "greater", "aclnnGtTensor");
 }
 
 /// Element-wise greater-than comparison between an array and a scalar.
 NPUArray greater(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnGtScalar start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(x1.shape),
-              x1.tensorSize, AclDtypeName(x1.aclDtype));
-    auto out = NPUArray(x1.shape, dtype.value_or(py::dtype::of<bool>()));
-    aclScalar* acl_scalar = CreateScalarForComparison(x1, scalar, dtype);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error = aclnnGtScalarGetWorkspaceSize(x1.tensorPtr, acl_scalar, out.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnGtScalarGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnGtScalar(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnGtScalar");
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, scalar, dtype.value_or(py::dtype::of<bool>()),
+        [](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnGtScalarGetWorkspaceSize(in, other, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnGtScalar(workspace, workspaceSize, executor, stream);
+        },
+        "greater", "aclnnGtScalar");
+}
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    aclDestroyScalar(acl_scalar);
-    LOG_INFO("aclnnGtScalar completed");
-    return out;
+/// Element-wise greater-than comparison between a scalar and an array (the mirrored array-scalar form).
+NPUArray greater(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype) {
+    return less(x2, scalar, dtype);
 }
 
 /// Element-wise greater-than-or-equal comparison between two arrays.
@@ -387,33 +354,27 @@ NPUArray greater_equal(const NPUArray& x1, const NPUArray& x2, std::optional<py:
             return aclnnGeTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnGeTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnGeTensor(workspace, workspaceSize, executor, stream);
         },
         "greater_equal", "aclnnGeTensor");
 }
 
 /// Element-wise greater-than-or-equal comparison between an array and a scalar.
 NPUArray greater_equal(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnGeScalar start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(x1.shape),
-              x1.tensorSize, AclDtypeName(x1.aclDtype));
-    auto out = NPUArray(x1.shape, dtype.value_or(py::dtype::of<bool>()));
-    aclScalar* acl_scalar = CreateScalarForComparison(x1, scalar, dtype);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error = aclnnGeScalarGetWorkspaceSize(x1.tensorPtr, acl_scalar, out.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnGeScalarGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnGeScalar(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnGeScalar");
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, scalar, dtype.value_or(py::dtype::of<bool>()),
+        [](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnGeScalarGetWorkspaceSize(in, other, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnGeScalar(workspace, workspaceSize, executor, stream);
+        },
+        "greater_equal", "aclnnGeScalar");
+}
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    aclDestroyScalar(acl_scalar);
-    LOG_INFO("aclnnGeScalar completed");
-    return out;
+/// Element-wise greater-than-or-equal comparison between a scalar and an array (the mirrored array-scalar form).
+NPUArray greater_equal(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype) {
+    return less_equal(x2, scalar, dtype);
 }
 
 /// Element-wise less-than comparison between two arrays.
@@ -425,33 +386,27 @@ NPUArray less(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> d
             return aclnnLtTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLtTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnLtTensor(workspace, workspaceSize, executor, stream);
         },
         "less", "aclnnLtTensor");
 }
 
 /// Element-wise less-than comparison between an array and a scalar.
 NPUArray less(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnLtScalar start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(x1.shape),
-              x1.tensorSize, AclDtypeName(x1.aclDtype));
-    auto out = NPUArray(x1.shape, dtype.value_or(py::dtype::of<bool>()));
-    aclScalar* acl_scalar = CreateScalarForComparison(x1, scalar, dtype);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error = aclnnLtScalarGetWorkspaceSize(x1.tensorPtr, acl_scalar, out.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnLtScalarGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnLtScalar(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnLtScalar");
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, scalar, dtype.value_or(py::dtype::of<bool>()),
+        [](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnLtScalarGetWorkspaceSize(in, other, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnLtScalar(workspace, workspaceSize, executor, stream);
+        },
+        "less", "aclnnLtScalar");
+}
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    aclDestroyScalar(acl_scalar);
-    LOG_INFO("aclnnLtScalar completed");
-    return out;
+/// Element-wise less-than comparison between a scalar and an array (the mirrored array-scalar form).
+NPUArray less(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype) {
+    return greater(x2, scalar, dtype);
 }
 
 /// Element-wise less-than-or-equal comparison between two arrays.
@@ -463,33 +418,27 @@ NPUArray less_equal(const NPUArray& x1, const NPUArray& x2, std::optional<py::dt
             return aclnnLeTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLeTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnLeTensor(workspace, workspaceSize, executor, stream);
         },
         "less_equal", "aclnnLeTensor");
 }
 
 /// Element-wise less-than-or-equal comparison between an array and a scalar.
 NPUArray less_equal(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnLeScalar start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(x1.shape),
-              x1.tensorSize, AclDtypeName(x1.aclDtype));
-    auto out = NPUArray(x1.shape, dtype.value_or(py::dtype::of<bool>()));
-    aclScalar* acl_scalar = CreateScalarForComparison(x1, scalar, dtype);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error = aclnnLeScalarGetWorkspaceSize(x1.tensorPtr, acl_scalar, out.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnLeScalarGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnLeScalar(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnLeScalar");
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, scalar, dtype.value_or(py::dtype::of<bool>()),
+        [](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnLeScalarGetWorkspaceSize(in, other, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnLeScalar(workspace, workspaceSize, executor, stream);
+        },
+        "less_equal", "aclnnLeScalar");
+}
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    aclDestroyScalar(acl_scalar);
-    LOG_INFO("aclnnLeScalar completed");
-    return out;
+/// Element-wise less-than-or-equal comparison between a scalar and an array (the mirrored array-scalar form).
+NPUArray less_equal(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype) {
+    return greater_equal(x2, scalar, dtype);
 }
 
 /// Element-wise equality comparison between two arrays.
@@ -501,33 +450,27 @@ NPUArray equal(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype>
             return aclnnEqTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnEqTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnEqTensor(workspace, workspaceSize, executor, stream);
         },
         "equal", "aclnnEqTensor");
 }
 
 /// Element-wise equal comparison between an array and a scalar.
 NPUArray equal(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnEqScalar start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(x1.shape),
-              x1.tensorSize, AclDtypeName(x1.aclDtype));
-    auto out = NPUArray(x1.shape, dtype.value_or(py::dtype::of<bool>()));
-    aclScalar* acl_scalar = CreateScalarForComparison(x1, scalar, dtype);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error = aclnnEqScalarGetWorkspaceSize(x1.tensorPtr, acl_scalar, out.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnEqScalarGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnEqScalar(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnEqScalar");
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, scalar, dtype.value_or(py::dtype::of<bool>()),
+        [](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnEqScalarGetWorkspaceSize(in, other, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnEqScalar(workspace, workspaceSize, executor, stream);
+        },
+        "equal", "aclnnEqScalar");
+}
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    aclDestroyScalar(acl_scalar);
-    LOG_INFO("aclnnEqScalar completed");
-    return out;
+/// Element-wise equal comparison between a scalar and an array (the mirrored array-scalar form).
+NPUArray equal(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype) {
+    return equal(x2, scalar, dtype);
 }
 
 /// Element-wise not-equal comparison between two arrays.
@@ -539,33 +482,27 @@ NPUArray not_equal(const NPUArray& x1, const NPUArray& x2, std::optional<py::dty
             return aclnnNeTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnNeTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnNeTensor(workspace, workspaceSize, executor, stream);
         },
         "not_equal", "aclnnNeTensor");
 }
 
 /// Element-wise not-equal comparison between an array and a scalar.
 NPUArray not_equal(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnNeScalar start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(x1.shape),
-              x1.tensorSize, AclDtypeName(x1.aclDtype));
-    auto out = NPUArray(x1.shape, dtype.value_or(py::dtype::of<bool>()));
-    aclScalar* acl_scalar = CreateScalarForComparison(x1, scalar, dtype);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error = aclnnNeScalarGetWorkspaceSize(x1.tensorPtr, acl_scalar, out.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnNeScalarGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnNeScalar(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnNeScalar");
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, scalar, dtype.value_or(py::dtype::of<bool>()),
+        [](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnNeScalarGetWorkspaceSize(in, other, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnNeScalar(workspace, workspaceSize, executor, stream);
+        },
+        "not_equal", "aclnnNeScalar");
+}
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    aclDestroyScalar(acl_scalar);
-    LOG_INFO("aclnnNeScalar completed");
-    return out;
+/// Element-wise not-equal comparison between a scalar and an array (the mirrored array-scalar form).
+NPUArray not_equal(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype) {
+    return not_equal(x2, scalar, dtype);
 }
 
 } // namespace asnumpy
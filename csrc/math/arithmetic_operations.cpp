@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/math/arithmetic_operations.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -27,6 +29,7 @@
 #include <aclnnop/aclnn_cast.h>
 #include <aclnnop/aclnn_div.h>
 #include <aclnnop/aclnn_exp.h>
+#include <aclnnop/aclnn_fill_scalar.h>
 #include <aclnnop/aclnn_floor.h>
 #include <aclnnop/aclnn_floor_divide.h>
 #include <aclnnop/aclnn_fmod_tensor.h>
@@ -37,31 +40,74 @@
 #include <aclnnop/aclnn_pow_tensor_tensor.h>
 #include <aclnnop/aclnn_reciprocal.h>
 #include <aclnnop/aclnn_remainder.h>
+#include <aclnnop/aclnn_rsub.h>
 #include <aclnnop/aclnn_sub.h>
 #include <aclnnop/aclnn_trunc.h>
 
 #include <fmt/core.h>
 #include <fmt/format.h>
+#include <memory>
 #include <stdexcept>
 
 namespace asnumpy {
 
+namespace {
+
+using ScalarPtr = std::unique_ptr<aclScalar, decltype(&aclDestroyScalar)>;
+
+// alpha = 1 for the Adds/Subs/Rsubs kernels, released even if the launch throws.
+ScalarPtr UnitAlpha(const char* func) {
+    int32_t one = 1;
+    aclScalar* alpha = aclCreateScalar(&one, ACL_INT32);
+    if (!alpha) {
+        throw std::runtime_error(fmt::format("[arithmetic_operations.cpp]({}) Failed to create alpha scalar", func));
+    }
+    return ScalarPtr(alpha, aclDestroyScalar);
+}
+
+// `value` as a 0-d array of `dtype`, for an operand no aclnn kernel takes as a scalar. The fill
+// rounds it to `dtype` once, as NumPy does to a weak scalar.
+NPUArray ScalarArray(const py::object& value, aclDataType dtype) {
+    NPUArray array(std::vector<int64_t>{}, dtype);
+    ScalarPtr scalar(CreateOperandScalar(value, dtype), aclDestroyScalar);
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor = nullptr;
+    auto error = aclnnInplaceFillScalarGetWorkspaceSize(array.tensor(), scalar.get(), &workspaceSize, &executor);
+    ACLNN_CHECK(error, "aclnnInplaceFillScalarGetWorkspaceSize");
+    AclWorkspace workspace(workspaceSize);
+    error = aclnnInplaceFillScalar(workspace.get(), workspaceSize, executor, cann::CurrentStream());
+    ACLNN_CHECK(error, "aclnnInplaceFillScalar");
+    ACL_OP_LAUNCHED("aclnnInplaceFillScalar");
+    return array;
+}
+
+// np.add(a, b, out=a) and friends: out= naming x1 itself is an in-place update.
+bool UpdatesX1(const NPUArray& x1, const std::optional<py::dtype>& dtype, const NPUArray* out) {
+    return out != nullptr && !dtype.has_value() && detail::SameView(*out, x1);
+}
+
+} // namespace
+
 /**
  * @brief Element-wise addition using aclnnAdd.
  */
-NPUArray Add(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype) {
+NPUArray Add(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    if (UpdatesX1(x1, dtype, out)) {
+        InplaceAdd(*out, x2);
+        return *out;
+    }
     LOG_DEBUG("aclnnAdd start: x1_shape={}, x2_shape={}, x1_dtype={}, x2_dtype={}", detail::FormatShape(x1.shape),
               detail::FormatShape(x2.shape), AclDtypeName(x1.aclDtype), AclDtypeName(x2.aclDtype));
 
     // Hand-rolled rather than EXECUTE_BINARY_OP because aclnnAdd takes an alpha scalar, so promote
     // explicitly here. Without this, `add` would keep taking x1's dtype and stay order-dependent.
-    PromotedOperands operands(x1, x2);
+    PromotedOperands operands(x1, x2, "aclnnAdd");
     const NPUArray& a = operands.x1();
     const NPUArray& b = operands.x2();
-    py::dtype out_dtype = dtype.has_value() ? dtype.value() : dtypes::NumpyFromAcl(operands.common());
-
-    auto out_shape = GetBroadcastShape(a, b);
-    auto out = NPUArray(out_shape, out_dtype);
+    const aclDataType out_dtype = dtype.has_value() ? dtypes::AclFromNumpy(dtype.value()) : operands.common();
+    detail::OutputTarget target(out, GetBroadcastShape(a, b), out_dtype, {&x1, &x2}, "aclnnAdd", __FILE__,
+                                __func__);
+    NPUArray& result = target.get();
 
     int32_t one = 1;
     aclScalar* alpha_scalar = aclCreateScalar(&one, ACL_INT32);
@@ -72,21 +118,48 @@ NPUArray Add(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dt
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor = nullptr;
     auto error =
-        aclnnAddGetWorkspaceSize(a.tensorPtr, b.tensorPtr, alpha_scalar, out.tensorPtr, &workspaceSize, &executor);
+        aclnnAddGetWorkspaceSize(a.tensor(), b.tensor(), alpha_scalar, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnAddGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnAdd(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnAdd(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnAdd");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnAdd");
 
     aclDestroyScalar(alpha_scalar);
 
     LOG_INFO("aclnnAdd completed");
-    return out;
+    return target.Finish();
+}
+
+/**
+ * @brief Tensor + scalar using aclnnAdds.
+ */
+NPUArray Add(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    if (UpdatesX1(x1, dtype, out)) {
+        InplaceAdd(*out, x2);
+        return *out;
+    }
+    auto alpha = UnitAlpha(__func__);
+    return EXECUTE_TENSOR_SCALAR_OP_OUT(
+        x1, x2, dtype, out,
+        [&alpha](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize,
+                 aclOpExecutor** executor) {
+            return aclnnAddsGetWorkspaceSize(in, other, alpha.get(), out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnAdds(workspace, workspaceSize, executor, stream);
+        },
+        "Add", "aclnnAdds");
+}
+
+/**
+ * @brief Scalar + tensor (addition commutes, so this is Add(x2, x1)).
+ */
+NPUArray Add(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    return Add(x2, x1, dtype, out);
 }
 
 /**
@@ -100,7 +173,7 @@ NPUArray Reciprocal(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnReciprocalGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnReciprocal(workspace, workspaceSize, executor, nullptr);
+            return aclnnReciprocal(workspace, workspaceSize, executor, stream);
         },
         "Reciprocal", "aclnnReciprocal");
 }
@@ -116,15 +189,15 @@ NPUArray Positive(const NPUArray& x, std::optional<py::dtype> dtype) {
 /**
  * @brief Unary negative operator using aclnnNeg.
  */
-NPUArray Negative(const NPUArray& x, std::optional<py::dtype> dtype) {
+NPUArray Negative(const NPUArray& x, std::optional<py::dtype> dtype, NPUArray* out) {
     auto out_dtype = dtype.value_or(x.dtype);
-    return EXECUTE_UNARY_OP(
-        x, out_dtype,
+    return EXECUTE_UNARY_OP_OUT(
+        x, out_dtype, out,
         [](aclTensor* in, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
             return aclnnNegGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnNeg(workspace, workspaceSize, executor, nullptr);
+            return aclnnNeg(workspace, workspaceSize, executor, stream);
         },
         "Negative", "aclnnNeg");
 }
@@ -132,22 +205,56 @@ NPUArray Negative(const NPUArray& x, std::optional<py::dtype> dtype) {
 /**
  * @brief Element-wise multiplication using aclnnMul.
  */
-NPUArray Multiply(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype) {
-    return EXECUTE_BINARY_OP(
-        x1, x2, dtype,
+NPUArray Multiply(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    if (UpdatesX1(x1, dtype, out)) {
+        InplaceMultiply(*out, x2);
+        return *out;
+    }
+    return EXECUTE_BINARY_OP_OUT(
+        x1, x2, dtype, out,
         [](aclTensor* in1, aclTensor* in2, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
             return aclnnMulGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnMul(workspace, workspaceSize, executor, nullptr);
+            return aclnnMul(workspace, workspaceSize, executor, stream);
         },
         "Multiply", "aclnnMul");
 }
 
+/**
+ * @brief Tensor * scalar using aclnnMuls.
+ */
+NPUArray Multiply(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    if (UpdatesX1(x1, dtype, out)) {
+        InplaceMultiply(*out, x2);
+        return *out;
+    }
+    return EXECUTE_TENSOR_SCALAR_OP_OUT(
+        x1, x2, dtype, out,
+        [](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnMulsGetWorkspaceSize(in, other, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnMuls(workspace, workspaceSize, executor, stream);
+        },
+        "Multiply", "aclnnMuls");
+}
+
+/**
+ * @brief Scalar * tensor (delegates to Multiply(x2, x1)).
+ */
+NPUArray Multiply(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    return Multiply(x2, x1, dtype, out);
+}
+
 /**
  * @brief Element-wise division using aclnnDiv.
  */
-NPUArray Divide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype) {
+NPUArray Divide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    if (UpdatesX1(x1, dtype, out) && dtypes::IsInexact(out->aclDtype)) {
+        InplaceDivide(*out, x2);
+        return *out;
+    }
     // NumPy types true_divide as 'ee->e','ff->f','dd->d','FF->F','DD->D' -- there is no integer
     // loop, so integer operands are cast up to float64 rather than truncated. Promoting both
     // operands here means ExecuteBinaryOp's own promotion is then a no-op.
@@ -156,40 +263,90 @@ NPUArray Divide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype>
         common = ACL_DOUBLE;
     PromotedOperands operands(x1, x2, common);
 
-    return EXECUTE_BINARY_OP(
-        operands.x1(), operands.x2(), dtype.has_value() ? dtype : dtypes::NumpyFromAcl(common),
+    return EXECUTE_BINARY_OP_OUT(
+        operands.x1(), operands.x2(), dtype.has_value() ? dtype : dtypes::NumpyFromAcl(common), out,
         [](aclTensor* in1, aclTensor* in2, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
             return aclnnDivGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnDiv(workspace, workspaceSize, executor, nullptr);
+            return aclnnDiv(workspace, workspaceSize, executor, stream);
         },
         "Divide", "aclnnDiv");
 }
 
+/**
+ * @brief Tensor / scalar using aclnnDivs.
+ */
+NPUArray Divide(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    if (UpdatesX1(x1, dtype, out) && dtypes::IsInexact(out->aclDtype)) {
+        InplaceDivide(*out, x2);
+        return *out;
+    }
+    // No integer loop, as for the tensor overload: widen integer operands to float64 up front, after
+    // which the weak scalar no longer changes the compute type.
+    aclDataType common = WeakScalarResultType(x1.aclDtype, x2);
+    if (!dtypes::IsInexact(common))
+        common = ACL_DOUBLE;
+    return EXECUTE_TENSOR_SCALAR_OP_OUT(
+        CastTo(x1, common), x2, dtype, out,
+        [](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnDivsGetWorkspaceSize(in, other, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnDivs(workspace, workspaceSize, executor, stream);
+        },
+        "Divide", "aclnnDivs");
+}
+
+/**
+ * @brief Scalar / tensor using aclnnDiv.
+ *
+ * aclnn has no scalar-dividend kernel, so the scalar is filled into a 0-d array on the device
+ * (no host upload) and divided as a tensor. reciprocal(x2) * x1 would round twice.
+ */
+NPUArray Divide(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    aclDataType common = WeakScalarResultType(x2.aclDtype, x1);
+    if (!dtypes::IsInexact(common))
+        common = ACL_DOUBLE;
+    return Divide(ScalarArray(x1, common), x2, dtype, out);
+}
+
 /**
  * @brief Element-wise true division (delegates to Divide).
  */
-NPUArray TrueDivide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype) {
-    return Divide(x1, x2, dtype);
+NPUArray TrueDivide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    return Divide(x1, x2, dtype, out);
+}
+
+NPUArray TrueDivide(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    return Divide(x1, x2, dtype, out);
+}
+
+NPUArray TrueDivide(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    return Divide(x1, x2, dtype, out);
 }
 
 /**
  * @brief Element-wise subtraction using aclnnSub.
  */
-NPUArray Subtract(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype) {
+NPUArray Subtract(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    if (UpdatesX1(x1, dtype, out)) {
+        InplaceSubtract(*out, x2);
+        return *out;
+    }
     LOG_DEBUG("aclnnSub start: x1_shape={}, x2_shape={}, x1_dtype={}, x2_dtype={}", detail::FormatShape(x1.shape),
               detail::FormatShape(x2.shape), AclDtypeName(x1.aclDtype), AclDtypeName(x2.aclDtype));
 
     // Hand-rolled because aclnnSub takes an alpha scalar; promote explicitly. See Add.
-    PromotedOperands operands(x1, x2);
+    PromotedOperands operands(x1, x2, "aclnnSub");
     const NPUArray& a = operands.x1();
     const NPUArray& b = operands.x2();
 
-    // 1. compute broadcast output shape
-    auto out_shape = GetBroadcastShape(a, b);
-    auto out_dtype = dtype.has_value() ? dtype.value() : dtypes::NumpyFromAcl(operands.common());
-    auto out = NPUArray(out_shape, out_dtype);
+    // 1. compute broadcast output shape and pick the output
+    const aclDataType out_dtype = dtype.has_value() ? dtypes::AclFromNumpy(dtype.value()) : operands.common();
+    detail::OutputTarget target(out, GetBroadcastShape(a, b), out_dtype, {&x1, &x2}, "aclnnSub", __FILE__,
+                                __func__);
+    NPUArray& result = target.get();
 
     // 2. create alpha = 1 scalar
     int32_t one = 1;
@@ -202,25 +359,201 @@ NPUArray Subtract(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtyp
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor = nullptr;
     auto error =
-        aclnnSubGetWorkspaceSize(a.tensorPtr, b.tensorPtr, alpha_scalar, out.tensorPtr, &workspaceSize, &executor);
+        aclnnSubGetWorkspaceSize(a.tensor(), b.tensor(), alpha_scalar, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnSubGetWorkspaceSize");
 
     // 4. allocate workspace
     AclWorkspace workspace(workspaceSize);
 
     // 5. execute op
-    error = aclnnSub(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnSub(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnSub");
 
     // 6. synchronize
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnSub");
 
     // 7. release resources
     aclDestroyScalar(alpha_scalar);
 
     LOG_INFO("aclnnSub completed");
-    return out;
+    return target.Finish();
+}
+
+/**
+ * @brief Tensor - scalar using aclnnSubs.
+ */
+NPUArray Subtract(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    if (UpdatesX1(x1, dtype, out)) {
+        InplaceSubtract(*out, x2);
+        return *out;
+    }
+    auto alpha = UnitAlpha(__func__);
+    return EXECUTE_TENSOR_SCALAR_OP_OUT(
+        x1, x2, dtype, out,
+        [&alpha](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize,
+                 aclOpExecutor** executor) {
+            return aclnnSubsGetWorkspaceSize(in, other, alpha.get(), out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnSubs(workspace, workspaceSize, executor, stream);
+        },
+        "Subtract", "aclnnSubs");
+}
+
+/**
+ * @brief Scalar - tensor using aclnnRsubs (computes other - alpha * self).
+ */
+NPUArray Subtract(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out) {
+    auto alpha = UnitAlpha(__func__);
+    return EXECUTE_TENSOR_SCALAR_OP_OUT(
+        x2, x1, dtype, out,
+        [&alpha](aclTensor* in, const aclScalar* other, aclTensor* out, uint64_t* workspaceSize,
+                 aclOpExecutor** executor) {
+            return aclnnRsubsGetWorkspaceSize(in, other, alpha.get(), out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnRsubs(workspace, workspaceSize, executor, stream);
+        },
+        "Subtract", "aclnnRsubs");
+}
+
+/**
+ * @brief self += other using aclnnInplaceAdd.
+ */
+void InplaceAdd(NPUArray& self, const NPUArray& other) {
+    auto alpha = UnitAlpha(__func__);
+    EXECUTE_INPLACE_BINARY_OP(
+        self, other,
+        [&alpha](aclTensor* selfRef, aclTensor* other, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnInplaceAddGetWorkspaceSize(selfRef, other, alpha.get(), workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnInplaceAdd(workspace, workspaceSize, executor, stream);
+        },
+        "InplaceAdd", "aclnnInplaceAdd");
+}
+
+/**
+ * @brief self += scalar using aclnnInplaceAdds.
+ */
+void InplaceAdd(NPUArray& self, const py::object& other) {
+    auto alpha = UnitAlpha(__func__);
+    EXECUTE_INPLACE_SCALAR_OP(
+        self, other,
+        [&alpha](aclTensor* selfRef, const aclScalar* other, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnInplaceAddsGetWorkspaceSize(selfRef, other, alpha.get(), workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnInplaceAdds(workspace, workspaceSize, executor, stream);
+        },
+        "InplaceAdd", "aclnnInplaceAdds");
+}
+
+/**
+ * @brief self -= other using aclnnInplaceSub.
+ */
+void InplaceSubtract(NPUArray& self, const NPUArray& other) {
+    auto alpha = UnitAlpha(__func__);
+    EXECUTE_INPLACE_BINARY_OP(
+        self, other,
+        [&alpha](aclTensor* selfRef, aclTensor* other, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnInplaceSubGetWorkspaceSize(selfRef, other, alpha.get(), workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnInplaceSub(workspace, workspaceSize, executor, stream);
+        },
+        "InplaceSubtract", "aclnnInplaceSub");
+}
+
+/**
+ * @brief self -= scalar using aclnnInplaceSubs.
+ */
+void InplaceSubtract(NPUArray& self, const py::object& other) {
+    auto alpha = UnitAlpha(__func__);
+    EXECUTE_INPLACE_SCALAR_OP(
+        self, other,
+        [&alpha](aclTensor* selfRef, const aclScalar* other, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnInplaceSubsGetWorkspaceSize(selfRef, other, alpha.get(), workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnInplaceSubs(workspace, workspaceSize, executor, stream);
+        },
+        "InplaceSubtract", "aclnnInplaceSubs");
+}
+
+/**
+ * @brief self *= other using aclnnInplaceMul.
+ */
+void InplaceMultiply(NPUArray& self, const NPUArray& other) {
+    EXECUTE_INPLACE_BINARY_OP(
+        self, other,
+        [](aclTensor* selfRef, aclTensor* other, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnInplaceMulGetWorkspaceSize(selfRef, other, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnInplaceMul(workspace, workspaceSize, executor, stream);
+        },
+        "InplaceMultiply", "aclnnInplaceMul");
+}
+
+/**
+ * @brief self *= scalar using aclnnInplaceMuls.
+ */
+void InplaceMultiply(NPUArray& self, const py::object& other) {
+    EXECUTE_INPLACE_SCALAR_OP(
+        self, other,
+        [](aclTensor* selfRef, const aclScalar* other, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnInplaceMulsGetWorkspaceSize(selfRef, other, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnInplaceMuls(workspace, workspaceSize, executor, stream);
+        },
+        "InplaceMultiply", "aclnnInplaceMuls");
+}
+
+namespace {
+
+// True division of an integer array cannot be stored back into it ('same_kind' forbids float -> int).
+void CheckInplaceDivide(const NPUArray& self, const char* func) {
+    if (!dtypes::IsInexact(self.aclDtype)) {
+        throw std::invalid_argument(fmt::format("[arithmetic_operations.cpp]({}) cannot divide a {} array in place: "
+                                                "true division yields float64",
+                                                func, AclDtypeName(self.aclDtype)));
+    }
+}
+
+} // namespace
+
+/**
+ * @brief self /= other using aclnnInplaceDiv.
+ */
+void InplaceDivide(NPUArray& self, const NPUArray& other) {
+    CheckInplaceDivide(self, __func__);
+    EXECUTE_INPLACE_BINARY_OP(
+        self, other,
+        [](aclTensor* selfRef, aclTensor* other, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnInplaceDivGetWorkspaceSize(selfRef, other, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnInplaceDiv(workspace, workspaceSize, executor, stream);
+        },
+        "InplaceDivide", "aclnnInplaceDiv");
+}
+
+/**
+ * @brief self /= scalar using aclnnInplaceDivs.
+ */
+void InplaceDivide(NPUArray& self, const py::object& other) {
+    CheckInplaceDivide(self, __func__);
+    EXECUTE_INPLACE_SCALAR_OP(
+        self, other,
+        [](aclTensor* selfRef, const aclScalar* other, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnInplaceDivsGetWorkspaceSize(selfRef, other, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnInplaceDivs(workspace, workspaceSize, executor, stream);
+        },
+        "InplaceDivide", "aclnnInplaceDivs");
 }
 
 /**
@@ -243,19 +576,18 @@ NPUArray FloorDivide(const NPUArray& x1, const NPUArray& x2, std::optional<py::d
     // 2. get workspace
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor = nullptr;
-    auto error = aclnnFloorDivideGetWorkspaceSize(a.tensorPtr, b.tensorPtr, out.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnFloorDivideGetWorkspaceSize(a.tensor(), b.tensor(), out.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnFloorDivideGetWorkspaceSize");
 
     // 3. allocate workspace
     AclWorkspace workspace(workspaceSize);
 
     // 4. execute op
-    error = aclnnFloorDivide(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnFloorDivide(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnFloorDivide");
 
     // 5. synchronize device
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnFloorDivide");
 
     LOG_INFO("aclnnFloorDivide completed");
     return out;
@@ -271,7 +603,7 @@ NPUArray Power(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype>
             return aclnnPowTensorTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnPowTensorTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnPowTensorTensor(workspace, workspaceSize, executor, stream);
         },
         "Power", "aclnnPowTensorTensor");
 }
@@ -280,82 +612,31 @@ NPUArray Power(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype>
  * @brief Scalar ** Tensor power using aclnnPowScalarTensor.
  */
 NPUArray Power(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype) {
-    if (x1.is_none()) {
-        throw std::runtime_error("[arithmetic_operations.cpp](Power ScalarTensor) Input scalar is None");
-    }
-
-    double value = 0;
-    try {
-        value = py::cast<double>(x1);
-    } catch (const py::cast_error& e) {
-        throw std::runtime_error("[arithmetic_operations.cpp](Power ScalarTensor) Conversion error: " +
-                                 std::string(e.what()));
-    }
-
-    LOG_DEBUG("aclnnPowScalarTensor start: scalar={}, x2_shape={}, aclDtype={}", value, detail::FormatShape(x2.shape),
-              AclDtypeName(x2.aclDtype));
-
-    aclScalar* x1_scalar = CreateScalar(value, ACL_FLOAT);
-    auto out = NPUArray(x2.shape, ACL_DOUBLE);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error =
-        aclnnPowScalarTensorGetWorkspaceSize(x1_scalar, x2.tensorPtr, out.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnPowScalarTensorGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnPowScalarTensor(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnPowScalarTensor");
-
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-
-    aclDestroyScalar(x1_scalar);
-    LOG_INFO("aclnnPowScalarTensor completed");
-    return out;
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x2, x1, dtype,
+        [](aclTensor* in, const aclScalar* base, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnPowScalarTensorGetWorkspaceSize(base, in, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnPowScalarTensor(workspace, workspaceSize, executor, stream);
+        },
+        "Power", "aclnnPowScalarTensor");
 }
 
 /**
  * @brief Tensor ** Scalar power using aclnnPowTensorScalar.
  */
 NPUArray Power(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype) {
-    if (x2.is_none()) {
-        throw std::runtime_error("[arithmetic_operations.cpp](Power TensorScalar) Input scalar is None");
-    }
-
-    double value = 0;
-    try {
-        value = py::cast<double>(x2);
-    } catch (const py::cast_error& e) {
-        throw std::runtime_error("[arithmetic_operations.cpp](Power TensorScalar) Conversion error: " +
-                                 std::string(e.what()));
-    }
-
-    LOG_DEBUG("aclnnPowTensorScalar start: x1_shape={}, scalar={}, aclDtype={}", detail::FormatShape(x1.shape), value,
-              AclDtypeName(x1.aclDtype));
-
-    aclScalar* x2_scalar = CreateScalar(value, ACL_FLOAT);
-    auto out = NPUArray(x1.shape, ACL_DOUBLE);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error =
-        aclnnPowTensorScalarGetWorkspaceSize(x1.tensorPtr, x2_scalar, out.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnPowTensorScalarGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnPowTensorScalar(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnPowTensorScalar");
-
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-
-    aclDestroyScalar(x2_scalar);
-    LOG_INFO("aclnnPowTensorScalar completed");
-    return out;
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, x2, dtype,
+        [](aclTensor* in, const aclScalar* exponent, aclTensor* out, uint64_t* workspaceSize,
+           aclOpExecutor** executor) {
+            return aclnnPowTensorScalarGetWorkspaceSize(in, exponent, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnPowTensorScalar(workspace, workspaceSize, executor, stream);
+        },
+        "Power", "aclnnPowTensorScalar");
 }
 
 /**
@@ -373,7 +654,7 @@ NPUArray FloatPower(const NPUArray& x1, const NPUArray& x2, std::optional<py::dt
             return aclnnPowTensorTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnPowTensorTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnPowTensorTensor(workspace, workspaceSize, executor, stream);
         },
         "FloatPower", "aclnnPowTensorTensor");
 }
@@ -392,7 +673,7 @@ NPUArray Fmod(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> d
             return aclnnFmodTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnFmodTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnFmodTensor(workspace, workspaceSize, executor, stream);
         },
         "Fmod", "aclnnFmodTensor");
 }
@@ -441,7 +722,7 @@ NPUArray Mod(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dt
             return aclnnRemainderTensorTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnRemainderTensorTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnRemainderTensorTensor(workspace, workspaceSize, executor, stream);
         },
         "Mod", "aclnnRemainderTensorTensor");
     if (compute != desired)
@@ -465,16 +746,15 @@ std::pair<NPUArray, NPUArray> Modf(const NPUArray& x) {
               x.tensorSize, AclDtypeName(x.aclDtype));
     uint64_t floor_ws = 0;
     aclOpExecutor* floor_exec = nullptr;
-    auto error = aclnnFloorGetWorkspaceSize(x.tensorPtr, int_part.tensorPtr, &floor_ws, &floor_exec);
+    auto error = aclnnFloorGetWorkspaceSize(x.tensor(), int_part.tensor(), &floor_ws, &floor_exec);
     ACLNN_CHECK(error, "aclnnFloorGetWorkspaceSize");
 
     AclWorkspace floor_ws_addr(floor_ws);
 
-    error = aclnnFloor(floor_ws_addr.get(), floor_ws, floor_exec, nullptr);
+    error = aclnnFloor(floor_ws_addr.get(), floor_ws, floor_exec, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnFloor");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnFloor");
     LOG_INFO("aclnnFloor completed");
 
     // === Sub (frac = x - int_part) ===
@@ -488,16 +768,15 @@ std::pair<NPUArray, NPUArray> Modf(const NPUArray& x) {
         throw std::runtime_error("[arithmetic_operations.cpp](Modf) Failed to create alpha scalar");
     }
 
-    error = aclnnSubGetWorkspaceSize(x.tensorPtr, int_part.tensorPtr, alpha, frac_part.tensorPtr, &sub_ws, &sub_exec);
+    error = aclnnSubGetWorkspaceSize(x.tensor(), int_part.tensor(), alpha, frac_part.tensor(), &sub_ws, &sub_exec);
     ACLNN_CHECK(error, "aclnnSubGetWorkspaceSize");
 
     AclWorkspace sub_ws_addr(sub_ws);
 
-    error = aclnnSub(sub_ws_addr.get(), sub_ws, sub_exec, nullptr);
+    error = aclnnSub(sub_ws_addr.get(), sub_ws, sub_exec, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnSub");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnSub");
     LOG_INFO("aclnnSub completed");
 
     aclDestroyScalar(alpha);
@@ -538,12 +817,12 @@ std::pair<NPUArray, NPUArray> Divmod(const NPUArray& x1, const NPUArray& x2, std
     uint64_t ws_size = 0;
     aclOpExecutor* executor = nullptr;
     auto error =
-        aclnnDivModGetWorkspaceSize(a.tensorPtr, b.tensorPtr, /*mode=*/2, quotient.tensorPtr, &ws_size, &executor);
+        aclnnDivModGetWorkspaceSize(a.tensor(), b.tensor(), /*mode=*/2, quotient.tensor(), &ws_size, &executor);
     ACLNN_CHECK(error, "aclnnDivModGetWorkspaceSize");
 
     AclWorkspace ws(ws_size);
 
-    error = aclnnDivMod(ws.get(), ws_size, executor, nullptr);
+    error = aclnnDivMod(ws.get(), ws_size, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnDivMod");
 
     // 4. remainder r = x1 - q * x2
@@ -551,8 +830,7 @@ std::pair<NPUArray, NPUArray> Divmod(const NPUArray& x1, const NPUArray& x2, std
     NPUArray remainder = Subtract(a, qx2, out_dtype);
 
     // 5. synchronize
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnDivMod");
 
     LOG_INFO("aclnnDivMod completed");
     return {quotient, remainder};
@@ -66,7 +66,7 @@ NPUArray Exp(const NPUArray& x) {
             return aclnnExpGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnExp(workspace, workspaceSize, executor, nullptr);
+            return aclnnExp(workspace, workspaceSize, executor, stream);
         },
         "Exp", "aclnnExp");
 }
@@ -78,7 +78,7 @@ NPUArray Expm1(const NPUArray& x) {
             return aclnnExpm1GetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnExpm1(workspace, workspaceSize, executor, nullptr);
+            return aclnnExpm1(workspace, workspaceSize, executor, stream);
         },
         "Expm1", "aclnnExpm1");
 }
@@ -90,7 +90,7 @@ NPUArray Exp2(const NPUArray& x) {
             return aclnnExp2GetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnExp2(workspace, workspaceSize, executor, nullptr);
+            return aclnnExp2(workspace, workspaceSize, executor, stream);
         },
         "Exp2", "aclnnExp2");
 }
@@ -102,7 +102,7 @@ NPUArray Log(const NPUArray& x) {
             return aclnnLogGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLog(workspace, workspaceSize, executor, nullptr);
+            return aclnnLog(workspace, workspaceSize, executor, stream);
         },
         "Log", "aclnnLog");
 }
@@ -114,7 +114,7 @@ NPUArray Log10(const NPUArray& x) {
             return aclnnLog10GetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLog10(workspace, workspaceSize, executor, nullptr);
+            return aclnnLog10(workspace, workspaceSize, executor, stream);
         },
         "Log10", "aclnnLog10");
 }
@@ -126,7 +126,7 @@ NPUArray Log2(const NPUArray& x) {
             return aclnnLog2GetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLog2(workspace, workspaceSize, executor, nullptr);
+            return aclnnLog2(workspace, workspaceSize, executor, stream);
         },
         "Log2", "aclnnLog2");
 }
@@ -138,7 +138,7 @@ NPUArray Log1p(const NPUArray& x) {
             return aclnnLog1pGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLog1p(workspace, workspaceSize, executor, nullptr);
+            return aclnnLog1p(workspace, workspaceSize, executor, stream);
         },
         "Log1p", "aclnnLog1p");
 }
@@ -151,7 +151,7 @@ NPUArray Logaddexp(const NPUArray& x1, const NPUArray& x2) {
             return aclnnLogAddExpGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLogAddExp(workspace, workspaceSize, executor, nullptr);
+            return aclnnLogAddExp(workspace, workspaceSize, executor, stream);
         },
         "Logaddexp", "aclnnLogAddExp");
 }
@@ -164,7 +164,7 @@ NPUArray Logaddexp2(const NPUArray& x1, const NPUArray& x2) {
             return aclnnLogAddExp2GetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnLogAddExp2(workspace, workspaceSize, executor, nullptr);
+            return aclnnLogAddExp2(workspace, workspaceSize, executor, stream);
         },
         "Logaddexp2", "aclnnLogAddExp2");
 }
@@ -14,20 +14,24 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/math/extrema_finding.hpp>
+#include <asnumpy/math/miscellaneous.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
+#include <asnumpy/utils/dtype_promotion.hpp>
 #include <asnumpy/utils/npu_array.hpp>
 #include <asnumpy/utils/npu_ops_macros.hpp>
+#include <asnumpy/utils/reduction.hpp>
 
 #include <aclnnop/aclnn_amax.h>
 #include <aclnnop/aclnn_amin.h>
-#include <aclnnop/aclnn_max.h>
+#include <aclnnop/aclnn_clamp.h>
 #include <aclnnop/aclnn_maximum.h>
-#include <aclnnop/aclnn_min.h>
 #include <aclnnop/aclnn_minimum.h>
-#include <aclnnop/aclnn_nan_to_num.h>
 
+#include <cmath>
 #include <cstdint>
 #include <fmt/core.h>
 #include <fmt/format.h>
@@ -55,7 +59,7 @@ NPUArray Maximum(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype
             return aclnnMaximumGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnMaximum(workspace, workspaceSize, executor, nullptr);
+            return aclnnMaximum(workspace, workspaceSize, executor, stream);
         },
         "Maximum", "aclnnMaximum");
 }
@@ -83,7 +87,7 @@ NPUArray Minimum(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype
             return aclnnMinimumGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnMinimum(workspace, workspaceSize, executor, nullptr);
+            return aclnnMinimum(workspace, workspaceSize, executor, stream);
         },
         "Minimum", "aclnnMinimum");
 }
@@ -95,7 +99,7 @@ NPUArray Fmax(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> d
             return aclnnMaximumGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnMaximum(workspace, workspaceSize, executor, nullptr);
+            return aclnnMaximum(workspace, workspaceSize, executor, stream);
         },
         "Fmax", "aclnnMaximum");
 }
@@ -107,369 +111,152 @@ NPUArray Fmin(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> d
             return aclnnMinimumGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnMinimum(workspace, workspaceSize, executor, nullptr);
+            return aclnnMinimum(workspace, workspaceSize, executor, stream);
         },
         "Fmin", "aclnnMinimum");
 }
 
-NPUArray Max(const NPUArray& a, int64_t axis, bool keepdims) {
-    LOG_DEBUG("aclnnAmax start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
-    auto shape = a.shape;
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
-    }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
-    }
-    std::vector<int64_t> data = {ax};
-    auto axis_array = aclCreateIntArray(data.data(), data.size());
-    auto result = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    auto error =
-        aclnnAmaxGetWorkspaceSize(a.tensorPtr, axis_array, keepdims, result.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnAmaxGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnAmax(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnAmax");
-
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnAmax completed");
-    return result;
+/**
+ * @brief Element-wise maximum of an array and a scalar.
+ *
+ * max(x, s) is a lower clamp, so this is aclnnClampMin with the scalar passed by value; NaN in
+ * either operand propagates as in the array overload.
+ */
+NPUArray Maximum(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype) {
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, x2, dtype,
+        [](aclTensor* in, const aclScalar* bound, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnClampMinGetWorkspaceSize(in, bound, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnClampMin(workspace, workspaceSize, executor, stream);
+        },
+        "Maximum", "aclnnClampMin");
 }
 
-double Max(const NPUArray& a) {
-    LOG_DEBUG("aclnnMax start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape), a.tensorSize,
-              AclDtypeName(a.aclDtype));
-    std::vector<int64_t> shape = {1};
-    auto result = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    auto error = aclnnMaxGetWorkspaceSize(a.tensorPtr, result.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnMaxGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
+NPUArray Maximum(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype) {
+    return Maximum(x2, x1, dtype);
+}
 
-    error = aclnnMax(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnMax");
-
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-
-    py::array x = result.ToNumpy();
-    py::dtype dt = x.dtype();
-    py::buffer_info buf = x.request();
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        LOG_INFO("aclnnMax completed");
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        LOG_INFO("aclnnMax completed");
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        LOG_INFO("aclnnMax completed");
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[extrema_finding.cpp]({}) unsupported dtype", __func__));
-    }
-    return 0;
+/**
+ * @brief Element-wise minimum of an array and a scalar, as an upper clamp (aclnnClampMax).
+ */
+NPUArray Minimum(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype) {
+    return EXECUTE_TENSOR_SCALAR_OP(
+        x1, x2, dtype,
+        [](aclTensor* in, const aclScalar* bound, aclTensor* out, uint64_t* workspaceSize, aclOpExecutor** executor) {
+            return aclnnClampMaxGetWorkspaceSize(in, bound, out, workspaceSize, executor);
+        },
+        [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
+            return aclnnClampMax(workspace, workspaceSize, executor, stream);
+        },
+        "Minimum", "aclnnClampMax");
 }
 
-NPUArray Nanmax(const NPUArray& a, int64_t axis, bool keepdims) {
-    LOG_DEBUG("aclnnNanToNum start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
-    auto shape = a.shape;
-    auto temp = NPUArray(a.shape, a.aclDtype);
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
-    }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
-    }
-    std::vector<int64_t> data = {ax};
-    auto axis_array = aclCreateIntArray(data.data(), data.size());
-    uint64_t workspaceSize1 = 0;
-    aclOpExecutor* executor1;
-    auto error1 = aclnnNanToNumGetWorkspaceSize(
-        a.tensorPtr, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
-        -std::numeric_limits<float>::infinity(), temp.tensorPtr, &workspaceSize1, &executor1);
-    ACLNN_CHECK(error1, "aclnnNanToNumGetWorkspaceSize");
-
-    AclWorkspace workspace1(workspaceSize1);
-
-    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, nullptr);
-    ACLNN_CHECK(error1, "aclnnNanToNum");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnNanToNum completed");
-
-    LOG_DEBUG("aclnnAmax start: input_shape={}, aclDtype={}, axis={}, keepdims={}", detail::FormatShape(temp.shape),
-              AclDtypeName(temp.aclDtype), axis, keepdims);
-    auto result = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    auto error =
-        aclnnAmaxGetWorkspaceSize(temp.tensorPtr, axis_array, keepdims, result.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnAmaxGetWorkspaceSize");
+NPUArray Minimum(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype) {
+    return Minimum(x2, x1, dtype);
+}
 
-    AclWorkspace workspace(workspaceSize);
+/**
+ * @brief Element-wise NaN-ignoring maximum of an array and a scalar.
+ *
+ * NaNs in x1 are first replaced with -inf, which the clamp then lifts to the scalar, so the scalar
+ * is taken exactly. A NaN scalar is ignored and x1 is returned (promoted).
+ */
+NPUArray Fmax(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype) {
+    const aclDataType common = WeakScalarResultType(x1.aclDtype, x2);
+    if (!IsFloatingAclDtype(common))
+        return Maximum(x1, x2, dtype);
+    if (std::isnan(py::cast<double>(x2)))
+        return CastTo(x1, dtype.has_value() ? NPUArray::GetACLDataType(dtype.value()) : common);
+
+    const float inf = std::numeric_limits<float>::infinity();
+    NPUArray filled = Nan_to_num(CastTo(x1, common), -inf, py::float_(inf), py::float_(-inf));
+    return Maximum(filled, x2, dtype);
+}
 
-    error = aclnnAmax(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnAmax");
+NPUArray Fmax(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype) { return Fmax(x2, x1, dtype); }
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnAmax completed");
-    return result;
+/**
+ * @brief Element-wise NaN-ignoring minimum of an array and a scalar; see the Fmax overload.
+ */
+NPUArray Fmin(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype) {
+    const aclDataType common = WeakScalarResultType(x1.aclDtype, x2);
+    if (!IsFloatingAclDtype(common))
+        return Minimum(x1, x2, dtype);
+    if (std::isnan(py::cast<double>(x2)))
+        return CastTo(x1, dtype.has_value() ? NPUArray::GetACLDataType(dtype.value()) : common);
+
+    const float inf = std::numeric_limits<float>::infinity();
+    NPUArray filled = Nan_to_num(CastTo(x1, common), inf, py::float_(inf), py::float_(-inf));
+    return Minimum(filled, x2, dtype);
 }
 
-double Nanmax(const NPUArray& a) {
-    LOG_DEBUG("aclnnNanToNum start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape),
-              a.tensorSize, AclDtypeName(a.aclDtype));
-    auto temp = NPUArray(a.shape, a.aclDtype);
-    uint64_t workspaceSize1 = 0;
-    aclOpExecutor* executor1;
-    auto error1 = aclnnNanToNumGetWorkspaceSize(
-        a.tensorPtr, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
-        -std::numeric_limits<float>::infinity(), temp.tensorPtr, &workspaceSize1, &executor1);
-    ACLNN_CHECK(error1, "aclnnNanToNumGetWorkspaceSize");
-
-    AclWorkspace workspace1(workspaceSize1);
-
-    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, nullptr);
-    ACLNN_CHECK(error1, "aclnnNanToNum");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnNanToNum completed");
-
-    std::vector<int64_t> shape = {1};
-    auto result = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    LOG_DEBUG("aclnnMax start: input_shape={}, aclDtype={}", detail::FormatShape(temp.shape),
-              AclDtypeName(temp.aclDtype));
-    auto error = aclnnMaxGetWorkspaceSize(temp.tensorPtr, result.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnMaxGetWorkspaceSize");
+NPUArray Fmin(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype) { return Fmin(x2, x1, dtype); }
 
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnMax(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnMax");
-
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-
-    py::array x = result.ToNumpy();
-    py::dtype dt = x.dtype();
-    py::buffer_info buf = x.request();
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        LOG_INFO("aclnnMax completed");
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        LOG_INFO("aclnnMax completed");
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        LOG_INFO("aclnnMax completed");
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[extrema_finding.cpp]({}) unsupported dtype", __func__));
-    }
-    return 0;
-}
+namespace {
 
-NPUArray Min(const NPUArray& a, int64_t axis, bool keepdims) {
-    LOG_DEBUG("aclnnAmin start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
-    auto shape = a.shape;
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
-    }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
+/**
+ * @brief aclnnAmax/aclnnAmin over every axis in `axes` at once.
+ */
+NPUArray ReduceExtremum(const NPUArray& a, const std::vector<int64_t>& axes, bool keepdims, bool isMax) {
+    const char* api = isMax ? "aclnnAmax" : "aclnnAmin";
+    const char* sizeApi = isMax ? "aclnnAmaxGetWorkspaceSize" : "aclnnAminGetWorkspaceSize";
+    if (axes.empty()) {
+        return NPUArray(a);
     }
-    std::vector<int64_t> data = {ax};
-    auto axis_array = aclCreateIntArray(data.data(), data.size());
-    auto result = NPUArray(shape, a.aclDtype);
+    LOG_DEBUG("{} start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}", api,
+              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), detail::FormatShape(axes),
+              keepdims);
+    auto dims = MakeAxisArray(axes);
+    auto result = NPUArray(ReducedShape(a.shape, axes, keepdims), a.aclDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error =
-        aclnnAminGetWorkspaceSize(a.tensorPtr, axis_array, keepdims, result.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnAminGetWorkspaceSize");
+    auto error = isMax ? aclnnAmaxGetWorkspaceSize(a.tensor(), dims.get(), keepdims, result.tensor(), &workspaceSize,
+                                                   &executor)
+                       : aclnnAminGetWorkspaceSize(a.tensor(), dims.get(), keepdims, result.tensor(), &workspaceSize,
+                                                   &executor);
+    ACLNN_CHECK(error, sizeApi);
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnAmin(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnAmin");
+    error = isMax ? aclnnAmax(workspace.get(), workspaceSize, executor, cann::CurrentStream())
+                  : aclnnAmin(workspace.get(), workspaceSize, executor, cann::CurrentStream());
+    ACLNN_CHECK(error, api);
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnAmin completed");
+    ACL_OP_LAUNCHED(api);
+    LOG_INFO("{} completed", api);
     return result;
 }
 
-double Min(const NPUArray& a) {
-    LOG_DEBUG("aclnnMin start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape), a.tensorSize,
-              AclDtypeName(a.aclDtype));
-    std::vector<int64_t> shape = {1};
-    auto result = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    auto error = aclnnMinGetWorkspaceSize(a.tensorPtr, result.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnMinGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
+} // namespace
 
-    error = aclnnMin(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnMin");
-
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-
-    py::array x = result.ToNumpy();
-    py::dtype dt = x.dtype();
-    py::buffer_info buf = x.request();
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        LOG_INFO("aclnnMin completed");
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        LOG_INFO("aclnnMin completed");
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        LOG_INFO("aclnnMin completed");
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[extrema_finding.cpp]({}) unsupported dtype", __func__));
-    }
-    return 0;
+NPUArray Max(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims) {
+    return ReduceExtremum(a, ReductionAxes(axis, a.shape.size(), "Max"), keepdims, true);
 }
 
-NPUArray Nanmin(const NPUArray& a, int64_t axis, bool keepdims) {
-    LOG_DEBUG("aclnnNanToNum start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
-    auto shape = a.shape;
-    auto temp = NPUArray(a.shape, a.aclDtype);
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
-    }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
-    }
-    std::vector<int64_t> data = {ax};
-    auto axis_array = aclCreateIntArray(data.data(), data.size());
-    uint64_t workspaceSize1 = 0;
-    aclOpExecutor* executor1;
-    auto error1 = aclnnNanToNumGetWorkspaceSize(
-        a.tensorPtr, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
-        -std::numeric_limits<float>::infinity(), temp.tensorPtr, &workspaceSize1, &executor1);
-    ACLNN_CHECK(error1, "aclnnNanToNumGetWorkspaceSize");
-
-    AclWorkspace workspace1(workspaceSize1);
-
-    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, nullptr);
-    ACLNN_CHECK(error1, "aclnnNanToNum");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnNanToNum completed");
-
-    LOG_DEBUG("aclnnAmin start: input_shape={}, aclDtype={}, axis={}, keepdims={}", detail::FormatShape(temp.shape),
-              AclDtypeName(temp.aclDtype), axis, keepdims);
-    auto result = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    auto error =
-        aclnnAminGetWorkspaceSize(temp.tensorPtr, axis_array, keepdims, result.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnAminGetWorkspaceSize");
+NPUArray Max(const NPUArray& a) { return Max(a, std::nullopt, false); }
 
-    AclWorkspace workspace(workspaceSize);
+NPUArray Nanmax(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims) {
+    auto axes = ReductionAxes(axis, a.shape.size(), "Nanmax");
+    const float inf = std::numeric_limits<float>::infinity();
+    return ReduceExtremum(Nan_to_num(a, -inf, py::float_(inf), py::float_(-inf)), axes, keepdims, true);
+}
 
-    error = aclnnAmin(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnAmin");
+NPUArray Nanmax(const NPUArray& a) { return Nanmax(a, std::nullopt, false); }
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnAmin completed");
-    return result;
+NPUArray Min(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims) {
+    return ReduceExtremum(a, ReductionAxes(axis, a.shape.size(), "Min"), keepdims, false);
 }
 
-double Nanmin(const NPUArray& a) {
-    LOG_DEBUG("aclnnNanToNum start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape),
-              a.tensorSize, AclDtypeName(a.aclDtype));
-    auto temp = NPUArray(a.shape, a.aclDtype);
-    uint64_t workspaceSize1 = 0;
-    aclOpExecutor* executor1;
-    auto error1 = aclnnNanToNumGetWorkspaceSize(
-        a.tensorPtr, -std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(),
-        -std::numeric_limits<float>::infinity(), temp.tensorPtr, &workspaceSize1, &executor1);
-    ACLNN_CHECK(error1, "aclnnNanToNumGetWorkspaceSize");
-
-    AclWorkspace workspace1(workspaceSize1);
-
-    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, nullptr);
-    ACLNN_CHECK(error1, "aclnnNanToNum");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnNanToNum completed");
-
-    std::vector<int64_t> shape = {1};
-    auto result = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    LOG_DEBUG("aclnnMin start: input_shape={}, aclDtype={}", detail::FormatShape(temp.shape),
-              AclDtypeName(temp.aclDtype));
-    auto error = aclnnMinGetWorkspaceSize(temp.tensorPtr, result.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnMinGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
+NPUArray Min(const NPUArray& a) { return Min(a, std::nullopt, false); }
 
-    error = aclnnMin(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnMin");
-
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-
-    py::array x = result.ToNumpy();
-    py::dtype dt = x.dtype();
-    py::buffer_info buf = x.request();
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        LOG_INFO("aclnnMin completed");
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        LOG_INFO("aclnnMin completed");
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        LOG_INFO("aclnnMin completed");
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[extrema_finding.cpp]({}) unsupported dtype", __func__));
-    }
-    return 0;
+NPUArray Nanmin(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims) {
+    auto axes = ReductionAxes(axis, a.shape.size(), "Nanmin");
+    const float inf = std::numeric_limits<float>::infinity();
+    return ReduceExtremum(Nan_to_num(a, inf, py::float_(inf), py::float_(-inf)), axes, keepdims, false);
 }
 
+NPUArray Nanmin(const NPUArray& a) { return Nanmin(a, std::nullopt, false); }
+
 } // namespace asnumpy
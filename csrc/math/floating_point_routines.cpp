@@ -40,7 +40,7 @@ NPUArray Signbit(const NPUArray& x) {
             return aclnnSignbitGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnSignbit(workspace, workspaceSize, executor, nullptr);
+            return aclnnSignbit(workspace, workspaceSize, executor, stream);
         },
         "Signbit", "aclnnSignbit");
 }
@@ -53,7 +53,7 @@ NPUArray Ldexp(const NPUArray& x1, const NPUArray& x2) {
     // participates in promotion -- the output follows x1 alone. But there is no integer loop
     // either, so an integer x1 widens to float64 rather than truncating (ldexp(1, -1) is 0.5, not
     // 0). Pin the output explicitly; otherwise the internal Multiply promotes against pow2, which
-    // Power always produces as float64.
+    // is float64 for integer exponents (a float scalar over an integer array, under NEP 50).
     aclDataType out = dtypes::IsInexact(x1.aclDtype) ? x1.aclDtype : ACL_DOUBLE;
     return Multiply(x1, pow2, dtypes::NumpyFromAcl(out));
 }
@@ -0,0 +1,328 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <asnumpy/array/basic.hpp>
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/dtypes/promote.hpp>
+#include <asnumpy/linalg/norms.hpp>
+#include <asnumpy/math/arithmetic_operations.hpp>
+#include <asnumpy/math/exponents_and_logarithms.hpp>
+#include <asnumpy/math/foreach.hpp>
+#include <asnumpy/math/miscellaneous.hpp>
+#include <asnumpy/utils/acl_resource.hpp>
+#include <asnumpy/utils/dtype_promotion.hpp>
+#include <asnumpy/utils/npu_array.hpp>
+#include <asnumpy/utils/npu_scalar.hpp>
+#include <asnumpy/utils/status_handler.hpp>
+
+#include <acl/acl.h>
+#include <aclnn/aclnn_base.h>
+#include <aclnnop/aclnn_foreach_add_list.h>
+#include <aclnnop/aclnn_foreach_add_scalar.h>
+#include <aclnnop/aclnn_foreach_div_list.h>
+#include <aclnnop/aclnn_foreach_exp.h>
+#include <aclnnop/aclnn_foreach_mul_list.h>
+#include <aclnnop/aclnn_foreach_mul_scalar.h>
+#include <aclnnop/aclnn_foreach_neg.h>
+#include <aclnnop/aclnn_foreach_norm.h>
+#include <aclnnop/aclnn_foreach_sqrt.h>
+#include <aclnnop/aclnn_foreach_sub_list.h>
+
+#include <algorithm>
+#include <fmt/core.h>
+#include <fmt/format.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace asnumpy {
+
+namespace {
+
+using TensorLists = std::vector<aclTensorList*>;
+
+/// GetWorkspaceSize of one Foreach kernel over a chunk: the input lists in operand order, then the output list.
+using WorkspaceFn = std::function<aclnnStatus(const TensorLists&, aclTensorList*, uint64_t*, aclOpExecutor**)>;
+
+using ExecuteFn = aclnnStatus (*)(void*, uint64_t, aclOpExecutor*, aclrtStream);
+
+struct ForeachKernel {
+    std::string api;
+    ExecuteFn execute;
+    /// One 0-d result per array (ForeachNorm) instead of one of the array's shape.
+    bool reduces = false;
+};
+
+/// Whether the Foreach kernels take `x` as a list entry.
+bool Batchable(const NPUArray& x) {
+    return x.tensorSize > 0 && x.IsContiguous() &&
+           (x.aclDtype == ACL_FLOAT || x.aclDtype == ACL_FLOAT16 || x.aclDtype == ACL_BF16);
+}
+
+bool BatchablePair(const NPUArray& a, const NPUArray& b) {
+    return Batchable(a) && Batchable(b) && a.aclDtype == b.aclDtype && a.shape == b.shape;
+}
+
+/**
+ * A descriptor of `x` for a tensor list, which owns (and destroys) its entries; the array's own
+ * descriptor stays with the array. The caller has already fetched x.tensor(), so the launch is
+ * ordered after the array's pending work like any other.
+ */
+aclTensor* ListEntry(const NPUArray& x) {
+    return aclCreateTensor(x.shape.data(), x.shape.size(), x.aclDtype, x.strides.data(), 0, ACL_FORMAT_ND,
+                           x.shape.data(), x.shape.size(), x.device_address());
+}
+
+std::unique_ptr<aclTensorList, decltype(&aclDestroyTensorList)> MakeList(std::vector<aclTensor*>& entries) {
+    return {aclCreateTensorList(entries.data(), entries.size()), aclDestroyTensorList};
+}
+
+void CheckSameLength(const ArrayList& x1, const ArrayList& x2, const char* func) {
+    if (x1.size() != x2.size()) {
+        throw std::invalid_argument(
+            fmt::format("[foreach.cpp]({}) lists differ in length: {} and {}", func, x1.size(), x2.size()));
+    }
+}
+
+/**
+ * Runs `kernel` over every batchable index and `fallback` over the rest.
+ *
+ * Batchable indices are grouped by the dtype of their first operand; `prepare` is called once per
+ * group for the GetWorkspaceSize of that dtype (which owns any scalar operand it needs), and the
+ * group is launched kForeachChunk arrays at a time.
+ */
+std::vector<NPUArray> RunForeach(const ForeachKernel& kernel, const std::vector<const ArrayList*>& operands,
+                                 const std::function<bool(size_t)>& batchable,
+                                 const std::function<WorkspaceFn(aclDataType)>& prepare,
+                                 const std::function<NPUArray(size_t)>& fallback) {
+    const ArrayList& first = *operands.front();
+    for (const ArrayList* operand : operands) {
+        if (std::find(operand->begin(), operand->end(), nullptr) != operand->end()) {
+            throw std::invalid_argument(fmt::format("[foreach.cpp]({}) lists must hold arrays, got None", kernel.api));
+        }
+    }
+    std::vector<std::optional<NPUArray>> results(first.size());
+    std::map<aclDataType, std::vector<size_t>> groups;
+    for (size_t i = 0; i < first.size(); ++i) {
+        if (batchable(i)) {
+            groups[first[i]->aclDtype].push_back(i);
+        } else {
+            results[i] = fallback(i);
+        }
+    }
+
+    for (const auto& [dtype, indices] : groups) {
+        WorkspaceFn getWorkspaceSize = prepare(dtype);
+        for (size_t begin = 0; begin < indices.size(); begin += kForeachChunk) {
+            const size_t end = std::min(begin + kForeachChunk, indices.size());
+            LOG_DEBUG("{} start: dtype={}, arrays={}", kernel.api, AclDtypeName(dtype), end - begin);
+
+            std::vector<std::vector<aclTensor*>> inputEntries(operands.size());
+            std::vector<aclTensor*> outputEntries;
+            for (size_t j = begin; j < end; ++j) {
+                const size_t i = indices[j];
+                for (size_t k = 0; k < operands.size(); ++k) {
+                    const NPUArray& x = *(*operands[k])[i];
+                    x.tensor();
+                    inputEntries[k].push_back(ListEntry(x));
+                }
+                results[i].emplace(kernel.reduces ? std::vector<int64_t>{} : first[i]->shape, dtype);
+                results[i]->tensor();
+                outputEntries.push_back(ListEntry(*results[i]));
+            }
+
+            std::vector<std::unique_ptr<aclTensorList, decltype(&aclDestroyTensorList)>> inputs;
+            TensorLists inputLists;
+            for (auto& entries : inputEntries) {
+                inputs.push_back(MakeList(entries));
+                inputLists.push_back(inputs.back().get());
+            }
+            auto output = MakeList(outputEntries);
+
+            uint64_t workspaceSize = 0;
+            aclOpExecutor* executor = nullptr;
+            auto error = getWorkspaceSize(inputLists, output.get(), &workspaceSize, &executor);
+            ACLNN_CHECK(error, kernel.api + "GetWorkspaceSize");
+
+            AclWorkspace workspace(workspaceSize);
+
+            error = kernel.execute(workspace.get(), workspaceSize, executor, cann::CurrentStream());
+            ACLNN_CHECK(error, kernel.api);
+
+            ACL_OP_LAUNCHED(kernel.api.c_str());
+            LOG_INFO("{} completed", kernel.api);
+        }
+    }
+    std::vector<NPUArray> ordered;
+    ordered.reserve(results.size());
+    for (auto& result : results) {
+        ordered.push_back(std::move(*result));
+    }
+    return ordered;
+}
+
+/// Element-wise binary operator over two lists.
+template <typename GetWorkspaceSize, typename Fallback>
+std::vector<NPUArray> RunBinary(const ArrayList& x1, const ArrayList& x2, const char* func, ForeachKernel kernel,
+                                GetWorkspaceSize getWorkspaceSize, Fallback fallback) {
+    CheckSameLength(x1, x2, func);
+    return RunForeach(
+        kernel, {&x1, &x2}, [&](size_t i) { return BatchablePair(*x1[i], *x2[i]); },
+        [&](aclDataType) -> WorkspaceFn {
+            return [getWorkspaceSize](const TensorLists& in, aclTensorList* out, uint64_t* ws, aclOpExecutor** exec) {
+                return getWorkspaceSize(in[0], in[1], out, ws, exec);
+            };
+        },
+        [&](size_t i) { return fallback(*x1[i], *x2[i]); });
+}
+
+/// Same as RunBinary for aclnnForeachAddList/SubList, which compute x1 + alpha * x2 with a tensor alpha.
+template <typename GetWorkspaceSize, typename Fallback>
+std::vector<NPUArray> RunBinaryAlpha(const ArrayList& x1, const ArrayList& x2, const char* func, ForeachKernel kernel,
+                                     GetWorkspaceSize getWorkspaceSize, Fallback fallback) {
+    CheckSameLength(x1, x2, func);
+    return RunForeach(
+        kernel, {&x1, &x2}, [&](size_t i) { return BatchablePair(*x1[i], *x2[i]); },
+        [&](aclDataType dtype) -> WorkspaceFn {
+            const NPUArray alpha = Full({}, py::int_(1), NPUArray::GetPyDtype(dtype));
+            return [getWorkspaceSize, alpha](const TensorLists& in, aclTensorList* out, uint64_t* ws,
+                                             aclOpExecutor** exec) {
+                return getWorkspaceSize(in[0], in[1], alpha.tensor(), out, ws, exec);
+            };
+        },
+        [&](size_t i) { return fallback(*x1[i], *x2[i]); });
+}
+
+/// Array-scalar operator; only arrays whose dtype the weak scalar leaves unchanged are batched.
+template <typename GetWorkspaceSize, typename Fallback>
+std::vector<NPUArray> RunScalar(const ArrayList& x, const py::object& value, ForeachKernel kernel,
+                                GetWorkspaceSize getWorkspaceSize, Fallback fallback) {
+    return RunForeach(
+        kernel, {&x},
+        [&](size_t i) { return Batchable(*x[i]) && WeakScalarResultType(x[i]->aclDtype, value) == x[i]->aclDtype; },
+        [&](aclDataType dtype) -> WorkspaceFn {
+            const NPUArray scalar = Full({}, value, NPUArray::GetPyDtype(dtype));
+            return [getWorkspaceSize, scalar](const TensorLists& in, aclTensorList* out, uint64_t* ws,
+                                              aclOpExecutor** exec) {
+                return getWorkspaceSize(in[0], scalar.tensor(), out, ws, exec);
+            };
+        },
+        [&](size_t i) { return fallback(*x[i], value); });
+}
+
+template <typename GetWorkspaceSize, typename Fallback>
+std::vector<NPUArray> RunUnary(const ArrayList& x, ForeachKernel kernel, GetWorkspaceSize getWorkspaceSize,
+                               Fallback fallback) {
+    return RunForeach(
+        kernel, {&x}, [&](size_t i) { return Batchable(*x[i]); },
+        [&](aclDataType) -> WorkspaceFn {
+            return [getWorkspaceSize](const TensorLists& in, aclTensorList* out, uint64_t* ws, aclOpExecutor** exec) {
+                return getWorkspaceSize(in[0], out, ws, exec);
+            };
+        },
+        [&](size_t i) { return fallback(*x[i]); });
+}
+
+/// Norm of every element of one array, for the arrays ForeachNorm does not take.
+NPUArray NormAll(const NPUArray& x, double ord) {
+    if (x.aclDtype == ACL_COMPLEX64 || x.aclDtype == ACL_COMPLEX128) {
+        throw std::invalid_argument(fmt::format("[foreach.cpp]({}) complex arrays are not supported, got {}", __func__,
+                                                AclDtypeName(x.aclDtype)));
+    }
+    const aclDataType desired = IsFloatingAclDtype(x.aclDtype) ? x.aclDtype : ACL_DOUBLE;
+    // Linalg_Norm computes in float32 and returns float32; the result is cast to NumPy's dtype.
+    std::vector<int64_t> axes(x.shape.size());
+    std::iota(axes.begin(), axes.end(), 0);
+    NPUArray norm = Linalg_Norm(EnsureAclDtype(x, ACL_FLOAT), ord, axes, false);
+    return EnsureAclDtype(norm, desired);
+}
+
+} // namespace
+
+std::vector<NPUArray> ForeachAdd(const ArrayList& x1, const ArrayList& x2) {
+    return RunBinaryAlpha(x1, x2, __func__, {"aclnnForeachAddList", aclnnForeachAddList},
+                          aclnnForeachAddListGetWorkspaceSize,
+                          [](const NPUArray& a, const NPUArray& b) { return Add(a, b); });
+}
+
+std::vector<NPUArray> ForeachSubtract(const ArrayList& x1, const ArrayList& x2) {
+    return RunBinaryAlpha(x1, x2, __func__, {"aclnnForeachSubList", aclnnForeachSubList},
+                          aclnnForeachSubListGetWorkspaceSize,
+                          [](const NPUArray& a, const NPUArray& b) { return Subtract(a, b); });
+}
+
+std::vector<NPUArray> ForeachMultiply(const ArrayList& x1, const ArrayList& x2) {
+    return RunBinary(x1, x2, __func__, {"aclnnForeachMulList", aclnnForeachMulList},
+                     aclnnForeachMulListGetWorkspaceSize,
+                     [](const NPUArray& a, const NPUArray& b) { return Multiply(a, b); });
+}
+
+std::vector<NPUArray> ForeachDivide(const ArrayList& x1, const ArrayList& x2) {
+    return RunBinary(x1, x2, __func__, {"aclnnForeachDivList", aclnnForeachDivList},
+                     aclnnForeachDivListGetWorkspaceSize,
+                     [](const NPUArray& a, const NPUArray& b) { return Divide(a, b); });
+}
+
+std::vector<NPUArray> ForeachAddScalar(const ArrayList& x, const py::object& value) {
+    return RunScalar(x, value, {"aclnnForeachAddScalar", aclnnForeachAddScalar},
+                     aclnnForeachAddScalarGetWorkspaceSize,
+                     [](const NPUArray& a, const py::object& v) { return Add(a, v); });
+}
+
+std::vector<NPUArray> ForeachMultiplyScalar(const ArrayList& x, const py::object& value) {
+    return RunScalar(x, value, {"aclnnForeachMulScalar", aclnnForeachMulScalar},
+                     aclnnForeachMulScalarGetWorkspaceSize,
+                     [](const NPUArray& a, const py::object& v) { return Multiply(a, v); });
+}
+
+std::vector<NPUArray> ForeachExp(const ArrayList& x) {
+    return RunUnary(x, {"aclnnForeachExp", aclnnForeachExp}, aclnnForeachExpGetWorkspaceSize,
+                    [](const NPUArray& a) { return Exp(a); });
+}
+
+std::vector<NPUArray> ForeachSqrt(const ArrayList& x) {
+    return RunUnary(x, {"aclnnForeachSqrt", aclnnForeachSqrt}, aclnnForeachSqrtGetWorkspaceSize,
+                    [](const NPUArray& a) { return Sqrt(a); });
+}
+
+std::vector<NPUArray> ForeachNegative(const ArrayList& x) {
+    return RunUnary(x, {"aclnnForeachNeg", aclnnForeachNeg}, aclnnForeachNegGetWorkspaceSize,
+                    [](const NPUArray& a) { return Negative(a); });
+}
+
+std::vector<NPUArray> ForeachNorm(const ArrayList& x, double ord) {
+    // aclnnForeachNorm supports the 1- and 2-norms only.
+    const bool batched = ord == 1.0 || ord == 2.0;
+    return RunForeach(
+        {"aclnnForeachNorm", aclnnForeachNorm, /*reduces=*/true}, {&x},
+        [&](size_t i) { return batched && Batchable(*x[i]); },
+        [&](aclDataType) -> WorkspaceFn {
+            std::shared_ptr<aclScalar> p(CreateScalar(static_cast<float>(ord), ACL_FLOAT), aclDestroyScalar);
+            return [p](const TensorLists& in, aclTensorList* out, uint64_t* ws, aclOpExecutor** exec) {
+                return aclnnForeachNormGetWorkspaceSize(in[0], p.get(), out, ws, exec);
+            };
+        },
+        [&](size_t i) { return NormAll(*x[i], ord); });
+}
+
+} // namespace asnumpy
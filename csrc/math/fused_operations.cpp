@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/dtypes/promote.hpp>
+#include <asnumpy/math/fused_operations.hpp>
+#include <asnumpy/utils/acl_executor.hpp>
+#include <asnumpy/utils/acl_resource.hpp>
+#include <asnumpy/utils/dtype_promotion.hpp>
+#include <asnumpy/utils/npu_array.hpp>
+#include <asnumpy/utils/npu_scalar.hpp>
+
+#include <acl/acl.h>
+#include <aclnn/aclnn_base.h>
+#include <aclnnop/aclnn_add.h>
+#include <aclnnop/aclnn_addcmul.h>
+#include <aclnnop/aclnn_lerp.h>
+#include <aclnnop/aclnn_sub.h>
+
+#include <algorithm>
+#include <cmath>
+#include <fmt/core.h>
+#include <fmt/format.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace asnumpy {
+
+namespace {
+
+/// Broadcast result of three operands; GetBroadcastShape only handles pairs of arrays.
+std::vector<int64_t> BroadcastShape3(const NPUArray& a, const NPUArray& b, const NPUArray& c, const char* func) {
+    std::vector<int64_t> lhs = GetBroadcastShape(a, b);
+    const std::vector<int64_t>& rhs = c.shape;
+    const size_t ndim = std::max(lhs.size(), rhs.size());
+    std::vector<int64_t> result(ndim, 1);
+    for (size_t i = 0; i < ndim; ++i) {
+        int64_t dimA = (i < lhs.size()) ? lhs[lhs.size() - 1 - i] : 1;
+        int64_t dimB = (i < rhs.size()) ? rhs[rhs.size() - 1 - i] : 1;
+        if (dimA != dimB && dimA != 1 && dimB != 1) {
+            throw std::invalid_argument(fmt::format(
+                "[fused_operations.cpp]({}) shapes are not broadcastable: dimA={} dimB={} at axis -{}", func, dimA,
+                dimB, i + 1));
+        }
+        result[ndim - 1 - i] = std::max(dimA, dimB);
+    }
+    return result;
+}
+
+/// Scalars for the alpha/value arguments: float operands take float, the rest keep their dtype.
+aclDataType ScalarDtype(aclDataType tensor_dtype) {
+    if (tensor_dtype == ACL_FLOAT16 || tensor_dtype == ACL_BF16) {
+        return ACL_FLOAT;
+    }
+    return tensor_dtype;
+}
+
+} // namespace
+
+NPUArray Addcmul(const NPUArray& input, const NPUArray& tensor1, const NPUArray& tensor2, double value) {
+    LOG_DEBUG("aclnnAddcmul start: input_shape={}, tensor1_shape={}, tensor2_shape={}, value={}",
+              detail::FormatShape(input.shape), detail::FormatShape(tensor1.shape),
+              detail::FormatShape(tensor2.shape), value);
+
+    aclDataType common = ResultType(ResultType(input.aclDtype, tensor1.aclDtype), tensor2.aclDtype);
+    if (!IsFloatingAclDtype(common) && value != std::trunc(value)) {
+        common = ACL_DOUBLE;
+    }
+    NPUArray in = EnsureAclDtype(input, common);
+    NPUArray t1 = EnsureAclDtype(tensor1, common);
+    NPUArray t2 = EnsureAclDtype(tensor2, common);
+    NPUArray out(BroadcastShape3(in, t1, t2, __func__), common);
+
+    aclScalar* value_scalar = CreateScalar(value, ScalarDtype(common));
+
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor = nullptr;
+    auto error = aclnnAddcmulGetWorkspaceSize(in.tensor(), t1.tensor(), t2.tensor(), value_scalar, out.tensor(),
+                                              &workspaceSize, &executor);
+    ACLNN_CHECK(error, "aclnnAddcmulGetWorkspaceSize");
+
+    AclWorkspace workspace(workspaceSize);
+
+    error = aclnnAddcmul(workspace.get(), workspaceSize, executor, cann::CurrentStream());
+    ACLNN_CHECK(error, "aclnnAddcmul");
+
+    ACL_OP_LAUNCHED("aclnnAddcmul");
+
+    aclDestroyScalar(value_scalar);
+
+    LOG_INFO("aclnnAddcmul completed");
+    return out;
+}
+
+NPUArray Lerp(const NPUArray& start, const NPUArray& end, const NPUArray& weight) {
+    LOG_DEBUG("aclnnLerp start: start_shape={}, end_shape={}, weight_shape={}", detail::FormatShape(start.shape),
+              detail::FormatShape(end.shape), detail::FormatShape(weight.shape));
+
+    aclDataType desired =
+        PromoteUnaryFloating(ResultType(ResultType(start.aclDtype, end.aclDtype), weight.aclDtype));
+    ACL_DTYPE_WARN(start.aclDtype, desired, __func__);
+    // aclnnLerp supports float16/float32 only; float64 is computed in float32 and cast back.
+    aclDataType compute = AclComputeFloatingDtype(desired, /*supports_float64=*/false);
+    NPUArray s = EnsureAclDtype(start, compute);
+    NPUArray e = EnsureAclDtype(end, compute);
+    NPUArray w = EnsureAclDtype(weight, compute);
+    NPUArray out(BroadcastShape3(s, e, w, __func__), compute);
+
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor = nullptr;
+    auto error = aclnnLerpGetWorkspaceSize(s.tensor(), e.tensor(), w.tensor(), out.tensor(), &workspaceSize, &executor);
+    ACLNN_CHECK(error, "aclnnLerpGetWorkspaceSize");
+
+    AclWorkspace workspace(workspaceSize);
+
+    error = aclnnLerp(workspace.get(), workspaceSize, executor, cann::CurrentStream());
+    ACLNN_CHECK(error, "aclnnLerp");
+
+    ACL_OP_LAUNCHED("aclnnLerp");
+    LOG_INFO("aclnnLerp completed");
+
+    if (desired != compute) {
+        return CastToDtype(out, desired);
+    }
+    return out;
+}
+
+NPUArray Axpy(const NPUArray& x, const NPUArray& y, const py::object& alpha, bool subtract) {
+    const char* api = subtract ? "aclnnSub" : "aclnnAdd";
+    LOG_DEBUG("{} (axpy) start: x_shape={}, y_shape={}, alpha={}", api, detail::FormatShape(x.shape),
+              detail::FormatShape(y.shape), py::repr(alpha).cast<std::string>());
+
+    // The dtype of the unfused chain: alpha * x promotes under NEP 50, then meets y.
+    aclDataType common = ResultType(WeakScalarResultType(x.aclDtype, alpha), y.aclDtype);
+    NPUArray xs = EnsureAclDtype(x, common);
+    NPUArray ys = EnsureAclDtype(y, common);
+    NPUArray out(GetBroadcastShape(xs, ys), common);
+
+    // aclnnSub takes alpha as well, so y - alpha * x needs no negated (and, unsigned, wrapped) alpha.
+    std::unique_ptr<aclScalar, decltype(&aclDestroyScalar)> alpha_scalar(CreateOperandScalar(alpha, common),
+                                                                         aclDestroyScalar);
+
+    // aclnnAdd/aclnnSub compute self +/- alpha * other, so y is self and x is other.
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor = nullptr;
+    auto error = subtract ? aclnnSubGetWorkspaceSize(ys.tensor(), xs.tensor(), alpha_scalar.get(), out.tensor(),
+                                                     &workspaceSize, &executor)
+                          : aclnnAddGetWorkspaceSize(ys.tensor(), xs.tensor(), alpha_scalar.get(), out.tensor(),
+                                                     &workspaceSize, &executor);
+    ACLNN_CHECK(error, subtract ? "aclnnSubGetWorkspaceSize" : "aclnnAddGetWorkspaceSize");
+
+    AclWorkspace workspace(workspaceSize);
+
+    error = subtract ? aclnnSub(workspace.get(), workspaceSize, executor, cann::CurrentStream())
+                     : aclnnAdd(workspace.get(), workspaceSize, executor, cann::CurrentStream());
+    ACLNN_CHECK(error, api);
+
+    ACL_OP_LAUNCHED(api);
+
+    LOG_INFO("{} (axpy) completed", api);
+    return out;
+}
+
+} // namespace asnumpy
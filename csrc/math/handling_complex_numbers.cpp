@@ -42,7 +42,7 @@ NPUArray Real(const NPUArray& val) {
             return aclnnRealGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnReal(workspace, workspaceSize, executor, nullptr);
+            return aclnnReal(workspace, workspaceSize, executor, stream);
         },
         "Real", "aclnnReal");
 }
@@ -40,7 +40,7 @@ NPUArray Sinh(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnSinhGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnSinh(workspace, workspaceSize, executor, nullptr);
+            return aclnnSinh(workspace, workspaceSize, executor, stream);
         },
         "Sinh", "aclnnSinh", dtype);
 }
@@ -52,7 +52,7 @@ NPUArray Cosh(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnCoshGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnCosh(workspace, workspaceSize, executor, nullptr);
+            return aclnnCosh(workspace, workspaceSize, executor, stream);
         },
         "Cosh", "aclnnCosh", dtype);
 }
@@ -64,7 +64,7 @@ NPUArray Tanh(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnTanhGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnTanh(workspace, workspaceSize, executor, nullptr);
+            return aclnnTanh(workspace, workspaceSize, executor, stream);
         },
         "Tanh", "aclnnTanh", dtype);
 }
@@ -76,7 +76,7 @@ NPUArray Arcsinh(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnAsinhGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnAsinh(workspace, workspaceSize, executor, nullptr);
+            return aclnnAsinh(workspace, workspaceSize, executor, stream);
         },
         "Arcsinh", "aclnnAsinh", dtype);
 }
@@ -88,7 +88,7 @@ NPUArray Arccosh(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnAcoshGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnAcosh(workspace, workspaceSize, executor, nullptr);
+            return aclnnAcosh(workspace, workspaceSize, executor, stream);
         },
         "Arccosh", "aclnnAcosh", dtype);
 }
@@ -100,7 +100,7 @@ NPUArray Arctanh(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnAtanhGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnAtanh(workspace, workspaceSize, executor, nullptr);
+            return aclnnAtanh(workspace, workspaceSize, executor, stream);
         },
         "Arctanh", "aclnnAtanh", dtype);
 }
@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/math/miscellaneous.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -168,17 +170,16 @@ NPUArray Clip(const NPUArray& a, const NPUArray& a_min, const NPUArray& a_max) {
     auto result = NPUArray(broadcast, outType);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnClampTensorGetWorkspaceSize(in_a.tensorPtr, in_min.tensorPtr, in_max.tensorPtr, result.tensorPtr,
+    auto error = aclnnClampTensorGetWorkspaceSize(in_a.tensor(), in_min.tensor(), in_max.tensor(), result.tensor(),
                                                   &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnClampTensorGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnClampTensor(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnClampTensor(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnClampTensor");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnClampTensor");
     LOG_INFO("aclnnClampTensor completed");
     return result;
 }
@@ -195,16 +196,15 @@ NPUArray Clip(const NPUArray& a, float a_min, float a_max) {
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnClampGetWorkspaceSize(a.tensorPtr, amin_scalar, amax_scalar, result.tensorPtr, &workspaceSize, &executor);
+        aclnnClampGetWorkspaceSize(a.tensor(), amin_scalar, amax_scalar, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnClampGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnClamp(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnClamp(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnClamp");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnClamp");
     LOG_INFO("aclnnClamp completed");
     return result;
 }
@@ -223,15 +223,14 @@ NPUArray Clip(const NPUArray& a, float a_min, const NPUArray& a_max) {
     uint64_t workspaceSize1 = 0;
     aclOpExecutor* executor1;
     auto error1 =
-        aclnnClampMinGetWorkspaceSize(in_a.tensorPtr, amin_scalar, temp.tensorPtr, &workspaceSize1, &executor1);
+        aclnnClampMinGetWorkspaceSize(in_a.tensor(), amin_scalar, temp.tensor(), &workspaceSize1, &executor1);
     ACLNN_CHECK(error1, "aclnnClampMinGetWorkspaceSize");
 
     AclWorkspace workspace1(workspaceSize1);
 
-    error1 = aclnnClampMin(workspace1.get(), workspaceSize1, executor1, nullptr);
+    error1 = aclnnClampMin(workspace1.get(), workspaceSize1, executor1, cann::CurrentStream());
     ACLNN_CHECK(error1, "aclnnClampMin");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnClampMin");
     LOG_INFO("aclnnClampMin completed");
 
     NPUArray in_max = EnsureAclDtype(a_max, outType);
@@ -242,7 +241,7 @@ NPUArray Clip(const NPUArray& a, float a_min, const NPUArray& a_max) {
             return aclnnClampMaxTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnClampMaxTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnClampMaxTensor(workspace, workspaceSize, executor, stream);
         },
         "Clip", "aclnnClampMaxTensor");
 }
@@ -261,15 +260,14 @@ NPUArray Clip(const NPUArray& a, const NPUArray& a_min, float a_max) {
     uint64_t workspaceSize1 = 0;
     aclOpExecutor* executor1;
     auto error1 =
-        aclnnClampMaxGetWorkspaceSize(in_a.tensorPtr, amax_scalar, temp.tensorPtr, &workspaceSize1, &executor1);
+        aclnnClampMaxGetWorkspaceSize(in_a.tensor(), amax_scalar, temp.tensor(), &workspaceSize1, &executor1);
     ACLNN_CHECK(error1, "aclnnClampMaxGetWorkspaceSize");
 
     AclWorkspace workspace1(workspaceSize1);
 
-    error1 = aclnnClampMax(workspace1.get(), workspaceSize1, executor1, nullptr);
+    error1 = aclnnClampMax(workspace1.get(), workspaceSize1, executor1, cann::CurrentStream());
     ACLNN_CHECK(error1, "aclnnClampMax");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnClampMax");
     LOG_INFO("aclnnClampMax completed");
 
     NPUArray in_min = EnsureAclDtype(a_min, outType);
@@ -280,7 +278,7 @@ NPUArray Clip(const NPUArray& a, const NPUArray& a_min, float a_max) {
             return aclnnClampMinTensorGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnClampMinTensor(workspace, workspaceSize, executor, nullptr);
+            return aclnnClampMinTensor(workspace, workspaceSize, executor, stream);
         },
         "Clip", "aclnnClampMinTensor");
 }
@@ -299,7 +297,7 @@ NPUArray Sqrt(const NPUArray& x) {
             return aclnnSqrtGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnSqrt(workspace, workspaceSize, executor, nullptr);
+            return aclnnSqrt(workspace, workspaceSize, executor, stream);
         },
         "Sqrt", "aclnnSqrt");
 }
@@ -312,7 +310,7 @@ NPUArray Square(const NPUArray& x) {
             return aclnnMulGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnMul(workspace, workspaceSize, executor, nullptr);
+            return aclnnMul(workspace, workspaceSize, executor, stream);
         },
         "Square", "aclnnMul");
 }
@@ -353,21 +351,20 @@ NPUArray Nan_to_num(const NPUArray& x, float nan, py::object posinf, py::object
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor = nullptr;
 
-    auto error = aclnnNanToNumGetWorkspaceSize(x.tensorPtr,   // input
+    auto error = aclnnNanToNumGetWorkspaceSize(x.tensor(),   // input
                                                nan,           // NaN replacement
                                                pos_val,       // +inf replacement (NaN sentinel means "use default")
                                                neg_val,       // -inf replacement (NaN sentinel means "use default")
-                                               out.tensorPtr, // output
+                                               out.tensor(), // output
                                                &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnNanToNumGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnNanToNum(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnNanToNum(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnNanToNum");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnNanToNum");
 
     LOG_INFO("aclnnNanToNum completed");
 
@@ -393,7 +390,7 @@ NPUArray Relu(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnReluGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnRelu(workspace, workspaceSize, executor, nullptr);
+            return aclnnRelu(workspace, workspaceSize, executor, stream);
         },
         "Relu", "aclnnRelu");
 }
@@ -420,7 +417,7 @@ NPUArray Gelu(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnGeluGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnGelu(workspace, workspaceSize, executor, nullptr);
+            return aclnnGelu(workspace, workspaceSize, executor, stream);
         },
         "Gelu", "aclnnGelu");
 }
@@ -36,7 +36,7 @@ NPUArray Sinc(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnSincGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnSinc(workspace, workspaceSize, executor, nullptr);
+            return aclnnSinc(workspace, workspaceSize, executor, stream);
         },
         "Sinc", "aclnnSinc", dtype);
 }
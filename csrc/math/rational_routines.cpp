@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/math/rational_routines.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -48,15 +50,14 @@ NPUArray Lcm(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dt
     uint64_t mul_workspace_size = 0;
     aclOpExecutor* mul_executor = nullptr;
     auto error =
-        aclnnMulGetWorkspaceSize(a.tensorPtr, b.tensorPtr, product.tensorPtr, &mul_workspace_size, &mul_executor);
+        aclnnMulGetWorkspaceSize(a.tensor(), b.tensor(), product.tensor(), &mul_workspace_size, &mul_executor);
     ACLNN_CHECK(error, "aclnnMulGetWorkspaceSize");
 
     AclWorkspace mul_workspace(mul_workspace_size);
 
-    error = aclnnMul(mul_workspace.get(), mul_workspace_size, mul_executor, nullptr);
+    error = aclnnMul(mul_workspace.get(), mul_workspace_size, mul_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnMul");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnMul");
     LOG_INFO("aclnnMul completed");
 
     // step 2: compute absolute product of x1 and x2 (|a * b|)
@@ -65,15 +66,14 @@ NPUArray Lcm(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dt
     NPUArray abs_product(shape, out_dtype);
     uint64_t abs_workspace_size = 0;
     aclOpExecutor* abs_executor = nullptr;
-    error = aclnnAbsGetWorkspaceSize(product.tensorPtr, abs_product.tensorPtr, &abs_workspace_size, &abs_executor);
+    error = aclnnAbsGetWorkspaceSize(product.tensor(), abs_product.tensor(), &abs_workspace_size, &abs_executor);
     ACLNN_CHECK(error, "aclnnAbsGetWorkspaceSize");
 
     AclWorkspace abs_workspace(abs_workspace_size);
 
-    error = aclnnAbs(abs_workspace.get(), abs_workspace_size, abs_executor, nullptr);
+    error = aclnnAbs(abs_workspace.get(), abs_workspace_size, abs_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnAbs");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnAbs");
     LOG_INFO("aclnnAbs completed");
 
     // step 3: compute GCD of x1 and x2 (GCD(a, b))
@@ -86,7 +86,7 @@ NPUArray Lcm(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dt
             return aclnnDivGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnDiv(workspace, workspaceSize, executor, nullptr);
+            return aclnnDiv(workspace, workspaceSize, executor, stream);
         },
         "Lcm", "aclnnDiv");
 }
@@ -101,7 +101,7 @@ NPUArray Gcd(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dt
             return aclnnGcdGetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnGcd(workspace, workspaceSize, executor, nullptr);
+            return aclnnGcd(workspace, workspaceSize, executor, stream);
         },
         "Gcd", "aclnnGcd");
 }
@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/math/rounding.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -87,22 +89,15 @@ NPUArray Around(const NPUArray& x, int decimals, std::optional<py::dtype> dtype)
 
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor = nullptr;
-    auto error = aclnnRoundDecimalsGetWorkspaceSize(x.tensorPtr, decimals, out.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnRoundDecimalsGetWorkspaceSize(x.tensor(), decimals, out.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnRoundDecimalsGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    aclrtStream stream = nullptr;
-    error = aclrtCreateStream(&stream);
-    if (error != ACL_SUCCESS || stream == nullptr) {
-        throw std::runtime_error("[rounding.cpp](around) Failed to get current stream");
-    }
-
-    error = aclnnRoundDecimals(workspace.get(), workspaceSize, executor, stream);
+    error = aclnnRoundDecimals(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnRoundDecimals");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnRoundDecimals");
     LOG_INFO("aclnnRoundDecimals completed");
     return out;
 }
@@ -123,7 +118,7 @@ NPUArray Rint(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnRoundGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnRound(workspace, workspaceSize, executor, nullptr);
+            return aclnnRound(workspace, workspaceSize, executor, stream);
         },
         "Rint", "aclnnRound");
 }
@@ -136,7 +131,7 @@ NPUArray Fix(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnTruncGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnTrunc(workspace, workspaceSize, executor, nullptr);
+            return aclnnTrunc(workspace, workspaceSize, executor, stream);
         },
         "Fix", "aclnnTrunc");
 }
@@ -148,7 +143,7 @@ NPUArray Floor(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnFloorGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnFloor(workspace, workspaceSize, executor, nullptr);
+            return aclnnFloor(workspace, workspaceSize, executor, stream);
         },
         "Floor", "aclnnFloor");
 }
@@ -160,7 +155,7 @@ NPUArray Ceil(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnCeilGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnCeil(workspace, workspaceSize, executor, nullptr);
+            return aclnnCeil(workspace, workspaceSize, executor, stream);
         },
         "Ceil", "aclnnCeil");
 }
@@ -172,7 +167,7 @@ NPUArray Trunc(const NPUArray& x, std::optional<py::dtype> dtype) {
             return aclnnTruncGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnTrunc(workspace, workspaceSize, executor, nullptr);
+            return aclnnTrunc(workspace, workspaceSize, executor, stream);
         },
         "Trunc", "aclnnTrunc");
 }
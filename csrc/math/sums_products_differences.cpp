@@ -14,17 +14,20 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/math/sums_products_differences.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
+#include <asnumpy/utils/cast.hpp>
 #include <asnumpy/utils/npu_array.hpp>
+#include <asnumpy/utils/reduction.hpp>
 #include <asnumpy/utils/status_handler.hpp>
 
 #include <acl/acl.h>
 #include <aclnn/aclnn_base.h>
 #include <aclnnop/aclnn_cumprod.h>
 #include <aclnnop/aclnn_cumsum.h>
-#include <aclnnop/aclnn_flatten.h>
 #include <aclnnop/aclnn_linalg_cross.h>
 #include <aclnnop/aclnn_nan_to_num.h>
 #include <aclnnop/aclnn_prod.h>
@@ -42,342 +45,145 @@
 #include <stdexcept>
 
 namespace asnumpy {
-NPUArray Prod(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnProdDim start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
-    py::dtype outDtype = dtype.has_value() ? dtype.value() : a.dtype;
-    auto shape = a.shape;
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
-    }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
-    }
-    auto result = NPUArray(shape, outDtype);
+namespace {
+
+NPUArray NanToNum(const NPUArray& a, float nan) {
+    LOG_DEBUG("aclnnNanToNum start: input_shape={}, tensorSize={}, aclDtype={}, nan={}", detail::FormatShape(a.shape),
+              a.tensorSize, AclDtypeName(a.aclDtype), nan);
+    auto temp = NPUArray(a.shape, a.aclDtype);
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor;
+    auto error = aclnnNanToNumGetWorkspaceSize(a.tensor(), nan, std::numeric_limits<float>::infinity(),
+                                               -std::numeric_limits<float>::infinity(), temp.tensor(),
+                                               &workspaceSize, &executor);
+    ACLNN_CHECK(error, "aclnnNanToNumGetWorkspaceSize");
+    AclWorkspace workspace(workspaceSize);
+    error = aclnnNanToNum(workspace.get(), workspaceSize, executor, cann::CurrentStream());
+    ACLNN_CHECK(error, "aclnnNanToNum");
+    ACL_OP_LAUNCHED("aclnnNanToNum");
+    LOG_INFO("aclnnNanToNum completed");
+    return temp;
+}
+
+NPUArray ProdDim(const NPUArray& a, int64_t axis, bool keepdims, aclDataType outDtype) {
+    LOG_DEBUG("aclnnProdDim start: input_shape={}, aclDtype={}, axis={}, keepdims={}", detail::FormatShape(a.shape),
+              AclDtypeName(a.aclDtype), axis, keepdims);
+    auto result = NPUArray(ReducedShape(a.shape, {axis}, keepdims), outDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnProdDimGetWorkspaceSize(a.tensorPtr, axis, keepdims, result.aclDtype, result.tensorPtr,
+    auto error = aclnnProdDimGetWorkspaceSize(a.tensor(), axis, keepdims, result.aclDtype, result.tensor(),
                                               &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnProdDimGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnProdDim(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnProdDim(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnProdDim");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnProdDim");
     LOG_INFO("aclnnProdDim completed");
     return result;
 }
 
-double Prod(const NPUArray& a) {
-    LOG_DEBUG("aclnnProd start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape), a.tensorSize,
-              AclDtypeName(a.aclDtype));
-    std::vector<int64_t> shape = {1};
-    auto result = NPUArray(shape, a.aclDtype);
+} // namespace
+
+NPUArray Prod(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims,
+              std::optional<py::dtype> dtype, const std::optional<NPUArray>& where) {
+    auto axes = ReductionAxes(axis, a.shape.size(), "Prod");
+    const aclDataType outDtype = dtype.has_value() ? NPUArray::GetACLDataType(dtype.value()) : a.aclDtype;
+    const NPUArray input = where.has_value() ? MaskReductionInput(a, *where, 1.0, a.shape) : a;
+    if (axes.empty()) {
+        return CastTo(input, outDtype);
+    }
+    if (axes.size() < a.shape.size()) {
+        // aclnnProdDim takes a single dim; reduce the highest axis first so the lower ones keep their index.
+        NPUArray current = input;
+        for (auto it = axes.rbegin(); it != axes.rend(); ++it) {
+            current = ProdDim(current, *it, keepdims, outDtype);
+        }
+        return current;
+    }
+
+    LOG_DEBUG("aclnnProd start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(input.shape),
+              input.tensorSize, AclDtypeName(input.aclDtype));
+    auto result = NPUArray({1}, outDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnProdGetWorkspaceSize(a.tensorPtr, result.aclDtype, result.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnProdGetWorkspaceSize(input.tensor(), result.aclDtype, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnProdGetWorkspaceSize");
-    void* workspaceAddr = nullptr;
     AclWorkspace workspace(workspaceSize);
-    error = aclnnProd(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnProd(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnProd");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnProd");
     LOG_INFO("aclnnProd completed");
-
-    py::array temp = result.ToNumpy();
-    py::dtype dt = temp.dtype();
-    py::buffer_info buf = temp.request();
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[sums_products_differences.cpp]({}) unsupported dtype", __func__));
+    if (!keepdims) {
+        return ScalarView(result);
     }
-    return 0;
+    auto shape = ReducedShape(a.shape, axes, keepdims);
+    return result.AsStrided(shape, std::vector<int64_t>(shape.size(), 1), result.storageOffset);
 }
 
-NPUArray Sum(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnReduceSum start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
-    py::dtype outDtype = dtype.has_value() ? dtype.value() : a.dtype;
-    auto shape = a.shape;
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
-    }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
+NPUArray Prod(const NPUArray& a) { return Prod(a, std::nullopt); }
+
+NPUArray Sum(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims,
+             std::optional<py::dtype> dtype, const std::optional<NPUArray>& where) {
+    auto axes = ReductionAxes(axis, a.shape.size(), "Sum");
+    const aclDataType outDtype = dtype.has_value() ? NPUArray::GetACLDataType(dtype.value()) : a.aclDtype;
+    const NPUArray input = where.has_value() ? MaskReductionInput(a, *where, 0.0, a.shape) : a;
+    if (axes.empty()) {
+        return CastTo(input, outDtype);
     }
-    std::vector<int64_t> tmp{axis};
-    aclIntArray* axis_array = aclCreateIntArray(tmp.data(), tmp.size());
-    auto result = NPUArray(shape, outDtype);
+    LOG_DEBUG("aclnnReduceSum start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
+              detail::FormatShape(input.shape), input.tensorSize, AclDtypeName(input.aclDtype),
+              detail::FormatShape(axes), keepdims);
+    auto dims = MakeAxisArray(axes);
+    auto result = NPUArray(ReducedShape(a.shape, axes, keepdims), outDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnReduceSumGetWorkspaceSize(a.tensorPtr, axis_array, keepdims, result.aclDtype, result.tensorPtr,
+    auto error = aclnnReduceSumGetWorkspaceSize(input.tensor(), dims.get(), keepdims, result.aclDtype, result.tensor(),
                                                 &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnReduceSumGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnReduceSum(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnReduceSum(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnReduceSum");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnReduceSum");
     LOG_INFO("aclnnReduceSum completed");
     return result;
 }
 
-double Sum(const NPUArray& a) {
-    LOG_DEBUG("aclnnFlatten start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape),
-              a.tensorSize, AclDtypeName(a.aclDtype));
-    std::vector<int64_t> shape = a.shape;
-    int64_t pro = 1;
-    for (int i = 0; i < shape.size(); i++) {
-        pro = pro * shape[i];
-    }
-    shape = {1, pro};
-    auto temp = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize1 = 0;
-    aclOpExecutor* executor1;
-    auto error1 = aclnnFlattenGetWorkspaceSize(a.tensorPtr, 0, temp.tensorPtr, &workspaceSize1, &executor1);
-    ACLNN_CHECK(error1, "aclnnFlattenGetWorkspaceSize");
-    AclWorkspace workspace1(workspaceSize1);
-    error1 = aclnnFlatten(workspace1.get(), workspaceSize1, executor1, nullptr);
-    ACLNN_CHECK(error1, "aclnnFlatten");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnFlatten completed");
-
-    LOG_DEBUG("aclnnReduceSum start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(temp.shape),
-              temp.tensorSize, AclDtypeName(temp.aclDtype));
-    std::vector<int64_t> tmp{1};
-    aclIntArray* axis_array = aclCreateIntArray(tmp.data(), tmp.size());
-    auto result = NPUArray({1}, a.aclDtype);
-    uint64_t workspaceSize2 = 0;
-    aclOpExecutor* executor2;
-    auto error2 = aclnnReduceSumGetWorkspaceSize(temp.tensorPtr, axis_array, false, result.aclDtype, result.tensorPtr,
-                                                 &workspaceSize2, &executor2);
-    ACLNN_CHECK(error2, "aclnnReduceSumGetWorkspaceSize");
-    AclWorkspace workspace2(workspaceSize2);
-    error2 = aclnnReduceSum(workspace2.get(), workspaceSize2, executor2, nullptr);
-    ACLNN_CHECK(error2, "aclnnReduceSum");
-    error2 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error2, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnReduceSum completed");
+NPUArray Sum(const NPUArray& a) { return Sum(a, std::nullopt); }
 
-    py::array x = result.ToNumpy();
-    py::dtype dt = x.dtype();
-    py::buffer_info buf = x.request();
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[sums_products_differences.cpp]({}) unsupported dtype", __func__));
-    }
-    return 0;
+NPUArray Nanprod(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims,
+                 std::optional<py::dtype> dtype, const std::optional<NPUArray>& where) {
+    return Prod(NanToNum(a, 1.0f), axis, keepdims, dtype, where);
 }
 
-NPUArray Nanprod(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnNanToNum start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
-    py::dtype outDtype = dtype.has_value() ? dtype.value() : a.dtype;
-    auto shape = a.shape;
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
-    }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
-    }
-    float scalar = 1.0;
-    auto temp = NPUArray(a.shape, a.aclDtype);
-    auto result = NPUArray(shape, outDtype);
-    uint64_t workspaceSize1 = 0;
-    aclOpExecutor* executor1;
-    auto error1 = aclnnNanToNumGetWorkspaceSize(a.tensorPtr, scalar, std::numeric_limits<float>::infinity(),
-                                                -std::numeric_limits<float>::infinity(), temp.tensorPtr,
-                                                &workspaceSize1, &executor1);
-    ACLNN_CHECK(error1, "aclnnNanToNumGetWorkspaceSize");
-    AclWorkspace workspace1(workspaceSize1);
-    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, nullptr);
-    ACLNN_CHECK(error1, "aclnnNanToNum");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnNanToNum completed");
-
-    uint64_t workspaceSize2 = 0;
-    aclOpExecutor* executor2;
-    LOG_DEBUG("aclnnProdDim start: input_shape={}, aclDtype={}, axis={}, keepdims={}", detail::FormatShape(temp.shape),
-              AclDtypeName(temp.aclDtype), axis, keepdims);
-    auto error2 = aclnnProdDimGetWorkspaceSize(temp.tensorPtr, axis, keepdims, result.aclDtype, result.tensorPtr,
-                                               &workspaceSize2, &executor2);
-    ACLNN_CHECK(error2, "aclnnProdDimGetWorkspaceSize");
-    AclWorkspace workspace2(workspaceSize2);
-    error2 = aclnnProdDim(workspace2.get(), workspaceSize2, executor2, nullptr);
-    ACLNN_CHECK(error2, "aclnnProdDim");
-    error2 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error2, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnProdDim completed");
-    return result;
-}
-
-double Nanprod(const NPUArray& a) {
-    LOG_DEBUG("aclnnNanToNum start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape),
-              a.tensorSize, AclDtypeName(a.aclDtype));
-    std::vector<int64_t> shape = {1};
-    float scalar = 1.0;
-    auto temp = NPUArray(a.shape, a.aclDtype);
-    auto result = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize1 = 0;
-    aclOpExecutor* executor1;
-    auto error1 = aclnnNanToNumGetWorkspaceSize(a.tensorPtr, scalar, std::numeric_limits<float>::infinity(),
-                                                -std::numeric_limits<float>::infinity(), temp.tensorPtr,
-                                                &workspaceSize1, &executor1);
-    ACLNN_CHECK(error1, "aclnnNanToNumGetWorkspaceSize");
-    AclWorkspace workspace1(workspaceSize1);
-    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, nullptr);
-    ACLNN_CHECK(error1, "aclnnNanToNum");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnNanToNum completed");
+NPUArray Nanprod(const NPUArray& a) { return Nanprod(a, std::nullopt); }
 
-    uint64_t workspaceSize2 = 0;
-    aclOpExecutor* executor2;
-    LOG_DEBUG("aclnnProd start: input_shape={}, aclDtype={}", detail::FormatShape(temp.shape),
-              AclDtypeName(temp.aclDtype));
-    auto error2 =
-        aclnnProdGetWorkspaceSize(temp.tensorPtr, result.aclDtype, result.tensorPtr, &workspaceSize2, &executor2);
-    ACLNN_CHECK(error2, "aclnnProdGetWorkspaceSize");
-    AclWorkspace workspace2(workspaceSize2);
-    error2 = aclnnProd(workspace2.get(), workspaceSize2, executor2, nullptr);
-    ACLNN_CHECK(error2, "aclnnProd");
-    error2 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error2, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnProd completed");
-
-    py::array tmp = result.ToNumpy();
-    py::dtype dt = tmp.dtype();
-    py::buffer_info buf = tmp.request();
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[sums_products_differences.cpp]({}) unsupported dtype", __func__));
+NPUArray Nansum(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims,
+                std::optional<py::dtype> dtype, const std::optional<NPUArray>& where) {
+    auto axes = ReductionAxes(axis, a.shape.size(), "Nansum");
+    const aclDataType outDtype = dtype.has_value() ? NPUArray::GetACLDataType(dtype.value()) : a.aclDtype;
+    const NPUArray input = where.has_value() ? MaskReductionInput(a, *where, 0.0, a.shape) : a;
+    if (axes.empty()) {
+        return CastTo(NanToNum(input, 0.0f), outDtype);
     }
-    return 0;
-}
-
-NPUArray Nansum(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype) {
     LOG_DEBUG("aclnnReduceNansum start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
-    py::dtype outDtype = dtype.has_value() ? dtype.value() : a.dtype;
-    auto shape = a.shape;
-    float scalar = 0.0;
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
-    }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
-    }
-    std::vector<int64_t> tmp{axis};
-    aclIntArray* axis_array = aclCreateIntArray(tmp.data(), tmp.size());
-    auto result = NPUArray(shape, outDtype);
+              detail::FormatShape(input.shape), input.tensorSize, AclDtypeName(input.aclDtype),
+              detail::FormatShape(axes), keepdims);
+    auto dims = MakeAxisArray(axes);
+    auto result = NPUArray(ReducedShape(a.shape, axes, keepdims), outDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnReduceNansumGetWorkspaceSize(a.tensorPtr, axis_array, keepdims, result.aclDtype, result.tensorPtr,
-                                                   &workspaceSize, &executor);
+    auto error = aclnnReduceNansumGetWorkspaceSize(input.tensor(), dims.get(), keepdims, result.aclDtype,
+                                                   result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnReduceNansumGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnReduceNansum(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnReduceNansum(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnReduceNansum");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnReduceNansum");
     LOG_INFO("aclnnReduceNansum completed");
     return result;
 }
 
-double Nansum(const NPUArray& a) {
-    LOG_DEBUG("aclnnFlatten start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape),
-              a.tensorSize, AclDtypeName(a.aclDtype));
-    auto shape = a.shape;
-    int64_t pro = 1;
-    for (int i = 0; i < shape.size(); i++) {
-        pro = pro * shape[i];
-    }
-    shape = {1, pro};
-    auto temp = NPUArray(shape, a.aclDtype);
-    uint64_t workspaceSize1 = 0;
-    aclOpExecutor* executor1;
-    auto error1 = aclnnFlattenGetWorkspaceSize(a.tensorPtr, 0, temp.tensorPtr, &workspaceSize1, &executor1);
-    ACLNN_CHECK(error1, "aclnnFlattenGetWorkspaceSize");
-    AclWorkspace workspace1(workspaceSize1);
-    error1 = aclnnFlatten(workspace1.get(), workspaceSize1, executor1, nullptr);
-    ACLNN_CHECK(error1, "aclnnFlatten");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnFlatten completed");
-
-    LOG_DEBUG("aclnnReduceNansum start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(temp.shape),
-              temp.tensorSize, AclDtypeName(temp.aclDtype));
-    std::vector<int64_t> tmp{1};
-    aclIntArray* axis_array = aclCreateIntArray(tmp.data(), tmp.size());
-    auto result = NPUArray({1}, a.aclDtype);
-    uint64_t workspaceSize2 = 0;
-    aclOpExecutor* executor2;
-    auto error2 = aclnnReduceNansumGetWorkspaceSize(temp.tensorPtr, axis_array, false, result.aclDtype,
-                                                    result.tensorPtr, &workspaceSize2, &executor2);
-    ACLNN_CHECK(error2, "aclnnReduceNansumGetWorkspaceSize");
-    AclWorkspace workspace2(workspaceSize2);
-    error2 = aclnnReduceNansum(workspace2.get(), workspaceSize2, executor2, nullptr);
-    ACLNN_CHECK(error2, "aclnnReduceNansum");
-    error2 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error2, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnReduceNansum completed");
-
-    py::array x = result.ToNumpy();
-    py::dtype dt = x.dtype();
-    py::buffer_info buf = x.request();
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[sums_products_differences.cpp]({}) unsupported dtype", __func__));
-    }
-    return 0;
-}
+NPUArray Nansum(const NPUArray& a) { return Nansum(a, std::nullopt); }
 
 NPUArray Cumprod(const NPUArray& a, int64_t axis, std::optional<py::dtype> dtype) {
     LOG_DEBUG("aclnnCumprod start: input_shape={}, tensorSize={}, aclDtype={}, axis={}", detail::FormatShape(a.shape),
@@ -388,14 +194,13 @@ NPUArray Cumprod(const NPUArray& a, int64_t axis, std::optional<py::dtype> dtype
     auto result = NPUArray(shape, outDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnCumprodGetWorkspaceSize(a.tensorPtr, axis_scalar, result.aclDtype, result.tensorPtr,
+    auto error = aclnnCumprodGetWorkspaceSize(a.tensor(), axis_scalar, result.aclDtype, result.tensor(),
                                               &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnCumprodGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnCumprod(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnCumprod(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnCumprod");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnCumprod");
     LOG_INFO("aclnnCumprod completed");
     return result;
 }
@@ -409,13 +214,12 @@ NPUArray Cumsum(const NPUArray& a, int64_t axis, std::optional<py::dtype> dtype)
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnCumsumGetWorkspaceSize(a.tensorPtr, axis, result.aclDtype, result.tensorPtr, &workspaceSize, &executor);
+        aclnnCumsumGetWorkspaceSize(a.tensor(), axis, result.aclDtype, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnCumsumGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnCumsum(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnCumsum(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnCumsum");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnCumsum");
     LOG_INFO("aclnnCumsum completed");
     return result;
 }
@@ -431,29 +235,27 @@ NPUArray Nancumprod(const NPUArray& a, int64_t axis, std::optional<py::dtype> dt
     auto result = NPUArray(shape, outDtype);
     uint64_t workspaceSize1 = 0;
     aclOpExecutor* executor1;
-    auto error1 = aclnnNanToNumGetWorkspaceSize(a.tensorPtr, scalar, std::numeric_limits<float>::infinity(),
-                                                -std::numeric_limits<float>::infinity(), temp.tensorPtr,
+    auto error1 = aclnnNanToNumGetWorkspaceSize(a.tensor(), scalar, std::numeric_limits<float>::infinity(),
+                                                -std::numeric_limits<float>::infinity(), temp.tensor(),
                                                 &workspaceSize1, &executor1);
     ACLNN_CHECK(error1, "aclnnNanToNumGetWorkspaceSize");
     AclWorkspace workspace1(workspaceSize1);
-    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, nullptr);
+    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, cann::CurrentStream());
     ACLNN_CHECK(error1, "aclnnNanToNum");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnNanToNum");
     LOG_INFO("aclnnNanToNum completed");
 
     uint64_t workspaceSize2 = 0;
     aclOpExecutor* executor2;
     LOG_DEBUG("aclnnCumprod start: input_shape={}, aclDtype={}, axis={}", detail::FormatShape(temp.shape),
               AclDtypeName(temp.aclDtype), axis);
-    auto error2 = aclnnCumprodGetWorkspaceSize(temp.tensorPtr, axis_scalar, result.aclDtype, result.tensorPtr,
+    auto error2 = aclnnCumprodGetWorkspaceSize(temp.tensor(), axis_scalar, result.aclDtype, result.tensor(),
                                                &workspaceSize2, &executor2);
     ACLNN_CHECK(error2, "aclnnCumprodGetWorkspaceSize");
     AclWorkspace workspace2(workspaceSize2);
-    error2 = aclnnCumprod(workspace2.get(), workspaceSize2, executor2, nullptr);
+    error2 = aclnnCumprod(workspace2.get(), workspaceSize2, executor2, cann::CurrentStream());
     ACLNN_CHECK(error2, "aclnnCumprod");
-    error2 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error2, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnCumprod");
     LOG_INFO("aclnnCumprod completed");
     return result;
 }
@@ -468,29 +270,27 @@ NPUArray Nancumsum(const NPUArray& a, int64_t axis, std::optional<py::dtype> dty
     auto result = NPUArray(shape, outDtype);
     uint64_t workspaceSize1 = 0;
     aclOpExecutor* executor1;
-    auto error1 = aclnnNanToNumGetWorkspaceSize(a.tensorPtr, scalar, std::numeric_limits<float>::infinity(),
-                                                -std::numeric_limits<float>::infinity(), temp.tensorPtr,
+    auto error1 = aclnnNanToNumGetWorkspaceSize(a.tensor(), scalar, std::numeric_limits<float>::infinity(),
+                                                -std::numeric_limits<float>::infinity(), temp.tensor(),
                                                 &workspaceSize1, &executor1);
     ACLNN_CHECK(error1, "aclnnNanToNumGetWorkspaceSize");
     AclWorkspace workspace1(workspaceSize1);
-    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, nullptr);
+    error1 = aclnnNanToNum(workspace1.get(), workspaceSize1, executor1, cann::CurrentStream());
     ACLNN_CHECK(error1, "aclnnNanToNum");
-    error1 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error1, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnNanToNum");
     LOG_INFO("aclnnNanToNum completed");
 
     uint64_t workspaceSize2 = 0;
     aclOpExecutor* executor2;
     LOG_DEBUG("aclnnCumsum start: input_shape={}, aclDtype={}, axis={}", detail::FormatShape(temp.shape),
               AclDtypeName(temp.aclDtype), axis);
-    auto error2 = aclnnCumsumGetWorkspaceSize(temp.tensorPtr, axis, result.aclDtype, result.tensorPtr, &workspaceSize2,
+    auto error2 = aclnnCumsumGetWorkspaceSize(temp.tensor(), axis, result.aclDtype, result.tensor(), &workspaceSize2,
                                               &executor2);
     ACLNN_CHECK(error2, "aclnnCumsumGetWorkspaceSize");
     AclWorkspace workspace2(workspaceSize2);
-    error2 = aclnnCumsum(workspace2.get(), workspaceSize2, executor2, nullptr);
+    error2 = aclnnCumsum(workspace2.get(), workspaceSize2, executor2, cann::CurrentStream());
     ACLNN_CHECK(error2, "aclnnCumsum");
-    error2 = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error2, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnCumsum");
     LOG_INFO("aclnnCumsum completed");
     return result;
 }
@@ -503,13 +303,12 @@ NPUArray Cross(const NPUArray& a, const NPUArray& b, int64_t axis) {
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnLinalgCrossGetWorkspaceSize(a.tensorPtr, b.tensorPtr, axis, result.tensorPtr, &workspaceSize, &executor);
+        aclnnLinalgCrossGetWorkspaceSize(a.tensor(), b.tensor(), axis, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnLinalgCrossGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnLinalgCross(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnLinalgCross(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnLinalgCross");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnLinalgCross");
     LOG_INFO("aclnnLinalgCross completed");
     return result;
 }
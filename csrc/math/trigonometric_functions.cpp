@@ -14,17 +14,20 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/math/trigonometric_functions.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
 #include <asnumpy/utils/dtype_promotion.hpp>
 #include <asnumpy/utils/npu_array.hpp>
+#include <asnumpy/utils/npu_scalar.hpp>
 
 #include <acl/acl.h>
 #include <aclnn/acl_meta.h>
 #include <aclnn/aclnn_base.h>
 #include <aclnnop/aclnn_acos.h>
-#include <aclnnop/aclnn_add.h>
+#include <aclnnop/aclnn_addcmul.h>
 #include <aclnnop/aclnn_asin.h>
 #include <aclnnop/aclnn_atan.h>
 #include <aclnnop/aclnn_atan2.h>
@@ -50,7 +53,7 @@ NPUArray Sin(const NPUArray& x) {
             return aclnnSinGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnSin(workspace, workspaceSize, executor, nullptr);
+            return aclnnSin(workspace, workspaceSize, executor, stream);
         },
         "Sin", "aclnnSin");
 }
@@ -62,7 +65,7 @@ NPUArray Cos(const NPUArray& x) {
             return aclnnCosGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnCos(workspace, workspaceSize, executor, nullptr);
+            return aclnnCos(workspace, workspaceSize, executor, stream);
         },
         "Cos", "aclnnCos");
 }
@@ -74,7 +77,7 @@ NPUArray Tan(const NPUArray& x) {
             return aclnnTanGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnTan(workspace, workspaceSize, executor, nullptr);
+            return aclnnTan(workspace, workspaceSize, executor, stream);
         },
         "Tan", "aclnnTan");
 }
@@ -90,7 +93,7 @@ NPUArray Arcsin(const NPUArray& x) {
             return aclnnAsinGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnAsin(workspace, workspaceSize, executor, nullptr);
+            return aclnnAsin(workspace, workspaceSize, executor, stream);
         },
         "Arcsin", "aclnnAsin");
 }
@@ -106,7 +109,7 @@ NPUArray Arccos(const NPUArray& x) {
             return aclnnAcosGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnAcos(workspace, workspaceSize, executor, nullptr);
+            return aclnnAcos(workspace, workspaceSize, executor, stream);
         },
         "Arccos", "aclnnAcos");
 }
@@ -122,114 +125,70 @@ NPUArray Arctan(const NPUArray& x) {
             return aclnnAtanGetWorkspaceSize(in, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnAtan(workspace, workspaceSize, executor, nullptr);
+            return aclnnAtan(workspace, workspaceSize, executor, stream);
         },
         "Arctan", "aclnnAtan");
 }
 
 NPUArray Hypot(const NPUArray& a, const NPUArray& b) {
-    LOG_DEBUG("aclnnMul start: a_shape={}, b_shape={}, aclDtype={}", detail::FormatShape(a.shape),
-              detail::FormatShape(b.shape), AclDtypeName(a.aclDtype));
+    LOG_DEBUG("Hypot start: a_shape={}, b_shape={}, a_dtype={}, b_dtype={}", detail::FormatShape(a.shape),
+              detail::FormatShape(b.shape), AclDtypeName(a.aclDtype), AclDtypeName(b.aclDtype));
 
-    auto broadcast = GetBroadcastShape(a, b);
+    aclDataType dtype = PromoteBinaryFloating(a.aclDtype, b.aclDtype);
+    ACL_DTYPE_WARN(a.aclDtype, dtype, __func__);
+    ACL_DTYPE_WARN(b.aclDtype, dtype, __func__);
+    NPUArray in_a = EnsureAclDtype(a, dtype);
+    NPUArray in_b = EnsureAclDtype(b, dtype);
+    NPUArray result(GetBroadcastShape(in_a, in_b), dtype);
+
+    // Three launches and one temporary the size of a: a² into a_squared, then
+    // result = a² + b·b with aclnnAddcmul (which broadcasts), then sqrt in place.
 
     // step 1: compute a squared (a²)
-    NPUArray a_squared(a.shape, a.dtype);
+    NPUArray a_squared(in_a.shape, dtype);
     uint64_t a_sq_workspace_size = 0;
     aclOpExecutor* a_sq_executor = nullptr;
-    auto error =
-        aclnnMulGetWorkspaceSize(a.tensorPtr, a.tensorPtr, a_squared.tensorPtr, &a_sq_workspace_size, &a_sq_executor);
+    auto error = aclnnMulGetWorkspaceSize(in_a.tensor(), in_a.tensor(), a_squared.tensor(), &a_sq_workspace_size,
+                                          &a_sq_executor);
     ACLNN_CHECK(error, "aclnnMulGetWorkspaceSize");
 
     AclWorkspace a_sq_workspace(a_sq_workspace_size);
 
-    error = aclnnMul(a_sq_workspace.get(), a_sq_workspace_size, a_sq_executor, nullptr);
+    error = aclnnMul(a_sq_workspace.get(), a_sq_workspace_size, a_sq_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnMul");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnMul completed");
+    ACL_OP_LAUNCHED("aclnnMul");
 
-    // step 2: compute b squared (b²)
-    NPUArray b_squared(b.shape, b.dtype);
-    uint64_t b_sq_workspace_size = 0;
-    aclOpExecutor* b_sq_executor = nullptr;
-    error =
-        aclnnMulGetWorkspaceSize(b.tensorPtr, b.tensorPtr, b_squared.tensorPtr, &b_sq_workspace_size, &b_sq_executor);
-    ACLNN_CHECK(error, "aclnnMulGetWorkspaceSize");
+    // step 2: accumulate b squared (a² + 1·b·b)
+    aclScalar* one = CreateScalar(1.0, dtype == ACL_DOUBLE ? ACL_DOUBLE : ACL_FLOAT);
+    uint64_t addcmul_workspace_size = 0;
+    aclOpExecutor* addcmul_executor = nullptr;
+    error = aclnnAddcmulGetWorkspaceSize(a_squared.tensor(), in_b.tensor(), in_b.tensor(), one, result.tensor(),
+                                         &addcmul_workspace_size, &addcmul_executor);
+    ACLNN_CHECK(error, "aclnnAddcmulGetWorkspaceSize");
 
-    AclWorkspace b_sq_workspace(b_sq_workspace_size);
-
-    error = aclnnMul(b_sq_workspace.get(), b_sq_workspace_size, b_sq_executor, nullptr);
-    ACLNN_CHECK(error, "aclnnMul");
+    AclWorkspace addcmul_workspace(addcmul_workspace_size);
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnMul completed");
-
-    // step 3: compute sum of squares (a² + b²)
-    LOG_DEBUG("aclnnAdd start: a_squared_shape={}, b_squared_shape={}, aclDtype={}",
-              detail::FormatShape(a_squared.shape), detail::FormatShape(b_squared.shape), AclDtypeName(a.aclDtype));
-    auto dtype = a.aclDtype;
-    if (a.aclDtype == b.aclDtype) {
-        dtype = a.aclDtype;
-    } else if (a.aclDtype == ACL_DOUBLE || b.aclDtype == ACL_DOUBLE) {
-        dtype = ACL_DOUBLE;
-    } else if (a.aclDtype == ACL_FLOAT || b.aclDtype == ACL_FLOAT) {
-        dtype = ACL_FLOAT;
-    }
-    NPUArray sum_squares(broadcast, dtype);
-    uint64_t add_workspace_size = 0;
-    aclOpExecutor* add_executor = nullptr;
-    aclScalar* alpha_scalar;
-    if (dtype == ACL_DOUBLE || dtype == ACL_INT64) {
-        double alpha = 1.0;
-        alpha_scalar = aclCreateScalar(&alpha, dtype);
-    } else {
-        float alpha = 1.0f;
-        alpha_scalar = aclCreateScalar(&alpha, dtype);
-    }
+    error = aclnnAddcmul(addcmul_workspace.get(), addcmul_workspace_size, addcmul_executor, cann::CurrentStream());
+    ACLNN_CHECK(error, "aclnnAddcmul");
 
-    error = aclnnAddGetWorkspaceSize(a_squared.tensorPtr, b_squared.tensorPtr, alpha_scalar, sum_squares.tensorPtr,
-                                     &add_workspace_size, &add_executor);
-    ACLNN_CHECK(error, "aclnnAddGetWorkspaceSize");
+    ACL_OP_LAUNCHED("aclnnAddcmul");
+    aclDestroyScalar(one);
 
-    AclWorkspace add_workspace(add_workspace_size);
-
-    error = aclnnAdd(add_workspace.get(), add_workspace_size, add_executor, nullptr);
-    ACLNN_CHECK(error, "aclnnAdd");
-
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnAdd completed");
-
-    // step 4: compute square root (√(a² + b²))
-    LOG_DEBUG("aclnnSqrt start: input_shape={}, aclDtype={}", detail::FormatShape(sum_squares.shape),
-              AclDtypeName(sum_squares.aclDtype));
-    aclDataType aclType = ACL_DOUBLE;
-    if (sum_squares.aclDtype == ACL_FLOAT || sum_squares.aclDtype == ACL_FLOAT16 ||
-        sum_squares.aclDtype == ACL_DOUBLE || sum_squares.aclDtype == ACL_COMPLEX64 ||
-        sum_squares.aclDtype == ACL_COMPLEX128) {
-        aclType = sum_squares.aclDtype;
-    }
-    ACL_DTYPE_WARN(sum_squares.aclDtype, aclType, __func__);
-    NPUArray result(broadcast, aclType);
+    // step 3: square root in place (√(a² + b²))
     uint64_t sqrt_workspace_size = 0;
     aclOpExecutor* sqrt_executor = nullptr;
-    error = aclnnSqrtGetWorkspaceSize(sum_squares.tensorPtr, result.tensorPtr, &sqrt_workspace_size, &sqrt_executor);
-    ACLNN_CHECK(error, "aclnnSqrtGetWorkspaceSize");
+    error = aclnnInplaceSqrtGetWorkspaceSize(result.tensor(), &sqrt_workspace_size, &sqrt_executor);
+    ACLNN_CHECK(error, "aclnnInplaceSqrtGetWorkspaceSize");
 
     AclWorkspace sqrt_workspace(sqrt_workspace_size);
 
-    error = aclnnSqrt(sqrt_workspace.get(), sqrt_workspace_size, sqrt_executor, nullptr);
-    ACLNN_CHECK(error, "aclnnSqrt");
+    error = aclnnInplaceSqrt(sqrt_workspace.get(), sqrt_workspace_size, sqrt_executor, cann::CurrentStream());
+    ACLNN_CHECK(error, "aclnnInplaceSqrt");
 
-    // synchronize device and release resources
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    aclDestroyScalar(alpha_scalar);
+    ACL_OP_LAUNCHED("aclnnInplaceSqrt");
 
-    LOG_INFO("aclnnSqrt completed");
+    LOG_INFO("Hypot completed");
 
     return result;
 }
@@ -249,7 +208,7 @@ NPUArray Arctan2(const NPUArray& y, const NPUArray& x) {
             return aclnnAtan2GetWorkspaceSize(in1, in2, out, workspaceSize, executor);
         },
         [](void* workspace, uint64_t workspaceSize, aclOpExecutor* executor, void* stream) {
-            return aclnnAtan2(workspace, workspaceSize, executor, nullptr);
+            return aclnnAtan2(workspace, workspaceSize, executor, stream);
         },
         "Arctan2", "aclnnAtan2");
     if (desired != compute) {
@@ -282,7 +241,6 @@ NPUArray Radians(const NPUArray& x) {
     void* scalar_factor_ptr = nullptr;
 
     // declare resources
-    aclrtStream stream = nullptr;
     uint64_t workspace_size = 0;
     aclOpExecutor* executor = nullptr;
     aclTensorList* input_list = nullptr;  // input tensor list
@@ -290,18 +248,15 @@ NPUArray Radians(const NPUArray& x) {
 
     try {
         // get device pointer of scalar tensor
-        auto error = aclGetRawTensorAddr(scalar_factor.tensorPtr, &scalar_factor_ptr);
+        auto error = aclGetRawTensorAddr(scalar_factor.tensor(), &scalar_factor_ptr);
         ACL_RT_CHECK(error, "aclGetRawTensorAddr");
 
         // copy conversion factor to device (adapt by data type)
         if (x.aclDtype == ACL_FLOAT) {
             float factor = static_cast<float>(rad_factor);
-            error = aclrtMemcpy(scalar_factor_ptr, sizeof(float), &factor, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-            ACL_RT_CHECK(error, "aclrtMemcpy");
+            cann::MemcpyHostToDevice(scalar_factor_ptr, &factor, sizeof(float));
         } else if (x.aclDtype == ACL_DOUBLE) {
-            error =
-                aclrtMemcpy(scalar_factor_ptr, sizeof(double), &rad_factor, sizeof(double), ACL_MEMCPY_HOST_TO_DEVICE);
-            ACL_RT_CHECK(error, "aclrtMemcpy");
+            cann::MemcpyHostToDevice(scalar_factor_ptr, &rad_factor, sizeof(double));
         } else if (x.aclDtype == ACL_FLOAT16) {
             float factor_float = static_cast<float>(rad_factor);
             uint32_t float_bits;
@@ -309,24 +264,18 @@ NPUArray Radians(const NPUArray& x) {
             uint16_t fp16_bits =
                 static_cast<uint16_t>(((float_bits >> 16) & 0x8000U) | (((float_bits >> 13) - 0x1C000U) & 0x7C00U) |
                                       ((float_bits >> 13) & 0x03FFU));
-            error = aclrtMemcpy(scalar_factor_ptr, sizeof(uint16_t), &fp16_bits, sizeof(uint16_t),
-                                ACL_MEMCPY_HOST_TO_DEVICE);
-            ACL_RT_CHECK(error, "aclrtMemcpy");
+            cann::MemcpyHostToDevice(scalar_factor_ptr, &fp16_bits, sizeof(uint16_t));
         }
 
-        // create execution stream
-        error = aclrtCreateStream(&stream);
-        ACL_RT_CHECK(error, "aclrtCreateStream");
-
         // key fix: wrap single tensor as tensor list (matching interface parameter requirements)
-        aclTensor* input_tensors[] = {x.tensorPtr};
+        aclTensor* input_tensors[] = {x.tensor()};
         input_list = aclCreateTensorList(input_tensors, 1);
 
-        aclTensor* output_tensors[] = {result.tensorPtr};
+        aclTensor* output_tensors[] = {result.tensor()};
         output_list = aclCreateTensorList(output_tensors, 1);
 
         // get workspace size
-        error = aclnnForeachMulScalarGetWorkspaceSize(input_list, scalar_factor.tensorPtr, output_list, &workspace_size,
+        error = aclnnForeachMulScalarGetWorkspaceSize(input_list, scalar_factor.tensor(), output_list, &workspace_size,
                                                       &executor);
         ACLNN_CHECK(error, "aclnnForeachMulScalarGetWorkspaceSize");
 
@@ -334,11 +283,9 @@ NPUArray Radians(const NPUArray& x) {
         AclWorkspace workspace(workspace_size);
 
         // execute scalar multiplication
-        error = aclnnForeachMulScalar(workspace.get(), workspace_size, executor, stream);
+        error = aclnnForeachMulScalar(workspace.get(), workspace_size, executor, cann::CurrentStream());
         ACLNN_CHECK(error, "aclnnForeachMulScalar");
-
-        error = aclrtSynchronizeStream(stream);
-        ACL_RT_CHECK(error, "aclrtSynchronizeStream");
+        ACL_OP_LAUNCHED("aclnnForeachMulScalar");
     } catch (const std::exception& e) {
         if (input_list != nullptr) {
             aclDestroyTensorList(input_list);
@@ -346,9 +293,6 @@ NPUArray Radians(const NPUArray& x) {
         if (output_list != nullptr) {
             aclDestroyTensorList(output_list);
         }
-        if (stream != nullptr) {
-            aclrtDestroyStream(stream);
-        }
         throw;
     }
 
@@ -368,20 +312,18 @@ NPUArray Degrees(const NPUArray& x) {
     const double factor = 180.0 / M_PI;
     auto factorArr = NPUArray({1}, aclType);
     void* factorPtr = nullptr;
-    auto error = aclGetRawTensorAddr(factorArr.tensorPtr, &factorPtr);
+    auto error = aclGetRawTensorAddr(factorArr.tensor(), &factorPtr);
     ACL_RT_CHECK(error, "aclGetRawTensorAddr");
     double hostValue = factor;
-    error = aclrtMemcpy(factorPtr, sizeof(double), &hostValue, sizeof(double), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(error, "Write const factor");
+    cann::MemcpyHostToDevice(factorPtr, &hostValue, sizeof(double));
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor = nullptr;
-    error = aclnnMulGetWorkspaceSize(x.tensorPtr, factorArr.tensorPtr, out.tensorPtr, &workspaceSize, &executor);
+    error = aclnnMulGetWorkspaceSize(x.tensor(), factorArr.tensor(), out.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnMulGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnMul(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnMul(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnMul");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnMul");
 
     LOG_INFO("aclnnMul completed");
 
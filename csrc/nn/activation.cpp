@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/nn/activation.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -51,16 +53,15 @@ NPUArray Softmax(const NPUArray& x, int64_t axis, std::optional<py::dtype> dtype
     // Call CANN softmax operator
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnSoftmaxGetWorkspaceSize(x.tensorPtr, ax, result.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnSoftmaxGetWorkspaceSize(x.tensor(), ax, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnSoftmaxGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
 
-    error = aclnnSoftmax(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnSoftmax(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnSoftmax");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnSoftmax");
     LOG_INFO("aclnnSoftmax completed");
     return result;
 }
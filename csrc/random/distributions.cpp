@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/random/distributions.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -68,14 +70,13 @@ NPUArray Generator_Pareto(float a, const std::vector<int64_t>& size) {
     uint64_t uni_workspaceSize = 0;
     aclOpExecutor* uni_executor;
     LOG_DEBUG("aclnnInplaceUniform start: shape={}", detail::FormatShape(size));
-    auto error = aclnnInplaceUniformGetWorkspaceSize(uni_temp.tensorPtr, 0.0, 1.0, seed, offset, &uni_workspaceSize,
+    auto error = aclnnInplaceUniformGetWorkspaceSize(uni_temp.tensor(), 0.0, 1.0, seed, offset, &uni_workspaceSize,
                                                      &uni_executor);
     ACLNN_CHECK(error, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uni_workspace(uni_workspaceSize);
-    error = aclnnInplaceUniform(uni_workspace.get(), uni_workspaceSize, uni_executor, nullptr);
+    error = aclnnInplaceUniform(uni_workspace.get(), uni_workspaceSize, uni_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceUniform");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     auto rsubs_temp = NPUArray(size, ACL_FLOAT);
@@ -86,14 +87,13 @@ NPUArray Generator_Pareto(float a, const std::vector<int64_t>& size) {
     uint64_t rsubs_workspaceSize = 0;
     aclOpExecutor* rsubs_executor;
     LOG_DEBUG("aclnnRsubs start: shape={}", detail::FormatShape(size));
-    error = aclnnRsubsGetWorkspaceSize(uni_temp.tensorPtr, other, alpha, rsubs_temp.tensorPtr, &rsubs_workspaceSize,
+    error = aclnnRsubsGetWorkspaceSize(uni_temp.tensor(), other, alpha, rsubs_temp.tensor(), &rsubs_workspaceSize,
                                        &rsubs_executor);
     ACLNN_CHECK(error, "aclnnRsubsGetWorkspaceSize");
     AclWorkspace rsubs_workspace(rsubs_workspaceSize);
-    error = aclnnRsubs(rsubs_workspace.get(), rsubs_workspaceSize, rsubs_executor, nullptr);
+    error = aclnnRsubs(rsubs_workspace.get(), rsubs_workspaceSize, rsubs_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnRsubs");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnRsubs");
     LOG_INFO("aclnnRsubs completed");
 
     auto result = NPUArray(size, ACL_FLOAT);
@@ -102,38 +102,35 @@ NPUArray Generator_Pareto(float a, const std::vector<int64_t>& size) {
     uint64_t exp_workspaceSize = 0;
     aclOpExecutor* exp_executor;
     LOG_DEBUG("aclnnPowTensorScalar start: shape={}, a={}", detail::FormatShape(size), a);
-    error = aclnnPowTensorScalarGetWorkspaceSize(rsubs_temp.tensorPtr, exponent, result.tensorPtr, &exp_workspaceSize,
+    error = aclnnPowTensorScalarGetWorkspaceSize(rsubs_temp.tensor(), exponent, result.tensor(), &exp_workspaceSize,
                                                  &exp_executor);
     ACLNN_CHECK(error, "aclnnPowTensorScalarGetWorkspaceSize");
     AclWorkspace exp_workspace(exp_workspaceSize);
-    error = aclnnPowTensorScalar(exp_workspace.get(), exp_workspaceSize, exp_executor, nullptr);
+    error = aclnnPowTensorScalar(exp_workspace.get(), exp_workspaceSize, exp_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnPowTensorScalar");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnPowTensorScalar");
     LOG_INFO("aclnnPowTensorScalar completed");
 
     uint64_t reci_workspaceSize = 0;
     aclOpExecutor* reci_executor;
     LOG_DEBUG("aclnnInplaceReciprocal start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceReciprocalGetWorkspaceSize(result.tensorPtr, &reci_workspaceSize, &reci_executor);
+    error = aclnnInplaceReciprocalGetWorkspaceSize(result.tensor(), &reci_workspaceSize, &reci_executor);
     ACLNN_CHECK(error, "aclnnInplaceReciprocalGetWorkspaceSize");
     AclWorkspace reci_workspace(reci_workspaceSize);
-    error = aclnnInplaceReciprocal(reci_workspace.get(), reci_workspaceSize, reci_executor, nullptr);
+    error = aclnnInplaceReciprocal(reci_workspace.get(), reci_workspaceSize, reci_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceReciprocal");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceReciprocal");
     LOG_INFO("aclnnInplaceReciprocal completed");
 
     uint64_t sub_workspaceSize = 0;
     aclOpExecutor* sub_executor;
     LOG_DEBUG("aclnnInplaceSubs start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceSubsGetWorkspaceSize(result.tensorPtr, other, alpha, &sub_workspaceSize, &sub_executor);
+    error = aclnnInplaceSubsGetWorkspaceSize(result.tensor(), other, alpha, &sub_workspaceSize, &sub_executor);
     ACLNN_CHECK(error, "aclnnInplaceSubsGetWorkspaceSize");
     AclWorkspace sub_workspace(sub_workspaceSize);
-    error = aclnnInplaceSubs(sub_workspace.get(), sub_workspaceSize, sub_executor, nullptr);
+    error = aclnnInplaceSubs(sub_workspace.get(), sub_workspaceSize, sub_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceSubs");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceSubs");
     LOG_INFO("aclnnInplaceSubs completed");
     return result;
 }
@@ -148,14 +145,13 @@ NPUArray Generator_Rayleigh(float scale, const std::vector<int64_t>& size) {
     uint64_t uni_workspaceSize = 0;
     aclOpExecutor* uni_executor;
     LOG_DEBUG("aclnnInplaceUniform start: shape={}", detail::FormatShape(size));
-    auto error = aclnnInplaceUniformGetWorkspaceSize(uni_temp.tensorPtr, 0.0, 1.0, seed, offset, &uni_workspaceSize,
+    auto error = aclnnInplaceUniformGetWorkspaceSize(uni_temp.tensor(), 0.0, 1.0, seed, offset, &uni_workspaceSize,
                                                      &uni_executor);
     ACLNN_CHECK(error, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uni_workspace(uni_workspaceSize);
-    error = aclnnInplaceUniform(uni_workspace.get(), uni_workspaceSize, uni_executor, nullptr);
+    error = aclnnInplaceUniform(uni_workspace.get(), uni_workspaceSize, uni_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceUniform");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     auto result = NPUArray(size, ACL_FLOAT);
@@ -166,26 +162,24 @@ NPUArray Generator_Rayleigh(float scale, const std::vector<int64_t>& size) {
     uint64_t rsubs_workspaceSize = 0;
     aclOpExecutor* rsubs_executor;
     LOG_DEBUG("aclnnRsubs start: shape={}", detail::FormatShape(size));
-    error = aclnnRsubsGetWorkspaceSize(uni_temp.tensorPtr, other, alpha, result.tensorPtr, &rsubs_workspaceSize,
+    error = aclnnRsubsGetWorkspaceSize(uni_temp.tensor(), other, alpha, result.tensor(), &rsubs_workspaceSize,
                                        &rsubs_executor);
     ACLNN_CHECK(error, "aclnnRsubsGetWorkspaceSize");
     AclWorkspace rsubs_workspace(rsubs_workspaceSize);
-    error = aclnnRsubs(rsubs_workspace.get(), rsubs_workspaceSize, rsubs_executor, nullptr);
+    error = aclnnRsubs(rsubs_workspace.get(), rsubs_workspaceSize, rsubs_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnRsubs");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnRsubs");
     LOG_INFO("aclnnRsubs completed");
 
     uint64_t log_workspaceSize = 0;
     aclOpExecutor* log_executor;
     LOG_DEBUG("aclnnInplaceLog start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceLogGetWorkspaceSize(result.tensorPtr, &log_workspaceSize, &log_executor);
+    error = aclnnInplaceLogGetWorkspaceSize(result.tensor(), &log_workspaceSize, &log_executor);
     ACLNN_CHECK(error, "aclnnInplaceLogGetWorkspaceSize");
     AclWorkspace log_workspace(log_workspaceSize);
-    error = aclnnInplaceLog(log_workspace.get(), log_workspaceSize, log_executor, nullptr);
+    error = aclnnInplaceLog(log_workspace.get(), log_workspaceSize, log_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceLog");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceLog");
     LOG_INFO("aclnnInplaceLog completed");
 
     float scalar3 = -2.0f;
@@ -193,38 +187,35 @@ NPUArray Generator_Rayleigh(float scale, const std::vector<int64_t>& size) {
     uint64_t muls_workspaceSize = 0;
     aclOpExecutor* muls_executor;
     LOG_DEBUG("aclnnInplaceMuls start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceMulsGetWorkspaceSize(result.tensorPtr, mulnum, &muls_workspaceSize, &muls_executor);
+    error = aclnnInplaceMulsGetWorkspaceSize(result.tensor(), mulnum, &muls_workspaceSize, &muls_executor);
     ACLNN_CHECK(error, "aclnnInplaceMulsGetWorkspaceSize");
     AclWorkspace muls_workspace(muls_workspaceSize);
-    error = aclnnInplaceMuls(muls_workspace.get(), muls_workspaceSize, muls_executor, nullptr);
+    error = aclnnInplaceMuls(muls_workspace.get(), muls_workspaceSize, muls_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceMuls");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceMuls");
     LOG_INFO("aclnnInplaceMuls completed");
 
     uint64_t sqrt_workspaceSize = 0;
     aclOpExecutor* sqrt_executor;
     LOG_DEBUG("aclnnInplaceSqrt start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceSqrtGetWorkspaceSize(result.tensorPtr, &sqrt_workspaceSize, &sqrt_executor);
+    error = aclnnInplaceSqrtGetWorkspaceSize(result.tensor(), &sqrt_workspaceSize, &sqrt_executor);
     ACLNN_CHECK(error, "aclnnInplaceSqrtGetWorkspaceSize");
     AclWorkspace sqrt_workspace(sqrt_workspaceSize);
-    error = aclnnInplaceSqrt(sqrt_workspace.get(), sqrt_workspaceSize, sqrt_executor, nullptr);
+    error = aclnnInplaceSqrt(sqrt_workspace.get(), sqrt_workspaceSize, sqrt_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceSqrt");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceSqrt");
     LOG_INFO("aclnnInplaceSqrt completed");
 
     aclScalar* muls = aclCreateScalar(&scale, ACL_FLOAT);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     LOG_DEBUG("aclnnInplaceMuls start: shape={}, scale={}", detail::FormatShape(size), scale);
-    error = aclnnInplaceMulsGetWorkspaceSize(result.tensorPtr, muls, &workspaceSize, &executor);
+    error = aclnnInplaceMulsGetWorkspaceSize(result.tensor(), muls, &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnInplaceMulsGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnInplaceMuls(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnInplaceMuls(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceMuls");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceMuls");
     LOG_INFO("aclnnInplaceMuls completed");
     return result;
 }
@@ -240,13 +231,12 @@ NPUArray Generator_Normal(float loc, float scale, const std::vector<int64_t>& si
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnNormalFloatFloatGetWorkspaceSize(loc, scale, seed, offset, result.tensorPtr, &workspaceSize, &executor);
+        aclnnNormalFloatFloatGetWorkspaceSize(loc, scale, seed, offset, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnNormalFloatFloatGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnNormalFloatFloat(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnNormalFloatFloat(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnNormalFloatFloat");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnNormalFloatFloat");
     LOG_INFO("aclnnNormalFloatFloat completed");
     return result;
 }
@@ -262,13 +252,12 @@ NPUArray Generator_Uniform(double low, double high, const std::vector<int64_t>&
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnInplaceUniformGetWorkspaceSize(result.tensorPtr, low, high, seed, offset, &workspaceSize, &executor);
+        aclnnInplaceUniformGetWorkspaceSize(result.tensor(), low, high, seed, offset, &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnInplaceUniform(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnInplaceUniform(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceUniform");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
     return result;
 }
@@ -286,13 +275,12 @@ NPUArray Generator_Standard_normal(const std::vector<int64_t>& size) {
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
     auto error =
-        aclnnNormalFloatFloatGetWorkspaceSize(loc, scale, seed, offset, result.tensorPtr, &workspaceSize, &executor);
+        aclnnNormalFloatFloatGetWorkspaceSize(loc, scale, seed, offset, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnNormalFloatFloatGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnNormalFloatFloat(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnNormalFloatFloat(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnNormalFloatFloat");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnNormalFloatFloat");
     LOG_INFO("aclnnNormalFloatFloat completed");
     return result;
 }
@@ -307,14 +295,13 @@ NPUArray Generator_Standard_cauchy(const std::vector<int64_t>& size) {
     uint64_t uni_workspaceSize = 0;
     aclOpExecutor* uni_executor;
     LOG_DEBUG("aclnnInplaceUniform start: shape={}", detail::FormatShape(size));
-    auto error = aclnnInplaceUniformGetWorkspaceSize(result.tensorPtr, 0.0, 1.0, seed, offset, &uni_workspaceSize,
+    auto error = aclnnInplaceUniformGetWorkspaceSize(result.tensor(), 0.0, 1.0, seed, offset, &uni_workspaceSize,
                                                      &uni_executor);
     ACLNN_CHECK(error, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uni_workspace(uni_workspaceSize);
-    error = aclnnInplaceUniform(uni_workspace.get(), uni_workspaceSize, uni_executor, nullptr);
+    error = aclnnInplaceUniform(uni_workspace.get(), uni_workspaceSize, uni_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceUniform");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     float scalar1 = 0.5f;
@@ -324,13 +311,12 @@ NPUArray Generator_Standard_cauchy(const std::vector<int64_t>& size) {
     uint64_t subs_workspaceSize = 0;
     aclOpExecutor* subs_executor;
     LOG_DEBUG("aclnnInplaceSubs start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceSubsGetWorkspaceSize(result.tensorPtr, other, alpha, &subs_workspaceSize, &subs_executor);
+    error = aclnnInplaceSubsGetWorkspaceSize(result.tensor(), other, alpha, &subs_workspaceSize, &subs_executor);
     ACLNN_CHECK(error, "aclnnInplaceSubsGetWorkspaceSize");
     AclWorkspace subs_workspace(subs_workspaceSize);
-    error = aclnnInplaceSubs(subs_workspace.get(), subs_workspaceSize, subs_executor, nullptr);
+    error = aclnnInplaceSubs(subs_workspace.get(), subs_workspaceSize, subs_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceSubs");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceSubs");
     LOG_INFO("aclnnInplaceSubs completed");
 
     double PI = 3.141592653589793238462643383279502884197169399375105820974944;
@@ -338,25 +324,23 @@ NPUArray Generator_Standard_cauchy(const std::vector<int64_t>& size) {
     uint64_t muls_workspaceSize = 0;
     aclOpExecutor* muls_executor;
     LOG_DEBUG("aclnnInplaceMuls start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceMulsGetWorkspaceSize(result.tensorPtr, pi, &muls_workspaceSize, &muls_executor);
+    error = aclnnInplaceMulsGetWorkspaceSize(result.tensor(), pi, &muls_workspaceSize, &muls_executor);
     ACLNN_CHECK(error, "aclnnInplaceMulsGetWorkspaceSize");
     AclWorkspace muls_workspace(muls_workspaceSize);
-    error = aclnnInplaceMuls(muls_workspace.get(), muls_workspaceSize, muls_executor, nullptr);
+    error = aclnnInplaceMuls(muls_workspace.get(), muls_workspaceSize, muls_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceMuls");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceMuls");
     LOG_INFO("aclnnInplaceMuls completed");
 
     uint64_t tan_workspaceSize = 0;
     aclOpExecutor* tan_executor;
     LOG_DEBUG("aclnnInplaceTan start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceTanGetWorkspaceSize(result.tensorPtr, &tan_workspaceSize, &tan_executor);
+    error = aclnnInplaceTanGetWorkspaceSize(result.tensor(), &tan_workspaceSize, &tan_executor);
     ACLNN_CHECK(error, "aclnnInplaceTanGetWorkspaceSize");
     AclWorkspace tan_workspace(tan_workspaceSize);
-    error = aclnnInplaceTan(tan_workspace.get(), tan_workspaceSize, tan_executor, nullptr);
+    error = aclnnInplaceTan(tan_workspace.get(), tan_workspaceSize, tan_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceTan");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceTan");
     LOG_INFO("aclnnInplaceTan completed");
     return result;
 }
@@ -371,14 +355,13 @@ NPUArray Generator_Weibull(float a, const std::vector<int64_t>& size) {
     uint64_t uni_workspaceSize = 0;
     aclOpExecutor* uni_executor;
     LOG_DEBUG("aclnnInplaceUniform start: shape={}, a={}", detail::FormatShape(size), a);
-    auto error = aclnnInplaceUniformGetWorkspaceSize(uni_temp.tensorPtr, 0.0, 1.0, seed, offset, &uni_workspaceSize,
+    auto error = aclnnInplaceUniformGetWorkspaceSize(uni_temp.tensor(), 0.0, 1.0, seed, offset, &uni_workspaceSize,
                                                      &uni_executor);
     ACLNN_CHECK(error, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uni_workspace(uni_workspaceSize);
-    error = aclnnInplaceUniform(uni_workspace.get(), uni_workspaceSize, uni_executor, nullptr);
+    error = aclnnInplaceUniform(uni_workspace.get(), uni_workspaceSize, uni_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceUniform");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     auto rsubs_temp = NPUArray(size, ACL_FLOAT);
@@ -389,26 +372,24 @@ NPUArray Generator_Weibull(float a, const std::vector<int64_t>& size) {
     uint64_t rsubs_workspaceSize1 = 0;
     aclOpExecutor* rsubs_executor1;
     LOG_DEBUG("aclnnRsubs start: shape={}", detail::FormatShape(size));
-    error = aclnnRsubsGetWorkspaceSize(uni_temp.tensorPtr, other1, alpha, rsubs_temp.tensorPtr, &rsubs_workspaceSize1,
+    error = aclnnRsubsGetWorkspaceSize(uni_temp.tensor(), other1, alpha, rsubs_temp.tensor(), &rsubs_workspaceSize1,
                                        &rsubs_executor1);
     ACLNN_CHECK(error, "aclnnRsubsGetWorkspaceSize");
     AclWorkspace rsubs_workspace1(rsubs_workspaceSize1);
-    error = aclnnRsubs(rsubs_workspace1.get(), rsubs_workspaceSize1, rsubs_executor1, nullptr);
+    error = aclnnRsubs(rsubs_workspace1.get(), rsubs_workspaceSize1, rsubs_executor1, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnRsubs");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnRsubs");
     LOG_INFO("aclnnRsubs completed");
 
     uint64_t log_workspaceSize = 0;
     aclOpExecutor* log_executor;
     LOG_DEBUG("aclnnInplaceLog start: shape={}", detail::FormatShape(size));
-    error = aclnnInplaceLogGetWorkspaceSize(rsubs_temp.tensorPtr, &log_workspaceSize, &log_executor);
+    error = aclnnInplaceLogGetWorkspaceSize(rsubs_temp.tensor(), &log_workspaceSize, &log_executor);
     ACLNN_CHECK(error, "aclnnInplaceLogGetWorkspaceSize");
     AclWorkspace log_workspace(log_workspaceSize);
-    error = aclnnInplaceLog(log_workspace.get(), log_workspaceSize, log_executor, nullptr);
+    error = aclnnInplaceLog(log_workspace.get(), log_workspaceSize, log_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnInplaceLog");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnInplaceLog");
     LOG_INFO("aclnnInplaceLog completed");
 
     auto result = NPUArray(size, ACL_FLOAT);
@@ -417,14 +398,13 @@ NPUArray Generator_Weibull(float a, const std::vector<int64_t>& size) {
     uint64_t rsubs_workspaceSize = 0;
     aclOpExecutor* rsubs_executor;
     LOG_DEBUG("aclnnRsubs start: shape={}", detail::FormatShape(size));
-    error = aclnnRsubsGetWorkspaceSize(rsubs_temp.tensorPtr, other2, alpha, result.tensorPtr, &rsubs_workspaceSize,
+    error = aclnnRsubsGetWorkspaceSize(rsubs_temp.tensor(), other2, alpha, result.tensor(), &rsubs_workspaceSize,
                                        &rsubs_executor);
     ACLNN_CHECK(error, "aclnnRsubsGetWorkspaceSize");
     AclWorkspace rsubs_workspace(rsubs_workspaceSize);
-    error = aclnnRsubs(rsubs_workspace.get(), rsubs_workspaceSize, rsubs_executor, nullptr);
+    error = aclnnRsubs(rsubs_workspace.get(), rsubs_workspaceSize, rsubs_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnRsubs");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnRsubs");
     LOG_INFO("aclnnRsubs completed");
 
     float scalar4 = 1.0f / a;
@@ -432,14 +412,13 @@ NPUArray Generator_Weibull(float a, const std::vector<int64_t>& size) {
     uint64_t exp_workspaceSize = 0;
     aclOpExecutor* exp_executor;
     LOG_DEBUG("aclnnPowTensorScalar start: shape={}, a={}", detail::FormatShape(size), a);
-    error = aclnnPowTensorScalarGetWorkspaceSize(result.tensorPtr, exponent, result.tensorPtr, &exp_workspaceSize,
+    error = aclnnPowTensorScalarGetWorkspaceSize(result.tensor(), exponent, result.tensor(), &exp_workspaceSize,
                                                  &exp_executor);
     ACLNN_CHECK(error, "aclnnPowTensorScalarGetWorkspaceSize");
     AclWorkspace exp_workspace(exp_workspaceSize);
-    error = aclnnPowTensorScalar(exp_workspace.get(), exp_workspaceSize, exp_executor, nullptr);
+    error = aclnnPowTensorScalar(exp_workspace.get(), exp_workspaceSize, exp_executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnPowTensorScalar");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnPowTensorScalar");
     LOG_INFO("aclnnPowTensorScalar completed");
     return result;
 }
@@ -454,7 +433,7 @@ NPUArray Binomial(int n, float p, const std::vector<int64_t>& size) {
     if (n == 0) {
         NPUArray result(size, ACL_INT32);
         void* data_ptr = nullptr;
-        auto ret = aclGetRawTensorAddr(result.tensorPtr, &data_ptr);
+        auto ret = aclGetRawTensorAddr(result.tensor(), &data_ptr);
         ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
         if (!data_ptr) {
             throw std::runtime_error(
@@ -462,8 +441,10 @@ NPUArray Binomial(int n, float p, const std::vector<int64_t>& size) {
         }
         // initialize entire output tensor with 0
         size_t total_elems = std::accumulate(size.begin(), size.end(), int64_t{1}, std::multiplies<int64_t>());
-        ret = aclrtMemset(data_ptr, total_elems * sizeof(int32_t), 0, total_elems * sizeof(int32_t));
-        ACL_RT_CHECK(ret, "aclrtMemset");
+        ret = aclrtMemsetAsync(data_ptr, total_elems * sizeof(int32_t), 0, total_elems * sizeof(int32_t),
+                               cann::CurrentStream());
+        ACL_RT_CHECK(ret, "aclrtMemsetAsync");
+        ACL_OP_LAUNCHED("aclrtMemsetAsync");
         return result;
     }
 
@@ -475,34 +456,28 @@ NPUArray Binomial(int n, float p, const std::vector<int64_t>& size) {
     // 3. build scalar probability tensor
     NPUArray prob_tensor({}, ACL_FLOAT);
     void* prob_data_ptr = nullptr;
-    auto ret = aclGetRawTensorAddr(prob_tensor.tensorPtr, &prob_data_ptr);
+    auto ret = aclGetRawTensorAddr(prob_tensor.tensor(), &prob_data_ptr);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!prob_data_ptr) {
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null prob_data_ptr", __func__));
     }
-    ret = aclrtMemcpy(prob_data_ptr, sizeof(float), &p, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(prob_data_ptr, &p, sizeof(float));
 
-    // 4. declare resources and create stream
+    // 4. declare resources
     uint64_t bernoulli_ws = 0;
     aclOpExecutor* bernoulli_exec = nullptr;
-    aclrtStream stream = nullptr;
-    ret = aclrtCreateStream(&stream);
-    ACL_RT_CHECK(ret, "aclrtCreateStream");
-    if (!stream)
-        throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclrtCreateStream returned null", __func__));
+    aclrtStream stream = cann::CurrentStream();
 
     // 5. generate Bernoulli tensor
     LOG_DEBUG("aclnnBernoulliTensor start: shape={}, n={}, p={}", detail::FormatShape(size), n, p);
-    ret = aclnnBernoulliTensorGetWorkspaceSize(bernoulli_tensor.tensorPtr, prob_tensor.tensorPtr, 42, 0,
-                                               bernoulli_tensor.tensorPtr, &bernoulli_ws, &bernoulli_exec);
+    ret = aclnnBernoulliTensorGetWorkspaceSize(bernoulli_tensor.tensor(), prob_tensor.tensor(), 42, 0,
+                                               bernoulli_tensor.tensor(), &bernoulli_ws, &bernoulli_exec);
     ACLNN_CHECK(ret, "aclnnBernoulliTensorGetWorkspaceSize");
     AclWorkspace bernoulli(bernoulli_ws);
     ret = aclnnBernoulliTensor(bernoulli.get(), bernoulli_ws, bernoulli_exec, stream);
     ACLNN_CHECK(ret, "aclnnBernoulliTensor");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnBernoulliTensor");
     LOG_INFO("aclnnBernoulliTensor completed");
 
     // 6. reduce sum (core fix)
@@ -514,17 +489,16 @@ NPUArray Binomial(int n, float p, const std::vector<int64_t>& size) {
     // 6.1 create aclIntArray for reduction axis (matching interface requirements)
     aclIntArray* dims_array = aclCreateIntArray(reduce_axis.data(), reduce_axis.size());
     if (dims_array == nullptr) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclCreateIntArray returned null", __func__));
     }
 
     // 6.2 call corrected ReduceSum interface (parameter order per docs)
     LOG_DEBUG("aclnnReduceSum start: shape={}", detail::FormatShape(size));
-    ret = aclnnReduceSumGetWorkspaceSize(bernoulli_tensor.tensorPtr, // input tensor
+    ret = aclnnReduceSumGetWorkspaceSize(bernoulli_tensor.tensor(), // input tensor
                                          dims_array,                 // reduction axis (aclIntArray type)
                                          false,                      // keep reduced axes
                                          ACL_INT32,                  // output dtype (matches result type)
-                                         result.tensorPtr,           // output tensor
+                                         result.tensor(),           // output tensor
                                          &sum_ws, &sum_exec);
     ACLNN_CHECK(ret, "aclnnReduceSumGetWorkspaceSize");
 
@@ -532,12 +506,10 @@ NPUArray Binomial(int n, float p, const std::vector<int64_t>& size) {
     AclWorkspace sumws(sum_ws);
     ret = aclnnReduceSum(sumws.get(), sum_ws, sum_exec, stream);
     ACLNN_CHECK(ret, "aclnnReduceSum");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnReduceSum");
 
     // 7. release all resources
     aclDestroyIntArray(dims_array); // destroy reduction axis array
-    aclrtDestroyStream(stream);
 
     LOG_INFO("aclnnReduceSum completed");
     return result;
@@ -555,12 +527,8 @@ NPUArray Exponential(float scale, const std::vector<int64_t>& size) {
 
     uint64_t uniform_ws = 0;
     aclOpExecutor* uniform_exec = nullptr;
-    aclrtStream stream = nullptr;
-    auto ret = aclrtCreateStream(&stream);
-    ACL_RT_CHECK(ret, "aclrtCreateStream");
-    if (!stream) {
-        throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclrtCreateStream returned null", __func__));
-    }
+    aclrtStream stream = cann::CurrentStream();
+    aclnnStatus ret = ACL_SUCCESS;
 
     double low = 0.0;
     double high = 1.0;
@@ -569,28 +537,25 @@ NPUArray Exponential(float scale, const std::vector<int64_t>& size) {
 
     // fill U with uniform distribution in-place
     LOG_DEBUG("aclnnInplaceUniform start: shape={}, scale={}", detail::FormatShape(size), scale);
-    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensorPtr, low, high, seed, offset, &uniform_ws, &uniform_exec);
+    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensor(), low, high, seed, offset, &uniform_ws, &uniform_exec);
     ACLNN_CHECK(ret, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uniform(uniform_ws);
     ret = aclnnInplaceUniform(uniform.get(), uniform_ws, uniform_exec, stream);
     ACLNN_CHECK(ret, "aclnnInplaceUniform");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     // 3. compute 1 - U
     NPUArray one_tensor({}, ACL_FLOAT);
     void* one_data = nullptr;
-    ret = aclGetRawTensorAddr(one_tensor.tensorPtr, &one_data);
+    ret = aclGetRawTensorAddr(one_tensor.tensor(), &one_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!one_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null one_data", __func__));
     }
     float one_val = 1.0f;
-    ret = aclrtMemcpy(one_data, sizeof(float), &one_val, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(one_data, &one_val, sizeof(float));
 
     NPUArray one_minus_u(size, ACL_FLOAT);
     uint64_t sub_ws = 0;
@@ -600,17 +565,16 @@ NPUArray Exponential(float scale, const std::vector<int64_t>& size) {
     aclScalar* alpha_scalar = aclCreateScalar(&one_val, ACL_FLOAT); // alpha = 1
 
     LOG_DEBUG("aclnnSub start: shape={}", detail::FormatShape(size));
-    ret = aclnnSubGetWorkspaceSize(one_tensor.tensorPtr,  // self
-                                   u_tensor.tensorPtr,    // other
+    ret = aclnnSubGetWorkspaceSize(one_tensor.tensor(),  // self
+                                   u_tensor.tensor(),    // other
                                    alpha_scalar,          // alpha
-                                   one_minus_u.tensorPtr, // out
+                                   one_minus_u.tensor(), // out
                                    &sub_ws, &sub_exec);
     ACLNN_CHECK(ret, "aclnnSubGetWorkspaceSize");
     AclWorkspace subws(sub_ws);
     ret = aclnnSub(subws.get(), sub_ws, sub_exec, stream);
     ACLNN_CHECK(ret, "aclnnSub");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnSub");
     aclDestroyScalar(alpha_scalar);
     LOG_INFO("aclnnSub completed");
 
@@ -619,43 +583,36 @@ NPUArray Exponential(float scale, const std::vector<int64_t>& size) {
     uint64_t log_ws = 0;
     aclOpExecutor* log_exec = nullptr;
     LOG_DEBUG("aclnnLog start: shape={}", detail::FormatShape(size));
-    ret = aclnnLogGetWorkspaceSize(one_minus_u.tensorPtr, log_tensor.tensorPtr, &log_ws, &log_exec);
+    ret = aclnnLogGetWorkspaceSize(one_minus_u.tensor(), log_tensor.tensor(), &log_ws, &log_exec);
     ACLNN_CHECK(ret, "aclnnLogGetWorkspaceSize");
     AclWorkspace logws(log_ws);
     ret = aclnnLog(logws.get(), log_ws, log_exec, stream);
     ACLNN_CHECK(ret, "aclnnLog");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnLog");
     LOG_INFO("aclnnLog completed");
 
     // 5. result = -scale * log(1 - U)
     NPUArray scale_tensor({}, ACL_FLOAT);
     void* scale_data = nullptr;
-    ret = aclGetRawTensorAddr(scale_tensor.tensorPtr, &scale_data);
+    ret = aclGetRawTensorAddr(scale_tensor.tensor(), &scale_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!scale_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null scale_data", __func__));
     }
     float neg_scale = -scale;
-    ret = aclrtMemcpy(scale_data, sizeof(float), &neg_scale, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(scale_data, &neg_scale, sizeof(float));
 
     NPUArray result(size, ACL_FLOAT);
     uint64_t mul_ws = 0;
     aclOpExecutor* mul_exec = nullptr;
     LOG_DEBUG("aclnnMul start: shape={}, scale={}", detail::FormatShape(size), scale);
-    ret = aclnnMulGetWorkspaceSize(scale_tensor.tensorPtr, log_tensor.tensorPtr, result.tensorPtr, &mul_ws, &mul_exec);
+    ret = aclnnMulGetWorkspaceSize(scale_tensor.tensor(), log_tensor.tensor(), result.tensor(), &mul_ws, &mul_exec);
     ACLNN_CHECK(ret, "aclnnMulGetWorkspaceSize");
     AclWorkspace mulws(mul_ws);
     ret = aclnnMul(mulws.get(), mul_ws, mul_exec, stream);
     ACLNN_CHECK(ret, "aclnnMul");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
-
-    // 6. cleanup resources
-    aclrtDestroyStream(stream);
+    ACL_OP_LAUNCHED("aclnnMul");
 
     LOG_INFO("aclnnMul completed");
     return result;
@@ -673,12 +630,8 @@ NPUArray Geometric(float p, const std::vector<int64_t>& size) {
 
     uint64_t uniform_ws = 0;
     aclOpExecutor* uniform_exec = nullptr;
-    aclrtStream stream = nullptr;
-    auto ret = aclrtCreateStream(&stream);
-    ACL_RT_CHECK(ret, "aclrtCreateStream");
-    if (!stream) {
-        throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclrtCreateStream returned null", __func__));
-    }
+    aclrtStream stream = cann::CurrentStream();
+    aclnnStatus ret = ACL_SUCCESS;
 
     double low = 0.0;
     double high = 1.0;
@@ -686,28 +639,25 @@ NPUArray Geometric(float p, const std::vector<int64_t>& size) {
     uint64_t offset = 0;
 
     LOG_DEBUG("aclnnInplaceUniform start: shape={}, p={}", detail::FormatShape(size), p);
-    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensorPtr, low, high, seed, offset, &uniform_ws, &uniform_exec);
+    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensor(), low, high, seed, offset, &uniform_ws, &uniform_exec);
     ACLNN_CHECK(ret, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uniform(uniform_ws);
     ret = aclnnInplaceUniform(uniform.get(), uniform_ws, uniform_exec, stream);
     ACLNN_CHECK(ret, "aclnnInplaceUniform");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     // 3. compute 1 - U
     NPUArray one_tensor({}, ACL_FLOAT);
     void* one_data = nullptr;
-    ret = aclGetRawTensorAddr(one_tensor.tensorPtr, &one_data);
+    ret = aclGetRawTensorAddr(one_tensor.tensor(), &one_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!one_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null one_data", __func__));
     }
     float one_val = 1.0f;
-    ret = aclrtMemcpy(one_data, sizeof(float), &one_val, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(one_data, &one_val, sizeof(float));
 
     NPUArray one_minus_u(size, ACL_FLOAT);
     uint64_t sub_ws = 0;
@@ -716,17 +666,16 @@ NPUArray Geometric(float p, const std::vector<int64_t>& size) {
     aclScalar* alpha_scalar = aclCreateScalar(&one_val, ACL_FLOAT);
 
     LOG_DEBUG("aclnnSub start: shape={}", detail::FormatShape(size));
-    ret = aclnnSubGetWorkspaceSize(one_tensor.tensorPtr,  // self
-                                   u_tensor.tensorPtr,    // other
+    ret = aclnnSubGetWorkspaceSize(one_tensor.tensor(),  // self
+                                   u_tensor.tensor(),    // other
                                    alpha_scalar,          // alpha
-                                   one_minus_u.tensorPtr, // out
+                                   one_minus_u.tensor(), // out
                                    &sub_ws, &sub_exec);
     ACLNN_CHECK(ret, "aclnnSubGetWorkspaceSize");
     AclWorkspace subws(sub_ws);
     ret = aclnnSub(subws.get(), sub_ws, sub_exec, stream);
     ACLNN_CHECK(ret, "aclnnSub");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnSub");
     aclDestroyScalar(alpha_scalar);
     LOG_INFO("aclnnSub completed");
 
@@ -736,41 +685,37 @@ NPUArray Geometric(float p, const std::vector<int64_t>& size) {
     aclOpExecutor* log_exec = nullptr;
 
     LOG_DEBUG("aclnnLog start: shape={}", detail::FormatShape(size));
-    ret = aclnnLogGetWorkspaceSize(one_minus_u.tensorPtr, log_tensor.tensorPtr, &log_ws, &log_exec);
+    ret = aclnnLogGetWorkspaceSize(one_minus_u.tensor(), log_tensor.tensor(), &log_ws, &log_exec);
     ACLNN_CHECK(ret, "aclnnLogGetWorkspaceSize");
     AclWorkspace logws(log_ws);
     ret = aclnnLog(logws.get(), log_ws, log_exec, stream);
     ACLNN_CHECK(ret, "aclnnLog");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnLog");
     LOG_INFO("aclnnLog completed");
 
     // 5. divide by log(1 - p)
     NPUArray denom_tensor({}, ACL_FLOAT);
     void* denom_data = nullptr;
-    ret = aclGetRawTensorAddr(denom_tensor.tensorPtr, &denom_data);
+    ret = aclGetRawTensorAddr(denom_tensor.tensor(), &denom_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!denom_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null denom_data", __func__));
     }
     float denom_val = std::log(1.0f - p);
-    ret = aclrtMemcpy(denom_data, sizeof(float), &denom_val, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(denom_data, &denom_val, sizeof(float));
 
     NPUArray div_tensor(size, ACL_FLOAT);
     uint64_t div_ws = 0;
     aclOpExecutor* div_exec = nullptr;
     LOG_DEBUG("aclnnDiv start: shape={}, p={}", detail::FormatShape(size), p);
-    ret = aclnnDivGetWorkspaceSize(log_tensor.tensorPtr, denom_tensor.tensorPtr, div_tensor.tensorPtr, &div_ws,
+    ret = aclnnDivGetWorkspaceSize(log_tensor.tensor(), denom_tensor.tensor(), div_tensor.tensor(), &div_ws,
                                    &div_exec);
     ACLNN_CHECK(ret, "aclnnDivGetWorkspaceSize");
     AclWorkspace divws(div_ws);
     ret = aclnnDiv(divws.get(), div_ws, div_exec, stream);
     ACLNN_CHECK(ret, "aclnnDiv");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnDiv");
     LOG_INFO("aclnnDiv completed");
 
     // 6. floor
@@ -778,28 +723,25 @@ NPUArray Geometric(float p, const std::vector<int64_t>& size) {
     uint64_t floor_ws = 0;
     aclOpExecutor* floor_exec = nullptr;
     LOG_DEBUG("aclnnFloor start: shape={}", detail::FormatShape(size));
-    ret = aclnnFloorGetWorkspaceSize(div_tensor.tensorPtr, floor_tensor.tensorPtr, &floor_ws, &floor_exec);
+    ret = aclnnFloorGetWorkspaceSize(div_tensor.tensor(), floor_tensor.tensor(), &floor_ws, &floor_exec);
     ACLNN_CHECK(ret, "aclnnFloorGetWorkspaceSize");
     AclWorkspace floor(floor_ws);
     ret = aclnnFloor(floor.get(), floor_ws, floor_exec, stream);
     ACLNN_CHECK(ret, "aclnnFloor");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnFloor");
     LOG_INFO("aclnnFloor completed");
 
     // 7. +1
     NPUArray one_tensor2({}, ACL_FLOAT);
     void* one_data2 = nullptr;
-    ret = aclGetRawTensorAddr(one_tensor2.tensorPtr, &one_data2);
+    ret = aclGetRawTensorAddr(one_tensor2.tensor(), &one_data2);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!one_data2) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null one_data2", __func__));
     }
     float one_val2 = 1.0f;
-    ret = aclrtMemcpy(one_data2, sizeof(float), &one_val2, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(one_data2, &one_val2, sizeof(float));
 
     NPUArray result(size, ACL_FLOAT);
     uint64_t add_ws = 0;
@@ -807,22 +749,18 @@ NPUArray Geometric(float p, const std::vector<int64_t>& size) {
     aclScalar* alpha_one = aclCreateScalar(&one_val2, ACL_FLOAT);
 
     LOG_DEBUG("aclnnAdd start: shape={}", detail::FormatShape(size));
-    ret = aclnnAddGetWorkspaceSize(floor_tensor.tensorPtr, // self
-                                   one_tensor2.tensorPtr,  // other
+    ret = aclnnAddGetWorkspaceSize(floor_tensor.tensor(), // self
+                                   one_tensor2.tensor(),  // other
                                    alpha_one,              // alpha
-                                   result.tensorPtr,       // out
+                                   result.tensor(),       // out
                                    &add_ws, &add_exec);
     ACLNN_CHECK(ret, "aclnnAddGetWorkspaceSize");
     AclWorkspace addws(add_ws);
     ret = aclnnAdd(addws.get(), add_ws, add_exec, stream);
     ACLNN_CHECK(ret, "aclnnAdd");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnAdd");
     aclDestroyScalar(alpha_one);
 
-    // 8. cleanup
-    aclrtDestroyStream(stream);
-
     LOG_INFO("aclnnAdd completed");
     return result;
 }
@@ -834,17 +772,13 @@ NPUArray Gumbel(double loc, double scale, const std::vector<int64_t>& size) {
             fmt::format("[distributions.cpp]({}) invalid parameter: scale={} <= 0", __func__, scale));
     }
 
-    // 2. prepare random stream and U tensor
+    // 2. prepare U tensor
     NPUArray u_tensor(size, ACL_FLOAT);
 
     uint64_t uniform_ws = 0;
     aclOpExecutor* uniform_exec = nullptr;
-    aclrtStream stream = nullptr;
-    auto ret = aclrtCreateStream(&stream);
-    ACL_RT_CHECK(ret, "aclrtCreateStream");
-    if (!stream) {
-        throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclrtCreateStream returned null", __func__));
-    }
+    aclrtStream stream = cann::CurrentStream();
+    aclnnStatus ret = ACL_SUCCESS;
 
     double low = 0.0;
     double high = 1.0;
@@ -852,13 +786,12 @@ NPUArray Gumbel(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t offset = 0;
 
     LOG_DEBUG("aclnnInplaceUniform start: shape={}, loc={}, scale={}", detail::FormatShape(size), loc, scale);
-    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensorPtr, low, high, seed, offset, &uniform_ws, &uniform_exec);
+    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensor(), low, high, seed, offset, &uniform_ws, &uniform_exec);
     ACLNN_CHECK(ret, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uniform(uniform_ws);
     ret = aclnnInplaceUniform(uniform.get(), uniform_ws, uniform_exec, stream);
     ACLNN_CHECK(ret, "aclnnInplaceUniform");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     // Steps:
@@ -873,41 +806,37 @@ NPUArray Gumbel(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t log_ws = 0;
     aclOpExecutor* log_exec = nullptr;
     LOG_DEBUG("aclnnLog start: shape={}", detail::FormatShape(size));
-    ret = aclnnLogGetWorkspaceSize(u_tensor.tensorPtr, log_u.tensorPtr, &log_ws, &log_exec);
+    ret = aclnnLogGetWorkspaceSize(u_tensor.tensor(), log_u.tensor(), &log_ws, &log_exec);
     ACLNN_CHECK(ret, "aclnnLogGetWorkspaceSize");
     AclWorkspace logws(log_ws);
     ret = aclnnLog(logws.get(), log_ws, log_exec, stream);
     ACLNN_CHECK(ret, "aclnnLog");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnLog");
     LOG_INFO("aclnnLog completed");
 
     // 4. neg_log_u = -1.0 * log_u  (construct -1 scalar tensor and use Mul)
     float neg_one_val = -1.0f;
     NPUArray neg_one_tensor({}, ACL_FLOAT);
     void* neg_one_data = nullptr;
-    ret = aclGetRawTensorAddr(neg_one_tensor.tensorPtr, &neg_one_data);
+    ret = aclGetRawTensorAddr(neg_one_tensor.tensor(), &neg_one_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!neg_one_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null neg_one_data", __func__));
     }
-    ret = aclrtMemcpy(neg_one_data, sizeof(float), &neg_one_val, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(neg_one_data, &neg_one_val, sizeof(float));
 
     NPUArray neg_log_u(size, ACL_FLOAT);
     uint64_t mul_ws1 = 0;
     aclOpExecutor* mul_exec1 = nullptr;
     LOG_DEBUG("aclnnMul start: shape={}", detail::FormatShape(size));
     ret =
-        aclnnMulGetWorkspaceSize(neg_one_tensor.tensorPtr, log_u.tensorPtr, neg_log_u.tensorPtr, &mul_ws1, &mul_exec1);
+        aclnnMulGetWorkspaceSize(neg_one_tensor.tensor(), log_u.tensor(), neg_log_u.tensor(), &mul_ws1, &mul_exec1);
     ACLNN_CHECK(ret, "aclnnMulGetWorkspaceSize");
     AclWorkspace mulws1(mul_ws1);
     ret = aclnnMul(mulws1.get(), mul_ws1, mul_exec1, stream);
     ACLNN_CHECK(ret, "aclnnMul");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnMul");
     LOG_INFO("aclnnMul completed");
 
     // 5. log_neg_log_u = log(neg_log_u)
@@ -915,41 +844,37 @@ NPUArray Gumbel(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t log2_ws = 0;
     aclOpExecutor* log2_exec = nullptr;
     LOG_DEBUG("aclnnLog start: shape={}", detail::FormatShape(size));
-    ret = aclnnLogGetWorkspaceSize(neg_log_u.tensorPtr, log_neg_log_u.tensorPtr, &log2_ws, &log2_exec);
+    ret = aclnnLogGetWorkspaceSize(neg_log_u.tensor(), log_neg_log_u.tensor(), &log2_ws, &log2_exec);
     ACLNN_CHECK(ret, "aclnnLogGetWorkspaceSize");
     AclWorkspace log2ws(log2_ws);
     ret = aclnnLog(log2ws.get(), log2_ws, log2_exec, stream);
     ACLNN_CHECK(ret, "aclnnLog");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnLog");
     LOG_INFO("aclnnLog completed");
 
     // 6. scaled = scale * log_neg_log_u  (construct scale scalar tensor and use Mul)
     float scale_f = static_cast<float>(scale);
     NPUArray scale_tensor({}, ACL_FLOAT);
     void* scale_data = nullptr;
-    ret = aclGetRawTensorAddr(scale_tensor.tensorPtr, &scale_data);
+    ret = aclGetRawTensorAddr(scale_tensor.tensor(), &scale_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!scale_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null scale_data", __func__));
     }
-    ret = aclrtMemcpy(scale_data, sizeof(float), &scale_f, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(scale_data, &scale_f, sizeof(float));
 
     NPUArray scaled(size, ACL_FLOAT);
     uint64_t mul_ws2 = 0;
     aclOpExecutor* mul_exec2 = nullptr;
     LOG_DEBUG("aclnnMul start: shape={}, scale={}", detail::FormatShape(size), scale);
-    ret = aclnnMulGetWorkspaceSize(scale_tensor.tensorPtr, log_neg_log_u.tensorPtr, scaled.tensorPtr, &mul_ws2,
+    ret = aclnnMulGetWorkspaceSize(scale_tensor.tensor(), log_neg_log_u.tensor(), scaled.tensor(), &mul_ws2,
                                    &mul_exec2);
     ACLNN_CHECK(ret, "aclnnMulGetWorkspaceSize");
     AclWorkspace mulws2(mul_ws2);
     ret = aclnnMul(mulws2.get(), mul_ws2, mul_exec2, stream);
     ACLNN_CHECK(ret, "aclnnMul");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnMul");
     LOG_INFO("aclnnMul completed");
 
     // 7. result = loc - scaled
@@ -957,15 +882,13 @@ NPUArray Gumbel(double loc, double scale, const std::vector<int64_t>& size) {
     float loc_f = static_cast<float>(loc);
     NPUArray loc_tensor({}, ACL_FLOAT);
     void* loc_data = nullptr;
-    ret = aclGetRawTensorAddr(loc_tensor.tensorPtr, &loc_data);
+    ret = aclGetRawTensorAddr(loc_tensor.tensor(), &loc_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!loc_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null loc_data", __func__));
     }
-    ret = aclrtMemcpy(loc_data, sizeof(float), &loc_f, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(loc_data, &loc_f, sizeof(float));
 
     NPUArray result(size, ACL_FLOAT);
     uint64_t sub_ws = 0;
@@ -973,26 +896,23 @@ NPUArray Gumbel(double loc, double scale, const std::vector<int64_t>& size) {
     float alpha_val = 1.0f;
     aclScalar* alpha_scalar = aclCreateScalar(&alpha_val, ACL_FLOAT);
     if (alpha_scalar == nullptr) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclCreateScalar returned null", __func__));
     }
 
     LOG_DEBUG("aclnnSub start: shape={}, loc={}, scale={}", detail::FormatShape(size), loc, scale);
-    ret = aclnnSubGetWorkspaceSize(loc_tensor.tensorPtr, // self (scalar)
-                                   scaled.tensorPtr,     // other (tensor)
+    ret = aclnnSubGetWorkspaceSize(loc_tensor.tensor(), // self (scalar)
+                                   scaled.tensor(),     // other (tensor)
                                    alpha_scalar,         // alpha
-                                   result.tensorPtr,     // out
+                                   result.tensor(),     // out
                                    &sub_ws, &sub_exec);
     ACLNN_CHECK(ret, "aclnnSubGetWorkspaceSize");
     AclWorkspace subws(sub_ws);
     ret = aclnnSub(subws.get(), sub_ws, sub_exec, stream);
     ACLNN_CHECK(ret, "aclnnSub");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnSub");
 
         // 8. cleanup resources
     aclDestroyScalar(alpha_scalar);
-    aclrtDestroyStream(stream);
 
     LOG_INFO("aclnnSub completed");
     return result;
@@ -1005,17 +925,13 @@ NPUArray Laplace(double loc, double scale, const std::vector<int64_t>& size) {
             fmt::format("[distributions.cpp]({}) invalid parameter: scale={} <= 0", __func__, scale));
     }
 
-    // 2. prepare stream and U tensor (Uniform in [-0.5, 0.5))
+    // 2. prepare U tensor (Uniform in [-0.5, 0.5))
     NPUArray u_tensor(size, ACL_FLOAT);
 
     uint64_t uniform_ws = 0;
     aclOpExecutor* uniform_exec = nullptr;
-    aclrtStream stream = nullptr;
-    auto ret = aclrtCreateStream(&stream);
-    ACL_RT_CHECK(ret, "aclrtCreateStream");
-    if (!stream) {
-        throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclrtCreateStream returned null", __func__));
-    }
+    aclrtStream stream = cann::CurrentStream();
+    aclnnStatus ret = ACL_SUCCESS;
 
     double low = -0.5;
     double high = 0.5;
@@ -1023,13 +939,12 @@ NPUArray Laplace(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t offset = 0;
 
     LOG_DEBUG("aclnnInplaceUniform start: shape={}, loc={}, scale={}", detail::FormatShape(size), loc, scale);
-    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensorPtr, low, high, seed, offset, &uniform_ws, &uniform_exec);
+    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensor(), low, high, seed, offset, &uniform_ws, &uniform_exec);
     ACLNN_CHECK(ret, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uniform(uniform_ws);
     ret = aclnnInplaceUniform(uniform.get(), uniform_ws, uniform_exec, stream);
     ACLNN_CHECK(ret, "aclnnInplaceUniform");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     // 3. a = abs(U)
@@ -1037,13 +952,12 @@ NPUArray Laplace(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t abs_ws = 0;
     aclOpExecutor* abs_exec = nullptr;
     LOG_DEBUG("aclnnAbs start: shape={}", detail::FormatShape(size));
-    ret = aclnnAbsGetWorkspaceSize(u_tensor.tensorPtr, abs_u.tensorPtr, &abs_ws, &abs_exec);
+    ret = aclnnAbsGetWorkspaceSize(u_tensor.tensor(), abs_u.tensor(), &abs_ws, &abs_exec);
     ACLNN_CHECK(ret, "aclnnAbsGetWorkspaceSize");
     AclWorkspace absws(abs_ws);
     ret = aclnnAbs(absws.get(), abs_ws, abs_exec, stream);
     ACLNN_CHECK(ret, "aclnnAbs");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnAbs");
     LOG_INFO("aclnnAbs completed");
 
     // 4. t = 1 - 2 * abs_u
@@ -1051,42 +965,37 @@ NPUArray Laplace(double loc, double scale, const std::vector<int64_t>& size) {
     NPUArray two_tensor({}, ACL_FLOAT);
     void* two_data = nullptr;
     float two_val_f = 2.0f;
-    ret = aclGetRawTensorAddr(two_tensor.tensorPtr, &two_data);
+    ret = aclGetRawTensorAddr(two_tensor.tensor(), &two_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!two_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null two_data", __func__));
     }
-    ret = aclrtMemcpy(two_data, sizeof(float), &two_val_f, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(two_data, &two_val_f, sizeof(float));
 
     NPUArray two_mul_abs(size, ACL_FLOAT);
     uint64_t mul_ws1 = 0;
     aclOpExecutor* mul_exec1 = nullptr;
     LOG_DEBUG("aclnnMul start: shape={}", detail::FormatShape(size));
-    ret = aclnnMulGetWorkspaceSize(two_tensor.tensorPtr, abs_u.tensorPtr, two_mul_abs.tensorPtr, &mul_ws1, &mul_exec1);
+    ret = aclnnMulGetWorkspaceSize(two_tensor.tensor(), abs_u.tensor(), two_mul_abs.tensor(), &mul_ws1, &mul_exec1);
     ACLNN_CHECK(ret, "aclnnMulGetWorkspaceSize");
     AclWorkspace mulws1(mul_ws1);
     ret = aclnnMul(mulws1.get(), mul_ws1, mul_exec1, stream);
     ACLNN_CHECK(ret, "aclnnMul");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnMul");
     LOG_INFO("aclnnMul completed");
 
     // 4.2 one_tensor scalar = 1.0
     NPUArray one_tensor({}, ACL_FLOAT);
     void* one_data = nullptr;
     float one_val_f = 1.0f;
-    ret = aclGetRawTensorAddr(one_tensor.tensorPtr, &one_data);
+    ret = aclGetRawTensorAddr(one_tensor.tensor(), &one_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!one_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null one_data", __func__));
     }
-    ret = aclrtMemcpy(one_data, sizeof(float), &one_val_f, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(one_data, &one_val_f, sizeof(float));
 
     // 4.3 t = 1 - 2*abs_u  :: use aclnnSub (self=one_tensor, other=two_mul_abs, alpha=1)
     NPUArray t_tensor(size, ACL_FLOAT);
@@ -1095,18 +1004,16 @@ NPUArray Laplace(double loc, double scale, const std::vector<int64_t>& size) {
     float alpha_val_f = 1.0f;
     aclScalar* alpha_scalar = aclCreateScalar(&alpha_val_f, ACL_FLOAT);
     if (alpha_scalar == nullptr) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclCreateScalar returned null", __func__));
     }
     LOG_DEBUG("aclnnSub start: shape={}", detail::FormatShape(size));
-    ret = aclnnSubGetWorkspaceSize(one_tensor.tensorPtr, two_mul_abs.tensorPtr, alpha_scalar, t_tensor.tensorPtr,
+    ret = aclnnSubGetWorkspaceSize(one_tensor.tensor(), two_mul_abs.tensor(), alpha_scalar, t_tensor.tensor(),
                                    &sub_ws1, &sub_exec1);
     ACLNN_CHECK(ret, "aclnnSubGetWorkspaceSize");
     AclWorkspace subws1(sub_ws1);
     ret = aclnnSub(subws1.get(), sub_ws1, sub_exec1, stream);
     ACLNN_CHECK(ret, "aclnnSub");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnSub");
     LOG_INFO("aclnnSub completed");
 
     // 5. log_t = log(t_tensor)
@@ -1114,13 +1021,12 @@ NPUArray Laplace(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t log_ws = 0;
     aclOpExecutor* log_exec = nullptr;
     LOG_DEBUG("aclnnLog start: shape={}", detail::FormatShape(size));
-    ret = aclnnLogGetWorkspaceSize(t_tensor.tensorPtr, log_t.tensorPtr, &log_ws, &log_exec);
+    ret = aclnnLogGetWorkspaceSize(t_tensor.tensor(), log_t.tensor(), &log_ws, &log_exec);
     ACLNN_CHECK(ret, "aclnnLogGetWorkspaceSize");
     AclWorkspace logws(log_ws);
     ret = aclnnLog(logws.get(), log_ws, log_exec, stream);
     ACLNN_CHECK(ret, "aclnnLog");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnLog");
     LOG_INFO("aclnnLog completed");
 
     // 6. sign_u = U / abs_u  (divide elementwise)
@@ -1128,41 +1034,37 @@ NPUArray Laplace(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t div_ws1 = 0;
     aclOpExecutor* div_exec1 = nullptr;
     LOG_DEBUG("aclnnDiv start: shape={}", detail::FormatShape(size));
-    ret = aclnnDivGetWorkspaceSize(u_tensor.tensorPtr, abs_u.tensorPtr, sign_u.tensorPtr, &div_ws1, &div_exec1);
+    ret = aclnnDivGetWorkspaceSize(u_tensor.tensor(), abs_u.tensor(), sign_u.tensor(), &div_ws1, &div_exec1);
     ACLNN_CHECK(ret, "aclnnDivGetWorkspaceSize");
     AclWorkspace divws1(div_ws1);
     ret = aclnnDiv(divws1.get(), div_ws1, div_exec1, stream);
     ACLNN_CHECK(ret, "aclnnDiv");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnDiv");
     LOG_INFO("aclnnDiv completed");
 
     // 7. scaled = scale * log_t  (use scale scalar tensor and Mul)
     float scale_f = static_cast<float>(scale);
     NPUArray scale_tensor({}, ACL_FLOAT);
     void* scale_data = nullptr;
-    ret = aclGetRawTensorAddr(scale_tensor.tensorPtr, &scale_data);
+    ret = aclGetRawTensorAddr(scale_tensor.tensor(), &scale_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!scale_data) {
         aclDestroyScalar(alpha_scalar);
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null scale_data", __func__));
     }
-    ret = aclrtMemcpy(scale_data, sizeof(float), &scale_f, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(scale_data, &scale_f, sizeof(float));
 
     NPUArray scaled(size, ACL_FLOAT);
     uint64_t mul_ws2 = 0;
     aclOpExecutor* mul_exec2 = nullptr;
     LOG_DEBUG("aclnnMul start: shape={}, scale={}", detail::FormatShape(size), scale);
-    ret = aclnnMulGetWorkspaceSize(scale_tensor.tensorPtr, log_t.tensorPtr, scaled.tensorPtr, &mul_ws2, &mul_exec2);
+    ret = aclnnMulGetWorkspaceSize(scale_tensor.tensor(), log_t.tensor(), scaled.tensor(), &mul_ws2, &mul_exec2);
     ACLNN_CHECK(ret, "aclnnMulGetWorkspaceSize");
     AclWorkspace mulws2(mul_ws2);
     ret = aclnnMul(mulws2.get(), mul_ws2, mul_exec2, stream);
     ACLNN_CHECK(ret, "aclnnMul");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnMul");
     LOG_INFO("aclnnMul completed");
 
     // 8. tmp = sign_u * scaled  (elementwise mul)
@@ -1170,47 +1072,42 @@ NPUArray Laplace(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t mul_ws3 = 0;
     aclOpExecutor* mul_exec3 = nullptr;
     LOG_DEBUG("aclnnMul start: shape={}", detail::FormatShape(size));
-    ret = aclnnMulGetWorkspaceSize(sign_u.tensorPtr, scaled.tensorPtr, tmp.tensorPtr, &mul_ws3, &mul_exec3);
+    ret = aclnnMulGetWorkspaceSize(sign_u.tensor(), scaled.tensor(), tmp.tensor(), &mul_ws3, &mul_exec3);
     ACLNN_CHECK(ret, "aclnnMulGetWorkspaceSize");
     AclWorkspace mulws3(mul_ws3);
     ret = aclnnMul(mulws3.get(), mul_ws3, mul_exec3, stream);
     ACLNN_CHECK(ret, "aclnnMul");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnMul");
     LOG_INFO("aclnnMul completed");
 
     // 9. result = loc - tmp  (use aclnnSub with self=loc_tensor, other=tmp, alpha=1)
     float loc_f = static_cast<float>(loc);
     NPUArray loc_tensor({}, ACL_FLOAT);
     void* loc_data = nullptr;
-    ret = aclGetRawTensorAddr(loc_tensor.tensorPtr, &loc_data);
+    ret = aclGetRawTensorAddr(loc_tensor.tensor(), &loc_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!loc_data) {
         aclDestroyScalar(alpha_scalar);
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null loc_data", __func__));
     }
-    ret = aclrtMemcpy(loc_data, sizeof(float), &loc_f, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(loc_data, &loc_f, sizeof(float));
 
     NPUArray result(size, ACL_FLOAT);
     uint64_t sub_ws2 = 0;
     aclOpExecutor* sub_exec2 = nullptr;
 
     LOG_DEBUG("aclnnSub start: shape={}, loc={}, scale={}", detail::FormatShape(size), loc, scale);
-    ret = aclnnSubGetWorkspaceSize(loc_tensor.tensorPtr, tmp.tensorPtr, alpha_scalar, result.tensorPtr, &sub_ws2,
+    ret = aclnnSubGetWorkspaceSize(loc_tensor.tensor(), tmp.tensor(), alpha_scalar, result.tensor(), &sub_ws2,
                                    &sub_exec2);
     ACLNN_CHECK(ret, "aclnnSubGetWorkspaceSize");
     AclWorkspace subws2(sub_ws2);
     ret = aclnnSub(subws2.get(), sub_ws2, sub_exec2, stream);
     ACLNN_CHECK(ret, "aclnnSub");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnSub");
 
     // 10. cleanup and return
     aclDestroyScalar(alpha_scalar);
-    aclrtDestroyStream(stream);
 
     LOG_INFO("aclnnSub completed");
     return result;
@@ -1228,12 +1125,8 @@ NPUArray Logistic(double loc, double scale, const std::vector<int64_t>& size) {
 
     uint64_t uniform_ws = 0;
     aclOpExecutor* uniform_exec = nullptr;
-    aclrtStream stream = nullptr;
-    auto ret = aclrtCreateStream(&stream);
-    ACL_RT_CHECK(ret, "aclrtCreateStream");
-    if (!stream) {
-        throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclrtCreateStream returned null", __func__));
-    }
+    aclrtStream stream = cann::CurrentStream();
+    aclnnStatus ret = ACL_SUCCESS;
 
     double low = 0.0;
     double high = 1.0;
@@ -1241,28 +1134,25 @@ NPUArray Logistic(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t offset = 0;
 
     LOG_DEBUG("aclnnInplaceUniform start: shape={}, loc={}, scale={}", detail::FormatShape(size), loc, scale);
-    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensorPtr, low, high, seed, offset, &uniform_ws, &uniform_exec);
+    ret = aclnnInplaceUniformGetWorkspaceSize(u_tensor.tensor(), low, high, seed, offset, &uniform_ws, &uniform_exec);
     ACLNN_CHECK(ret, "aclnnInplaceUniformGetWorkspaceSize");
     AclWorkspace uniform(uniform_ws);
     ret = aclnnInplaceUniform(uniform.get(), uniform_ws, uniform_exec, stream);
     ACLNN_CHECK(ret, "aclnnInplaceUniform");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnInplaceUniform");
     LOG_INFO("aclnnInplaceUniform completed");
 
     // 3. compute 1 - U
     NPUArray one_tensor({}, ACL_FLOAT);
     void* one_data = nullptr;
-    ret = aclGetRawTensorAddr(one_tensor.tensorPtr, &one_data);
+    ret = aclGetRawTensorAddr(one_tensor.tensor(), &one_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!one_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null one_data", __func__));
     }
     float one_val = 1.0f;
-    ret = aclrtMemcpy(one_data, sizeof(float), &one_val, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(one_data, &one_val, sizeof(float));
 
     NPUArray one_minus_u(size, ACL_FLOAT);
     uint64_t sub_ws = 0;
@@ -1270,14 +1160,13 @@ NPUArray Logistic(double loc, double scale, const std::vector<int64_t>& size) {
 
     aclScalar* alpha_scalar = aclCreateScalar(&one_val, ACL_FLOAT); // alpha = 1
     LOG_DEBUG("aclnnSub start: shape={}", detail::FormatShape(size));
-    ret = aclnnSubGetWorkspaceSize(one_tensor.tensorPtr, u_tensor.tensorPtr, alpha_scalar, one_minus_u.tensorPtr,
+    ret = aclnnSubGetWorkspaceSize(one_tensor.tensor(), u_tensor.tensor(), alpha_scalar, one_minus_u.tensor(),
                                    &sub_ws, &sub_exec);
     ACLNN_CHECK(ret, "aclnnSubGetWorkspaceSize");
     AclWorkspace subws(sub_ws);
     ret = aclnnSub(subws.get(), sub_ws, sub_exec, stream);
     ACLNN_CHECK(ret, "aclnnSub");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnSub");
     aclDestroyScalar(alpha_scalar);
     LOG_INFO("aclnnSub completed");
 
@@ -1286,13 +1175,12 @@ NPUArray Logistic(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t div_ws = 0;
     aclOpExecutor* div_exec = nullptr;
     LOG_DEBUG("aclnnDiv start: shape={}", detail::FormatShape(size));
-    ret = aclnnDivGetWorkspaceSize(u_tensor.tensorPtr, one_minus_u.tensorPtr, ratio.tensorPtr, &div_ws, &div_exec);
+    ret = aclnnDivGetWorkspaceSize(u_tensor.tensor(), one_minus_u.tensor(), ratio.tensor(), &div_ws, &div_exec);
     ACLNN_CHECK(ret, "aclnnDivGetWorkspaceSize");
     AclWorkspace divws(div_ws);
     ret = aclnnDiv(divws.get(), div_ws, div_exec, stream);
     ACLNN_CHECK(ret, "aclnnDiv");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnDiv");
     LOG_INFO("aclnnDiv completed");
 
     // 5. log(ratio)
@@ -1300,75 +1188,65 @@ NPUArray Logistic(double loc, double scale, const std::vector<int64_t>& size) {
     uint64_t log_ws = 0;
     aclOpExecutor* log_exec = nullptr;
     LOG_DEBUG("aclnnLog start: shape={}", detail::FormatShape(size));
-    ret = aclnnLogGetWorkspaceSize(ratio.tensorPtr, log_ratio.tensorPtr, &log_ws, &log_exec);
+    ret = aclnnLogGetWorkspaceSize(ratio.tensor(), log_ratio.tensor(), &log_ws, &log_exec);
     ACLNN_CHECK(ret, "aclnnLogGetWorkspaceSize");
     AclWorkspace logws(log_ws);
     ret = aclnnLog(logws.get(), log_ws, log_exec, stream);
     ACLNN_CHECK(ret, "aclnnLog");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnLog");
     LOG_INFO("aclnnLog completed");
 
     // 6. scale * log(ratio)
     NPUArray scale_tensor({}, ACL_FLOAT);
     void* scale_data = nullptr;
-    ret = aclGetRawTensorAddr(scale_tensor.tensorPtr, &scale_data);
+    ret = aclGetRawTensorAddr(scale_tensor.tensor(), &scale_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!scale_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null scale_data", __func__));
     }
     float scale_val = static_cast<float>(scale);
-    ret = aclrtMemcpy(scale_data, sizeof(float), &scale_val, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(scale_data, &scale_val, sizeof(float));
 
     NPUArray scaled_log(size, ACL_FLOAT);
     uint64_t mul_ws = 0;
     aclOpExecutor* mul_exec = nullptr;
     LOG_DEBUG("aclnnMul start: shape={}, scale={}", detail::FormatShape(size), scale);
     ret =
-        aclnnMulGetWorkspaceSize(scale_tensor.tensorPtr, log_ratio.tensorPtr, scaled_log.tensorPtr, &mul_ws, &mul_exec);
+        aclnnMulGetWorkspaceSize(scale_tensor.tensor(), log_ratio.tensor(), scaled_log.tensor(), &mul_ws, &mul_exec);
     ACLNN_CHECK(ret, "aclnnMulGetWorkspaceSize");
     AclWorkspace mulws(mul_ws);
     ret = aclnnMul(mulws.get(), mul_ws, mul_exec, stream);
     ACLNN_CHECK(ret, "aclnnMul");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnMul");
     LOG_INFO("aclnnMul completed");
 
     // 7. loc + (scale * log_ratio)
     NPUArray loc_tensor({}, ACL_FLOAT);
     void* loc_data = nullptr;
-    ret = aclGetRawTensorAddr(loc_tensor.tensorPtr, &loc_data);
+    ret = aclGetRawTensorAddr(loc_tensor.tensor(), &loc_data);
     ACL_RT_CHECK(ret, "aclGetRawTensorAddr");
     if (!loc_data) {
-        aclrtDestroyStream(stream);
         throw std::runtime_error(
             fmt::format("[distributions.cpp]({}) aclGetRawTensorAddr returned null loc_data", __func__));
     }
     float loc_val = static_cast<float>(loc);
-    ret = aclrtMemcpy(loc_data, sizeof(float), &loc_val, sizeof(float), ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(ret, "aclrtMemcpy");
+    cann::MemcpyHostToDevice(loc_data, &loc_val, sizeof(float));
 
     NPUArray result(size, ACL_FLOAT);
     uint64_t add_ws = 0;
     aclOpExecutor* add_exec = nullptr;
     aclScalar* alpha_add = aclCreateScalar(&one_val, ACL_FLOAT); // alpha = 1
     LOG_DEBUG("aclnnAdd start: shape={}, loc={}, scale={}", detail::FormatShape(size), loc, scale);
-    ret = aclnnAddGetWorkspaceSize(loc_tensor.tensorPtr, scaled_log.tensorPtr, alpha_add, result.tensorPtr, &add_ws,
+    ret = aclnnAddGetWorkspaceSize(loc_tensor.tensor(), scaled_log.tensor(), alpha_add, result.tensor(), &add_ws,
                                    &add_exec);
     ACLNN_CHECK(ret, "aclnnAddGetWorkspaceSize");
     AclWorkspace addws(add_ws);
     ret = aclnnAdd(addws.get(), add_ws, add_exec, stream);
     ACLNN_CHECK(ret, "aclnnAdd");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnAdd");
     aclDestroyScalar(alpha_add);
 
-        // 8. cleanup resources
-    aclrtDestroyStream(stream);
-
     LOG_INFO("aclnnAdd completed");
     return result;
 }
@@ -1390,12 +1268,8 @@ NPUArray Lognormal(float mean, float sigma, const std::vector<int64_t>& size) {
     uint64_t exp_ws = 0;
     aclOpExecutor* exp_exec = nullptr;
 
-    aclrtStream stream = nullptr;
-    auto ret = aclrtCreateStream(&stream);
-    ACL_RT_CHECK(ret, "aclrtCreateStream");
-    if (!stream) {
-        throw std::runtime_error(fmt::format("[distributions.cpp]({}) aclrtCreateStream returned null", __func__));
-    }
+    aclrtStream stream = cann::CurrentStream();
+    aclnnStatus ret = ACL_SUCCESS;
 
     // 3. call aclnnInplaceNormal to generate N(mean, sigma) into z_tensor
     int64_t seed = 12345;
@@ -1405,29 +1279,25 @@ NPUArray Lognormal(float mean, float sigma, const std::vector<int64_t>& size) {
 
     LOG_DEBUG("aclnnInplaceNormal start: shape={}, mean={}, sigma={}", detail::FormatShape(size), mean, sigma);
     ret =
-        aclnnInplaceNormalGetWorkspaceSize(z_tensor.tensorPtr, mean_f, sigma_f, seed, offset, &normal_ws, &normal_exec);
+        aclnnInplaceNormalGetWorkspaceSize(z_tensor.tensor(), mean_f, sigma_f, seed, offset, &normal_ws, &normal_exec);
     ACLNN_CHECK(ret, "aclnnInplaceNormalGetWorkspaceSize");
     AclWorkspace normal(normal_ws);
     ret = aclnnInplaceNormal(normal.get(), normal_ws, normal_exec, stream);
     ACLNN_CHECK(ret, "aclnnInplaceNormal");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnInplaceNormal");
     LOG_INFO("aclnnInplaceNormal completed");
 
     // 4. apply exponential transform: result = exp(z_tensor)
     NPUArray result(size, ACL_FLOAT);
 
     LOG_DEBUG("aclnnExp start: shape={}, mean={}, sigma={}", detail::FormatShape(size), mean, sigma);
-    ret = aclnnExpGetWorkspaceSize(z_tensor.tensorPtr, result.tensorPtr, &exp_ws, &exp_exec);
+    ret = aclnnExpGetWorkspaceSize(z_tensor.tensor(), result.tensor(), &exp_ws, &exp_exec);
     ACLNN_CHECK(ret, "aclnnExpGetWorkspaceSize");
     AclWorkspace expws(exp_ws);
     ret = aclnnExp(expws.get(), exp_ws, exp_exec, stream);
     ACLNN_CHECK(ret, "aclnnExp");
-    ret = aclrtSynchronizeStream(stream);
-    ACL_RT_CHECK(ret, "aclrtSynchronizeStream");
+    ACL_OP_LAUNCHED("aclnnExp");
 
-    // 5. cleanup stream and return
-    aclrtDestroyStream(stream);
     LOG_INFO("aclnnExp completed");
     return result;
 }
@@ -1491,7 +1361,10 @@ NPUArray Lognormal(float mean, float sigma, const std::vector<int64_t>& size) {
     }
 
     // 5. synchronize
-    ret = aclrtSynchronizeStream(stream);
+    {
+        cann::HostWaitScope wait;
+        ret = aclrtSynchronizeStream(stream);
+    }
     if (ret != ACL_SUCCESS) {
         if (ws_addr) aclrtFree(ws_addr);
         aclrtDestroyStream(stream);
@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/sorting/sorting.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -38,14 +40,13 @@ NPUArray Sort(const NPUArray& a, int axis, bool stable) {
     auto indices = NPUArray(shape, ACL_INT64);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnSortGetWorkspaceSize(a.tensorPtr, stable, axis, false, result.tensorPtr, indices.tensorPtr,
+    auto error = aclnnSortGetWorkspaceSize(a.tensor(), stable, axis, false, result.tensor(), indices.tensor(),
                                            &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnSortGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnSort(workspace.get(), workspace.size(), executor, nullptr);
+    error = aclnnSort(workspace.get(), workspace.size(), executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnSort");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnSort");
     LOG_INFO("aclnnSort completed");
     return result;
 }
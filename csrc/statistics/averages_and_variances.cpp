@@ -14,15 +14,20 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/math/arithmetic_operations.hpp>
+#include <asnumpy/math/sums_products_differences.hpp>
 #include <asnumpy/statistics/averages_and_variances.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
+#include <asnumpy/utils/cast.hpp>
 #include <asnumpy/utils/npu_array.hpp>
+#include <asnumpy/utils/reduction.hpp>
 #include <asnumpy/utils/status_handler.hpp>
 
 #include <acl/acl.h>
 #include <aclnn/aclnn_base.h>
-#include <aclnnop/aclnn_flatten.h>
 #include <aclnnop/aclnn_mean.h>
 
 #include <cmath>
@@ -36,115 +41,52 @@
 #include <stdexcept>
 
 namespace asnumpy {
-namespace {
-int64_t CalculateTotalElements(const std::vector<int64_t>& shape) {
-    int64_t total = 1;
-    for (size_t i = 0; i < shape.size(); i++) {
-        total *= shape[i];
-    }
-    return total;
-}
-
-NPUArray FlattenArray(const NPUArray& a) {
-    LOG_DEBUG("aclnnFlatten start: input_shape={}, aclDtype={}", detail::FormatShape(a.shape),
-              AclDtypeName(a.aclDtype));
-    int64_t totalElements = CalculateTotalElements(a.shape);
-    std::vector<int64_t> flatShape = {1, totalElements};
-    auto temp = NPUArray(flatShape, a.aclDtype);
 
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    auto error = aclnnFlattenGetWorkspaceSize(a.tensorPtr, 0, temp.tensorPtr, &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnFlattenGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnFlatten(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnFlatten");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnFlatten completed");
-
-    return temp;
-}
-
-double ExtractScalarValue(const NPUArray& result) {
-    py::array x = result.ToNumpy();
-    py::dtype dt = x.dtype();
-    py::buffer_info buf = x.request();
+namespace {
 
-    if (dt.is(py::dtype::of<int>())) {
-        int* results = static_cast<int*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<double>())) {
-        double* results = static_cast<double*>(buf.ptr);
-        return results[0];
-    } else if (dt.is(py::dtype::of<float>())) {
-        float* results = static_cast<float*>(buf.ptr);
-        return results[0];
-    } else {
-        throw std::runtime_error(fmt::format("[averages_and_variances.cpp]({}) unsupported dtype", __func__));
+// `a` as a read-only view of `shape` (which it must broadcast to): broadcast dimensions get stride 0.
+NPUArray BroadcastView(const NPUArray& a, const std::vector<int64_t>& shape) {
+    std::vector<int64_t> strides(shape.size(), 0);
+    const size_t lead = shape.size() - a.shape.size();
+    for (size_t i = 0; i < a.shape.size(); ++i) {
+        strides[lead + i] = a.shape[i] == shape[lead + i] ? a.strides[i] : 0;
     }
+    return a.AsStrided(shape, strides, a.storageOffset);
 }
-} // namespace
 
-NPUArray Mean(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnMean start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
-              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), axis, keepdims);
+} // anonymous namespace
+
+NPUArray Mean(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims,
+              std::optional<py::dtype> dtype, const std::optional<NPUArray>& where) {
+    auto axes = ReductionAxes(axis, a.shape.size(), "Mean");
     py::dtype outDtype = dtype.has_value() ? dtype.value() : a.dtype;
-    auto shape = a.shape;
-    int64_t ax = axis;
-    if (axis < 0) {
-        ax = shape.size() + axis;
+    if (where.has_value()) {
+        // Masked mean: masked sum over the number of selected elements. The cast mask is already 0
+        // where `where` is false; viewed at a.shape (no copy), the same reduction counts each slice.
+        auto total = Sum(a, axis, keepdims, outDtype, where);
+        auto count = Sum(BroadcastView(CastTo(*where, total.aclDtype), a.shape), axis, keepdims);
+        return Divide(total, count, outDtype);
     }
-    if (ax < 0 || ax >= static_cast<int64_t>(shape.size())) {
-        throw std::out_of_range("axis out of range");
+    if (axes.empty()) {
+        return CastTo(a, NPUArray::GetACLDataType(outDtype));
     }
-    if (keepdims) {
-        shape[ax] = 1;
-    } else {
-        shape.erase(shape.begin() + ax);
-    }
-    std::vector<int64_t> tmp{axis};
-    aclIntArray* axis_array = aclCreateIntArray(tmp.data(), tmp.size());
-    auto result = NPUArray(shape, outDtype);
+    LOG_DEBUG("aclnnMean start: input_shape={}, tensorSize={}, aclDtype={}, axis={}, keepdims={}",
+              detail::FormatShape(a.shape), a.tensorSize, AclDtypeName(a.aclDtype), detail::FormatShape(axes),
+              keepdims);
+    auto dims = MakeAxisArray(axes);
+    auto result = NPUArray(ReducedShape(a.shape, axes, keepdims), outDtype);
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor;
-    auto error = aclnnMeanGetWorkspaceSize(a.tensorPtr, axis_array, keepdims, result.aclDtype, result.tensorPtr,
+    auto error = aclnnMeanGetWorkspaceSize(a.tensor(), dims.get(), keepdims, result.aclDtype, result.tensor(),
                                            &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnMeanGetWorkspaceSize");
     AclWorkspace workspace(workspaceSize);
-    error = aclnnMean(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnMean(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnMean");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnMean");
     LOG_INFO("aclnnMean completed");
     return result;
 }
 
-double Mean(const NPUArray& a, std::optional<py::dtype> dtype) {
-    LOG_DEBUG("aclnnMean start: input_shape={}, tensorSize={}, aclDtype={}", detail::FormatShape(a.shape), a.tensorSize,
-              AclDtypeName(a.aclDtype));
-    auto temp = FlattenArray(a);
-
-    std::vector<int64_t> tmp{1};
-    aclIntArray* axis_array = aclCreateIntArray(tmp.data(), tmp.size());
-    auto outDtype = dtype.has_value() ? dtype.value() : a.dtype;
-    auto result = NPUArray({1}, outDtype);
-
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor;
-    auto error = aclnnMeanGetWorkspaceSize(temp.tensorPtr, axis_array, false, result.aclDtype, result.tensorPtr,
-                                           &workspaceSize, &executor);
-    ACLNN_CHECK(error, "aclnnMeanGetWorkspaceSize");
-
-    AclWorkspace workspace(workspaceSize);
-
-    error = aclnnMean(workspace.get(), workspaceSize, executor, nullptr);
-    ACLNN_CHECK(error, "aclnnMean");
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    LOG_INFO("aclnnMean completed");
-    return ExtractScalarValue(result);
-}
+NPUArray Mean(const NPUArray& a, std::optional<py::dtype> dtype) { return Mean(a, std::nullopt, false, dtype); }
 } // namespace asnumpy
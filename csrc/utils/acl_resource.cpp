@@ -16,7 +16,7 @@
 
 #include "asnumpy/utils/acl_resource.hpp"
 #include <acl/acl.h>
-#include <spdlog/spdlog.h>
+#include "asnumpy/cann/graph.hpp"
 #include "asnumpy/utils/status_handler.hpp"
 
 namespace asnumpy {
@@ -25,39 +25,51 @@ namespace asnumpy {
 // AclWorkspace
 // ============================================================================
 
-AclWorkspace::AclWorkspace(uint64_t size) : size_(size) {
+AclWorkspace::AclWorkspace(uint64_t size, aclrtStream stream) : size_(size) {
+    if (size_ > 0ULL && cann::CapturingGraph()) {
+        // Baked into the graph, so it must outlive the arena's current buffer.
+        ptr_ = cann::CapturingGraph()->AllocateWorkspace(size_);
+        return;
+    }
     if (size_ > 0ULL) {
-        auto error = aclrtMalloc(&ptr_, size_, ACL_MEM_MALLOC_HUGE_FIRST);
-        ACL_RT_CHECK(error, "aclrtMalloc");
-        spdlog::info("AclWorkspace allocated {} bytes", size_);
+        auto& arena = cann::WorkspaceArena::ForStream(stream);
+        ptr_ = arena.Acquire(size_);
+        arena_ = &arena;
+        LOG_DEBUG("AclWorkspace leased {} bytes", size_);
     }
 }
 
-AclWorkspace::~AclWorkspace() {
-    if (ptr_) {
-        aclrtFree(ptr_);
-    }
-}
+AclWorkspace::~AclWorkspace() { Reset(); }
 
-AclWorkspace::AclWorkspace(AclWorkspace&& other) noexcept : ptr_(other.ptr_), size_(other.size_) {
+AclWorkspace::AclWorkspace(AclWorkspace&& other) noexcept
+    : arena_(other.arena_), ptr_(other.ptr_), size_(other.size_) {
+    other.arena_ = nullptr;
     other.ptr_ = nullptr;
     other.size_ = 0;
 }
 
 AclWorkspace& AclWorkspace::operator=(AclWorkspace&& other) noexcept {
     if (this != &other) {
-        // Free current resource
-        if (ptr_) {
-            aclrtFree(ptr_);
-        }
-        // Take ownership of other resource
+        // End current lease
+        Reset();
+        // Take over the other lease
+        arena_ = other.arena_;
         ptr_ = other.ptr_;
         size_ = other.size_;
         // Clear other object
+        other.arena_ = nullptr;
         other.ptr_ = nullptr;
         other.size_ = 0;
     }
     return *this;
 }
 
+void AclWorkspace::Reset() noexcept {
+    if (arena_) {
+        arena_->Release();
+        arena_ = nullptr;
+    }
+    ptr_ = nullptr;
+}
+
 } // namespace asnumpy
@@ -16,6 +16,8 @@
 
 #include <asnumpy/utils/cast.hpp>
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
 #include <asnumpy/utils/status_handler.hpp>
 
@@ -26,7 +28,7 @@ namespace asnumpy {
 
 NPUArray CastTo(const NPUArray& input, aclDataType targetDtype) {
     if (input.aclDtype == targetDtype)
-        return NPUArray(input); // deep copy; keeps callers free to cast unconditionally
+        return NPUArray(input); // copy-on-write; keeps callers free to cast unconditionally
 
     LOG_DEBUG("aclnnCast start: tensorSize={}, from={}, to={}", input.tensorSize, AclDtypeName(input.aclDtype),
               AclDtypeName(targetDtype));
@@ -35,15 +37,14 @@ NPUArray CastTo(const NPUArray& input, aclDataType targetDtype) {
 
     uint64_t workspaceSize = 0;
     aclOpExecutor* executor = nullptr;
-    auto error = aclnnCastGetWorkspaceSize(input.tensorPtr, targetDtype, result.tensorPtr, &workspaceSize, &executor);
+    auto error = aclnnCastGetWorkspaceSize(input.tensor(), targetDtype, result.tensor(), &workspaceSize, &executor);
     ACLNN_CHECK(error, "aclnnCastGetWorkspaceSize");
 
     AclWorkspace workspace(workspaceSize);
-    error = aclnnCast(workspace.get(), workspaceSize, executor, nullptr);
+    error = aclnnCast(workspace.get(), workspaceSize, executor, cann::CurrentStream());
     ACLNN_CHECK(error, "aclnnCast");
 
-    error = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(error, "aclnnCast: aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnCast");
 
     LOG_INFO("aclnnCast completed");
     return result;
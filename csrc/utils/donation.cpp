@@ -0,0 +1,59 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ ******************************************************************************/
+
+#include <asnumpy/utils/donation.hpp>
+
+#include <atomic>
+
+namespace asnumpy {
+
+namespace {
+
+// Element-wise kernels that have an aclnnInplace* form, i.e. that CANN itself runs with the output
+// over an input. Reductions, scans, sorts and anything gathering from other positions stay out.
+constexpr std::string_view kOverwritingKernels[] = {
+    "aclnnAdd",   "aclnnAdds", "aclnnSub",   "aclnnSubs",  "aclnnMul",  "aclnnMuls",  "aclnnDiv",
+    "aclnnDivs",  "aclnnExp",  "aclnnExp2",  "aclnnExpm1", "aclnnLog",  "aclnnLog2",  "aclnnLog10",
+    "aclnnLog1p", "aclnnSqrt", "aclnnSin",   "aclnnCos",   "aclnnTan",  "aclnnTanh",  "aclnnSinh",
+    "aclnnCosh",  "aclnnAsin", "aclnnAcos",  "aclnnAtan",  "aclnnNeg",  "aclnnReciprocal",
+};
+
+std::atomic<uint64_t> g_donationsElided{0};
+std::atomic<uint64_t> g_donationsDeclined{0};
+
+} // namespace
+
+bool KernelWritesOverInput(std::string_view aclnn_api) {
+    for (std::string_view kernel : kOverwritingKernels) {
+        if (kernel == aclnn_api)
+            return true;
+    }
+    return false;
+}
+
+DonationStats GetDonationStats() {
+    return {g_donationsElided.load(std::memory_order_relaxed), g_donationsDeclined.load(std::memory_order_relaxed)};
+}
+
+namespace detail {
+
+void CountDonation(bool elided) {
+    (elided ? g_donationsElided : g_donationsDeclined).fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+} // namespace asnumpy
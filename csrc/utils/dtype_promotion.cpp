@@ -14,6 +14,8 @@
  * limitations under the License.
  *****************************************************************************/
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/utils/dtype_promotion.hpp>
 #include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
@@ -74,13 +76,12 @@ NPUArray CastToDtype(const NPUArray& input, aclDataType targetDtype) {
     auto result = NPUArray(input.shape, targetDtype);
     uint64_t wsSize = 0;
     aclOpExecutor* exec = nullptr;
-    auto err = aclnnCastGetWorkspaceSize(input.tensorPtr, targetDtype, result.tensorPtr, &wsSize, &exec);
+    auto err = aclnnCastGetWorkspaceSize(input.tensor(), targetDtype, result.tensor(), &wsSize, &exec);
     ACLNN_CHECK(err, "aclnnCastGetWorkspaceSize");
     AclWorkspace ws(wsSize);
-    err = aclnnCast(ws.get(), wsSize, exec, nullptr);
+    err = aclnnCast(ws.get(), wsSize, exec, cann::CurrentStream());
     ACLNN_CHECK(err, "aclnnCast");
-    err = aclrtSynchronizeDevice();
-    ACL_RT_CHECK(err, "aclrtSynchronizeDevice");
+    ACL_OP_LAUNCHED("aclnnCast");
     LOG_INFO("aclnnCast completed");
     return result;
 }
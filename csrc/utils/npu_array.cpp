@@ -14,10 +14,109 @@
  * limitations under the License.
  *****************************************************************************/
 
+
+#include <aclnnop/aclnn_copy.h>
+#include <asnumpy/cann/allocator.hpp>
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/graph.hpp>
+#include <asnumpy/cann/pinned.hpp>
+#include <asnumpy/cann/stream.hpp>
 #include <asnumpy/dtypes/dtype_table.hpp>
+#include <asnumpy/utils/acl_resource.hpp>
 #include <asnumpy/utils/npu_array.hpp>
 #include <asnumpy/utils/status_handler.hpp>
 #include <cstddef>
+#include <cstring>
+#include <fmt/ranges.h>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+std::vector<int64_t> ContiguousStrides(const std::vector<int64_t>& shape) {
+    std::vector<int64_t> strides(shape.size());
+    int64_t currentStride = 1;
+    for (int64_t i = static_cast<int64_t>(shape.size()) - 1; i >= 0; i--) {
+        strides[i] = currentStride;
+        currentStride *= shape[i];
+    }
+    return strides;
+}
+
+std::shared_ptr<NPUStorage> NewStorage(size_t nbytes) {
+    return std::make_shared<NPUStorage>(std::make_shared<NPUBuffer>(nbytes, asnumpy::cann::CurrentStream()));
+}
+
+// Marker behind the copy just launched on the current stream; blocking mode has already waited.
+std::shared_ptr<asnumpy::cann::StreamMarker> CompletionMarker() {
+    if (asnumpy::cann::GetExecutionMode() == asnumpy::cann::ExecutionMode::Blocking) {
+        return nullptr;
+    }
+    return asnumpy::cann::StreamMarker::Record(asnumpy::cann::CurrentStream());
+}
+
+// NumPy array over pinned pool memory; the capsule hands the block back when NumPy frees it.
+py::array PinnedArray(const py::dtype& dtype, const std::vector<int64_t>& shape, size_t nbytes) {
+    void* ptr = asnumpy::cann::PinnedHostPool::Instance().Allocate(std::max<size_t>(nbytes, 1));
+    py::capsule owner(ptr, [](void* p) { asnumpy::cann::PinnedHostPool::Instance().Free(p); });
+    return py::array(dtype, shape, ptr, owner);
+}
+
+} // namespace
+
+/**
+ * @brief Allocate a device buffer of `nbytes` on `stream` from the caching allocator.
+ *
+ * A zero-byte buffer holds a null pointer, which is what aclCreateTensor expects for empty arrays.
+ */
+NPUBuffer::NPUBuffer(size_t nbytes, aclrtStream stream) : asnumpy::cann::BufferUsage(nullptr, stream), nbytes(nbytes) {
+    if (nbytes > 0) {
+        this->ptr = asnumpy::cann::CachingAllocator::Instance().Allocate(nbytes, stream);
+    }
+}
+
+/**
+ * @brief Wrap `nbytes` of device memory at `ptr` that `owner` keeps alive.
+ *
+ * The memory is not the caching allocator's, so uses on other streams are not reported to it.
+ */
+NPUBuffer::NPUBuffer(void* ptr, size_t nbytes, std::shared_ptr<void> owner)
+    : asnumpy::cann::BufferUsage(ptr, asnumpy::cann::CurrentStream()), nbytes(nbytes), owner(std::move(owner)) {
+    this->pooled = false;
+    this->aliased.store(true, std::memory_order_release);
+}
+
+NPUBuffer::~NPUBuffer() {
+    if (this->owner) {
+        // The owner frees the memory with no regard for our streams: let queued work on it finish.
+        for (const auto& marker : this->reads) {
+            aclrtSynchronizeEvent(marker->event());
+        }
+        if (this->lastWrite) {
+            aclrtSynchronizeEvent(this->lastWrite->event());
+        }
+        return;
+    }
+    if (this->ptr) {
+        asnumpy::cann::CachingAllocator::Instance().Free(this->ptr);
+    }
+}
+
+NPUStorage::NPUStorage(std::shared_ptr<NPUBuffer> buffer) : buffer(std::move(buffer)) {
+    this->buffer->storages.fetch_add(1, std::memory_order_acq_rel);
+}
+
+NPUStorage::~NPUStorage() { this->buffer->storages.fetch_sub(1, std::memory_order_acq_rel); }
+
+/**
+ * @brief Point this storage, and therefore every view of it, at `replacement`.
+ */
+void NPUStorage::Reset(std::shared_ptr<NPUBuffer> replacement) {
+    replacement->storages.fetch_add(1, std::memory_order_acq_rel);
+    this->buffer->storages.fetch_sub(1, std::memory_order_acq_rel);
+    this->buffer = std::move(replacement);
+}
 
 /**
  * @brief Constructor that creates an NPUArray with specified shape and data type.
@@ -29,26 +128,15 @@
  * @param dtype np.dtype defining the data type of array elements.
  * @throws std::runtime_error If memory allocation fails or data type is not supported.
  */
-NPUArray::NPUArray(const std::vector<int64_t>& shape, py::dtype dtype) {
+NPUArray::NPUArray(const std::vector<int64_t>& shape, py::dtype dtype) : tensorPtr(nullptr) {
     this->shape = shape;
     this->dtype = dtype;
     this->aclDtype = GetACLDataType(dtype);
     tensorSize = GetShapeSize(shape);
     auto tensorByteSize = this->tensorSize * GetDataTypeSize(this->aclDtype);
-    this->devicePtr = nullptr;
-    if (tensorByteSize > 0) {
-        auto error = aclrtMalloc(&this->devicePtr, tensorByteSize, ACL_MEM_MALLOC_HUGE_FIRST);
-        ACL_RT_CHECK(error, "aclrtMalloc");
-    }
-    this->strides.resize(this->shape.size());
-    auto currentStride = 1;
-    for (int64_t i = this->shape.size() - 1; i >= 0; i--) {
-        this->strides[i] = currentStride;
-        currentStride *= this->shape[i];
-    }
-    tensorPtr =
-        aclCreateTensor(this->shape.data(), this->shape.size(), GetACLDataType(this->dtype), this->strides.data(), 0,
-                        ACL_FORMAT_ND, this->shape.data(), this->shape.size(), this->devicePtr);
+    this->storage_ = NewStorage(tensorByteSize);
+    this->strides = ContiguousStrides(this->shape);
+    CreateTensor();
 }
 
 /**
@@ -62,7 +150,7 @@ NPUArray::NPUArray(const std::vector<int64_t>& shape, py::dtype dtype) {
  * @param acl_type ACL data type constant.
  * @throws std::runtime_error If memory allocation fails or data type is not supported.
  */
-NPUArray::NPUArray(const std::vector<int64_t>& shape, aclDataType acl_type) {
+NPUArray::NPUArray(const std::vector<int64_t>& shape, aclDataType acl_type) : tensorPtr(nullptr) {
     this->shape = shape;
     this->aclDtype = acl_type;
     this->tensorSize = GetShapeSize(shape);
@@ -72,58 +160,27 @@ NPUArray::NPUArray(const std::vector<int64_t>& shape, aclDataType acl_type) {
     // for compatibility, create an empty py::dtype object
     this->dtype = GetPyDtype(acl_type);
 
-    this->devicePtr = nullptr;
-    if (tensorByteSize > 0) {
-        auto error = aclrtMalloc(&this->devicePtr, tensorByteSize, ACL_MEM_MALLOC_HUGE_FIRST);
-        ACL_RT_CHECK(error, "aclrtMalloc");
-    }
-    this->strides.resize(this->shape.size());
-    auto currentStride = 1;
-    for (int64_t i = this->shape.size() - 1; i >= 0; i--) {
-        this->strides[i] = currentStride;
-        currentStride *= this->shape[i];
-    }
-    tensorPtr = aclCreateTensor(this->shape.data(), this->shape.size(), acl_type, this->strides.data(), 0,
-                                ACL_FORMAT_ND, this->shape.data(), this->shape.size(), this->devicePtr);
+    this->storage_ = NewStorage(tensorByteSize);
+    this->strides = ContiguousStrides(this->shape);
+    CreateTensor();
 }
 
 /**
- * @brief Copy constructor - deep copy.
+ * @brief Private constructor for views: fields are filled in by AsStrided.
+ */
+NPUArray::NPUArray() : tensorPtr(nullptr), tensorSize(0) {}
+
+/**
+ * @brief Copy constructor - copy-on-write.
  *
- * Creates a new NPUArray with the same content as the given NPUArray.
- * The new object owns its own memory space and is completely independent of the original.
+ * Creates a new NPUArray with the same content as the given NPUArray. The two are independent:
+ * neither ever observes the other's writes. When `other` covers its buffer densely the buffer is
+ * shared and only duplicated by the first write to either array, so copies that are only read
+ * cost no device memory or copy. Copying a view yields a dense, C-contiguous array.
  *
  * @param other The NPUArray to copy from.
  */
-NPUArray::NPUArray(const NPUArray& other) {
-    this->shape = other.shape;
-    this->dtype = other.dtype;
-    this->aclDtype = other.aclDtype;
-    this->tensorSize = other.tensorSize;
-    this->strides = other.strides;
-    auto tensorByteSize = this->tensorSize * GetDataTypeSize(this->aclDtype);
-    this->devicePtr = nullptr;
-    if (tensorByteSize > 0) {
-        auto error = aclrtMalloc(&this->devicePtr, tensorByteSize, ACL_MEM_MALLOC_HUGE_FIRST);
-        ACL_RT_CHECK(error, "aclrtMalloc");
-        this->tensorPtr = aclCreateTensor(this->shape.data(), this->shape.size(), this->aclDtype, this->strides.data(),
-                                          0, ACL_FORMAT_ND, this->shape.data(), this->shape.size(), this->devicePtr);
-        void* srcPtr = nullptr;
-        error = aclGetRawTensorAddr(other.tensorPtr, &srcPtr);
-        ACL_RT_CHECK(error, "aclGetRawTensorAddr");
-        if (!srcPtr) {
-            throw std::runtime_error("[npu_array.cpp](NPUArray) aclGetRawTensorAddr returned null pointer");
-        }
-        error = aclrtMemcpy(this->devicePtr, tensorByteSize, srcPtr, tensorByteSize, ACL_MEMCPY_DEVICE_TO_DEVICE);
-        ACL_RT_CHECK(error, "aclrtMemcpy");
-        error = aclrtSynchronizeDevice();
-        ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-    } else {
-        // zero-size array; pass nullptr as data pointer when creating tensor
-        this->tensorPtr = aclCreateTensor(this->shape.data(), this->shape.size(), this->aclDtype, this->strides.data(),
-                                          0, ACL_FORMAT_ND, this->shape.data(), this->shape.size(), nullptr);
-    }
-}
+NPUArray::NPUArray(const NPUArray& other) : tensorPtr(nullptr) { CopyFrom(other); }
 
 /**
  * @brief Move constructor.
@@ -140,60 +197,24 @@ NPUArray::NPUArray(NPUArray&& other) noexcept {
     this->aclDtype = other.aclDtype;
     this->tensorSize = other.tensorSize;
     this->strides = std::move(other.strides);
-    this->devicePtr = other.devicePtr;
+    this->storageOffset = other.storageOffset;
+    this->storage_ = std::move(other.storage_);
+    this->tensorData_ = other.tensorData_;
     other.tensorPtr = nullptr;
-    other.devicePtr = nullptr;
 }
 
 /**
  * @brief Copy assignment operator.
  *
- * Implements deep copy assignment, ensuring the current object is completely independent of the right-hand object.
+ * Copy-on-write like the copy constructor: the current object never observes writes to the right-hand object,
+ * nor the right-hand object writes to the current one.
  *
  * @param other The NPUArray to copy from.
  * @return Reference to this NPUArray.
  */
 NPUArray& NPUArray::operator=(const NPUArray& other) {
     if (this != &other) {
-        // release old resources
-        if (this->tensorPtr) {
-            aclDestroyTensor(this->tensorPtr);
-            this->tensorPtr = nullptr;
-        }
-        if (this->devicePtr) {
-            aclrtFree(this->devicePtr);
-            this->devicePtr = nullptr;
-        }
-        this->shape = other.shape;
-        this->dtype = other.dtype;
-        this->aclDtype = other.aclDtype;
-        this->tensorSize = other.tensorSize;
-        this->strides = other.strides;
-
-        auto tensorByteSize = this->tensorSize * GetDataTypeSize(this->aclDtype);
-        this->devicePtr = nullptr;
-        if (tensorByteSize > 0) {
-            auto error = aclrtMalloc(&this->devicePtr, tensorByteSize, ACL_MEM_MALLOC_HUGE_FIRST);
-            ACL_RT_CHECK(error, "aclrtMalloc");
-            this->tensorPtr =
-                aclCreateTensor(this->shape.data(), this->shape.size(), this->aclDtype, this->strides.data(), 0,
-                                ACL_FORMAT_ND, this->shape.data(), this->shape.size(), this->devicePtr);
-            void* srcPtr = nullptr;
-            error = aclGetRawTensorAddr(other.tensorPtr, &srcPtr);
-            ACL_RT_CHECK(error, "aclGetRawTensorAddr");
-            if (!srcPtr) {
-                throw std::runtime_error("[npu_array.cpp](operator=) aclGetRawTensorAddr returned null pointer");
-            }
-            error = aclrtMemcpy(this->devicePtr, tensorByteSize, srcPtr, tensorByteSize, ACL_MEMCPY_DEVICE_TO_DEVICE);
-            ACL_RT_CHECK(error, "aclrtMemcpy");
-            error = aclrtSynchronizeDevice();
-            ACL_RT_CHECK(error, "aclrtSynchronizeDevice");
-        } else {
-            // zero-size array; pass nullptr as data pointer when creating tensor
-            this->tensorPtr =
-                aclCreateTensor(this->shape.data(), this->shape.size(), this->aclDtype, this->strides.data(), 0,
-                                ACL_FORMAT_ND, this->shape.data(), this->shape.size(), nullptr);
-        }
+        CopyFrom(other);
     }
     return *this;
 }
@@ -209,41 +230,347 @@ NPUArray& NPUArray::operator=(const NPUArray& other) {
  */
 NPUArray& NPUArray::operator=(NPUArray&& other) noexcept {
     if (this != &other) {
-        // release old resources
+        // release old resources; the storage goes back to the allocator once no view refers to it
         if (this->tensorPtr) {
             aclDestroyTensor(this->tensorPtr);
             this->tensorPtr = nullptr;
         }
-        if (this->devicePtr) {
-            aclrtFree(this->devicePtr);
-            this->devicePtr = nullptr;
-        }
         this->tensorPtr = other.tensorPtr;
-        this->devicePtr = other.devicePtr;
         this->shape = std::move(other.shape);
         this->dtype = other.dtype;
         this->aclDtype = other.aclDtype;
         this->tensorSize = other.tensorSize;
         this->strides = std::move(other.strides);
-        this->devicePtr = other.devicePtr;
+        this->storageOffset = other.storageOffset;
+        this->storage_ = std::move(other.storage_);
+        this->tensorData_ = other.tensorData_;
         other.tensorPtr = nullptr;
-        other.devicePtr = nullptr;
     }
     return *this;
 }
 
 /**
  * @brief Destructor that releases resources occupied by NPUArray.
+ *
+ * Only the tensor descriptor is owned outright; the device buffer is released by NPUStorage when
+ * the last view of it goes away.
  */
 NPUArray::~NPUArray() {
     if (this->tensorPtr) {
-        auto error = aclDestroyTensor(this->tensorPtr);
+        aclDestroyTensor(this->tensorPtr);
         this->tensorPtr = nullptr;
     }
-    if (this->devicePtr) {
-        auto error = aclrtFree(this->devicePtr);
-        this->devicePtr = nullptr;
+}
+
+/**
+ * @brief Storage dims aclCreateTensor is given for this array.
+ *
+ * An array that covers its whole buffer densely describes the storage by its own shape, exactly
+ * as before views existed; any other view describes it as a flat run of elements.
+ */
+std::vector<int64_t> NPUArray::StorageDims() const {
+    auto itemsize = GetDataTypeSize(this->aclDtype);
+    size_t storageBytes = this->storage_ ? this->storage_->buffer->nbytes : 0;
+    if (this->storageOffset != 0 || !IsContiguous() || this->tensorSize * itemsize != storageBytes) {
+        return {static_cast<int64_t>(storageBytes / itemsize)};
     }
+    return this->shape;
+}
+
+/**
+ * @brief (Re)create the aclTensor descriptor for this array's shape, strides and offset.
+ */
+void NPUArray::CreateTensor() const {
+    if (this->tensorPtr) {
+        aclDestroyTensor(this->tensorPtr);
+        this->tensorPtr = nullptr;
+    }
+    auto storageDims = StorageDims();
+    this->tensorData_ = this->storage_ ? this->storage_->buffer->ptr : nullptr;
+    this->tensorPtr = aclCreateTensor(this->shape.data(), this->shape.size(), this->aclDtype, this->strides.data(),
+                                      this->storageOffset, ACL_FORMAT_ND, storageDims.data(), storageDims.size(),
+                                      this->tensorData_);
+}
+
+/**
+ * @brief Duplicate a buffer this array's storage shares with a copy, before the first write.
+ *
+ * The duplicate is a stream-ordered device-to-device copy of the whole buffer: a read of the
+ * shared buffer (so it waits for that buffer's last writer, and the other owner's next write
+ * waits for it) and the first write of the new one. Every view of this storage follows, because
+ * the storage itself is re-pointed; their descriptors are rebuilt on next use.
+ *
+ * @throws std::runtime_error If the copy cannot be launched.
+ */
+void NPUArray::Unshare() {
+    auto shared = this->storage_->buffer;
+    auto fresh = std::make_shared<NPUBuffer>(shared->nbytes, asnumpy::cann::CurrentStream());
+    LOG_DEBUG("copy-on-write: duplicating {} bytes", shared->nbytes);
+    if (shared->nbytes > 0) {
+        asnumpy::cann::NestedLaunchScope nested;
+        asnumpy::cann::TrackRead(shared);
+        asnumpy::cann::TrackWrite(fresh);
+        auto error = aclrtMemcpyAsync(fresh->ptr, fresh->nbytes, shared->ptr, shared->nbytes,
+                                      ACL_MEMCPY_DEVICE_TO_DEVICE, asnumpy::cann::CurrentStream());
+        ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+        ACL_OP_LAUNCHED("aclrtMemcpyAsync");
+    }
+    this->storage_->Reset(std::move(fresh));
+}
+
+/**
+ * @brief Make this array a copy of `other`.
+ *
+ * When `other` covers its whole buffer densely this array gets a new storage over the same buffer
+ * (copy-on-write; see Unshare). A view of part of a buffer is copied now instead, so a small copy
+ * never keeps a large buffer alive: contiguous sources with one stream-ordered memcpy, strided
+ * views through aclnnInplaceCopy, which gathers by the source strides into the dense destination.
+ *
+ * @param other The NPUArray to copy from; may be a view of this array's storage.
+ * @throws std::runtime_error If the copy cannot be launched.
+ */
+void NPUArray::CopyFrom(const NPUArray& other) {
+    // Keep other's buffer alive across the copy even if `other` is a view this array replaces.
+    auto source = other.storage_ ? other.storage_->buffer : nullptr;
+    auto sourceAddress = other.device_address();
+    bool sourceContiguous = other.IsContiguous();
+    auto tensorByteSize = other.tensorSize * GetDataTypeSize(other.aclDtype);
+    bool sharesWholeBuffer = source && sourceContiguous && other.storageOffset == 0 &&
+                             tensorByteSize == source->nbytes && !source->aliased.load(std::memory_order_acquire);
+
+    this->shape = other.shape;
+    this->dtype = other.dtype;
+    this->aclDtype = other.aclDtype;
+    this->tensorSize = other.tensorSize;
+    this->strides = sharesWholeBuffer ? other.strides : ContiguousStrides(this->shape);
+    this->storageOffset = 0;
+    if (sharesWholeBuffer) {
+        this->storage_ = std::make_shared<NPUStorage>(source);
+        CreateTensor();
+        return;
+    }
+    this->storage_ = NewStorage(tensorByteSize);
+    CreateTensor();
+    if (tensorByteSize == 0) {
+        return;
+    }
+
+    if (sourceContiguous) {
+        // Stream-ordered, so the copy sees every queued write to `other`.
+        asnumpy::cann::TrackRead(source);
+        asnumpy::cann::TrackWrite(this->storage_->buffer);
+        auto error = aclrtMemcpyAsync(this->storage_->buffer->ptr, tensorByteSize, sourceAddress, tensorByteSize,
+                                      ACL_MEMCPY_DEVICE_TO_DEVICE, asnumpy::cann::CurrentStream());
+        ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+        ACL_OP_LAUNCHED("aclrtMemcpyAsync");
+        return;
+    }
+
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor = nullptr;
+    auto ret = aclnnInplaceCopyGetWorkspaceSize(this->tensor(), other.tensor(), &workspaceSize, &executor);
+    ACLNN_CHECK(ret, "aclnnInplaceCopyGetWorkspaceSize");
+    asnumpy::AclWorkspace workspace(workspaceSize);
+    ret = aclnnInplaceCopy(workspace.get(), workspaceSize, executor, asnumpy::cann::CurrentStream());
+    ACLNN_CHECK(ret, "aclnnInplaceCopy");
+    ACL_OP_LAUNCHED("aclnnInplaceCopy");
+}
+
+void* NPUArray::device_address() const {
+    if (!this->storage_ || !this->storage_->buffer->ptr) {
+        return nullptr;
+    }
+    return static_cast<char*>(this->storage_->buffer->ptr) + this->storageOffset * GetDataTypeSize(this->aclDtype);
+}
+
+/**
+ * @brief Create a view sharing this array's storage.
+ *
+ * @return std::unique_ptr<NPUArray> A view with the same shape, strides and offset.
+ */
+std::unique_ptr<NPUArray> NPUArray::View() const {
+    return std::make_unique<NPUArray>(AsStrided(this->shape, this->strides, this->storageOffset));
+}
+
+/**
+ * @brief Create a view of this array's storage with arbitrary shape, strides and offset.
+ *
+ * Only metadata is built: the returned array refers to the same NPUStorage, so no device memory
+ * is allocated or copied and the cost is independent of the array size.
+ *
+ * @param shape View shape.
+ * @param strides View strides, in elements; must be non-negative.
+ * @param storageOffset Offset of the first element, in elements from the start of the storage.
+ * @return NPUArray The view.
+ * @throws std::invalid_argument If the ranks differ, a stride or the offset is negative, or the view
+ *         reaches past the end of the storage. Surfaces to Python as ValueError.
+ */
+NPUArray NPUArray::AsStrided(const std::vector<int64_t>& shape, const std::vector<int64_t>& strides,
+                             int64_t storageOffset) const {
+    if (shape.size() != strides.size()) {
+        throw std::invalid_argument(fmt::format(
+            "[npu_array.cpp](AsStrided) shape has {} dimensions but strides has {}", shape.size(), strides.size()));
+    }
+    if (storageOffset < 0) {
+        throw std::invalid_argument("[npu_array.cpp](AsStrided) storage offset must be non-negative");
+    }
+    auto itemsize = GetDataTypeSize(this->aclDtype);
+    int64_t capacity = this->storage_ ? static_cast<int64_t>(this->storage_->buffer->nbytes) / itemsize : 0;
+    int64_t size = GetShapeSize(shape);
+    int64_t last = storageOffset;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (strides[i] < 0) {
+            throw std::invalid_argument("[npu_array.cpp](AsStrided) strides must be non-negative");
+        }
+        if (shape[i] > 0) {
+            last += (shape[i] - 1) * strides[i];
+        }
+    }
+    if (size > 0 && last >= capacity) {
+        throw std::invalid_argument(fmt::format(
+            "[npu_array.cpp](AsStrided) view reaches element {} of a storage holding {}", last, capacity));
+    }
+
+    NPUArray view;
+    view.shape = shape;
+    view.strides = strides;
+    view.storageOffset = storageOffset;
+    view.dtype = this->dtype;
+    view.aclDtype = this->aclDtype;
+    view.tensorSize = size;
+    view.storage_ = this->storage_;
+    view.CreateTensor();
+    return view;
+}
+
+/**
+ * @brief Check whether the array is C-contiguous.
+ *
+ * Follows NumPy: dimensions of size 1 may have any stride, and an empty array is contiguous.
+ */
+bool NPUArray::IsContiguous() const {
+    if (this->tensorSize == 0) {
+        return true;
+    }
+    int64_t expected = 1;
+    for (int64_t i = static_cast<int64_t>(this->shape.size()) - 1; i >= 0; i--) {
+        if (this->shape[i] == 1) {
+            continue;
+        }
+        if (this->strides[i] != expected) {
+            return false;
+        }
+        expected *= this->shape[i];
+    }
+    return true;
+}
+
+/**
+ * @brief Return a C-contiguous array with this array's contents.
+ *
+ * A contiguous array comes back as a view of the same storage; a strided view is materialized.
+ */
+NPUArray NPUArray::Contiguous() const {
+    if (IsContiguous()) {
+        return AsStrided(this->shape, this->strides, this->storageOffset);
+    }
+    return NPUArray(*this);
+}
+
+bool NPUArray::SharesStorage(const NPUArray& other) const {
+    return this->storage_ != nullptr && this->storage_ == other.storage_;
+}
+
+/**
+ * @brief Copy the elements of `other` into this array's storage.
+ *
+ * Contiguous pairs take one stream-ordered memcpy, anything else aclnnInplaceCopy. A source that
+ * is a view of this array's storage is first copied out, so overlapping ranges are safe.
+ *
+ * @param other Array of the same shape and dtype.
+ * @throws std::invalid_argument If the shapes or dtypes differ.
+ * @throws std::runtime_error If the copy cannot be launched.
+ */
+void NPUArray::Assign(const NPUArray& other) {
+    if (this->shape != other.shape || this->aclDtype != other.aclDtype) {
+        throw std::invalid_argument(fmt::format("[npu_array.cpp](Assign) cannot assign an array of shape ({}) and "
+                                                "dtype {} to one of shape ({}) and dtype {}",
+                                                fmt::join(other.shape, ", "), asnumpy::AclDtypeName(other.aclDtype),
+                                                fmt::join(this->shape, ", "), asnumpy::AclDtypeName(this->aclDtype)));
+    }
+    if (this->tensorSize == 0) {
+        return;
+    }
+    if (SharesStorage(other)) {
+        if (this->storageOffset == other.storageOffset && this->strides == other.strides) {
+            return;
+        }
+        NPUArray copy(other.shape, other.aclDtype);
+        copy.Assign(other);
+        Assign(copy);
+        return;
+    }
+
+    if (IsContiguous() && other.IsContiguous()) {
+        auto tensorByteSize = this->tensorSize * GetDataTypeSize(this->aclDtype);
+        this->tensor(); // unshares, and tracks the write
+        std::as_const(other).tensor();
+        auto error = aclrtMemcpyAsync(device_address(), tensorByteSize, other.device_address(), tensorByteSize,
+                                      ACL_MEMCPY_DEVICE_TO_DEVICE, asnumpy::cann::CurrentStream());
+        ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+        ACL_OP_LAUNCHED("aclrtMemcpyAsync");
+        return;
+    }
+
+    uint64_t workspaceSize = 0;
+    aclOpExecutor* executor = nullptr;
+    auto ret = aclnnInplaceCopyGetWorkspaceSize(this->tensor(), other.tensor(), &workspaceSize, &executor);
+    ACLNN_CHECK(ret, "aclnnInplaceCopyGetWorkspaceSize");
+    asnumpy::AclWorkspace workspace(workspaceSize);
+    ret = aclnnInplaceCopy(workspace.get(), workspaceSize, executor, asnumpy::cann::CurrentStream());
+    ACLNN_CHECK(ret, "aclnnInplaceCopy");
+    ACL_OP_LAUNCHED("aclnnInplaceCopy");
+}
+
+void NPUArray::MakeExclusive() {
+    if (!this->storage_) {
+        return;
+    }
+    if (this->storage_->IsShared()) {
+        Unshare();
+    }
+    this->storage_->buffer->aliased.store(true, std::memory_order_release);
+}
+
+/**
+ * @brief Mark this array's buffer as free for the next operator's result.
+ *
+ * The buffer must be ours alone: one storage, no views of it, and not aliased by DLPack or a
+ * captured graph. It must also hold exactly this array's elements in C order, so that an operator
+ * whose result has this array's shape and dtype can take it without reinterpreting a byte.
+ */
+bool NPUArray::Donate() {
+    if (!this->storage_ || this->tensorSize == 0 || this->storage_.use_count() != 1 || this->storage_->IsShared()) {
+        return false;
+    }
+    NPUBuffer& buffer = *this->storage_->buffer;
+    const bool dense = this->storageOffset == 0 && IsContiguous() &&
+                       static_cast<size_t>(this->tensorSize * GetDataTypeSize(this->aclDtype)) == buffer.nbytes;
+    if (!dense || buffer.aliased.load(std::memory_order_acquire)) {
+        return false;
+    }
+    buffer.donated.store(true, std::memory_order_release);
+    return true;
+}
+
+void NPUArray::Reclaim() const {
+    if (this->storage_) {
+        this->storage_->buffer->donated.store(false, std::memory_order_release);
+    }
+}
+
+bool NPUArray::IsDonated() const {
+    return this->storage_ && this->storage_->buffer->donated.load(std::memory_order_acquire);
 }
 
 /**
@@ -268,30 +595,103 @@ NPUArray NPUArray::FromNumpy(py::array hostData) {
     if (!rawDataPtr) {
         throw std::runtime_error("[npu_array.cpp](FromNumpy) aclGetRawTensorAddr returned null pointer");
     }
-    error = aclrtMemcpy(rawDataPtr, tensorByteSize, info.ptr, tensorByteSize, ACL_MEMCPY_HOST_TO_DEVICE);
-    ACL_RT_CHECK(error, "aclrtMemcpy");
-    error = aclrtSynchronizeStream(nullptr);
-    ACL_RT_CHECK(error, "aclrtSynchronizeStream");
+    asnumpy::cann::MemcpyHostToDevice(rawDataPtr, info.ptr, tensorByteSize, result.storage_->buffer);
+    return result;
+}
+
+/**
+ * @brief Start copying a NumPy array to a new NPUArray without waiting for the copy.
+ *
+ * The copy is queued on the current stream and the result is tracked as written by it, so
+ * operators on any stream that use the result wait for it on the device. In blocking mode the
+ * copy has finished on return and `done` is null.
+ *
+ * @param hostData Input NumPy array.
+ * @param done Set to a marker behind the copy, or nullptr if it has already finished.
+ * @return NPUArray The created NPUArray.
+ * @throws std::runtime_error If the copy cannot be queued.
+ */
+NPUArray NPUArray::FromNumpyAsync(py::array hostData, std::shared_ptr<asnumpy::cann::StreamMarker>& done) {
+    asnumpy::cann::ThrowIfCapturing(__FILE__, __func__);
+    done = nullptr;
+    py::buffer_info info = hostData.request();
+    size_t tensorByteSize = info.size * info.itemsize;
+    auto result = NPUArray(info.shape, hostData.dtype());
+    if (tensorByteSize == 0)
+        return result;
+
+    auto& pool = asnumpy::cann::PinnedHostPool::Instance();
+    auto stream = asnumpy::cann::CurrentStream();
+    const void* src = info.ptr;
+    void* staging = nullptr;
+    if (!pool.Contains(src, tensorByteSize)) {
+        // An async copy out of pageable memory is not truly async; snapshot it into pinned memory.
+        staging = pool.Allocate(tensorByteSize);
+        std::memcpy(staging, src, tensorByteSize);
+        src = staging;
+    }
+    try {
+        asnumpy::cann::TrackWrite(result.storage_->buffer);
+        auto error = aclrtMemcpyAsync(result.device_address(), tensorByteSize, src, tensorByteSize,
+                                      ACL_MEMCPY_HOST_TO_DEVICE, stream);
+        ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+        ACL_OP_LAUNCHED("aclrtMemcpyAsync");
+        done = CompletionMarker();
+    } catch (...) {
+        aclrtSynchronizeStream(stream);
+        pool.Free(staging);
+        throw;
+    }
+    pool.Free(staging, done);
     return result;
 }
 
 /**
  * @brief Convert NPUArray to NumPy array.
  *
- * Copies data from NPU device memory to host memory and returns a NumPy array.
+ * Copies data from NPU device memory to host memory and returns a NumPy array. A strided view is
+ * first made contiguous on device, so the host copy is always a single memcpy.
  *
  * @return py::array The converted NumPy array.
  * @throws std::runtime_error If getting tensor data pointer fails or data copy fails.
  * @throws std::runtime_error If tensor size doesn't match NumPy array size.
  */
 py::array NPUArray::ToNumpy() const {
+    py::array result(this->dtype, this->shape);
+    return ToNumpy(result);
+}
+
+/**
+ * @brief Copy data from NPU device memory into an existing NumPy array.
+ *
+ * `out` must be writeable, C-contiguous and match this array's shape and dtype. If it is pinned
+ * memory from the pinned host pool (asnumpy.cann.pinned_empty) the data is DMA'd straight into
+ * it; otherwise large copies are staged through pinned buffers and small ones use aclrtMemcpy.
+ *
+ * @param out Destination array.
+ * @return py::array `out`.
+ * @throws std::invalid_argument If `out` does not fit. Surfaces to Python as ValueError.
+ * @throws std::runtime_error If the copy fails.
+ */
+py::array NPUArray::ToNumpy(py::array out) const {
+    bool shapeMatches = out.ndim() == static_cast<py::ssize_t>(this->shape.size());
+    for (size_t i = 0; shapeMatches && i < this->shape.size(); ++i) {
+        shapeMatches = out.shape()[i] == this->shape[i];
+    }
+    if (!shapeMatches || !out.dtype().equal(this->dtype)) {
+        throw std::invalid_argument("[npu_array.cpp](ToNumpy) out must have the same shape and dtype as the array");
+    }
+    if (!(out.flags() & py::array::c_style) || !out.writeable()) {
+        throw std::invalid_argument("[npu_array.cpp](ToNumpy) out must be a writeable C-contiguous array");
+    }
+    if (!IsContiguous()) {
+        return Contiguous().ToNumpy(out);
+    }
     auto tensorByteSize = this->tensorSize * GetDataTypeSize(this->aclDtype);
 
-    // create result array
-    py::array result(this->dtype, this->shape);
-    py::buffer_info info = result.request();
+    py::buffer_info info = out.request(true);
     if (tensorByteSize == 0)
-        return result;
+        return out;
 
     // The host buffer is sized from `dtype`, the device buffer from `aclDtype`. dtype_table keeps
     // those in exact correspondence, so a mismatch means that invariant is broken. Check before
@@ -304,18 +704,257 @@ py::array NPUArray::ToNumpy() const {
                         info.size * info.itemsize, py::str(this->dtype).cast<std::string>(), tensorByteSize,
                         asnumpy::dtypes::Name(this->aclDtype)));
 
-    void* rawDataPtr = nullptr;
-    auto error = aclGetRawTensorAddr(this->tensorPtr, &rawDataPtr);
-    ACL_RT_CHECK(error, "aclGetRawTensorAddr");
+    // Not aclGetRawTensorAddr: that returns the storage start, which is not the first element of
+    // a view with an offset.
+    void* rawDataPtr = device_address();
     if (!rawDataPtr) {
-        throw std::runtime_error("[npu_array.cpp](ToNumpy) aclGetRawTensorAddr returned null pointer");
+        throw std::runtime_error("[npu_array.cpp](ToNumpy) device address is null");
     }
 
+    // The waits below let other threads run, and one of them may rebind this array to new storage
+    // (copy-on-write); the reference keeps the buffer being read alive until the copy is done.
+    auto storage = this->storage_;
+
+    // Host observation point: in async mode wait for the launch that last wrote this array (on
+    // whichever stream) and nothing else.
+    asnumpy::cann::WaitForWriter(*storage->buffer, __FILE__, __func__);
+
     // Every supported dtype has an identical host and device representation (NumPy float16 and
     // ACL_FLOAT16 are both IEEE-754 binary16), so a raw copy is exact for all of them.
-    error = aclrtMemcpy(info.ptr, tensorByteSize, rawDataPtr, tensorByteSize, ACL_MEMCPY_DEVICE_TO_HOST);
-    ACL_RT_CHECK(error, "aclrtMemcpy");
+    auto stream = asnumpy::cann::CurrentStream();
+    if (asnumpy::cann::PinnedHostPool::Instance().Contains(info.ptr, tensorByteSize)) {
+        auto error = aclrtMemcpyAsync(info.ptr, tensorByteSize, rawDataPtr, tensorByteSize,
+                                      ACL_MEMCPY_DEVICE_TO_HOST, stream);
+        ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+        asnumpy::cann::SynchronizeStream(stream, __FILE__, __func__);
+    } else if (tensorByteSize >= asnumpy::cann::kStagingThreshold) {
+        asnumpy::cann::StagedCopyDeviceToHost(info.ptr, rawDataPtr, tensorByteSize, stream);
+    } else {
+        aclError error;
+        {
+            asnumpy::cann::HostWaitScope wait;
+            error = aclrtMemcpy(info.ptr, tensorByteSize, rawDataPtr, tensorByteSize, ACL_MEMCPY_DEVICE_TO_HOST);
+        }
+        ACL_RT_CHECK(error, "aclrtMemcpy");
+    }
+
+    return out;
+}
 
+/**
+ * @brief Start copying NPUArray data to a new pinned NumPy array without waiting for the copy.
+ *
+ * The copy is queued on the current stream behind the last write to this array. Since the
+ * destination is pinned, the DMA needs no staging and the host is not involved until it reads
+ * the result. In blocking mode the copy has finished on return and `done` is null.
+ *
+ * @param done Set to a marker behind the copy, or nullptr if it has already finished.
+ * @return py::array Destination NumPy array; not to be read before `done` completes.
+ * @throws std::runtime_error If the copy cannot be queued.
+ */
+py::array NPUArray::ToNumpyAsync(std::shared_ptr<asnumpy::cann::StreamMarker>& done) const {
+    asnumpy::cann::ThrowIfCapturing(__FILE__, __func__);
+    done = nullptr;
+    if (!IsContiguous()) {
+        return Contiguous().ToNumpyAsync(done);
+    }
+    size_t tensorByteSize = this->tensorSize * GetDataTypeSize(this->aclDtype);
+    auto out = PinnedArray(this->dtype, this->shape, tensorByteSize);
+    if (tensorByteSize == 0)
+        return out;
+
+    asnumpy::cann::TrackRead(this->storage_->buffer);
+    auto stream = asnumpy::cann::CurrentStream();
+    auto error = aclrtMemcpyAsync(out.mutable_data(), tensorByteSize, device_address(), tensorByteSize,
+                                  ACL_MEMCPY_DEVICE_TO_HOST, stream);
+    ACL_RT_CHECK(error, "aclrtMemcpyAsync");
+    ACL_OP_LAUNCHED("aclrtMemcpyAsync");
+    done = CompletionMarker();
+    return out;
+}
+
+/**
+ * @brief Start copying NPUArray data to the host in chunks.
+ *
+ * Like ToNumpy, the host first waits for the last write to the array; the chunks then stream
+ * through the pinned staging ring while the caller consumes earlier ones.
+ *
+ * @param chunkBytes Size of every chunk but the last.
+ * @return std::unique_ptr<ChunkedDeviceToHost> Reader handing out the chunks in order.
+ * @throws std::invalid_argument If the array is not contiguous.
+ * @throws std::runtime_error If the first copies cannot be queued.
+ */
+std::unique_ptr<asnumpy::cann::ChunkedDeviceToHost> NPUArray::ReadChunks(size_t chunkBytes) const {
+    if (!IsContiguous()) {
+        throw std::invalid_argument("[npu_array.cpp](ReadChunks) array must be contiguous");
+    }
+    size_t tensorByteSize = this->tensorSize * GetDataTypeSize(this->aclDtype);
+    asnumpy::cann::WaitForWriter(*this->storage_->buffer, __FILE__, __func__);
+    return std::make_unique<asnumpy::cann::ChunkedDeviceToHost>(device_address(), tensorByteSize, chunkBytes,
+                                                                 asnumpy::cann::CurrentStream());
+}
+
+// ============================================================================
+// DLPack
+// ============================================================================
+
+namespace {
+
+// What an exported DLManagedTensor points into: a view keeping the storage alive, and the
+// shape and strides arrays the DLTensor refers to.
+struct DlpackExport {
+    std::unique_ptr<NPUArray> view;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    asnumpy::dlpack::DLManagedTensor managed;
+};
+
+void DeleteDlpackExport(asnumpy::dlpack::DLManagedTensor* self) {
+    // Consumers may call this from any thread, and NPUArray holds a py::dtype.
+    py::gil_scoped_acquire gil;
+    delete static_cast<DlpackExport*>(self->manager_ctx);
+}
+
+int32_t CurrentDevice() {
+    int32_t device = 0;
+    auto error = aclrtGetDevice(&device);
+    ACL_RT_CHECK(error, "aclrtGetDevice");
+    return device;
+}
+
+} // namespace
+
+/**
+ * @brief Export NPUArray as a DLPack tensor over the same device memory.
+ *
+ * The tensor describes this array exactly: storage start as `data`, the offset in bytes as
+ * `byte_offset`, and the element strides, so views are exported without a copy.
+ *
+ * @param consumerStream Stream the consumer reads on; std::nullopt makes the host wait.
+ * @return DLManagedTensor* Owned by the caller, released through its deleter.
+ * @throws std::invalid_argument If the dtype has no DLPack type code.
+ */
+asnumpy::dlpack::DLManagedTensor* NPUArray::ToDlpack(std::optional<aclrtStream> consumerStream) {
+    uint8_t code = 0;
+    switch (this->dtype.kind()) {
+    case 'b':
+        code = asnumpy::dlpack::kDLBool;
+        break;
+    case 'i':
+        code = asnumpy::dlpack::kDLInt;
+        break;
+    case 'u':
+        code = asnumpy::dlpack::kDLUInt;
+        break;
+    case 'f':
+        code = asnumpy::dlpack::kDLFloat;
+        break;
+    case 'c':
+        code = asnumpy::dlpack::kDLComplex;
+        break;
+    default:
+        throw std::invalid_argument(fmt::format("[npu_array.cpp](ToDlpack) dtype '{}' has no DLPack equivalent",
+                                                py::str(this->dtype).cast<std::string>()));
+    }
+    if (this->storage_->IsShared()) {
+        Unshare();
+    }
+    auto& buffer = *this->storage_->buffer;
+    buffer.aliased.store(true, std::memory_order_release);
+    if (!consumerStream) {
+        asnumpy::cann::WaitForWriter(buffer, __FILE__, __func__);
+    } else if (buffer.lastWrite && buffer.lastWrite->stream() != *consumerStream) {
+        auto error = aclrtStreamWaitEvent(*consumerStream, buffer.lastWrite->event());
+        ACL_RT_CHECK(error, "aclrtStreamWaitEvent");
+    }
+
+    auto itemsize = GetDataTypeSize(this->aclDtype);
+    auto context = std::make_unique<DlpackExport>();
+    context->view = View();
+    context->shape = this->shape;
+    context->strides = this->strides;
+    auto& tensor = context->managed.dl_tensor;
+    tensor.data = buffer.ptr;
+    tensor.device = {asnumpy::dlpack::kDLExtDev, CurrentDevice()};
+    tensor.ndim = static_cast<int32_t>(this->shape.size());
+    tensor.dtype = {code, static_cast<uint8_t>(itemsize * 8), 1};
+    tensor.shape = context->shape.data();
+    tensor.strides = context->strides.data();
+    tensor.byte_offset = static_cast<uint64_t>(this->storageOffset * itemsize);
+    context->managed.manager_ctx = context.get();
+    context->managed.deleter = DeleteDlpackExport;
+    return &context.release()->managed;
+}
+
+/**
+ * @brief Create an NPUArray over the device memory of a DLPack tensor.
+ *
+ * A tensor asnumpy exported itself comes back as a view of the original storage, so stream
+ * ordering and may_share_memory keep working across the round trip. Any other tensor gets its
+ * own NPUBuffer over the described memory, released through the tensor's deleter.
+ *
+ * @param managed Tensor to take ownership of.
+ * @return NPUArray Array over the same memory.
+ * @throws std::invalid_argument If the tensor cannot be represented; `managed` is released.
+ */
+NPUArray NPUArray::FromDlpack(asnumpy::dlpack::DLManagedTensor* managed) {
+    std::shared_ptr<void> owner(managed, [](void* p) {
+        auto* tensor = static_cast<asnumpy::dlpack::DLManagedTensor*>(p);
+        if (tensor->deleter) {
+            tensor->deleter(tensor);
+        }
+    });
+    if (managed->deleter == DeleteDlpackExport) {
+        return std::move(*static_cast<DlpackExport*>(managed->manager_ctx)->view->View());
+    }
+
+    const auto& tensor = managed->dl_tensor;
+    if (tensor.device.device_type != asnumpy::dlpack::kDLExtDev) {
+        throw std::invalid_argument(fmt::format(
+            "[npu_array.cpp](FromDlpack) only NPU (kDLExtDev) tensors can be imported, got device type {}",
+            static_cast<int>(tensor.device.device_type)));
+    }
+    if (tensor.device.device_id != CurrentDevice()) {
+        throw std::invalid_argument(fmt::format("[npu_array.cpp](FromDlpack) tensor is on device {}, not device {}",
+                                                tensor.device.device_id, CurrentDevice()));
+    }
+    char kind = 0;
+    switch (tensor.dtype.code) {
+        case asnumpy::dlpack::kDLBool: kind = 'b'; break;
+        case asnumpy::dlpack::kDLInt: kind = 'i'; break;
+        case asnumpy::dlpack::kDLUInt: kind = 'u'; break;
+        case asnumpy::dlpack::kDLFloat: kind = 'f'; break;
+        case asnumpy::dlpack::kDLComplex: kind = 'c'; break;
+    default:
+        break;
+    }
+    if (kind == 0 || tensor.dtype.lanes != 1 || tensor.dtype.bits % 8 != 0) {
+        throw std::invalid_argument(
+            fmt::format("[npu_array.cpp](FromDlpack) unsupported DLPack dtype (code {}, {} bits, {} lanes)",
+                        tensor.dtype.code, tensor.dtype.bits, tensor.dtype.lanes));
+    }
+
+    NPUArray result;
+    result.dtype = py::dtype(fmt::format("{}{}", kind, tensor.dtype.bits / 8));
+    result.aclDtype = GetACLDataType(result.dtype);
+    result.shape.assign(tensor.shape, tensor.shape + tensor.ndim);
+    result.strides = tensor.strides ? std::vector<int64_t>(tensor.strides, tensor.strides + tensor.ndim)
+                                    : ContiguousStrides(result.shape);
+    result.tensorSize = GetShapeSize(result.shape);
+
+    // Bytes spanned from the first element to the last.
+    auto itemsize = GetDataTypeSize(result.aclDtype);
+    int64_t lastOffset = 0;
+    for (size_t i = 0; i < result.shape.size(); ++i) {
+        if (result.strides[i] < 0) {
+            throw std::invalid_argument("[npu_array.cpp](FromDlpack) tensors with negative strides are not supported");
+        }
+        lastOffset += (result.shape[i] - 1) * result.strides[i];
+    }
+    size_t nbytes = result.tensorSize == 0 ? 0 : static_cast<size_t>((lastOffset + 1) * itemsize);
+    void* first = static_cast<char*>(tensor.data) + tensor.byte_offset;
+    result.storage_ = std::make_shared<NPUStorage>(std::make_shared<NPUBuffer>(first, nbytes, std::move(owner)));
+    result.CreateTensor();
     return result;
 }
 
@@ -403,3 +1042,11 @@ std::vector<int64_t> GetBroadcastShape(const NPUArray& a, const NPUArray& b) {
 
     return result;
 }
+
+NPUArray ScalarView(const NPUArray& a) {
+    if (a.tensorSize != 1) {
+        throw std::invalid_argument(
+            fmt::format("[npu_array.cpp](ScalarView) expected one element, got shape ({})", fmt::join(a.shape, ", ")));
+    }
+    return a.AsStrided({}, {}, a.storageOffset);
+}
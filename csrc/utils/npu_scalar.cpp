@@ -18,6 +18,7 @@
 #include <asnumpy/utils/status_handler.hpp>
 
 #include <fmt/format.h>
+#include <pybind11/complex.h>
 
 /*
     Creates an aclScalar object by automatically determining the appropriate ACL data type
@@ -191,7 +192,8 @@ template <typename ValueType> aclScalar* CreateScalar(ValueType value, aclDataTy
         return checkScalar(aclCreateScalar(&converted, ACL_FLOAT4_E1M2), "aclCreateScalar");
     }
     case ACL_STRING: {
-        static std::string str_value;
+        // Per thread: concurrent callers must not overwrite each other's string before it is read.
+        thread_local std::string str_value;
         str_value = std::to_string(static_cast<double>(value));
         return checkScalar(aclCreateScalar(str_value.data(), ACL_STRING), "aclCreateScalar");
     }
@@ -274,3 +276,32 @@ aclScalar* CreateScalar(const py::object& scalar, aclDataType dtype) {
                         __func__, static_cast<int>(dtype), e.what()));
     }
 }
+
+aclScalar* CreateOperandScalar(const py::handle& scalar, aclDataType dtype) {
+    py::object value = py::reinterpret_borrow<py::object>(scalar);
+    switch (dtype) {
+    case ACL_FLOAT16:
+    case ACL_BF16:
+    case ACL_FLOAT:
+    case ACL_DOUBLE:
+        return CreateScalar(value, ACL_DOUBLE);
+    case ACL_COMPLEX32:
+    case ACL_COMPLEX64:
+    case ACL_COMPLEX128: {
+        std::complex<double> converted;
+        try {
+            converted = py::cast<std::complex<double>>(value);
+        } catch (const py::cast_error& e) {
+            throw std::runtime_error(
+                fmt::format("[npu_scalar.cpp]({}) Failed to convert Python object to complex: {}", __func__, e.what()));
+        }
+        aclScalar* result = aclCreateScalar(&converted, ACL_COMPLEX128);
+        if (result == nullptr) {
+            throw std::runtime_error(fmt::format("[npu_scalar.cpp]({}) aclCreateScalar returned nullptr", __func__));
+        }
+        return result;
+    }
+    default:
+        return CreateScalar(value, dtype);
+    }
+}
@@ -0,0 +1,139 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#include <asnumpy/utils/reduction.hpp>
+
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/utils/acl_executor.hpp>
+#include <asnumpy/utils/acl_resource.hpp>
+#include <asnumpy/utils/npu_scalar.hpp>
+#include <asnumpy/utils/status_handler.hpp>
+
+#include <aclnn/aclnn_base.h>
+#include <aclnnop/aclnn_fill_scalar.h>
+#include <aclnnop/aclnn_s_where.h>
+
+#include <algorithm>
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+#include <stdexcept>
+
+namespace asnumpy {
+namespace {
+
+bool BroadcastsTo(const std::vector<int64_t>& from, const std::vector<int64_t>& to) {
+    if (from.size() > to.size()) {
+        return false;
+    }
+    const size_t lead = to.size() - from.size();
+    for (size_t i = 0; i < from.size(); ++i) {
+        if (from[i] != 1 && from[i] != to[lead + i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+std::vector<int64_t> ReductionAxes(const std::optional<std::vector<int64_t>>& axis, size_t ndim, const char* func) {
+    const auto n = static_cast<int64_t>(ndim);
+    std::vector<int64_t> axes;
+    if (!axis.has_value()) {
+        for (int64_t i = 0; i < n; ++i) {
+            axes.push_back(i);
+        }
+        return axes;
+    }
+    for (int64_t ax : *axis) {
+        if (ax < -n || ax >= n) {
+            throw std::out_of_range(
+                fmt::format("[reduction.cpp]({}) axis {} is out of bounds for array of dimension {}", func, ax, n));
+        }
+        axes.push_back(ax < 0 ? ax + n : ax);
+    }
+    std::sort(axes.begin(), axes.end());
+    if (std::adjacent_find(axes.begin(), axes.end()) != axes.end()) {
+        throw std::invalid_argument(
+            fmt::format("[reduction.cpp]({}) duplicate value in axis ({})", func, fmt::join(*axis, ", ")));
+    }
+    return axes;
+}
+
+std::vector<int64_t> ReducedShape(const std::vector<int64_t>& shape, const std::vector<int64_t>& axes, bool keepdims) {
+    std::vector<int64_t> reduced;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        const bool isReduced = std::binary_search(axes.begin(), axes.end(), static_cast<int64_t>(i));
+        if (!isReduced) {
+            reduced.push_back(shape[i]);
+        } else if (keepdims) {
+            reduced.push_back(1);
+        }
+    }
+    return reduced;
+}
+
+AclIntArrayPtr MakeAxisArray(const std::vector<int64_t>& axes) {
+    AclIntArrayPtr array(aclCreateIntArray(axes.data(), axes.size()), aclDestroyIntArray);
+    if (!array) {
+        throw std::runtime_error("[reduction.cpp](MakeAxisArray) failed to create aclIntArray");
+    }
+    return array;
+}
+
+NPUArray MaskReductionInput(const NPUArray& a, const NPUArray& where, double identity,
+                            const std::vector<int64_t>& shape) {
+    if (where.aclDtype != ACL_BOOL) {
+        throw std::invalid_argument(fmt::format(
+            "[reduction.cpp](MaskReductionInput) where must be a boolean array, got {}", AclDtypeName(where.aclDtype)));
+    }
+    if (!BroadcastsTo(a.shape, shape) || !BroadcastsTo(where.shape, shape)) {
+        throw std::invalid_argument(
+            fmt::format("[reduction.cpp](MaskReductionInput) where of shape ({}) does not broadcast to ({})",
+                        fmt::join(where.shape, ", "), fmt::join(shape, ", ")));
+    }
+    LOG_DEBUG("aclnnSWhere start: input_shape={}, where_shape={}, aclDtype={}, identity={}",
+              detail::FormatShape(a.shape), detail::FormatShape(where.shape), AclDtypeName(a.aclDtype), identity);
+
+    // 0-d identity operand; aclnnSWhere broadcasts it along with the mask.
+    auto fill = NPUArray(std::vector<int64_t>{}, a.aclDtype);
+    std::unique_ptr<aclScalar, decltype(&aclDestroyScalar)> value(CreateScalar(identity, a.aclDtype),
+                                                                   aclDestroyScalar);
+    uint64_t workspaceSize1 = 0;
+    aclOpExecutor* executor1 = nullptr;
+    auto error1 = aclnnInplaceFillScalarGetWorkspaceSize(fill.tensor(), value.get(), &workspaceSize1, &executor1);
+    ACLNN_CHECK(error1, "aclnnInplaceFillScalarGetWorkspaceSize");
+    AclWorkspace workspace1(workspaceSize1);
+    error1 = aclnnInplaceFillScalar(workspace1.get(), workspaceSize1, executor1, cann::CurrentStream());
+    ACLNN_CHECK(error1, "aclnnInplaceFillScalar");
+    ACL_OP_LAUNCHED("aclnnInplaceFillScalar");
+
+    auto result = NPUArray(shape, a.aclDtype);
+    uint64_t workspaceSize2 = 0;
+    aclOpExecutor* executor2 = nullptr;
+    auto error2 = aclnnSWhereGetWorkspaceSize(where.tensor(), a.tensor(), fill.tensor(), result.tensor(),
+                                              &workspaceSize2, &executor2);
+    ACLNN_CHECK(error2, "aclnnSWhereGetWorkspaceSize");
+    AclWorkspace workspace2(workspaceSize2);
+    error2 = aclnnSWhere(workspace2.get(), workspaceSize2, executor2, cann::CurrentStream());
+    ACLNN_CHECK(error2, "aclnnSWhere");
+    ACL_OP_LAUNCHED("aclnnSWhere");
+    LOG_INFO("aclnnSWhere completed");
+    return result;
+}
+
+} // namespace asnumpy
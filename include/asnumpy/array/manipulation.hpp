@@ -0,0 +1,92 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <asnumpy/utils/npu_array.hpp>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace asnumpy {
+
+// Array manipulation routines. Everything here except AscontiguousArray's copy path is a view:
+// the result shares the input's storage and only shape, strides and offset change, so the cost
+// does not depend on the array size. A copy is made only where a view cannot express the result,
+// as documented per function.
+
+/**
+ * @brief Give the array a new shape without changing its data.
+ *
+ * One dimension may be -1 and is inferred. Returns a view whenever the existing strides allow it
+ * (always for a contiguous array), otherwise reshapes a contiguous copy, like numpy.reshape.
+ *
+ * @throws std::invalid_argument If the sizes do not match or more than one dimension is -1.
+ */
+NPUArray Reshape(const NPUArray& a, const std::vector<int64_t>& newshape);
+
+/**
+ * @brief Permute the dimensions; reverses them when `axes` is not given.
+ *
+ * @throws std::invalid_argument If `axes` is not a permutation of the dimensions.
+ */
+NPUArray Transpose(const NPUArray& a, const std::optional<std::vector<int64_t>>& axes);
+
+/**
+ * @brief Insert dimensions of size 1 at the positions in `axis` (relative to the result).
+ *
+ * @throws std::out_of_range If an axis is out of bounds for the result.
+ * @throws std::invalid_argument If an axis is repeated.
+ */
+NPUArray ExpandDims(const NPUArray& a, const std::vector<int64_t>& axis);
+
+/**
+ * @brief Remove dimensions of size 1: all of them, or those listed in `axis`.
+ *
+ * @throws std::invalid_argument If a listed dimension does not have size 1.
+ */
+NPUArray Squeeze(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis);
+
+/**
+ * @brief Flatten to one dimension; a view when possible, like numpy.ravel.
+ */
+NPUArray Ravel(const NPUArray& a);
+
+/**
+ * @brief Basic indexing: integers, slices, Ellipsis and None (newaxis), or a tuple of them.
+ *
+ * Always a view, except that a slice with a negative step is materialized through aclnnFlip,
+ * because aclTensor strides cannot be negative. Integer and boolean array indices are not
+ * supported.
+ *
+ * @throws std::out_of_range If an index is out of bounds or there are too many indices.
+ */
+NPUArray GetItem(const NPUArray& a, const py::object& key);
+
+/**
+ * @brief The array itself if C-contiguous (as a view), otherwise a C-contiguous copy.
+ */
+NPUArray AscontiguousArray(const NPUArray& a);
+
+/**
+ * @brief Whether two arrays are views of the same device buffer.
+ *
+ * Conservative like numpy.may_share_memory: views of one buffer that touch disjoint elements
+ * still report true.
+ */
+bool MayShareMemory(const NPUArray& a, const NPUArray& b);
+
+} // namespace asnumpy
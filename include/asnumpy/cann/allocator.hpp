@@ -0,0 +1,164 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <acl/acl.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace asnumpy {
+namespace cann {
+
+class StreamMarker;
+
+/**
+ * @brief Snapshot of the caching allocator's counters
+ *
+ * `reserved_bytes` is device memory obtained from aclrtMalloc and held by the cache;
+ * `allocated_bytes` is the part of it currently handed out to live buffers.
+ */
+struct MemoryStats {
+    uint64_t reserved_bytes = 0;
+    uint64_t allocated_bytes = 0;
+    uint64_t peak_reserved_bytes = 0;
+    uint64_t peak_allocated_bytes = 0;
+    uint64_t device_malloc_count = 0;
+    uint64_t device_free_count = 0;
+};
+
+/**
+ * @brief Process-wide caching allocator for NPU device memory
+ *
+ * aclrtMalloc/aclrtFree are expensive and synchronizing, so freed buffers are kept in size-class
+ * pools and handed back to later requests instead of being returned to the driver. Requests are
+ * rounded to 512 bytes and served from one of two pools:
+ *  - small (<= 1 MiB): carved out of 2 MiB segments
+ *  - large (> 1 MiB): carved out of 20 MiB segments, or an exact 2 MiB-rounded segment above 10 MiB
+ *
+ * A block larger than the request is split and the remainder stays cached; on free, a block is
+ * merged with free neighbours of the same segment. Every block remembers the stream it was
+ * allocated on and is only reused by requests on that stream, so reuse is ordered by the stream
+ * itself and needs no synchronization. A block that was also used on other streams (see
+ * RecordStream) is held back on free until markers recorded on those streams have completed.
+ *
+ * Example usage:
+ * @code
+ * auto& allocator = asnumpy::cann::CachingAllocator::Instance();
+ * void* ptr = allocator.Allocate(bytes);
+ * // ... launch kernels reading/writing ptr ...
+ * allocator.Free(ptr);  // cached, not aclrtFree'd
+ * @endcode
+ */
+class CachingAllocator {
+  public:
+    /**
+     * @brief Get the process-wide allocator
+     *
+     * The instance is intentionally leaked: static destructors run after aclFinalize, when
+     * aclrtFree is no longer valid, and the device reset releases the memory anyway.
+     */
+    static CachingAllocator& Instance();
+
+    /**
+     * @brief Allocate device memory
+     * @param size Requested size in bytes; 0 returns nullptr
+     * @param stream Stream the memory will be used on
+     * @return Device address, aligned to 512 bytes
+     * @throws std::runtime_error If the device is out of memory even after releasing the cache
+     */
+    void* Allocate(size_t size, aclrtStream stream = nullptr);
+
+    /**
+     * @brief Return a pointer obtained from Allocate to the cache. nullptr is ignored.
+     * @throws std::invalid_argument If the pointer was not allocated by this allocator
+     */
+    void Free(void* ptr);
+
+    /**
+     * @brief Note that kernels on `stream` use a block allocated on another stream
+     *
+     * Free then defers reuse of the block until the work enqueued on `stream` has finished.
+     * @throws std::invalid_argument If the pointer was not allocated by this allocator
+     */
+    void RecordStream(void* ptr, aclrtStream stream);
+
+    /**
+     * @brief Release every cached segment that has no live block back to the driver
+     */
+    void EmptyCache();
+
+    /**
+     * @brief Get a snapshot of the allocator counters
+     */
+    MemoryStats Stats() const;
+
+    /**
+     * @brief Reset the peak counters to the current usage
+     */
+    void ResetPeakStats();
+
+    CachingAllocator(const CachingAllocator&) = delete;
+    CachingAllocator& operator=(const CachingAllocator&) = delete;
+
+  private:
+    struct Block {
+        aclrtStream stream;
+        size_t size;
+        void* ptr;
+        bool allocated = false;
+        bool small;
+        Block* prev = nullptr; // neighbours within the same segment
+        Block* next = nullptr;
+        std::vector<aclrtStream> streamUses; // other streams the block was used on
+    };
+
+    struct DeferredFree {
+        Block* block;
+        std::vector<std::shared_ptr<StreamMarker>> markers;
+    };
+
+    struct BlockComparator {
+        bool operator()(const Block* a, const Block* b) const;
+    };
+
+    using BlockPool = std::set<Block*, BlockComparator>;
+
+    CachingAllocator() = default;
+    ~CachingAllocator() = default;
+
+    BlockPool& PoolFor(bool small) { return small ? smallBlocks_ : largeBlocks_; }
+    Block* FindFreeBlock(size_t size, aclrtStream stream, bool small);
+    Block* MallocSegment(std::unique_lock<std::mutex>& lock, size_t size, aclrtStream stream, bool small);
+    void FreeBlockLocked(Block* block);
+    void ProcessDeferredFreesLocked();
+    void ReleaseCachedSegments(std::unique_lock<std::mutex>& lock); // unlocks `lock` while it synchronizes
+    void UpdatePeaks();
+
+    mutable std::mutex mutex_;
+    BlockPool smallBlocks_;
+    BlockPool largeBlocks_;
+    std::unordered_map<void*, Block*> activeBlocks_;
+    std::vector<DeferredFree> deferredFrees_;
+    MemoryStats stats_;
+};
+
+} // namespace cann
+} // namespace asnumpy
@@ -0,0 +1,144 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <acl/acl.h>
+#include <cstddef>
+#include <memory>
+
+namespace asnumpy {
+namespace cann {
+
+struct BufferUsage;
+
+/**
+ * @brief How operators are ordered against the host
+ *
+ * Blocking: every operator synchronizes the device before returning, so failures surface at the
+ * call that caused them. This is the default.
+ *
+ * Async: operators are only enqueued. The host waits for the device at observation points alone
+ * (NPUArray::ToNumpy waits for the array's last writer, explicit Synchronize for everything).
+ * Device buffers are released into the caching allocator straight away, which only hands them out
+ * again on the same stream, i.e. behind the kernels still using them, or after the other streams
+ * that used them have caught up.
+ */
+enum class ExecutionMode { Blocking, Async };
+
+/**
+ * @brief Switch the execution mode. Leaving Async mode synchronizes first.
+ */
+void SetExecutionMode(ExecutionMode mode);
+
+/**
+ * @brief Get the current execution mode
+ */
+ExecutionMode GetExecutionMode();
+
+/**
+ * @brief Tell the runtime an operator was enqueued
+ *
+ * Blocking mode synchronizes the current stream and throws if the operator failed. Async mode
+ * records a marker for the operator on the current stream, attaches it to the buffers the operator
+ * tracked (see TrackRead/TrackWrite) and returns, so a failure found by a later synchronization
+ * can be attributed to it. Use the ACL_OP_LAUNCHED macro rather than calling this directly.
+ *
+ * @param op_name Name of the enqueued operator (e.g. "aclnnAdd")
+ * @param file Source file of the launch site (use __FILE__)
+ * @param func Function of the launch site (use __func__)
+ * @throw std::runtime_error In blocking mode, if the device reports an error
+ */
+void NotifyLaunched(const char* op_name, const char* file, const char* func);
+
+/**
+ * @brief Wait until all enqueued work is done
+ *
+ * @param file Source file of the observation point (use __FILE__)
+ * @param func Function of the observation point (use __func__)
+ * @throw std::runtime_error If the device reports an error; in async mode the message names the
+ *        first operator that did not complete and where it was launched from
+ */
+void Synchronize(const char* file, const char* func);
+
+/**
+ * @brief Wait until all work enqueued on one stream is done
+ *
+ * @param stream Stream to wait for
+ * @param file Source file of the observation point (use __FILE__)
+ * @param func Function of the observation point (use __func__)
+ * @throw std::runtime_error If the device reports an error; the message names the failing op
+ */
+void SynchronizeStream(aclrtStream stream, const char* file, const char* func);
+
+/**
+ * @brief Host-to-device copy into a buffer allocated on the current stream
+ *
+ * A plain aclrtMemcpy is not stream-ordered, so in async mode it could overwrite a freshly
+ * allocated buffer that a kernel queued on the current stream still reads. Use this for small
+ * host uploads inside ops.
+ *
+ * Copies of kStagingThreshold bytes or more go through the pinned staging pool instead and are
+ * queued on the current stream like an operator; pass the destination's `dstUsage` so later
+ * readers on other streams wait for them. Returns once `src` may be reused either way.
+ */
+void MemcpyHostToDevice(void* dst, const void* src, size_t bytes,
+                        const std::shared_ptr<BufferUsage>& dstUsage = nullptr);
+
+/// Called on entering a host wait; returns whatever the matching exit hook needs to undo it.
+using HostWaitEnterHook = void* (*)();
+/// Called on leaving a host wait with the value its enter hook returned.
+using HostWaitExitHook = void (*)(void*);
+
+/**
+ * @brief Install what HostWaitScope does around a blocking runtime call
+ *
+ * The runtime knows nothing of Python. The bindings install hooks that drop the GIL on enter (if
+ * the calling thread holds it) and take it back on exit. Without hooks the scope does nothing.
+ */
+void SetHostWaitHooks(HostWaitEnterHook enter, HostWaitExitHook exit);
+
+/**
+ * @brief Scope of a host thread blocked on the device
+ *
+ * Wraps every synchronization and synchronous copy, so other host threads keep submitting work
+ * while this one waits. Nothing in the scope may touch Python objects or NPUArray metadata, which
+ * the GIL still guards.
+ *
+ * Never hold a runtime mutex across the end of the scope: it reacquires the GIL, and a thread
+ * holding the GIL may itself be waiting for that mutex.
+ */
+class HostWaitScope {
+  public:
+    HostWaitScope();
+    ~HostWaitScope();
+
+    HostWaitScope(const HostWaitScope&) = delete;
+    HostWaitScope& operator=(const HostWaitScope&) = delete;
+
+  private:
+    HostWaitExitHook exit_;
+    void* state_ = nullptr;
+};
+
+} // namespace cann
+} // namespace asnumpy
+
+// Must follow every operator launch: synchronizes in blocking mode, records the op in async mode.
+// Usage: ACL_OP_LAUNCHED("aclnnAdd");
+#define ACL_OP_LAUNCHED(op_name) ::asnumpy::cann::NotifyLaunched(op_name, __FILE__, __func__)
+
+// Host observation point: waits for the device and surfaces deferred errors.
+#define ACL_SYNCHRONIZE() ::asnumpy::cann::Synchronize(__FILE__, __func__)
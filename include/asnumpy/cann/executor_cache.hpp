@@ -0,0 +1,180 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <aclnn/aclnn_base.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace asnumpy {
+namespace cann {
+
+/**
+ * @brief Everything aclCreateTensor is given for one operand except its address
+ */
+struct TensorLayout {
+    aclDataType dtype;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    int64_t offset;
+    std::vector<int64_t> storageDims;
+};
+
+/**
+ * @brief Snapshot of the executor cache counters
+ */
+struct ExecutorCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    uint64_t uncacheable = 0; // executors the op refused to make repeatable
+    uint64_t entries = 0;
+    uint64_t capacity = 0;
+};
+
+/**
+ * @brief Repeatable aclOpExecutor of one op signature, with the tensor descriptors it was built over
+ *
+ * Relaunching only points the descriptors at the new operands' addresses; the tiling done by
+ * GetWorkspaceSize is reused.
+ */
+class CachedExecutor {
+  public:
+    ~CachedExecutor();
+
+    CachedExecutor(const CachedExecutor&) = delete;
+    CachedExecutor& operator=(const CachedExecutor&) = delete;
+
+    aclOpExecutor* executor() const { return executor_; }
+    uint64_t workspaceSize() const { return workspaceSize_; }
+    bool repeatable() const { return repeatable_; }
+
+    /**
+     * @brief Point the executor at new storage addresses, inputs first, in signature order
+     * @return The first failing aclSet{Input,Output}TensorAddr status, or ACL_SUCCESS
+     */
+    aclnnStatus Rebind(const std::vector<void*>& addresses);
+
+    /**
+     * @brief Remember `stream` as the last one launched on; the executor is not destroyed before it drains
+     */
+    void MarkLaunched(aclrtStream stream) {
+        launched_ = true;
+        lastStream_ = stream;
+    }
+
+    // Held from Rebind to launch: the addresses are part of the executor's state.
+    std::mutex mutex;
+
+  private:
+    friend class ExecutorCache;
+    CachedExecutor() = default;
+
+    aclOpExecutor* executor_ = nullptr;
+    uint64_t workspaceSize_ = 0;
+    bool repeatable_ = false;
+    size_t numInputs_ = 0;
+    std::vector<aclTensor*> tensors_;
+    std::vector<void*> addresses_;
+    bool launched_ = false;
+    aclrtStream lastStream_ = nullptr;
+};
+
+/**
+ * @brief Process-wide LRU cache of repeatable executors keyed on op signature
+ *
+ * aclnnXxxGetWorkspaceSize does host-side tiling and builds a new executor on every call, which
+ * dominates the cost of small ops. The key is the aclnn API name plus the layout of every operand
+ * (dtype, shape, strides, offset, storage shape); callers only cache ops whose remaining arguments
+ * are fixed by the API name, i.e. that take no attributes.
+ */
+class ExecutorCache {
+  public:
+    using BuildFunc = std::function<aclnnStatus(const std::vector<aclTensor*>&, uint64_t*, aclOpExecutor**)>;
+
+    static constexpr size_t kDefaultCapacity = 1024;
+
+    /**
+     * @brief Get the process-wide cache (leaked, like the CachingAllocator)
+     */
+    static ExecutorCache& Instance();
+
+    bool Enabled() const { return capacity_.load(std::memory_order_relaxed) > 0; }
+
+    /**
+     * @brief Look up the executor of a signature
+     * @return The entry, or nullptr on a miss
+     */
+    std::shared_ptr<CachedExecutor> Find(const std::string& op, const std::vector<TensorLayout>& layouts);
+
+    /**
+     * @brief Build an executor for a signature over its own descriptors and cache it if it is repeatable
+     *
+     * @param numInputs Leading operands that are inputs; the rest are outputs
+     * @param addresses Storage address of every operand, bound to the new descriptors
+     * @param build Calls the op's GetWorkspaceSize with the given descriptors
+     * @param status Set to the status of `build`; nullptr is returned if it failed
+     * @return The entry; not cached (and usable once) if the op refused to make it repeatable
+     */
+    std::shared_ptr<CachedExecutor> Build(const std::string& op, const std::vector<TensorLayout>& layouts,
+                                          size_t numInputs, const std::vector<void*>& addresses,
+                                          const BuildFunc& build, aclnnStatus* status);
+
+    /**
+     * @brief Drop every entry
+     */
+    void Clear();
+
+    /**
+     * @brief Set the maximum number of entries, evicting the least recently used; 0 disables caching
+     */
+    void SetCapacity(size_t capacity);
+
+    /**
+     * @brief Get a snapshot of the counters
+     */
+    ExecutorCacheStats Stats() const;
+
+    ExecutorCache(const ExecutorCache&) = delete;
+    ExecutorCache& operator=(const ExecutorCache&) = delete;
+
+  private:
+    using LruList = std::list<std::pair<std::string, std::shared_ptr<CachedExecutor>>>;
+
+    ExecutorCache() = default;
+    ~ExecutorCache() = default;
+
+    // Moves entries beyond `capacity` into `dropped`; the caller destroys them after unlocking.
+    void EvictLocked(LruList& dropped, size_t capacity);
+
+    mutable std::mutex mutex_;
+    std::atomic<size_t> capacity_{kDefaultCapacity};
+    LruList lru_; // most recently used first
+    std::unordered_map<std::string, LruList::iterator> entries_;
+    ExecutorCacheStats stats_;
+};
+
+} // namespace cann
+} // namespace asnumpy
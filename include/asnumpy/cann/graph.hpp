@@ -0,0 +1,116 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <acl/acl.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace asnumpy {
+namespace cann {
+
+struct BufferUsage;
+class StreamMarker;
+
+/**
+ * @brief Sequence of launches captured once with aclmdlRICapture and replayed as a single launch
+ *
+ * Between BeginCapture and EndCapture the calling thread enqueues on a capture stream of its
+ * own. Launches are recorded, not run: the aclnn kernels, their device addresses and workspaces
+ * are baked into the graph, so Replay costs no host dispatch, GetWorkspaceSize or allocation.
+ *
+ * Every buffer an operator tracks during capture is pinned: the graph holds it until it is
+ * destroyed, and marks it aliased so it is never shared copy-on-write. Writing to a captured
+ * input in place therefore feeds the next replay. Workspaces come from graph-owned allocations
+ * instead of the stream's WorkspaceArena, which may outgrow (and free) its buffer.
+ *
+ * Nothing in a capture may wait for the device: synchronizations and device-to-host copies throw.
+ * Small host-to-device uploads inside a capture (operator constants) run once, at capture time.
+ */
+class Graph {
+  public:
+    Graph() = default;
+    ~Graph();
+
+    Graph(const Graph&) = delete;
+    Graph& operator=(const Graph&) = delete;
+
+    /**
+     * @brief Synchronize the device and start capturing the calling thread's launches
+     * @throws std::runtime_error If already captured, nested in another capture, or capture fails
+     */
+    void BeginCapture();
+
+    /**
+     * @brief Stop capturing and restore the calling thread's stream
+     * @param keep False to throw the capture away (e.g. an exception left the captured block)
+     * @throws std::runtime_error If the runtime fails to end the capture
+     */
+    void EndCapture(bool keep = true);
+
+    /**
+     * @brief Launch the captured sequence on the current stream
+     *
+     * Ordered against other streams like an operator that reads and writes the pinned buffers.
+     *
+     * @throws std::runtime_error If nothing was captured, or the launch fails
+     */
+    void Replay();
+
+    bool captured() const { return model_ != nullptr; }
+    size_t launchCount() const { return ops_.size(); }
+    size_t bufferCount() const { return buffers_.size(); }
+
+    // Capture hooks, called by TrackRead/TrackWrite, NotifyLaunched and AclWorkspace.
+    void Pin(const std::shared_ptr<BufferUsage>& usage, bool write);
+    void RecordLaunch(const char* op_name) { ops_.emplace_back(op_name); }
+    void* AllocateWorkspace(uint64_t size);
+
+  private:
+    void ReleaseResources() noexcept;
+
+    aclrtStream stream_ = nullptr;   // capture stream, held for the graph's lifetime
+    aclrtStream previous_ = nullptr; // the capturing thread's stream before BeginCapture
+    aclmdlRI model_ = nullptr;
+    std::vector<std::pair<std::shared_ptr<BufferUsage>, bool>> buffers_; // `second` is true if written
+    std::unordered_map<const BufferUsage*, size_t> bufferIndex_;
+    std::vector<void*> workspaces_;
+    std::vector<std::string> ops_;
+    std::shared_ptr<StreamMarker> lastReplay_; // async mode only
+};
+
+/**
+ * @brief Graph the calling thread is capturing into, or nullptr
+ */
+Graph* CapturingGraph();
+
+/**
+ * @brief Throw if the calling thread is capturing a graph; guards every wait for the device
+ *
+ * @param file Source file of the observation point (use __FILE__)
+ * @param func Function of the observation point (use __func__)
+ * @throws std::runtime_error While capturing
+ */
+void ThrowIfCapturing(const char* file, const char* func);
+
+} // namespace cann
+} // namespace asnumpy
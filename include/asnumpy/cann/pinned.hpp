@@ -0,0 +1,229 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <acl/acl.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace asnumpy {
+namespace cann {
+
+class StreamMarker;
+
+/**
+ * @brief Snapshot of the pinned host pool's counters
+ */
+struct PinnedMemoryStats {
+    uint64_t reserved_bytes = 0;  // page-locked memory obtained from aclrtMallocHost and held by the pool
+    uint64_t allocated_bytes = 0; // the part of it currently handed out
+    uint64_t host_malloc_count = 0;
+    uint64_t host_free_count = 0;
+};
+
+/**
+ * @brief Process-wide cache of page-locked (pinned) host buffers
+ *
+ * A copy between pageable host memory and the device is bounced by the runtime through its own
+ * staging buffers. Copies through memory from aclrtMallocHost are DMA'd directly and can be
+ * asynchronous. Pinning is expensive, so buffers are cached instead of being freed: requests are
+ * rounded up to a power-of-two size class (at least 64 KiB) and served from per-class free lists.
+ *
+ * The free lists are kept per NUMA node of the requesting thread. Pages are placed on the node of
+ * the thread that first touches them, so a buffer allocated and filled by a thread is local to it,
+ * and later requests from that node get such a buffer back.
+ *
+ * A buffer a queued copy still reads from or writes to is released with a marker of that copy and
+ * is only handed out again once the marker has completed.
+ */
+class PinnedHostPool {
+  public:
+    /**
+     * @brief Get the process-wide pool
+     *
+     * Intentionally leaked, like CachingAllocator: aclrtFreeHost is not valid after aclFinalize.
+     */
+    static PinnedHostPool& Instance();
+
+    /**
+     * @brief Allocate at least `size` bytes of pinned host memory
+     * @throws std::runtime_error If aclrtMallocHost fails even after releasing the cache
+     */
+    void* Allocate(size_t size);
+
+    /**
+     * @brief Return a buffer from Allocate to the pool, for reuse once `pending` (if any) completes
+     * @throws std::invalid_argument If the pointer was not allocated by this pool
+     */
+    void Free(void* ptr, std::shared_ptr<StreamMarker> pending = nullptr);
+
+    /**
+     * @brief Whether [ptr, ptr + size) lies inside one live buffer of this pool
+     */
+    bool Contains(const void* ptr, size_t size) const;
+
+    /**
+     * @brief Free every cached buffer that is not in use back to the driver
+     */
+    void EmptyCache();
+
+    /**
+     * @brief Get a snapshot of the pool counters
+     */
+    PinnedMemoryStats Stats() const;
+
+    PinnedHostPool(const PinnedHostPool&) = delete;
+    PinnedHostPool& operator=(const PinnedHostPool&) = delete;
+
+  private:
+    struct Block {
+        size_t size;
+        int node;
+        bool allocated = false;
+        std::shared_ptr<StreamMarker> pending;
+    };
+
+    PinnedHostPool() = default;
+    ~PinnedHostPool() = default;
+
+    void* TakeCachedLocked(int node, size_t size);
+    void ReleaseCachedLocked();
+
+    mutable std::mutex mutex_;
+    std::map<uintptr_t, Block> blocks_;                     // every buffer, by address
+    std::map<std::pair<int, size_t>, std::vector<void*>> free_; // (node, size class) -> cached buffers
+    PinnedMemoryStats stats_;
+};
+
+/**
+ * @brief Counters of staged transfers
+ *
+ * A transfer is timed on the device, from a marker queued before its first chunk to one behind its
+ * last, so the rate includes the overlapped host copies but not time spent queued behind earlier
+ * work. A transfer is counted once it has completed and the counters were read.
+ */
+struct TransferStats {
+    uint64_t transfer_count = 0;
+    uint64_t bytes = 0;
+    double seconds = 0;
+    uint64_t last_bytes = 0; // most recent completed transfer
+    double last_seconds = 0;
+    bool last_host_to_device = false;
+};
+
+/**
+ * @brief Get a snapshot of the staged transfer counters
+ */
+TransferStats GetTransferStats();
+
+/**
+ * @brief Transfers of at least this many bytes go through the staging buffers
+ *
+ * Below it the runtime's own bounce is as fast and saves the extra host copy.
+ */
+constexpr size_t kStagingThreshold = 1 << 20;
+
+/**
+ * @brief Size of one chunk of a staged transfer
+ */
+constexpr size_t kStagingChunk = 8 << 20;
+
+/**
+ * @brief Pinned buffers a staged transfer cycles through
+ *
+ * With more than two, a late host copy or DMA does not immediately stall the other side. Host
+ * memory used by a transfer is bounded by kStagingDepth * kStagingChunk, whatever its size.
+ */
+constexpr size_t kStagingDepth = 3;
+
+/**
+ * @brief Copy `bytes` from host memory to the device through pinned staging buffers
+ *
+ * The copy is cut into chunks that cycle through kStagingDepth pinned buffers, so filling one
+ * overlaps with the DMA out of the others. Returns once `src` may be reused; the last chunks may
+ * still be in flight on `stream`.
+ */
+void StagedCopyHostToDevice(void* dst, const void* src, size_t bytes, aclrtStream stream);
+
+/**
+ * @brief Copy `bytes` from the device to host memory through pinned staging buffers
+ *
+ * Runs a ChunkedDeviceToHost to completion. Returns when `dst` holds the data.
+ */
+void StagedCopyDeviceToHost(void* dst, const void* src, size_t bytes, aclrtStream stream);
+
+/**
+ * @brief Device-to-host copy handed to the host one chunk at a time
+ *
+ * Chunks are queued ahead on `stream` into a ring of up to kStagingDepth pinned buffers, so the
+ * DMA of later chunks overlaps with whatever the host does with the current one. The host never
+ * holds more than the ring, however large the copy.
+ *
+ * Example usage:
+ * @code
+ * asnumpy::cann::ChunkedDeviceToHost reader(src, bytes, asnumpy::cann::kStagingChunk, stream);
+ * size_t n = 0;
+ * while (const void* chunk = reader.Next(&n)) {
+ *     Consume(chunk, n);
+ * }
+ * @endcode
+ */
+class ChunkedDeviceToHost {
+  public:
+    /**
+     * @brief Queue the first chunks of copying `bytes` from device address `src`
+     *
+     * `src` must stay valid until the reader is destroyed.
+     *
+     * @throws std::runtime_error If pinned memory cannot be allocated or a copy cannot be queued
+     */
+    ChunkedDeviceToHost(const void* src, size_t bytes, size_t chunk, aclrtStream stream);
+    ~ChunkedDeviceToHost();
+
+    /**
+     * @brief Wait for the next chunk
+     *
+     * @param size Set to the size of the chunk
+     * @return Pinned buffer holding the chunk, valid until the next call; nullptr after the last one
+     * @throws std::runtime_error If a copy fails
+     */
+    const void* Next(size_t* size);
+
+    ChunkedDeviceToHost(const ChunkedDeviceToHost&) = delete;
+    ChunkedDeviceToHost& operator=(const ChunkedDeviceToHost&) = delete;
+
+  private:
+    void Issue(size_t index);
+    void Release();
+
+    const char* src_;
+    size_t bytes_;
+    size_t chunk_;
+    size_t chunks_;
+    aclrtStream stream_;
+    std::vector<void*> slots_;
+    std::vector<std::shared_ptr<StreamMarker>> inFlight_;
+    std::shared_ptr<StreamMarker> start_;
+    size_t next_ = 0; // index of the next chunk to hand out
+};
+
+} // namespace cann
+} // namespace asnumpy
@@ -0,0 +1,244 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <acl/acl.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace asnumpy {
+namespace cann {
+
+// ============================================================================
+// Current stream
+// ============================================================================
+
+/**
+ * @brief Stream the calling thread enqueues operators on
+ *
+ * nullptr (the device's default stream) unless another stream was made current with
+ * ExchangeCurrentStream or a StreamGuard. Every aclnn launch passes this stream.
+ *
+ * On a thread's first call, binds the shared context (see SetSharedContext) if the thread has no
+ * ACL context of its own.
+ *
+ * @throw std::runtime_error If binding the shared context fails
+ */
+aclrtStream CurrentStream();
+
+/**
+ * @brief Set the ACL context adopted by threads that have none
+ *
+ * ACL contexts are per thread, and a thread that never called aclrtSetDevice cannot launch.
+ * set_device shares the context it created, so operators can be called from any host thread;
+ * reset_device withdraws it with nullptr.
+ */
+void SetSharedContext(aclrtContext context);
+
+/**
+ * @brief Make `stream` current for the calling thread
+ * @return The previously current stream
+ */
+aclrtStream ExchangeCurrentStream(aclrtStream stream);
+
+/**
+ * @brief RAII helper that makes a stream current for the enclosing scope
+ *
+ * Example usage:
+ * @code
+ * {
+ *     asnumpy::cann::StreamGuard guard(asnumpy::cann::StreamPool::Instance().Acquire());
+ *     auto y = asnumpy::Sin(x);  // enqueued on the pooled stream
+ * }
+ * @endcode
+ */
+class StreamGuard {
+  public:
+    explicit StreamGuard(aclrtStream stream) : previous_(ExchangeCurrentStream(stream)) {}
+    ~StreamGuard() { ExchangeCurrentStream(previous_); }
+
+    StreamGuard(const StreamGuard&) = delete;
+    StreamGuard& operator=(const StreamGuard&) = delete;
+
+  private:
+    aclrtStream previous_;
+};
+
+// ============================================================================
+// StreamPool
+// ============================================================================
+
+/**
+ * @brief Fixed set of device streams handed out round-robin
+ *
+ * Streams are created lazily and never destroyed, so creating an asnumpy.cann.Stream costs no
+ * driver call once the pool is warm and cached memory bound to a stream stays reusable.
+ */
+class StreamPool {
+  public:
+    static constexpr size_t kPoolSize = 8;
+
+    /**
+     * @brief Get the process-wide pool (leaked, like the CachingAllocator)
+     */
+    static StreamPool& Instance();
+
+    /**
+     * @brief Get the next stream of the pool
+     * @throws std::runtime_error If creating the stream fails
+     */
+    aclrtStream Acquire();
+
+    StreamPool(const StreamPool&) = delete;
+    StreamPool& operator=(const StreamPool&) = delete;
+
+  private:
+    StreamPool() = default;
+    ~StreamPool() = default;
+
+    std::mutex mutex_;
+    std::vector<aclrtStream> streams_;
+    size_t next_ = 0;
+};
+
+// ============================================================================
+// StreamMarker
+// ============================================================================
+
+/**
+ * @brief Event recorded on a stream behind an enqueued operator
+ *
+ * A marker is shared by the execution queue and every buffer the operator touched; its event
+ * goes back to a process-wide pool once the last reference is dropped.
+ */
+class StreamMarker {
+  public:
+    /**
+     * @brief Record a marker behind the work currently enqueued on `stream`
+     * @throws std::runtime_error If creating or recording the event fails
+     */
+    static std::shared_ptr<StreamMarker> Record(aclrtStream stream);
+
+    ~StreamMarker();
+
+    aclrtEvent event() const { return event_; }
+    aclrtStream stream() const { return stream_; }
+
+    /**
+     * @brief Whether everything enqueued before the marker has finished
+     */
+    bool IsComplete() const;
+
+    /**
+     * @brief Destroy the event instead of recycling it; event state is unreliable after a device fault
+     */
+    void Discard() { recyclable_ = false; }
+
+    StreamMarker(const StreamMarker&) = delete;
+    StreamMarker& operator=(const StreamMarker&) = delete;
+
+  private:
+    StreamMarker(aclrtEvent event, aclrtStream stream) : event_(event), stream_(stream) {}
+
+    aclrtEvent event_;
+    aclrtStream stream_;
+    bool recyclable_ = true;
+};
+
+// ============================================================================
+// Buffer dependencies
+// ============================================================================
+
+/**
+ * @brief Last writer and readers of one device buffer, maintained in async mode only
+ *
+ * An operator reading the buffer on stream S waits for the last writer if that ran on another
+ * stream; an operator writing it also waits for the readers on other streams. Operators on the
+ * same stream are ordered by the stream itself and never wait. In blocking mode every operator
+ * has finished before the next starts, so nothing is tracked.
+ */
+struct BufferUsage {
+    BufferUsage(void* ptr, aclrtStream stream) : ptr(ptr), stream(stream) {}
+
+    void* ptr;          // device buffer, for CachingAllocator::RecordStream
+    aclrtStream stream; // stream the buffer was allocated on
+    bool pooled = true; // false for memory not from the CachingAllocator, which is not told about uses
+    // Also written without going through tracking (by a DLPack consumer or a graph replay), so
+    // copies of it are made eagerly instead of copy-on-write.
+    std::atomic<bool> aliased{false};
+    std::shared_ptr<StreamMarker> lastWrite;
+    std::vector<std::shared_ptr<StreamMarker>> reads; // latest read per stream since lastWrite
+};
+
+/**
+ * @brief Declare that the next operator on the current stream reads the buffer
+ *
+ * Makes the current stream wait for a last writer on another stream and tells the allocator the
+ * buffer is in use there. The read is attached to the operator's marker by CommitTracked.
+ */
+void TrackRead(const std::shared_ptr<BufferUsage>& usage);
+
+/**
+ * @brief Declare that the next operator on the current stream writes the buffer
+ */
+void TrackWrite(const std::shared_ptr<BufferUsage>& usage);
+
+/**
+ * @brief Attach `marker` to every buffer tracked by the calling thread since the last launch
+ *
+ * Called by NotifyLaunched; operators never call this themselves.
+ */
+void CommitTracked(const std::shared_ptr<StreamMarker>& marker);
+
+/**
+ * @brief Set aside the buffers tracked so far while a nested launch is made
+ *
+ * Copy-on-write duplicates a buffer from inside NPUArray::tensor(), while the enclosing operator
+ * is still collecting its tensors. Without this scope the duplicate's launch would be credited
+ * with the enclosing operator's reads and writes.
+ */
+class NestedLaunchScope {
+  public:
+    NestedLaunchScope();
+    ~NestedLaunchScope();
+
+    NestedLaunchScope(const NestedLaunchScope&) = delete;
+    NestedLaunchScope& operator=(const NestedLaunchScope&) = delete;
+
+  private:
+    std::vector<std::pair<std::shared_ptr<BufferUsage>, bool>> saved_;
+};
+
+/**
+ * @brief Block the host until everything enqueued before `marker` has finished
+ *
+ * @throws std::runtime_error If the device reports an error; the message names the failing op
+ */
+void WaitForMarker(const StreamMarker& marker, const char* file, const char* func);
+
+/**
+ * @brief Block the host until the last write to the buffer has finished
+ *
+ * @throws std::runtime_error If the device reports an error; the message names the failing op
+ */
+void WaitForWriter(const BufferUsage& usage, const char* file, const char* func);
+
+} // namespace cann
+} // namespace asnumpy
@@ -0,0 +1,113 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+#pragma once
+
+#include <acl/acl.h>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace asnumpy {
+namespace cann {
+
+/**
+ * @brief Counters of one workspace arena, or aggregated over all of them
+ */
+struct WorkspaceStats {
+    uint64_t capacity_bytes = 0;   // device memory currently held by the arenas
+    uint64_t high_water_bytes = 0; // largest single workspace requested so far
+    uint64_t grow_count = 0;       // number of times an arena had to (re)allocate
+    uint64_t lease_count = 0;      // number of workspaces handed out
+};
+
+/**
+ * @brief Grow-only operator workspace buffer bound to one stream
+ *
+ * aclnn kernels on a stream execute in submission order, so one scratch buffer can back the
+ * workspace of every kernel launched on that stream. The arena keeps the largest buffer requested
+ * so far and hands it out again; it only goes back to the CachingAllocator when a larger request
+ * replaces it. Once the arena covers the biggest workspace of a workload, leases cost no
+ * allocation at all.
+ *
+ * A buffer outgrown while a lease on it is still alive is retired rather than freed, and is
+ * returned to the allocator once the last lease ends.
+ *
+ * Operators do not use the arena directly; they go through the asnumpy::AclWorkspace lease.
+ */
+class WorkspaceArena {
+  public:
+    /**
+     * @brief Get the arena of a stream, creating it on first use
+     * @param stream Stream the workspace will be used on (nullptr is the default stream)
+     */
+    static WorkspaceArena& ForStream(aclrtStream stream);
+
+    /**
+     * @brief Get the counters summed over all arenas
+     */
+    static WorkspaceStats Stats();
+
+    /**
+     * @brief Get this arena's own counters
+     */
+    WorkspaceStats ArenaStats();
+
+    /**
+     * @brief Hand every arena buffer back to the CachingAllocator
+     *
+     * Only valid while no lease is alive, e.g. right before a device reset.
+     */
+    static void ReleaseAll();
+
+    /**
+     * @brief Start a lease of at least `size` bytes
+     * @return Device address of the arena buffer
+     * @throws std::runtime_error If growing the arena fails
+     */
+    void* Acquire(uint64_t size);
+
+    /**
+     * @brief End a lease started by Acquire
+     */
+    void Release() noexcept;
+
+    /**
+     * @brief Grow the arena to at least `size` bytes ahead of time
+     */
+    void Reserve(uint64_t size);
+
+    WorkspaceArena(const WorkspaceArena&) = delete;
+    WorkspaceArena& operator=(const WorkspaceArena&) = delete;
+
+  private:
+    explicit WorkspaceArena(aclrtStream stream) : stream_(stream) {}
+
+    void GrowLocked(uint64_t size);
+    void FreeRetiredLocked() noexcept;
+
+    std::mutex mutex_;
+    aclrtStream stream_;
+    void* ptr_ = nullptr;
+    uint64_t capacity_ = 0;
+    uint64_t highWater_ = 0;
+    uint64_t growCount_ = 0;
+    uint64_t leaseCount_ = 0;
+    int activeLeases_ = 0;
+    std::vector<void*> retired_;
+};
+
+} // namespace cann
+} // namespace asnumpy
@@ -0,0 +1,44 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <acl/acl.h>
+#include <string_view>
+
+namespace asnumpy::dtypes {
+
+/**
+ * Which aclnn kernels take mixed input dtypes and promote them themselves.
+ *
+ * Kernels such as aclnnAdd or aclnnGtTensor accept operands of different dtypes and convert them
+ * while computing, so casting an operand beforehand only costs a full-size cast kernel and a
+ * temporary. But aclnn promotes like PyTorch, not like NumPy: an integer mixed with a float takes
+ * that float's type whatever its width, so int32 + float32 is computed in float32 where NumPy
+ * widens to float64. Leaving the cast to the kernel is therefore only exact where both rules
+ * agree.
+ *
+ * The table in capabilities.cpp lists, per kernel, the input dtypes it accepts; a combination
+ * (a, b) -> common is native when both inputs are among them and the kernel's own promotion of
+ * (a, b) is `common`. tests/asnumpy_tests/dtype_tests/test_dtype_layer.py runs every native
+ * combination against NumPy.
+ */
+
+/// True if `aclnn_api` computes inputs of dtypes `a` and `b` in `common` without either operand
+/// being cast first. False for kernels absent from the table.
+bool KernelPromotes(std::string_view aclnn_api, aclDataType a, aclDataType b, aclDataType common);
+
+} // namespace asnumpy::dtypes
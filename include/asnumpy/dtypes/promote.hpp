@@ -18,30 +18,81 @@
 
 #include <asnumpy/utils/npu_array.hpp>
 #include <acl/acl.h>
+#include <cstdint>
 #include <optional>
+#include <stdexcept>
+#include <string_view>
 
 namespace asnumpy {
 
 /**
  * @brief NumPy-exact type promotion for two ACL dtypes.
  *
- * Delegates to numpy.result_type rather than reimplementing the promotion lattice, so asnumpy
- * cannot drift from NumPy. tests/asnumpy_tests/interop_tests/test_numpy_baseline.py pins
- * numpy.result_type as the oracle for exactly this reason.
+ * A lookup into a compiled copy of NumPy's promotion lattice over the 14 supported dtypes, so it
+ * needs neither the interpreter nor the GIL. The table cannot drift from NumPy unnoticed:
+ * tests/asnumpy_tests/dtype_tests/test_dtype_layer.py checks every pair against numpy.result_type,
+ * the oracle pinned by tests/asnumpy_tests/interop_tests/test_numpy_baseline.py.
  *
- * Results are memoized per (a, b) pair, so the Python call happens once per dtype combination
- * rather than once per operation.
+ * Identical dtypes promote to themselves, including device-only ones such as bf16.
  *
- * Only array-array promotion is modelled. NEP 50 weak scalar semantics (a Python int or float
- * operand binding weakly) are not implemented yet; scalar overloads still take the array's dtype.
+ * Only array-array promotion is modelled here; for an array combined with a scalar operand see
+ * WeakScalarResultType.
  *
  * @param a First ACL dtype.
  * @param b Second ACL dtype.
  * @return The promoted ACL dtype.
- * @throws std::invalid_argument If either input, or the promoted result, has no NumPy equivalent.
+ * @throws std::invalid_argument If the dtypes differ and either has no NumPy equivalent.
  */
 aclDataType ResultType(aclDataType a, aclDataType b);
 
+/**
+ * @brief NEP 50 promotion of an array dtype with a scalar operand.
+ *
+ * Python bool, int, float and complex scalars are weak: they adopt the array's dtype unless they
+ * are of a higher kind (bool < integer < floating < complex), in which case the result is that
+ * kind's default -- int64, float64, or complex64/complex128 to match the array's float precision.
+ * NumPy scalars carry a dtype and promote exactly like a 0-d array of it (see ResultType).
+ *
+ * @param array ACL dtype of the array operand.
+ * @param scalar The scalar operand.
+ * @return The promoted ACL dtype.
+ * @throws std::invalid_argument If scalar is neither a Python nor a NumPy scalar.
+ */
+aclDataType WeakScalarResultType(aclDataType array, const py::handle& scalar);
+
+/**
+ * @brief Whether a value of dtype `from` may be stored into `to` under NumPy's "same_kind" casting.
+ *
+ * True when `to` is of the same or a higher kind (bool < unsigned < signed < floating < complex),
+ * which is the rule ufuncs apply to an `out=` operand: float64 into float32 and uint8 into int8 are
+ * allowed, float into int and int8 into uint8 are not.
+ */
+bool CanCastSameKind(aclDataType from, aclDataType to);
+
+/**
+ * @brief A result that cannot be stored in its output operand under "same_kind" casting.
+ *
+ * Raised as TypeError, as NumPy raises UFuncTypeError (a TypeError) for the same write.
+ */
+class CastingError : public std::invalid_argument {
+  public:
+    using std::invalid_argument::invalid_argument;
+};
+
+/**
+ * @brief Counters of the operand casts PromotedOperands was asked for.
+ *
+ * `avoided` counts operands left in their own dtype because the kernel promotes them itself;
+ * `materialized` counts those that got a cast kernel and a temporary.
+ */
+struct CastStats {
+    uint64_t avoided = 0;
+    uint64_t materialized = 0;
+};
+
+/// Process-wide CastStats since start-up.
+CastStats GetCastStats();
+
 /**
  * @brief Two binary operands promoted to their common dtype.
  *
@@ -49,6 +100,10 @@ aclDataType ResultType(aclDataType a, aclDataType b);
  * same-dtype case costs nothing beyond a pointer. Any cast result is owned by this object, so it
  * must outlive the references handed out by x1() and x2().
  *
+ * Given the aclnn kernel the operands are for, the casts are skipped altogether when that kernel
+ * computes the mixed pair in the common dtype itself (dtypes::KernelPromotes). x1() and x2() then
+ * keep their own dtypes; common() is still the result dtype.
+ *
  * Non-copyable and non-movable: the accessors return references into internal storage.
  */
 class PromotedOperands {
@@ -56,6 +111,9 @@ class PromotedOperands {
     /// Promote to result_type(x1, x2).
     PromotedOperands(const NPUArray& x1, const NPUArray& x2);
 
+    /// Promote to result_type(x1, x2) for `aclnn_api`, leaving the casts to the kernel if it can.
+    PromotedOperands(const NPUArray& x1, const NPUArray& x2, std::string_view aclnn_api);
+
     /// Promote to an explicitly requested common dtype (used when a caller forces the operand type).
     PromotedOperands(const NPUArray& x1, const NPUArray& x2, aclDataType common);
 
@@ -71,7 +129,7 @@ class PromotedOperands {
     aclDataType common() const { return common_; }
 
   private:
-    void Materialize(const NPUArray& x1, const NPUArray& x2);
+    void Materialize(const NPUArray& x1, const NPUArray& x2, bool kernelPromotes = false);
 
     std::optional<NPUArray> x1_storage_;
     std::optional<NPUArray> x2_storage_;
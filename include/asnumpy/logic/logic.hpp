@@ -93,7 +93,8 @@ NPUArray greater(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype
  * @brief Perform element-wise greater-than comparison between an array and a scalar.
  *
  * Compares each element of x1 with the scalar value and returns a boolean array
- * indicating where x1 > scalar. Uses aclnnGtScalar internally.
+ * indicating where x1 > scalar. Uses aclnnGtScalar internally. The scalar is passed by value
+ * and promotes under NEP 50, as do the other comparison scalar overloads.
  *
  * @param x1 Input array.
  * @param scalar Scalar value to compare against.
@@ -103,6 +104,19 @@ NPUArray greater(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype
  */
 NPUArray greater(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype = std::nullopt);
 
+/**
+ * @brief Perform element-wise greater-than comparison between a scalar and an array.
+ *
+ * Evaluated as less(x2, scalar), i.e. with aclnnLtScalar.
+ *
+ * @param scalar Scalar value to compare.
+ * @param x2 Input array.
+ * @param dtype (optional) Target numpy dtype for the output array (default: np.bool_).
+ * @return NPUArray Boolean array where each element indicates the result of scalar > x2.
+ * @throws std::runtime_error If ACL operation fails.
+ */
+NPUArray greater(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+
 /**
  * @brief Perform element-wise greater-than-or-equal comparison between two arrays.
  *
@@ -131,6 +145,19 @@ NPUArray greater_equal(const NPUArray& x1, const NPUArray& x2, std::optional<py:
  */
 NPUArray greater_equal(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype = std::nullopt);
 
+/**
+ * @brief Perform element-wise greater-than-or-equal comparison between a scalar and an array.
+ *
+ * Evaluated as less_equal(x2, scalar), i.e. with aclnnLeScalar.
+ *
+ * @param scalar Scalar value to compare.
+ * @param x2 Input array.
+ * @param dtype (optional) Target numpy dtype for the output array (default: np.bool_).
+ * @return NPUArray Boolean array where each element indicates the result of scalar >= x2.
+ * @throws std::runtime_error If ACL operation fails.
+ */
+NPUArray greater_equal(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+
 /**
  * @brief Perform element-wise less-than comparison between two arrays.
  *
@@ -159,6 +186,19 @@ NPUArray less(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> d
  */
 NPUArray less(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype = std::nullopt);
 
+/**
+ * @brief Perform element-wise less-than comparison between a scalar and an array.
+ *
+ * Evaluated as greater(x2, scalar), i.e. with aclnnGtScalar.
+ *
+ * @param scalar Scalar value to compare.
+ * @param x2 Input array.
+ * @param dtype (optional) Target numpy dtype for the output array (default: np.bool_).
+ * @return NPUArray Boolean array where each element indicates the result of scalar < x2.
+ * @throws std::runtime_error If ACL operation fails.
+ */
+NPUArray less(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+
 /**
  * @brief Perform element-wise less-than-or-equal comparison between two arrays.
  *
@@ -187,6 +227,19 @@ NPUArray less_equal(const NPUArray& x1, const NPUArray& x2, std::optional<py::dt
  */
 NPUArray less_equal(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype = std::nullopt);
 
+/**
+ * @brief Perform element-wise less-than-or-equal comparison between a scalar and an array.
+ *
+ * Evaluated as greater_equal(x2, scalar), i.e. with aclnnGeScalar.
+ *
+ * @param scalar Scalar value to compare.
+ * @param x2 Input array.
+ * @param dtype (optional) Target numpy dtype for the output array (default: np.bool_).
+ * @return NPUArray Boolean array where each element indicates the result of scalar <= x2.
+ * @throws std::runtime_error If ACL operation fails.
+ */
+NPUArray less_equal(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+
 /**
  * @brief Perform element-wise equality comparison between two arrays.
  *
@@ -215,6 +268,19 @@ NPUArray equal(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype>
  */
 NPUArray equal(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype = std::nullopt);
 
+/**
+ * @brief Perform element-wise equal comparison between a scalar and an array.
+ *
+ * Evaluated as equal(x2, scalar), i.e. with aclnnEqScalar.
+ *
+ * @param scalar Scalar value to compare.
+ * @param x2 Input array.
+ * @param dtype (optional) Target numpy dtype for the output array (default: np.bool_).
+ * @return NPUArray Boolean array where each element indicates the result of scalar == x2.
+ * @throws std::runtime_error If ACL operation fails.
+ */
+NPUArray equal(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+
 /**
  * @brief Perform element-wise not-equal comparison between two arrays.
  *
@@ -243,4 +309,17 @@ NPUArray not_equal(const NPUArray& x1, const NPUArray& x2, std::optional<py::dty
  */
 NPUArray not_equal(const NPUArray& x1, const py::object& scalar, std::optional<py::dtype> dtype = std::nullopt);
 
+/**
+ * @brief Perform element-wise not-equal comparison between a scalar and an array.
+ *
+ * Evaluated as not_equal(x2, scalar), i.e. with aclnnNeScalar.
+ *
+ * @param scalar Scalar value to compare.
+ * @param x2 Input array.
+ * @param dtype (optional) Target numpy dtype for the output array (default: np.bool_).
+ * @return NPUArray Boolean array where each element indicates the result of scalar != x2.
+ * @throws std::runtime_error If ACL operation fails.
+ */
+NPUArray not_equal(const py::object& scalar, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+
 } // namespace asnumpy
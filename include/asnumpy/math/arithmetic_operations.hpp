@@ -33,10 +33,41 @@ namespace asnumpy {
  * @param x1 First input array.
  * @param x2 Second input array.
  * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
  * @return NPUArray Output array with element-wise sums.
  * @throws std::runtime_error If shapes are not broadcastable, dtype unsupported, or ACL op fails.
  */
-NPUArray Add(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Add(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+             NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise addition of an array and a scalar.
+ *
+ * Uses aclnnAdds with the scalar passed by value, so no device memory is allocated for it. The
+ * scalar promotes under NEP 50: a Python scalar of the array's kind keeps the array's dtype.
+ *
+ * @param x1 Input array.
+ * @param x2 Python or NumPy scalar.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray Add(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt,
+             NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise addition of a scalar and an array.
+ *
+ * @param x1 Python or NumPy scalar.
+ * @param x2 Input array.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray Add(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+             NPUArray* out = nullptr);
 
 /**
  * @brief Compute the reciprocal (1/x) of each element in the input array.
@@ -53,7 +84,7 @@ NPUArray Reciprocal(const NPUArray& x, std::optional<py::dtype> dtype = std::nul
 /**
  * @brief Unary positive operator: return a copy or cast of the input array.
  *
- * If the target dtype matches the input, this returns a deep copy.
+ * If the target dtype matches the input, this returns a copy-on-write copy.
  * Otherwise, performs dtype casting on NPU using aclnnCast.
  *
  * @param x Input array.
@@ -70,10 +101,11 @@ NPUArray Positive(const NPUArray& x, std::optional<py::dtype> dtype = std::nullo
  *
  * @param x Input array.
  * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
  * @return NPUArray Array with element-wise negated values.
  * @throws std::runtime_error If ACL operation or memory allocation fails.
  */
-NPUArray Negative(const NPUArray& x, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Negative(const NPUArray& x, std::optional<py::dtype> dtype = std::nullopt, NPUArray* out = nullptr);
 
 /**
  * @brief Element-wise multiplication of two arrays with broadcasting.
@@ -84,10 +116,40 @@ NPUArray Negative(const NPUArray& x, std::optional<py::dtype> dtype = std::nullo
  * @param x1 First input array.
  * @param x2 Second input array.
  * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
  * @return NPUArray Array with element-wise products.
  * @throws std::runtime_error If shapes are not broadcastable, dtype unsupported, or ACL op fails.
  */
-NPUArray Multiply(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Multiply(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+                  NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise multiplication of an array by a scalar.
+ *
+ * Computed with aclnnMuls; promotion as for the Add scalar overload.
+ *
+ * @param x1 Input array.
+ * @param x2 Python or NumPy scalar.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray Multiply(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt,
+                  NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise multiplication of a scalar by an array.
+ *
+ * @param x1 Python or NumPy scalar.
+ * @param x2 Input array.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray Multiply(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+                  NPUArray* out = nullptr);
 
 /**
  * @brief Element-wise division of two arrays with broadcasting.
@@ -98,10 +160,40 @@ NPUArray Multiply(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtyp
  * @param x1 Dividend array.
  * @param x2 Divisor array.
  * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
  * @return NPUArray Array with element-wise quotients.
  * @throws std::runtime_error If shapes are not broadcastable, dtype unsupported, or ACL op fails.
  */
-NPUArray Divide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Divide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+                NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise division of an array by a scalar.
+ *
+ * Computed with aclnnDivs. Integer operands widen to float64, as for the array overload.
+ *
+ * @param x1 Input array.
+ * @param x2 Python or NumPy scalar.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray Divide(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt,
+                NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise division of a scalar by an array, as reciprocal(x2) * x1.
+ *
+ * @param x1 Python or NumPy scalar.
+ * @param x2 Input array.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray Divide(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+                NPUArray* out = nullptr);
 
 /**
  * @brief Element-wise true division of two arrays.
@@ -111,10 +203,38 @@ NPUArray Divide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype>
  * @param x1 Dividend array.
  * @param x2 Divisor array.
  * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
  * @return NPUArray Array with element-wise quotients.
  * @throws std::runtime_error If Divide fails.
  */
-NPUArray TrueDivide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray TrueDivide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+                    NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise true division of an array by a scalar (delegates to Divide).
+ *
+ * @param x1 Input array.
+ * @param x2 Python or NumPy scalar.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray TrueDivide(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt,
+                    NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise true division of a scalar by an array (delegates to Divide).
+ *
+ * @param x1 Python or NumPy scalar.
+ * @param x2 Input array.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray TrueDivide(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+                    NPUArray* out = nullptr);
 
 /**
  * @brief Element-wise subtraction of two arrays with broadcasting.
@@ -125,10 +245,62 @@ NPUArray TrueDivide(const NPUArray& x1, const NPUArray& x2, std::optional<py::dt
  * @param x1 First input array.
  * @param x2 Second input array.
  * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
  * @return NPUArray Array with element-wise differences.
  * @throws std::runtime_error If shapes are not broadcastable, dtype unsupported, or ACL op fails.
  */
-NPUArray Subtract(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Subtract(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+                  NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise subtraction of a scalar from an array.
+ *
+ * Computed with aclnnSubs; promotion as for the Add scalar overload.
+ *
+ * @param x1 Input array.
+ * @param x2 Python or NumPy scalar.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray Subtract(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt,
+                  NPUArray* out = nullptr);
+
+/**
+ * @brief Element-wise subtraction of an array from a scalar, using aclnnRsubs.
+ *
+ * @param x1 Python or NumPy scalar.
+ * @param x2 Input array.
+ * @param dtype (optional) Target dtype for the output array.
+ * @param out (optional) Existing array to receive the result.
+ * @return NPUArray Output array.
+ * @throws std::runtime_error If conversion fails or ACL op fails.
+ */
+NPUArray Subtract(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt,
+                  NPUArray* out = nullptr);
+
+/**
+ * @brief In-place update self += other (self -= other, ...), with broadcasting of other.
+ *
+ * Runs the aclnn Inplace* kernels, so no output array is allocated: `+=` and `np.add(a, b, out=a)`
+ * both end up here. other must broadcast to self's shape and the promoted type must cast to
+ * self's dtype under "same_kind"; InplaceDivide also rejects integer self, as true division
+ * always yields a float.
+ *
+ * @param self Array to update.
+ * @param other Array or Python/NumPy scalar operand.
+ * @throws std::invalid_argument If the result does not fit self's shape or dtype.
+ * @throws std::runtime_error If the ACL op fails.
+ */
+void InplaceAdd(NPUArray& self, const NPUArray& other);
+void InplaceAdd(NPUArray& self, const py::object& other);
+void InplaceSubtract(NPUArray& self, const NPUArray& other);
+void InplaceSubtract(NPUArray& self, const py::object& other);
+void InplaceMultiply(NPUArray& self, const NPUArray& other);
+void InplaceMultiply(NPUArray& self, const py::object& other);
+void InplaceDivide(NPUArray& self, const NPUArray& other);
+void InplaceDivide(NPUArray& self, const py::object& other);
 
 /**
  * @brief Element-wise floor division of two arrays with broadcasting.
@@ -160,7 +332,8 @@ NPUArray Power(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype>
 /**
  * @brief Scalar ** Tensor power.
  *
- * Computes scalar ** x2 element-wise on NPU using aclnnPowScalarTensor.
+ * Computes scalar ** x2 element-wise on NPU using aclnnPowScalarTensor. The scalar promotes
+ * under NEP 50 and never touches device memory.
  *
  * @param x1 Scalar base (Python object convertible to number).
  * @param x2 Exponent array.
@@ -173,7 +346,8 @@ NPUArray Power(const py::object& x1, const NPUArray& x2, std::optional<py::dtype
 /**
  * @brief Tensor ** Scalar power.
  *
- * Computes x1 ** scalar element-wise on NPU using aclnnPowTensorScalar.
+ * Computes x1 ** scalar element-wise on NPU using aclnnPowTensorScalar. The scalar promotes
+ * under NEP 50 and never touches device memory.
  *
  * @param x1 Base array.
  * @param x2 Scalar exponent (Python object convertible to number).
@@ -19,7 +19,9 @@
 #include <asnumpy/utils/npu_array.hpp>
 #include <acl/acl.h>
 #include <aclnn/aclnn_base.h>
+#include <optional>
 #include <utility>
+#include <vector>
 
 namespace asnumpy {
 
@@ -31,16 +33,31 @@ NPUArray Fmax(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> d
 
 NPUArray Fmin(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
 
-NPUArray Max(const NPUArray& a, int64_t axis, bool keepdims);
-double Max(const NPUArray& a);
+// Array-scalar forms: clamp kernels with the scalar passed by value, promoted under NEP 50.
+NPUArray Maximum(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Maximum(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
 
-NPUArray Nanmax(const NPUArray& a, int64_t axis, bool keepdims);
-double Nanmax(const NPUArray& a);
+NPUArray Minimum(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Minimum(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
 
-NPUArray Min(const NPUArray& a, int64_t axis, bool keepdims);
-double Min(const NPUArray& a);
+NPUArray Fmax(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Fmax(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
 
-NPUArray Nanmin(const NPUArray& a, int64_t axis, bool keepdims);
-double Nanmin(const NPUArray& a);
+NPUArray Fmin(const NPUArray& x1, const py::object& x2, std::optional<py::dtype> dtype = std::nullopt);
+NPUArray Fmin(const py::object& x1, const NPUArray& x2, std::optional<py::dtype> dtype = std::nullopt);
+
+// Reductions over `axis` (std::nullopt: every axis) in a single aclnnAmax/aclnnAmin call. The
+// whole-array forms return a 0-d array that stays on the device.
+NPUArray Max(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false);
+NPUArray Max(const NPUArray& a);
+
+NPUArray Nanmax(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false);
+NPUArray Nanmax(const NPUArray& a);
+
+NPUArray Min(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false);
+NPUArray Min(const NPUArray& a);
+
+NPUArray Nanmin(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false);
+NPUArray Nanmin(const NPUArray& a);
 
 } // namespace asnumpy
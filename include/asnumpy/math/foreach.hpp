@@ -0,0 +1,95 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <asnumpy/utils/npu_array.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace asnumpy {
+
+/**
+ * Multi-tensor element-wise operators (the aclnnForeach* kernels).
+ *
+ * Each function applies one operator to every array, or every pair of arrays, of its lists and
+ * returns the results in order. Arrays the Foreach kernels take are batched: they must be
+ * non-empty, C-contiguous and float16, bfloat16 or float32, and a pair must also agree in shape
+ * and dtype. Such arrays are grouped by dtype and handed over kForeachChunk at a time, one launch
+ * per group. Hundreds of small arrays thus cost a few launches, GetWorkspaceSize calls and (in
+ * blocking mode) syncs rather than one of each per array. Every other array goes through the
+ * ordinary operator on its own, with its promotion and broadcasting, so results match it.
+ */
+
+using ArrayList = std::vector<const NPUArray*>;
+
+/// Arrays per Foreach launch. The kernels tile a list across the AI cores, and lists of a few
+/// dozen tensors already keep them busy.
+inline constexpr size_t kForeachChunk = 48;
+
+/**
+ * @brief x1[i] + x2[i] for every i
+ * @throws std::invalid_argument If the lists differ in length
+ */
+std::vector<NPUArray> ForeachAdd(const ArrayList& x1, const ArrayList& x2);
+
+/**
+ * @brief x1[i] - x2[i] for every i
+ * @throws std::invalid_argument If the lists differ in length
+ */
+std::vector<NPUArray> ForeachSubtract(const ArrayList& x1, const ArrayList& x2);
+
+/**
+ * @brief x1[i] * x2[i] for every i
+ * @throws std::invalid_argument If the lists differ in length
+ */
+std::vector<NPUArray> ForeachMultiply(const ArrayList& x1, const ArrayList& x2);
+
+/**
+ * @brief x1[i] / x2[i] (true division) for every i
+ * @throws std::invalid_argument If the lists differ in length
+ */
+std::vector<NPUArray> ForeachDivide(const ArrayList& x1, const ArrayList& x2);
+
+/**
+ * @brief x[i] + value for every i; `value` is a Python or NumPy scalar, weakly typed as for Add
+ */
+std::vector<NPUArray> ForeachAddScalar(const ArrayList& x, const py::object& value);
+
+/**
+ * @brief x[i] * value for every i; `value` is a Python or NumPy scalar, weakly typed as for Multiply
+ */
+std::vector<NPUArray> ForeachMultiplyScalar(const ArrayList& x, const py::object& value);
+
+/// @brief exp(x[i]) for every i
+std::vector<NPUArray> ForeachExp(const ArrayList& x);
+
+/// @brief sqrt(x[i]) for every i
+std::vector<NPUArray> ForeachSqrt(const ArrayList& x);
+
+/// @brief -x[i] for every i
+std::vector<NPUArray> ForeachNegative(const ArrayList& x);
+
+/**
+ * @brief The vector `ord`-norm of all elements of x[i], as a 0-d array, for every i
+ *
+ * As numpy.linalg.norm(x[i].ravel(), ord): the result keeps a floating dtype and is float64 for
+ * other inputs. Only ord 1 and 2 are batched.
+ */
+std::vector<NPUArray> ForeachNorm(const ArrayList& x, double ord);
+
+} // namespace asnumpy
@@ -0,0 +1,72 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <asnumpy/utils/npu_array.hpp>
+
+namespace asnumpy {
+
+/**
+ * @brief Fused multiply-add: input + value * tensor1 * tensor2 in one launch.
+ *
+ * Runs aclnnAddcmul over the three operands broadcast together and promoted to their
+ * common dtype, replacing a Mul followed by an Add and the temporary between them.
+ *
+ * @param input Addend.
+ * @param tensor1 First factor.
+ * @param tensor2 Second factor.
+ * @param value Scale applied to the product.
+ * @return NPUArray Result with the broadcast shape of all three operands.
+ * @throws std::invalid_argument If the shapes are not broadcastable.
+ * @throws std::runtime_error If the ACL operation fails.
+ */
+NPUArray Addcmul(const NPUArray& input, const NPUArray& tensor1, const NPUArray& tensor2, double value = 1.0);
+
+/**
+ * @brief Linear interpolation: start + weight * (end - start) in one launch.
+ *
+ * Runs aclnnLerp. Integer operands are promoted to float64 as NumPy would; float64 is
+ * computed in float32 and cast back because the kernel has no double variant.
+ *
+ * @param start Value at weight 0.
+ * @param end Value at weight 1.
+ * @param weight Interpolation weight.
+ * @return NPUArray Result with the broadcast shape of all three operands.
+ * @throws std::invalid_argument If the shapes are not broadcastable.
+ * @throws std::runtime_error If the ACL operation fails.
+ */
+NPUArray Lerp(const NPUArray& start, const NPUArray& end, const NPUArray& weight);
+
+/**
+ * @brief Scaled addition: y + alpha * x (or y - alpha * x) in one launch.
+ *
+ * Runs aclnnAdd (aclnnSub) with its alpha scalar, replacing a Mul by a scalar followed by an
+ * Add (Sub). The result has the dtype of the unfused chain: alpha promotes against x as a
+ * scalar operand (see WeakScalarResultType), and that dtype against y. The product is not
+ * rounded to its own dtype first, so callers fall back to the chain when that dtype is narrower.
+ *
+ * @param x Scaled operand.
+ * @param y Addend (minuend when subtract is true).
+ * @param alpha Python or NumPy scalar applied to x.
+ * @param subtract Whether to compute y - alpha * x.
+ * @return NPUArray Result with the broadcast shape of x and y.
+ * @throws std::invalid_argument If the shapes are not broadcastable or alpha is not a scalar.
+ * @throws std::runtime_error If the ACL operation fails.
+ */
+NPUArray Axpy(const NPUArray& x, const NPUArray& y, const py::object& alpha, bool subtract = false);
+
+} // namespace asnumpy
@@ -21,21 +21,30 @@
 #include <acl/acl.h>
 #include <aclnn/aclnn_base.h>
 
+#include <cstdint>
 #include <optional>
 #include <utility>
+#include <vector>
 
 namespace asnumpy {
-NPUArray Prod(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype = std::nullopt);
-double Prod(const NPUArray& a);
-
-NPUArray Sum(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype = std::nullopt);
-double Sum(const NPUArray& a);
-
-NPUArray Nanprod(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype = std::nullopt);
-double Nanprod(const NPUArray& a);
-
-NPUArray Nansum(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype = std::nullopt);
-double Nansum(const NPUArray& a);
+// Reductions over `axis` (std::nullopt: every axis) are one aclnn reduce call on the array as it is,
+// without a flattened copy. `where` masks elements out by replacing them with the identity first.
+// Whole-array reductions return a 0-d array that stays on the device (see ScalarView).
+NPUArray Prod(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false,
+              std::optional<py::dtype> dtype = std::nullopt, const std::optional<NPUArray>& where = std::nullopt);
+NPUArray Prod(const NPUArray& a);
+
+NPUArray Sum(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false,
+             std::optional<py::dtype> dtype = std::nullopt, const std::optional<NPUArray>& where = std::nullopt);
+NPUArray Sum(const NPUArray& a);
+
+NPUArray Nanprod(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false,
+                 std::optional<py::dtype> dtype = std::nullopt, const std::optional<NPUArray>& where = std::nullopt);
+NPUArray Nanprod(const NPUArray& a);
+
+NPUArray Nansum(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false,
+                std::optional<py::dtype> dtype = std::nullopt, const std::optional<NPUArray>& where = std::nullopt);
+NPUArray Nansum(const NPUArray& a);
 
 NPUArray Cumprod(const NPUArray& a, int64_t axis, std::optional<py::dtype> dtype = std::nullopt);
 
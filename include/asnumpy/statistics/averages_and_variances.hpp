@@ -21,10 +21,16 @@
 #include <acl/acl.h>
 #include <aclnn/aclnn_base.h>
 
+#include <cstdint>
 #include <optional>
 #include <utility>
+#include <vector>
 
 namespace asnumpy {
-NPUArray Mean(const NPUArray& a, int64_t axis, bool keepdims, std::optional<py::dtype> dtype = std::nullopt);
-double Mean(const NPUArray& a, std::optional<py::dtype> dtype = std::nullopt);
+// Mean over `axis` (std::nullopt: every axis) in one aclnnMean call; with `where`, the mean of the
+// selected elements only.
+NPUArray Mean(const NPUArray& a, const std::optional<std::vector<int64_t>>& axis, bool keepdims = false,
+              std::optional<py::dtype> dtype = std::nullopt, const std::optional<NPUArray>& where = std::nullopt);
+// Mean of the whole array, as a 0-d array that stays on the device.
+NPUArray Mean(const NPUArray& a, std::optional<py::dtype> dtype = std::nullopt);
 } // namespace asnumpy
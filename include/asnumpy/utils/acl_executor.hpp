@@ -17,16 +17,28 @@
 #pragma once
 
 #include <aclnn/aclnn_base.h>
+#include <cstdint>
 #include <fmt/format.h>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <spdlog/spdlog.h>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <typeinfo>
 #include <vector>
+#include "asnumpy/cann/execution.hpp"
+#include "asnumpy/cann/executor_cache.hpp"
+#include "asnumpy/cann/stream.hpp"
 #include "asnumpy/dtypes/dtype_table.hpp"
 #include "asnumpy/dtypes/promote.hpp"
 #include "asnumpy/utils/acl_resource.hpp"
+#include "asnumpy/utils/cast.hpp"
+#include "asnumpy/utils/donation.hpp"
 #include "asnumpy/utils/npu_array.hpp"
+#include "asnumpy/utils/npu_scalar.hpp"
 #include "asnumpy/utils/status_handler.hpp"
 
 namespace asnumpy {
@@ -44,6 +56,169 @@ inline std::string FormatShape(const std::vector<int64_t>& shape) {
     return result.empty() ? "()" : result;
 }
 
+// A GetWorkspaceSize callable is fully described by its type (plus its value, for a function
+// pointer) only if it captures nothing; only then may the executor it builds be reused.
+template <typename F>
+inline constexpr bool kCacheableBuild = std::is_empty_v<std::decay_t<F>> || std::is_pointer_v<std::decay_t<F>>;
+
+// Executor cache op name for a GetWorkspaceSize callable: distinct callables never share entries.
+template <typename F>
+std::string ExecutorCacheOp(const std::string& aclnn_api, const F& func) {
+    using Func = std::decay_t<F>;
+    std::string op = aclnn_api + '/' + typeid(Func).name();
+    if constexpr (std::is_pointer_v<Func>) {
+        Func ptr = func;
+        op += fmt::format("@{:x}", reinterpret_cast<std::uintptr_t>(ptr));
+    }
+    return op;
+}
+
+/**
+ * @brief Build and launch one aclnn operator, reusing a cached repeatable executor when possible
+ *
+ * @param arrays Operands, inputs first, in the order `build` takes them
+ * @param tensors Their tensor() handles; fetching these is what tracks the operands
+ * @param numInputs Number of leading operands that are inputs
+ * @param cacheable Whether `build` may be keyed on `op` (see kCacheableBuild)
+ */
+template <typename ExecuteFunc>
+void LaunchOp(const std::string& op, bool cacheable, const std::vector<const NPUArray*>& arrays,
+              const std::vector<aclTensor*>& tensors, size_t numInputs, const cann::ExecutorCache::BuildFunc& build,
+              ExecuteFunc&& execute_func, const std::string& aclnn_api, const char* src_file, const char* src_func) {
+    auto& cache = cann::ExecutorCache::Instance();
+    if (!cacheable || !cache.Enabled()) {
+        uint64_t workspaceSize = 0;
+        aclOpExecutor* executor = nullptr;
+        auto error = build(tensors, &workspaceSize, &executor);
+        CheckAclnnStatus(error, src_file, src_func, aclnn_api + "GetWorkspaceSize");
+        AclWorkspace workspace(workspaceSize);
+        error = std::invoke(execute_func, workspace.get(), workspaceSize, executor, cann::CurrentStream());
+        CheckAclnnStatus(error, src_file, src_func, aclnn_api);
+        return;
+    }
+
+    std::vector<cann::TensorLayout> layouts;
+    std::vector<void*> addresses(tensors.size(), nullptr);
+    layouts.reserve(arrays.size());
+    for (size_t i = 0; i < arrays.size(); ++i) {
+        const NPUArray& array = *arrays[i];
+        auto error = aclGetRawTensorAddr(tensors[i], &addresses[i]);
+        CheckAclnnStatus(error, src_file, src_func, "aclGetRawTensorAddr");
+        layouts.push_back({array.aclDtype, array.shape, array.strides, array.storageOffset, array.StorageDims()});
+    }
+
+    auto entry = cache.Find(op, layouts);
+    if (!entry) {
+        aclnnStatus error = ACL_SUCCESS;
+        entry = cache.Build(op, layouts, numInputs, addresses, build, &error);
+        CheckAclnnStatus(error, src_file, src_func, aclnn_api + "GetWorkspaceSize");
+    }
+
+    // One launch at a time per entry: the bound addresses are part of the executor.
+    std::lock_guard<std::mutex> lock(entry->mutex);
+    auto error = entry->Rebind(addresses);
+    CheckAclnnStatus(error, src_file, src_func, "aclSetTensorAddr");
+    AclWorkspace workspace(entry->workspaceSize());
+    auto stream = cann::CurrentStream();
+    error = std::invoke(execute_func, workspace.get(), entry->workspaceSize(), entry->executor(), stream);
+    CheckAclnnStatus(error, src_file, src_func, aclnn_api);
+    entry->MarkLaunched(stream);
+}
+
+// True if `a` and `b` are the same view: same storage, offset, strides and shape.
+inline bool SameView(const NPUArray& a, const NPUArray& b) {
+    return a.SharesStorage(b) && a.storageOffset == b.storageOffset && a.strides == b.strides && a.shape == b.shape;
+}
+
+/**
+ * @brief Where an operator writes its result
+ *
+ * Without an `out` operand this is a freshly allocated array, or the buffer of a donated input
+ * (NPUArray::Donate) that has the result's shape and dtype when the kernel may write over its
+ * input (KernelWritesOverInput). With one, the kernel writes straight into `out` when it already
+ * has the result's dtype and shares no storage with an input. Otherwise the result goes to a
+ * temporary that Finish() casts and copies into `out`: aclnn out-of-place kernels neither promise
+ * to cast on store nor to tolerate an output aliasing an input.
+ */
+class OutputTarget {
+  public:
+    OutputTarget(NPUArray* out, const std::vector<int64_t>& shape, aclDataType dtype,
+                 std::initializer_list<const NPUArray*> inputs, std::string_view aclnn_api, const char* src_file,
+                 const char* src_func)
+        : out_(out) {
+        if (out_ == nullptr && TakeDonation(shape, dtype, inputs, aclnn_api))
+            return;
+        if (out_ != nullptr) {
+            if (out_->shape != shape) {
+                throw std::invalid_argument(fmt::format("[{}]({}) output operand has shape {}, the result has shape {}",
+                                                        LogBasename(src_file), src_func, FormatShape(out_->shape),
+                                                        FormatShape(shape)));
+            }
+            if (!CanCastSameKind(dtype, out_->aclDtype)) {
+                throw CastingError(
+                    fmt::format("[{}]({}) cannot cast the {} result to the {} output operand with casting rule "
+                                "'same_kind'",
+                                LogBasename(src_file), src_func, AclDtypeName(dtype), AclDtypeName(out_->aclDtype)));
+            }
+            bool aliased = false;
+            for (const NPUArray* input : inputs)
+                aliased = aliased || input->SharesStorage(*out_);
+            if (out_->aclDtype == dtype && !aliased)
+                return;
+        }
+        fresh_.emplace(shape, dtype);
+    }
+
+    NPUArray& get() { return fresh_ ? *fresh_ : *out_; }
+
+    /// The operator's result: `out` itself, once any temporary has been copied into it, or the
+    /// fresh array.
+    NPUArray Finish() {
+        if (donated_)
+            fresh_->Reclaim();
+        if (out_ == nullptr)
+            return std::move(*fresh_);
+        if (fresh_)
+            out_->Assign(fresh_->aclDtype == out_->aclDtype ? *fresh_ : CastTo(*fresh_, out_->aclDtype));
+        return *out_;
+    }
+
+  private:
+    // Only the first operator to see a donated input may take its buffer, so the donation ends
+    // here whether or not it fits. A taken buffer stays donated until Finish(): the operand may be
+    // a copy-on-write copy of the donor, and the result's write must not duplicate the buffer.
+    bool TakeDonation(const std::vector<int64_t>& shape, aclDataType dtype,
+                      std::initializer_list<const NPUArray*> inputs, std::string_view aclnn_api) {
+        const NPUArray* donor = nullptr;
+        for (const NPUArray* input : inputs) {
+            if (donor == nullptr && input->IsDonated())
+                donor = input;
+        }
+        if (donor == nullptr)
+            return false;
+        bool fits = donor->shape == shape && donor->aclDtype == dtype && donor->storageOffset == 0 &&
+                    donor->IsContiguous() && KernelWritesOverInput(aclnn_api);
+        // Another operand over the same buffer must read it in the same layout, element for element.
+        for (const NPUArray* input : inputs) {
+            fits = fits && (!input->IsDonated() ||
+                            (input->shape == donor->shape && input->strides == donor->strides &&
+                             input->storageOffset == donor->storageOffset));
+        }
+        detail::CountDonation(fits);
+        if (!fits) {
+            donor->Reclaim();
+            return false;
+        }
+        fresh_.emplace(donor->AsStrided(shape, donor->strides, 0));
+        donated_ = true;
+        return true;
+    }
+
+    NPUArray* out_;
+    std::optional<NPUArray> fresh_;
+    bool donated_ = false;
+};
+
 } // namespace detail
 
 /**
@@ -57,6 +232,7 @@ inline std::string FormatShape(const std::vector<int64_t>& shape) {
  * @tparam ExecuteFunc Type of the function to execute the operation
  * @param input Input array
  * @param dtype Output data type. If nullopt, the input's dtype is used.
+ * @param out Array to write the result into, or nullptr to allocate one (see detail::OutputTarget)
  * @param get_workspace_size_func Function to get workspace size and executor
  * @param execute_func Function to execute the operator
  * @param op_name Operator name (for logging and error messages)
@@ -66,7 +242,7 @@ inline std::string FormatShape(const std::vector<int64_t>& shape) {
  * @return NPUArray Output array
  */
 template <typename GetWorkspaceSizeFunc, typename ExecuteFunc>
-NPUArray ExecuteUnaryOp(const NPUArray& input, std::optional<py::dtype> dtype,
+NPUArray ExecuteUnaryOp(const NPUArray& input, std::optional<py::dtype> dtype, NPUArray* out,
                         GetWorkspaceSizeFunc&& get_workspace_size_func, ExecuteFunc&& execute_func,
                         const std::string& op_name, const std::string& aclnn_api, const char* src_file,
                         const char* src_func) {
@@ -77,29 +253,26 @@ NPUArray ExecuteUnaryOp(const NPUArray& input, std::optional<py::dtype> dtype,
     // Determine output type and shape. nullopt means "same as input" -- the doxygen promised this
     // default but the code used to call dtype.value() unconditionally, throwing bad_optional_access
     // with no op name or source context. ExecuteBinaryOp honours nullopt, so this stays symmetric.
-    auto out = dtype.has_value() ? NPUArray(input.shape, dtype.value()) : NPUArray(input.shape, input.aclDtype);
+    const aclDataType out_dtype = dtype.has_value() ? dtypes::AclFromNumpy(dtype.value()) : input.aclDtype;
+    detail::OutputTarget target(out, input.shape, out_dtype, {&input}, aclnn_api, src_file, src_func);
+    NPUArray& result = target.get();
 
-    // Get workspace size and executor
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error = std::invoke(get_workspace_size_func, input.tensorPtr, out.tensorPtr, &workspaceSize, &executor);
-    CheckAclnnStatus(error, src_file, src_func, aclnn_api + "GetWorkspaceSize");
+    // Get (or reuse) the executor and launch it
+    auto build = [&get_workspace_size_func](const std::vector<aclTensor*>& tensors, uint64_t* workspaceSize,
+                                            aclOpExecutor** executor) {
+        return std::invoke(get_workspace_size_func, tensors[0], tensors[1], workspaceSize, executor);
+    };
+    detail::LaunchOp(detail::ExecutorCacheOp(aclnn_api, get_workspace_size_func),
+                     detail::kCacheableBuild<GetWorkspaceSizeFunc>, {&input, &result},
+                     {input.tensor(), result.tensor()}, 1, build, execute_func, aclnn_api, src_file, src_func);
 
-    // RAII management of workspace
-    AclWorkspace workspace(workspaceSize);
-
-    // Execute operation
-    error = std::invoke(execute_func, workspace.get(), workspaceSize, executor, nullptr);
-    CheckAclnnStatus(error, src_file, src_func, aclnn_api);
-
-    // Synchronize device
-    error = aclrtSynchronizeDevice();
-    CheckAclRuntimeStatus(error, src_file, src_func, aclnn_api + ": aclrtSynchronizeDevice");
+    // Synchronize device (blocking mode) or record the launch (async mode)
+    cann::NotifyLaunched(aclnn_api.c_str(), src_file, src_func);
 
     spdlog::info("[{}]({}) {} completed", detail::LogBasename(src_file), src_func, aclnn_api);
 
     // All resources automatically freed by RAII
-    return out;
+    return target.Finish();
 }
 
 /**
@@ -113,12 +286,14 @@ NPUArray ExecuteUnaryOp(const NPUArray& input, std::optional<py::dtype> dtype,
  * @tparam ExecuteFunc Type of the function to execute the operation
  * Both operands are promoted to numpy.result_type(x1.dtype, x2.dtype) before the kernel runs, so
  * the result does not depend on argument order. An operand is only cast when its dtype differs
- * from the promoted type, so same-dtype calls -- the common case -- cost nothing extra.
+ * from the promoted type, so same-dtype calls -- the common case -- cost nothing extra. Mixed
+ * dtypes the kernel promotes exactly by itself are not cast at all (dtypes::KernelPromotes).
  *
  * @param x1 First input array
  * @param x2 Second input array
  * @param dtype Output data type. If nullopt, the promoted operand type is used. Pass an explicit
  *              dtype for ops whose output type is not the operand type (comparisons return bool).
+ * @param out Array to write the result into, or nullptr to allocate one (see detail::OutputTarget)
  * @param get_workspace_size_func Function to get workspace size and executor
  * @param execute_func Function to execute the operator
  * @param op_name Operator name (for logging and error messages)
@@ -128,7 +303,7 @@ NPUArray ExecuteUnaryOp(const NPUArray& input, std::optional<py::dtype> dtype,
  * @return NPUArray Output array
  */
 template <typename GetWorkspaceSizeFunc, typename ExecuteFunc>
-NPUArray ExecuteBinaryOp(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype,
+NPUArray ExecuteBinaryOp(const NPUArray& x1, const NPUArray& x2, std::optional<py::dtype> dtype, NPUArray* out,
                          GetWorkspaceSizeFunc&& get_workspace_size_func, ExecuteFunc&& execute_func,
                          const std::string& op_name, const std::string& aclnn_api, const char* src_file,
                          const char* src_func) {
@@ -138,45 +313,218 @@ NPUArray ExecuteBinaryOp(const NPUArray& x1, const NPUArray& x2, std::optional<p
 
     // Promote operands to a common dtype. Previously x2's dtype was never consulted and x1's won,
     // which made the result depend on argument order.
-    PromotedOperands operands(x1, x2);
+    PromotedOperands operands(x1, x2, aclnn_api);
     const NPUArray& a = operands.x1();
     const NPUArray& b = operands.x2();
 
     // Determine output shape and type. The default path uses the aclDataType ctor directly rather
     // than going through NumpyFromAcl: building a Python np.dtype only for NPUArray to convert it
     // straight back would cost a dtype construction plus an inverse table lookup on every op.
-    auto out_shape = GetBroadcastShape(a, b);
-    auto out = dtype.has_value() ? NPUArray(out_shape, dtype.value()) : NPUArray(out_shape, operands.common());
+    const aclDataType out_dtype = dtype.has_value() ? dtypes::AclFromNumpy(dtype.value()) : operands.common();
+    detail::OutputTarget target(out, GetBroadcastShape(a, b), out_dtype, {&x1, &x2}, aclnn_api, src_file,
+                                src_func);
+    NPUArray& result = target.get();
 
-    // Get workspace size and executor
-    uint64_t workspaceSize = 0;
-    aclOpExecutor* executor = nullptr;
-    auto error =
-        std::invoke(get_workspace_size_func, a.tensorPtr, b.tensorPtr, out.tensorPtr, &workspaceSize, &executor);
-    CheckAclnnStatus(error, src_file, src_func, aclnn_api + "GetWorkspaceSize");
+    // Get (or reuse) the executor and launch it
+    auto build = [&get_workspace_size_func](const std::vector<aclTensor*>& tensors, uint64_t* workspaceSize,
+                                            aclOpExecutor** executor) {
+        return std::invoke(get_workspace_size_func, tensors[0], tensors[1], tensors[2], workspaceSize, executor);
+    };
+    detail::LaunchOp(detail::ExecutorCacheOp(aclnn_api, get_workspace_size_func),
+                     detail::kCacheableBuild<GetWorkspaceSizeFunc>, {&a, &b, &result},
+                     {a.tensor(), b.tensor(), result.tensor()}, 2, build, execute_func, aclnn_api, src_file, src_func);
 
-    // RAII management of workspace
-    AclWorkspace workspace(workspaceSize);
+    // Synchronize device (blocking mode) or record the launch (async mode)
+    cann::NotifyLaunched(aclnn_api.c_str(), src_file, src_func);
 
-    // Execute operation
-    error = std::invoke(execute_func, workspace.get(), workspaceSize, executor, nullptr);
-    CheckAclnnStatus(error, src_file, src_func, aclnn_api);
+    spdlog::info("[{}]({}) {} completed", detail::LogBasename(src_file), src_func, aclnn_api);
 
-    // Synchronize device
-    error = aclrtSynchronizeDevice();
-    CheckAclRuntimeStatus(error, src_file, src_func, aclnn_api + ": aclrtSynchronizeDevice");
+    // All resources automatically freed by RAII
+    return target.Finish();
+}
+
+/**
+ * @brief Generic tensor-scalar operator execution template
+ *
+ * For the aclnn kernels that take their second operand as an aclScalar (aclnnMuls, aclnnGtScalar,
+ * aclnnClampMin, ...). The scalar is passed by value with the launch, so unlike a 0-d operand
+ * array it costs no device allocation, host-to-device copy or sync.
+ *
+ * Operands promote under NEP 50 (see WeakScalarResultType): the input is cast only when the scalar
+ * outranks its kind, so `x * 2` keeps x's dtype. The executor is never cached, since the scalar's
+ * value is part of it.
+ *
+ * @param input Array operand
+ * @param scalar Python or NumPy scalar operand
+ * @param dtype Output data type. If nullopt, the promoted operand type is used.
+ * @param out Array to write the result into, or nullptr to allocate one (see detail::OutputTarget)
+ * @param get_workspace_size_func Called as (input, scalar, out, workspaceSize, executor)
+ * @param execute_func Function to execute the operator
+ * @param op_name Operator name (for logging and error messages)
+ * @param aclnn_api ACLNN API name (e.g., "aclnnMuls")
+ * @param src_file Source file path (auto-captured via EXECUTE_TENSOR_SCALAR_OP macro)
+ * @param src_func Source function name (auto-captured via EXECUTE_TENSOR_SCALAR_OP macro)
+ * @return NPUArray Output array
+ */
+template <typename GetWorkspaceSizeFunc, typename ExecuteFunc>
+NPUArray ExecuteTensorScalarOp(const NPUArray& input, const py::handle& scalar, std::optional<py::dtype> dtype,
+                               NPUArray* out, GetWorkspaceSizeFunc&& get_workspace_size_func,
+                               ExecuteFunc&& execute_func, const std::string& op_name, const std::string& aclnn_api,
+                               const char* src_file, const char* src_func) {
+    spdlog::debug("[{}]({}) {} start: input_shape={}, aclDtype={}, scalar={}", detail::LogBasename(src_file),
+                  src_func, aclnn_api, detail::FormatShape(input.shape), AclDtypeName(input.aclDtype),
+                  py::repr(scalar).cast<std::string>());
+
+    const aclDataType common = WeakScalarResultType(input.aclDtype, scalar);
+    std::optional<NPUArray> promoted;
+    if (input.aclDtype != common)
+        promoted = CastTo(input, common);
+    const NPUArray& a = promoted ? *promoted : input;
+
+    const aclDataType out_dtype = dtype.has_value() ? dtypes::AclFromNumpy(dtype.value()) : common;
+    detail::OutputTarget target(out, a.shape, out_dtype, {&input}, aclnn_api, src_file, src_func);
+    NPUArray& result = target.get();
+    std::unique_ptr<aclScalar, decltype(&aclDestroyScalar)> value(CreateOperandScalar(scalar, common),
+                                                                   aclDestroyScalar);
+
+    auto build = [&get_workspace_size_func, &value](const std::vector<aclTensor*>& tensors, uint64_t* workspaceSize,
+                                                    aclOpExecutor** executor) {
+        return std::invoke(get_workspace_size_func, tensors[0], value.get(), tensors[1], workspaceSize, executor);
+    };
+    detail::LaunchOp(aclnn_api, false, {&a, &result}, {a.tensor(), result.tensor()}, 1, build, execute_func,
+                     aclnn_api, src_file, src_func);
+
+    cann::NotifyLaunched(aclnn_api.c_str(), src_file, src_func);
 
     spdlog::info("[{}]({}) {} completed", detail::LogBasename(src_file), src_func, aclnn_api);
+    return target.Finish();
+}
 
-    // All resources automatically freed by RAII
-    return out;
+namespace detail {
+
+// An in-place update must keep self's shape and be storable in self's dtype ("same_kind").
+inline void CheckInplace(const NPUArray& self, const std::vector<int64_t>& shape, aclDataType dtype,
+                         const char* src_file, const char* src_func) {
+    if (shape != self.shape) {
+        throw std::invalid_argument(fmt::format("[{}]({}) cannot update an array of shape {} in place with a result "
+                                                "of shape {}",
+                                                LogBasename(src_file), src_func, FormatShape(self.shape),
+                                                FormatShape(shape)));
+    }
+    if (!CanCastSameKind(dtype, self.aclDtype)) {
+        throw CastingError(fmt::format("[{}]({}) cannot store a {} result in a {} array with casting rule 'same_kind'",
+                                       LogBasename(src_file), src_func, AclDtypeName(dtype),
+                                       AclDtypeName(self.aclDtype)));
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief Generic in-place binary operator execution template
+ *
+ * For the aclnn Inplace* kernels (aclnnInplaceMul, ...), which overwrite `self` with self op other,
+ * so the update needs no output allocation at all. `other` must broadcast to self's shape and the
+ * promoted type must be storable in self's dtype; `other` is then cast to that dtype. An `other`
+ * that is a different view of self's storage is copied first, since it would change under the
+ * kernel. The executor is not cached: self is both an input and the output of the kernel.
+ *
+ * @param self Array updated in place
+ * @param other Second operand
+ * @param get_workspace_size_func Called as (self, other, workspaceSize, executor)
+ * @param execute_func Function to execute the operator
+ * @param op_name Operator name (for logging and error messages)
+ * @param aclnn_api ACLNN API name (e.g., "aclnnInplaceMul")
+ * @param src_file Source file path (auto-captured via EXECUTE_INPLACE_BINARY_OP macro)
+ * @param src_func Source function name (auto-captured via EXECUTE_INPLACE_BINARY_OP macro)
+ */
+template <typename GetWorkspaceSizeFunc, typename ExecuteFunc>
+void ExecuteInplaceBinaryOp(NPUArray& self, const NPUArray& other, GetWorkspaceSizeFunc&& get_workspace_size_func,
+                            ExecuteFunc&& execute_func, const std::string& op_name, const std::string& aclnn_api,
+                            const char* src_file, const char* src_func) {
+    spdlog::debug("[{}]({}) {} start: self_shape={}, other_shape={}, self_dtype={}, other_dtype={}",
+                  detail::LogBasename(src_file), src_func, aclnn_api, detail::FormatShape(self.shape),
+                  detail::FormatShape(other.shape), AclDtypeName(self.aclDtype), AclDtypeName(other.aclDtype));
+
+    detail::CheckInplace(self, GetBroadcastShape(self, other), ResultType(self.aclDtype, other.aclDtype), src_file,
+                         src_func);
+    std::optional<NPUArray> staged;
+    if (other.aclDtype != self.aclDtype) {
+        staged = CastTo(other, self.aclDtype);
+    } else if (other.SharesStorage(self) && !detail::SameView(other, self)) {
+        staged.emplace(other.shape, other.aclDtype);
+        staged->Assign(other);
+    }
+    const NPUArray& b = staged ? *staged : other;
+
+    auto build = [&get_workspace_size_func](const std::vector<aclTensor*>& tensors, uint64_t* workspaceSize,
+                                            aclOpExecutor** executor) {
+        return std::invoke(get_workspace_size_func, tensors[0], tensors[1], workspaceSize, executor);
+    };
+    detail::LaunchOp(aclnn_api, false, {&self, &b}, {self.tensor(), b.tensor()}, 2, build, execute_func, aclnn_api,
+                     src_file, src_func);
+
+    cann::NotifyLaunched(aclnn_api.c_str(), src_file, src_func);
+
+    spdlog::info("[{}]({}) {} completed", detail::LogBasename(src_file), src_func, aclnn_api);
+}
+
+/**
+ * @brief Generic in-place tensor-scalar operator execution template
+ *
+ * The aclScalar counterpart of ExecuteInplaceBinaryOp (aclnnInplaceMuls, ...). The scalar promotes
+ * under NEP 50, so a Python scalar of self's kind always fits; a Python int outside the range of
+ * an integer self is rejected.
+ *
+ * @param get_workspace_size_func Called as (self, scalar, workspaceSize, executor)
+ */
+template <typename GetWorkspaceSizeFunc, typename ExecuteFunc>
+void ExecuteInplaceScalarOp(NPUArray& self, const py::handle& scalar, GetWorkspaceSizeFunc&& get_workspace_size_func,
+                            ExecuteFunc&& execute_func, const std::string& op_name, const std::string& aclnn_api,
+                            const char* src_file, const char* src_func) {
+    spdlog::debug("[{}]({}) {} start: self_shape={}, aclDtype={}, scalar={}", detail::LogBasename(src_file), src_func,
+                  aclnn_api, detail::FormatShape(self.shape), AclDtypeName(self.aclDtype),
+                  py::repr(scalar).cast<std::string>());
+
+    detail::CheckInplace(self, self.shape, WeakScalarResultType(self.aclDtype, scalar), src_file, src_func);
+    std::unique_ptr<aclScalar, decltype(&aclDestroyScalar)> value(CreateOperandScalar(scalar, self.aclDtype),
+                                                                   aclDestroyScalar);
+
+    auto build = [&get_workspace_size_func, &value](const std::vector<aclTensor*>& tensors, uint64_t* workspaceSize,
+                                                    aclOpExecutor** executor) {
+        return std::invoke(get_workspace_size_func, tensors[0], value.get(), workspaceSize, executor);
+    };
+    detail::LaunchOp(aclnn_api, false, {&self}, {self.tensor()}, 1, build, execute_func, aclnn_api, src_file,
+                     src_func);
+
+    cann::NotifyLaunched(aclnn_api.c_str(), src_file, src_func);
+
+    spdlog::info("[{}]({}) {} completed", detail::LogBasename(src_file), src_func, aclnn_api);
 }
 
 } // namespace asnumpy
 
 // Wrapper macros - automatically capture source location at call site
 #define EXECUTE_UNARY_OP(input, dtype, get_ws, exec, name, aclnn_api)                                                  \
-    ::asnumpy::ExecuteUnaryOp(input, dtype, get_ws, exec, name, aclnn_api, __FILE__, __func__)
+    ::asnumpy::ExecuteUnaryOp(input, dtype, nullptr, get_ws, exec, name, aclnn_api, __FILE__, __func__)
+
+#define EXECUTE_UNARY_OP_OUT(input, dtype, out, get_ws, exec, name, aclnn_api)                                         \
+    ::asnumpy::ExecuteUnaryOp(input, dtype, out, get_ws, exec, name, aclnn_api, __FILE__, __func__)
 
 #define EXECUTE_BINARY_OP(x1, x2, dtype, get_ws, exec, name, aclnn_api)                                                \
-    ::asnumpy::ExecuteBinaryOp(x1, x2, dtype, get_ws, exec, name, aclnn_api, __FILE__, __func__)
+    ::asnumpy::ExecuteBinaryOp(x1, x2, dtype, nullptr, get_ws, exec, name, aclnn_api, __FILE__, __func__)
+
+#define EXECUTE_BINARY_OP_OUT(x1, x2, dtype, out, get_ws, exec, name, aclnn_api)                                       \
+    ::asnumpy::ExecuteBinaryOp(x1, x2, dtype, out, get_ws, exec, name, aclnn_api, __FILE__, __func__)
+
+#define EXECUTE_TENSOR_SCALAR_OP(input, scalar, dtype, get_ws, exec, name, aclnn_api)                                  \
+    ::asnumpy::ExecuteTensorScalarOp(input, scalar, dtype, nullptr, get_ws, exec, name, aclnn_api, __FILE__, __func__)
+
+#define EXECUTE_TENSOR_SCALAR_OP_OUT(input, scalar, dtype, out, get_ws, exec, name, aclnn_api)                         \
+    ::asnumpy::ExecuteTensorScalarOp(input, scalar, dtype, out, get_ws, exec, name, aclnn_api, __FILE__, __func__)
+
+#define EXECUTE_INPLACE_BINARY_OP(self, other, get_ws, exec, name, aclnn_api)                                          \
+    ::asnumpy::ExecuteInplaceBinaryOp(self, other, get_ws, exec, name, aclnn_api, __FILE__, __func__)
+
+#define EXECUTE_INPLACE_SCALAR_OP(self, scalar, get_ws, exec, name, aclnn_api)                                         \
+    ::asnumpy::ExecuteInplaceScalarOp(self, scalar, get_ws, exec, name, aclnn_api, __FILE__, __func__)
@@ -17,35 +17,41 @@
 #pragma once
 
 #include <acl/acl.h>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/cann/workspace.hpp>
 #include <cstdint>
 #include <utility>
 
 namespace asnumpy {
 
 /**
- * @brief RAII wrapper class for managing CANN workspace memory
+ * @brief RAII lease of CANN workspace memory
  *
- * Automatically manages workspace allocation and deallocation to ensure exception safety.
+ * Leases the per-stream cann::WorkspaceArena instead of allocating, so back-to-back operators
+ * reuse one buffer and steady-state workloads make no workspace allocations at all. The lease is
+ * released when the object goes out of scope, which keeps it exception safe.
  * Copy is prohibited, only move semantics are allowed.
  *
  * Example usage:
  * @code
- * AclWorkspace workspace(workspaceSize);  // Allocate workspace
+ * AclWorkspace workspace(workspaceSize);  // Lease workspace
  * // Use workspace.get() to get the pointer
- * // Automatically freed when goes out of scope
+ * // Automatically released when goes out of scope
  * @endcode
  */
 class AclWorkspace {
   public:
     /**
-     * @brief Constructor, allocates workspace of specified size
-     * @param size workspace size in bytes, if 0 no allocation is made
-     * @throws std::runtime_error if memory allocation fails
+     * @brief Constructor, leases workspace of specified size
+     * @param size workspace size in bytes, if 0 nothing is leased
+     * @param stream stream the operator using the workspace is launched on (the calling thread's
+     *        current stream by default)
+     * @throws std::runtime_error if the arena has to grow and the allocation fails
      */
-    explicit AclWorkspace(uint64_t size);
+    explicit AclWorkspace(uint64_t size, aclrtStream stream = cann::CurrentStream());
 
     /**
-     * @brief Destructor, automatically frees workspace
+     * @brief Destructor, automatically ends the lease
      */
     ~AclWorkspace();
 
@@ -76,6 +82,9 @@ class AclWorkspace {
     bool valid() const noexcept { return ptr_ != nullptr; }
 
   private:
+    void Reset() noexcept;
+
+    cann::WorkspaceArena* arena_ = nullptr;
     void* ptr_ = nullptr;
     uint64_t size_ = 0;
 };
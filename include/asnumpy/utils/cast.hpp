@@ -24,8 +24,8 @@ namespace asnumpy {
 /**
  * @brief Cast an array to `targetDtype` on device, via aclnnCast.
  *
- * Returns a deep copy unchanged when the array is already `targetDtype`, so callers can invoke it
- * unconditionally. Takes an aclDataType rather than a py::dtype so no NumPy round trip is involved.
+ * Returns a copy-on-write copy when the array is already `targetDtype`, so callers can invoke it
+ * unconditionally; no device memory is touched unless the copy is later written. Takes an aclDataType rather than a py::dtype so no NumPy round trip is involved.
  *
  * This is the single cast primitive: the promotion layer, `astype`, and the ops that need to widen
  * an operand all route through it.
@@ -0,0 +1,74 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+
+namespace asnumpy {
+namespace dlpack {
+
+/**
+ * DLPack (https://github.com/dmlc/dlpack) structures, in the unversioned layout carried by
+ * `__dlpack__` capsules named "dltensor". Declared here instead of depending on dlpack.h; the
+ * field order and types must stay identical to it.
+ */
+
+enum DLDeviceType : int32_t {
+    kDLCPU = 1,
+    // Devices without a dedicated code. torch_npu exports Ascend tensors with this type.
+    kDLExtDev = 12,
+};
+
+enum DLDataTypeCode : uint8_t {
+    kDLInt = 0,
+    kDLUInt = 1,
+    kDLFloat = 2,
+    kDLOpaqueHandle = 3,
+    kDLBfloat = 4,
+    kDLComplex = 5,
+    kDLBool = 6,
+};
+
+struct DLDevice {
+    DLDeviceType device_type;
+    int32_t device_id;
+};
+
+struct DLDataType {
+    uint8_t code;   // DLDataTypeCode
+    uint8_t bits;   // of one lane; 64 for complex64
+    uint16_t lanes; // 1 for scalar types
+};
+
+struct DLTensor {
+    void* data; // start of the allocation; the first element is at data + byte_offset
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    int64_t* strides; // in elements; NULL means C-contiguous
+    uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(DLManagedTensor* self); // called by the consumer once it is done with the tensor
+};
+
+} // namespace dlpack
+} // namespace asnumpy
@@ -0,0 +1,55 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace asnumpy {
+
+/**
+ * Buffer donation: an operand known to be dead after an operator can hand that operator its buffer
+ * (NPUArray::Donate), and the result is then written over it instead of into a fresh allocation.
+ * detail::OutputTarget takes a donated buffer when the result has the donor's shape and dtype and
+ * the kernel is listed here as computing each output element from the input elements at the same
+ * position only, which makes writing over an input harmless.
+ */
+
+/// True if `aclnn_api` may write its result over an input of the same shape and dtype.
+bool KernelWritesOverInput(std::string_view aclnn_api);
+
+/**
+ * @brief Counters of donated buffers reaching an operator.
+ *
+ * `elided` counts results written into a donated buffer, each an allocation saved; `declined`
+ * counts donations the operator could not use (other shape or dtype, or a kernel not listed).
+ */
+struct DonationStats {
+    uint64_t elided = 0;
+    uint64_t declined = 0;
+};
+
+/// Process-wide DonationStats since start-up.
+DonationStats GetDonationStats();
+
+namespace detail {
+
+void CountDonation(bool elided);
+
+} // namespace detail
+
+} // namespace asnumpy
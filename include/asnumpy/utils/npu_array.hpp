@@ -19,9 +19,15 @@
 #include <acl/acl.h>
 #include <aclnn/aclnn_base.h>
 #include <algorithm>
+#include <asnumpy/cann/pinned.hpp>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/utils/dlpack.hpp>
+#include <atomic>
 #include <cstdint>
 #include <fmt/core.h>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <pybind11/buffer_info.h>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
@@ -31,17 +37,78 @@
 
 namespace py = pybind11;
 
+/**
+ * @brief Device allocation, shared by every array that holds the same contents
+ *
+ * Returned to the caching allocator when the last reference goes away. Stream tracking
+ * (asnumpy::cann::BufferUsage) is per buffer, so a write orders later reads through every array
+ * that refers to it, and a copy inherits the ordering of the array it was copied from.
+ */
+struct NPUBuffer : asnumpy::cann::BufferUsage {
+    NPUBuffer(size_t nbytes, aclrtStream stream);
+    // Memory allocated outside asnumpy (NPUArray::FromDlpack); dropping `owner` releases it.
+    NPUBuffer(void* ptr, size_t nbytes, std::shared_ptr<void> owner);
+    ~NPUBuffer();
+
+    NPUBuffer(const NPUBuffer&) = delete;
+    NPUBuffer& operator=(const NPUBuffer&) = delete;
+
+    size_t nbytes;
+    std::atomic<int> storages{0}; // NPUStorage objects pointing here; > 1 means copy-on-write is pending
+    std::atomic<bool> donated{false}; // contents are dead; see NPUArray::Donate
+    std::shared_ptr<void> owner;
+};
+
+/**
+ * @brief Identity shared by an NPUArray and all views of it
+ *
+ * Copies of an array get their own NPUStorage over the same NPUBuffer. The first write through
+ * any storage whose buffer is shared re-points that storage (and so all of its views) at a private
+ * duplicate; see NPUArray::tensor().
+ */
+struct NPUStorage {
+    explicit NPUStorage(std::shared_ptr<NPUBuffer> buffer);
+    ~NPUStorage();
+
+    NPUStorage(const NPUStorage&) = delete;
+    NPUStorage& operator=(const NPUStorage&) = delete;
+
+    bool IsShared() const { return buffer->storages.load(std::memory_order_acquire) > 1; }
+    void Reset(std::shared_ptr<NPUBuffer> replacement);
+
+    std::shared_ptr<NPUBuffer> buffer;
+};
+
 class NPUArray {
   public:
-    aclTensor* tensorPtr;
+    // Mutable: rebuilt on first use after copy-on-write has re-pointed the storage.
+    mutable aclTensor* tensorPtr;
     std::vector<int64_t> shape;
-    std::vector<int64_t> strides;
+    std::vector<int64_t> strides;  // in elements
+    int64_t storageOffset = 0;     // in elements, from the start of the storage
     py::dtype dtype;
     aclDataType aclDtype;
     size_t tensorSize;
 
   private:
-    void* devicePtr;
+    std::shared_ptr<NPUStorage> storage_;
+    mutable void* tensorData_ = nullptr; // buffer address tensorPtr was created over
+
+    // Uninitialized array for AsStrided to fill in.
+    NPUArray();
+    // (Re)create tensorPtr from shape, strides and storageOffset over the current buffer.
+    void CreateTensor() const;
+    // Rebuild tensorPtr if the storage has been re-pointed since it was created.
+    void RefreshTensor() const {
+        if (storage_ && tensorData_ != storage_->buffer->ptr) {
+            CreateTensor();
+        }
+    }
+    // Give storage_ a private duplicate of a buffer it shares with a copy.
+    void Unshare();
+    // Make this array a copy of `other`: shares its buffer when `other` covers it densely,
+    // otherwise allocates and copies the elements in C order.
+    void CopyFrom(const NPUArray& other);
 
   public:
     /**
@@ -50,7 +117,41 @@ class NPUArray {
      * @param dtype Data type
      */
     NPUArray(const std::vector<int64_t>& shape, py::dtype dtype);
-    void* device_address() const { return devicePtr; }
+
+    /**
+     * @brief Address of the first element of this array (the storage start plus storageOffset)
+     */
+    void* device_address() const;
+
+    /**
+     * @brief Get the tensor handle to pass to an operator that writes this array
+     *
+     * Every operator obtains its tensors through tensor(): the non-const overload declares a
+     * write, the const one a read, of the next operator launched on the current stream. In async
+     * mode this is where the current stream is made to wait for other streams that wrote (or, for
+     * a write, read) the array; see asnumpy::cann::TrackRead.
+     *
+     * A write is also where a copy-on-write copy is finally made, so read-only code must use the
+     * const overload (std::as_const on a local) or it pays for a duplicate it never needed. A
+     * donated buffer is written in place: its other copies belong to the operator taking it.
+     */
+    aclTensor* tensor() {
+        if (storage_ && storage_->IsShared() && !storage_->buffer->donated.load(std::memory_order_acquire)) {
+            Unshare();
+        }
+        RefreshTensor();
+        asnumpy::cann::TrackWrite(storage_ ? storage_->buffer : nullptr);
+        return tensorPtr;
+    }
+
+    /**
+     * @brief Get the tensor handle to pass to an operator that only reads this array
+     */
+    aclTensor* tensor() const {
+        RefreshTensor();
+        asnumpy::cann::TrackRead(storage_ ? storage_->buffer : nullptr);
+        return tensorPtr;
+    }
 
     /**
      * @brief Constructor to create an empty NPUArray from shape and ACL data type
@@ -59,7 +160,7 @@ class NPUArray {
      */
     NPUArray(const std::vector<int64_t>& shape, aclDataType acl_type);
 
-    // Copy constructor - deep copy
+    // Copy constructor - copy-on-write: shares the buffer until either side is written
     NPUArray(const NPUArray& other);
 
     // Move constructor
@@ -85,18 +186,169 @@ class NPUArray {
      */
     static NPUArray FromNumpy(py::array host_data);
 
+    /**
+     * @brief Start a host-to-device copy and return without waiting for it
+     *
+     * The returned array can be passed to operators right away: they are queued behind the copy.
+     * A pinned `host_data` (asnumpy.cann.pinned_empty) is DMA'd directly and must stay alive and
+     * unmodified until `done` completes; pageable memory is first copied into a pinned block.
+     *
+     * @param host_data Input NumPy array.
+     * @param done Set to a marker behind the copy, or nullptr if it has already finished.
+     * @return NPUArray Created NPUArray.
+     */
+    static NPUArray FromNumpyAsync(py::array host_data, std::shared_ptr<asnumpy::cann::StreamMarker>& done);
+
     /**
      * @brief Copy data from NPU to host and return a NumPy array
      * @return py::array Returned NumPy array
      */
     py::array ToNumpy() const;
 
+    /**
+     * @brief Copy data from NPU into an existing host array
+     *
+     * `out` must be writeable, C-contiguous and match this array's shape and dtype. Arrays from
+     * asnumpy.cann.pinned_empty are page-locked and receive the data without staging.
+     *
+     * @param out Destination NumPy array
+     * @return py::array `out`
+     */
+    py::array ToNumpy(py::array out) const;
+
+    /**
+     * @brief Start a device-to-host copy into a new pinned NumPy array and return without waiting
+     *
+     * The returned array must not be read before `done` completes.
+     *
+     * @param done Set to a marker behind the copy, or nullptr if it has already finished.
+     * @return py::array Destination NumPy array.
+     */
+    py::array ToNumpyAsync(std::shared_ptr<asnumpy::cann::StreamMarker>& done) const;
+
+    /**
+     * @brief Start copying this array to the host in chunks of `chunkBytes`
+     *
+     * Waits for the last write to the array, then queues the first chunks. The array must be
+     * contiguous and must outlive the returned reader.
+     *
+     * @param chunkBytes Size of every chunk but the last
+     * @return Reader handing out the chunks in order
+     * @throws std::invalid_argument If the array is not contiguous
+     */
+    std::unique_ptr<asnumpy::cann::ChunkedDeviceToHost> ReadChunks(size_t chunkBytes) const;
+
+    /**
+     * @brief Export this array as a DLPack tensor sharing its device memory
+     *
+     * A buffer shared with copy-on-write copies is duplicated first, and the buffer is marked as
+     * aliased, so writes by the consumer are never seen through other asnumpy arrays. The tensor
+     * keeps the memory alive until the consumer calls its deleter.
+     *
+     * @param consumerStream Stream the consumer will use the tensor on; it is made to wait for the
+     *        last write to the array. Without one the host waits instead.
+     * @return DLManagedTensor owned by the caller
+     * @throws std::invalid_argument If the dtype has no DLPack equivalent
+     */
+    asnumpy::dlpack::DLManagedTensor* ToDlpack(std::optional<aclrtStream> consumerStream);
+
+    /**
+     * @brief Wrap the device memory of a DLPack tensor without copying
+     *
+     * Takes ownership of `managed`, whose deleter is called once no array refers to the memory,
+     * also if this throws.
+     *
+     * @param managed Tensor on the current NPU (kDLExtDev)
+     * @return NPUArray View of the tensor's memory
+     * @throws std::invalid_argument If the tensor is on another device, has negative strides or an
+     *         unsupported dtype
+     */
+    static NPUArray FromDlpack(asnumpy::dlpack::DLManagedTensor* managed);
+
     /**
      * @brief Create a view
+     *
+     * The view shares this array's storage: no device memory is allocated or copied.
+     *
      * @return std::unique_ptr<NPUArray> Returned view object
      */
     std::unique_ptr<NPUArray> View() const;
 
+    /**
+     * @brief Create a view with the given shape, element strides and element offset into the storage
+     *
+     * Building block for reshape, transpose, slicing and friends; O(1) in the array size.
+     *
+     * @throws std::invalid_argument If a stride is negative or the view reaches past the storage.
+     */
+    NPUArray AsStrided(const std::vector<int64_t>& shape, const std::vector<int64_t>& strides,
+                       int64_t storageOffset) const;
+
+    /**
+     * @brief Whether the elements are laid out densely in C order (dimensions of size 1 ignored)
+     */
+    bool IsContiguous() const;
+
+    /**
+     * @brief Storage dims of this array's aclTensor descriptor (its shape, or the flat element count of a view)
+     */
+    std::vector<int64_t> StorageDims() const;
+
+    /**
+     * @brief This array if already C-contiguous (as a view), otherwise a C-contiguous copy
+     *
+     * Operators whose kernel, or whose raw memcpy, cannot take a strided tensor call this on
+     * their input; everything else passes views straight to aclnn.
+     */
+    NPUArray Contiguous() const;
+
+    /**
+     * @brief Whether this array and `other` are views of the same storage
+     *
+     * Copy-on-write copies are not views: they may share a buffer now, but never observe each
+     * other's writes.
+     */
+    bool SharesStorage(const NPUArray& other) const;
+
+    /**
+     * @brief Copy the elements of `other` into this array's storage, in place
+     *
+     * Every view of this array's storage sees the new values. The copy is stream-ordered like an
+     * operator that reads `other` and writes this array.
+     *
+     * @throws std::invalid_argument If the shapes or dtypes differ
+     */
+    void Assign(const NPUArray& other);
+
+    /**
+     * @brief Give this array a buffer no copy shares, and stop later copies from sharing it
+     *
+     * For buffers that are written without tensor(), such as the inputs a captured graph reads.
+     */
+    void MakeExclusive();
+
+    /**
+     * @brief Let the next operator overwrite this array's buffer with its result
+     *
+     * For a caller that knows this array is dead once that operator has read it. Refused, with no
+     * effect, unless this array covers its buffer densely and no view, copy-on-write copy or
+     * DLPack consumer refers to it. The operator that takes the buffer (detail::OutputTarget)
+     * ends the donation; Reclaim() ends one nobody took.
+     *
+     * @return Whether the buffer was donated
+     */
+    bool Donate();
+
+    /**
+     * @brief End a donation of this array's buffer
+     */
+    void Reclaim() const;
+
+    /**
+     * @brief Whether this array's buffer is donated to the next operator
+     */
+    bool IsDonated() const;
+
     /**
      * @brief Calculate the total size of the array.
      * @param shape Vector containing the dimensions of the array, defining its shape.
@@ -161,3 +413,13 @@ class NPUArray {
 };
 
 std::vector<int64_t> GetBroadcastShape(const NPUArray& a, const NPUArray& b);
+
+/**
+ * @brief 0-d view of a one-element array
+ *
+ * Whole-array kernels such as aclnnProd write a {1}-shaped array; returning this view of it keeps
+ * the value on the device while giving the result NumPy's scalar shape ().
+ *
+ * @throws std::invalid_argument If `a` does not hold exactly one element.
+ */
+NPUArray ScalarView(const NPUArray& a);
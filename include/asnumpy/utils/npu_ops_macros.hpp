@@ -16,16 +16,18 @@
 
 #pragma once
 
+#include <asnumpy/cann/execution.hpp>
+#include <asnumpy/cann/stream.hpp>
+#include <asnumpy/utils/acl_executor.hpp>
 #include <asnumpy/utils/acl_resource.hpp>
 #include <asnumpy/utils/status_handler.hpp>
 
 #define EXECUTE_OP_WORKSPACE(OpName, workspaceSize, executor, AclnnFunc, AclnnApiName)                                 \
     do {                                                                                                               \
         asnumpy::AclWorkspace workspace(workspaceSize);                                                                \
-        auto error_func = AclnnFunc(workspace.get(), workspace.size(), executor, nullptr);                             \
+        auto error_func = AclnnFunc(workspace.get(), workspace.size(), executor, asnumpy::cann::CurrentStream());      \
         ACLNN_CHECK(error_func, AclnnApiName);                                                                         \
-        auto error_sync = aclrtSynchronizeDevice();                                                                    \
-        ACL_RT_CHECK(error_sync, AclnnApiName ": aclrtSynchronizeDevice");                                             \
+        ACL_OP_LAUNCHED(AclnnApiName);                                                                                 \
     } while (0)
 
 #define DEFINE_UNARY_OP(OpName, AclnnGetWorkspaceSizeFunc, AclnnFunc)                                                  \
@@ -35,11 +37,12 @@
         auto shape = x.shape;                                                                                          \
         auto dtype = x.dtype;                                                                                          \
         auto result = NPUArray(shape, dtype);                                                                          \
-        uint64_t workspaceSize = 0;                                                                                    \
-        aclOpExecutor* executor;                                                                                       \
-        auto error = AclnnGetWorkspaceSizeFunc(x.tensorPtr, result.tensorPtr, &workspaceSize, &executor);              \
-        ACLNN_CHECK(error, #AclnnFunc "GetWorkspaceSize");                                                             \
-        EXECUTE_OP_WORKSPACE(OpName, workspaceSize, executor, AclnnFunc, #AclnnFunc);                                  \
+        auto build = [](const std::vector<aclTensor*>& tensors, uint64_t* workspaceSize, aclOpExecutor** executor) {   \
+            return AclnnGetWorkspaceSizeFunc(tensors[0], tensors[1], workspaceSize, executor);                         \
+        };                                                                                                             \
+        detail::LaunchOp(detail::ExecutorCacheOp(#AclnnFunc, AclnnGetWorkspaceSizeFunc), true, {&x, &result},         \
+                         {x.tensor(), result.tensor()}, 1, build, AclnnFunc, #AclnnFunc, __FILE__, __func__);          \
+        ACL_OP_LAUNCHED(#AclnnFunc);                                                                                   \
         LOG_INFO("{} completed", #AclnnFunc);                                                                          \
         return result;                                                                                                 \
     }
@@ -51,12 +54,13 @@
         auto shape = GetBroadcastShape(x1, x2);                                                                        \
         auto dtype = x1.dtype;                                                                                         \
         auto result = NPUArray(shape, dtype);                                                                          \
-        uint64_t workspaceSize = 0;                                                                                    \
-        aclOpExecutor* executor;                                                                                       \
-        auto error =                                                                                                   \
-            AclnnGetWorkspaceSizeFunc(x1.tensorPtr, x2.tensorPtr, result.tensorPtr, &workspaceSize, &executor);        \
-        ACLNN_CHECK(error, #AclnnFunc "GetWorkspaceSize");                                                             \
-        EXECUTE_OP_WORKSPACE(OpName, workspaceSize, executor, AclnnFunc, #AclnnFunc);                                  \
+        auto build = [](const std::vector<aclTensor*>& tensors, uint64_t* workspaceSize, aclOpExecutor** executor) {   \
+            return AclnnGetWorkspaceSizeFunc(tensors[0], tensors[1], tensors[2], workspaceSize, executor);             \
+        };                                                                                                             \
+        detail::LaunchOp(detail::ExecutorCacheOp(#AclnnFunc, AclnnGetWorkspaceSizeFunc), true, {&x1, &x2, &result},   \
+                         {x1.tensor(), x2.tensor(), result.tensor()}, 2, build, AclnnFunc, #AclnnFunc, __FILE__,       \
+                         __func__);                                                                                    \
+        ACL_OP_LAUNCHED(#AclnnFunc);                                                                                   \
         LOG_INFO("{} completed", #AclnnFunc);                                                                          \
         return result;                                                                                                 \
     }
@@ -107,3 +107,18 @@ template <typename ValueType> aclScalar* CreateScalar(ValueType value, aclDataTy
  * @throws std::runtime_error If the specified data type is unsupported or conversion fails
  */
 aclScalar* CreateScalar(const py::object& scalar, aclDataType dtype);
+
+/**
+ * @brief Creates the scalar operand of a tensor-scalar operator that computes in `dtype`
+ *
+ * aclnn treats a scalar operand as weakly typed, so it need not match the tensor exactly. Floating
+ * and complex values are therefore carried at double precision rather than narrowed on the host.
+ * Bool and integer values are converted to `dtype` itself, so a Python int out of its range is
+ * rejected rather than wrapped, as NumPy does.
+ *
+ * @param scalar Python or NumPy scalar
+ * @param dtype ACL data type the operator computes in
+ * @return aclScalar* Pointer to the created scalar object
+ * @throws std::runtime_error If the value does not fit `dtype` or conversion fails
+ */
+aclScalar* CreateOperandScalar(const py::handle& scalar, aclDataType dtype);
@@ -0,0 +1,65 @@
+/******************************************************************************
+ * Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *****************************************************************************/
+
+
+#pragma once
+
+#include <asnumpy/utils/npu_array.hpp>
+#include <acl/acl.h>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace asnumpy {
+
+/**
+ * @brief Axes of a reduction, normalised for the aclnn reduce kernels.
+ *
+ * Negative axes are wrapped and the result is sorted. std::nullopt (NumPy's axis=None) selects
+ * every dimension, so a whole-array reduction is a single kernel call over the array as it is
+ * rather than over a flattened copy.
+ *
+ * @throws std::out_of_range If an axis is out of bounds for `ndim` dimensions.
+ * @throws std::invalid_argument If an axis is repeated.
+ */
+std::vector<int64_t> ReductionAxes(const std::optional<std::vector<int64_t>>& axis, size_t ndim, const char* func);
+
+/**
+ * @brief Shape left after reducing `shape` over `axes` (as returned by ReductionAxes).
+ */
+std::vector<int64_t> ReducedShape(const std::vector<int64_t>& shape, const std::vector<int64_t>& axes, bool keepdims);
+
+using AclIntArrayPtr = std::unique_ptr<aclIntArray, decltype(&aclDestroyIntArray)>;
+
+/**
+ * @brief Owning aclIntArray for the `dim` argument of the aclnn reduce kernels.
+ */
+AclIntArrayPtr MakeAxisArray(const std::vector<int64_t>& axes);
+
+/**
+ * @brief Apply a reduction's where= mask.
+ *
+ * Returns `a` broadcast to `shape`, with every element whose `where` entry is false replaced by
+ * `identity` (the reduction's neutral element: 0 for sums, 1 for products). One aclnnSWhere pass.
+ *
+ * @throws std::invalid_argument If `where` is not boolean or does not broadcast to `shape`.
+ */
+NPUArray MaskReductionInput(const NPUArray& a, const NPUArray& where, double identity,
+                            const std::vector<int64_t>& shape);
+
+} // namespace asnumpy
@@ -27,7 +27,7 @@ from ._version import __version__
 from .cann import finalize, init, reset_device, reset_device_force, set_device
 
 if TYPE_CHECKING:
-    from . import linalg, random
+    from . import foreach, linalg, random
     from ._dtype import (
         can_cast,
         dtype,
@@ -38,6 +38,8 @@ if TYPE_CHECKING:
         promote_types,
         result_type,
     )
+    from ._fusion import fuse
+    from ._lazy import LazyArray, compute, is_lazy, lazy
     from ._types import (
         ArrayLike,
         AxisLike,
@@ -47,15 +49,23 @@ if TYPE_CHECKING:
         ShapeLike,
     )
     from .array import (
+        ascontiguousarray,
         empty,
         empty_like,
+        expand_dims,
         eye,
+        from_dlpack,
         full,
         full_like,
         identity,
         linspace,
+        may_share_memory,
         ones,
         ones_like,
+        ravel,
+        reshape,
+        squeeze,
+        transpose,
         zeros,
         zeros_like,
     )
@@ -169,7 +179,7 @@ if TYPE_CHECKING:
     from .nn import softmax
     from .sorting import sort
     from .statistics import mean
-    from .utils import broadcast_shape, ndarray
+    from .utils import DeviceScalar, Transfer, broadcast_shape, ndarray
 
 
 # NumPy dtype aliases accessible as ap.float32, ap.int32, etc. These resolve to NumPy's own
@@ -216,17 +226,27 @@ _NUMPY_DTYPE_NAMES = {
 
 _LAZY_MAPPING = {
     # .array
+    "ascontiguousarray": ".array",
     "empty": ".array",
     "empty_like": ".array",
+    "expand_dims": ".array",
     "eye": ".array",
+    "from_dlpack": ".array",
     "full": ".array",
     "full_like": ".array",
     "identity": ".array",
     "linspace": ".array",
+    "may_share_memory": ".array",
     "ones": ".array",
     "ones_like": ".array",
+    "ravel": ".array",
+    "reshape": ".array",
+    "squeeze": ".array",
+    "transpose": ".array",
     "zeros": ".array",
     "zeros_like": ".array",
+    # .foreach
+    "foreach": ".foreach",
     # .linalg
     "linalg": ".linalg",
     # .linalg.direct
@@ -360,6 +380,8 @@ _LAZY_MAPPING = {
     "AxisOptional": "._types",
     "ScalarLike": "._types",
     # .utils
+    "DeviceScalar": ".utils",
+    "Transfer": ".utils",
     "broadcast_shape": ".utils",
     "ndarray": ".utils",
     # ._dtype
@@ -371,6 +393,13 @@ _LAZY_MAPPING = {
     "issubdtype": "._dtype",
     "promote_types": "._dtype",
     "result_type": "._dtype",
+    # ._fusion
+    "fuse": "._fusion",
+    # ._lazy
+    "LazyArray": "._lazy",
+    "compute": "._lazy",
+    "is_lazy": "._lazy",
+    "lazy": "._lazy",
 }
 
 
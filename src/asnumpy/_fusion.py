@@ -0,0 +1,374 @@
+# *****************************************************************************
+# Copyright (c) 2025 ISE Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Fused-kernel rewrites for lazy plans.
+
+Common element-wise chains have a single CANN kernel. Before a lazy plan runs, :func:`rewrite`
+replaces them (largest pattern first):
+
+- ``sqrt(a*a + b*b)``      -> ``hypot``   (aclnnMul + aclnnAddcmul + in-place aclnnSqrt)
+- ``a + t*(b - a)``        -> ``lerp``    (aclnnLerp)
+- ``x*s + y``, ``y - x*s`` -> ``axpy``    (aclnnAdd with alpha = s, -s; s a real scalar)
+- ``a + b*c``, ``a - b*c`` -> ``addcmul`` (aclnnAddcmul with value = 1, -1)
+
+A chain is only absorbed when its inner results are used nowhere else. ``explain()`` on a lazy
+array (or on a function wrapped by :func:`fuse`) lists the fused steps and what they replaced.
+"""
+
+from __future__ import annotations
+
+import functools
+
+import numpy as np
+from loguru import logger
+
+from ._core import ndarray as _core_ndarray
+from ._core.math import addcmul as _addcmul
+from ._core.math import axpy as _axpy
+from ._core.math import hypot as _hypot
+from ._core.math import lerp as _lerp
+from ._dtype import result_type
+from ._lazy import LazyArray, Ref, Step, _Plan, lazy, materialize
+from .utils import ndarray
+
+# ========== Fused kernels ==========
+# Each keeps the dtype the unfused chain would produce and runs that chain where the kernel
+# cannot (mixed operand dtypes, or precision the kernel lacks).
+
+
+def _common_dtype(*arrays) -> np.dtype | None:
+    dtypes = {np.dtype(array.dtype) for array in arrays}
+    return dtypes.pop() if len(dtypes) == 1 else None
+
+
+def _fused_hypot(a, b):
+    dtype = _common_dtype(a, b)
+    if dtype is None or dtype.kind != "f":
+        from .math import add, multiply, sqrt
+
+        return sqrt(add(multiply(a, a), multiply(b, b)))
+    return ndarray(_hypot(a, b))
+
+
+def _fused_lerp(start, end, weight):
+    # aclnnLerp has no float64 variant; computing in float32 would lose precision.
+    if _common_dtype(start, end, weight) not in (np.dtype(np.float16), np.dtype(np.float32)):
+        from .math import add, multiply, subtract
+
+        return add(start, multiply(weight, subtract(end, start)))
+    return ndarray(_lerp(start, end, weight))
+
+
+def _fused_axpy(x, y, alpha, subtract=False):
+    # The chain rounds alpha * x to its own dtype before meeting y; the kernel does not.
+    product = result_type(np.dtype(x.dtype), alpha)
+    if product != result_type(product, np.dtype(y.dtype)):
+        from .math import add, multiply
+        from .math import subtract as _subtract
+
+        scaled = multiply(x, alpha)
+        return _subtract(y, scaled) if subtract else add(scaled, y)
+    return ndarray(_axpy(x, y, alpha, subtract))
+
+
+def _fused_addcmul(a, b, c, value=1.0):
+    if _common_dtype(a, b, c) is None:
+        from .math import add, multiply, subtract
+
+        product = multiply(b, c)
+        return add(a, product) if value > 0 else subtract(a, product)
+    return ndarray(_addcmul(a, b, c, value))
+
+
+# ========== Pattern matching ==========
+
+
+def _is_array(operand) -> bool:
+    return isinstance(operand, (Ref, _core_ndarray))
+
+
+def _is_real_scalar(operand) -> bool:
+    if isinstance(operand, (bool, np.bool_)):
+        return False
+    return isinstance(operand, (int, float, np.integer, np.floating))
+
+
+def _same(a, b) -> bool:
+    if isinstance(a, Ref) and isinstance(b, Ref):
+        return a.index == b.index
+    return a is b
+
+
+class _Matcher:
+    """Consumer bookkeeping for the plan being rewritten."""
+
+    def __init__(self, plan) -> None:
+        self.plan = plan
+        self.consumers = plan.consumers()
+        self.live = set(plan.outputs)
+
+    def dead(self, index: int) -> bool:
+        return self.consumers[index] == 0 and index not in self.live
+
+    def producer(self, operand, name: str) -> Step | None:
+        """The binary/unary *name* step behind *operand*, if nothing else reads its value."""
+        if not isinstance(operand, Ref):
+            return None
+        index = operand.index
+        if self.consumers[index] != 1 or index in self.live:
+            return None
+        step = self.plan.steps[index]
+        if step.name != name or step.fused is not None:
+            return None
+        if any(value is not None for value in step.kwargs.values()):
+            return None
+        return step
+
+    def replace(self, index: int, step: Step) -> None:
+        old = self.plan.steps[index]
+        self.plan.steps[index] = step
+        for producer in step.refs():
+            self.consumers[producer] += 1
+        pending = list(old.refs())
+        while pending:
+            producer = pending.pop()
+            self.consumers[producer] -= 1
+            if self.dead(producer):
+                pending.extend(self.plan.steps[producer].refs())
+
+
+def _binary(step: Step, name: str) -> bool:
+    return (
+        step.name == name
+        and len(step.args) == 2
+        and all(value is None for value in step.kwargs.values())
+    )
+
+
+def _match_hypot(step: Step, m: _Matcher) -> Step | None:
+    if step.name != "sqrt" or len(step.args) != 1 or step.kwargs:
+        return None
+    total = m.producer(step.args[0], "add")
+    if total is None or not _binary(total, "add"):
+        return None
+    squares = [m.producer(arg, "multiply") for arg in total.args]
+    if any(square is None or len(square.args) != 2 for square in squares):
+        return None
+    (a, a2), (b, b2) = squares[0].args, squares[1].args
+    if not (_same(a, a2) and _same(b, b2) and _is_array(a) and _is_array(b)):
+        return None
+    return Step(
+        "hypot", _fused_hypot, (a, b), {}, fused="sqrt(add(multiply(a, a), multiply(b, b)))"
+    )
+
+
+def _match_add(step: Step, m: _Matcher) -> Step | None:
+    if not _binary(step, "add"):
+        return None
+    for base, other in (step.args, step.args[::-1]):
+        product = m.producer(other, "multiply")
+        if product is None or len(product.args) != 2 or not _is_array(base):
+            continue
+        p, q = product.args
+        for weight, diff in ((p, q), (q, p)):
+            span = m.producer(diff, "subtract")
+            if span is None or not _binary(span, "subtract"):
+                continue
+            end, start = span.args
+            if _same(start, base) and _is_array(end) and _is_array(weight):
+                return Step(
+                    "lerp", _fused_lerp, (base, end, weight), {},
+                    fused="add(a, multiply(t, subtract(b, a)))",
+                )
+        for x, alpha in ((p, q), (q, p)):
+            if _is_array(x) and _is_real_scalar(alpha):
+                return Step(
+                    "axpy", _fused_axpy, (x, base, alpha), {}, fused="add(multiply(x, s), y)"
+                )
+        if _is_array(p) and _is_array(q):
+            return Step("addcmul", _fused_addcmul, (base, p, q), {}, fused="add(a, multiply(b, c))")
+    return None
+
+
+def _match_subtract(step: Step, m: _Matcher) -> Step | None:
+    if not _binary(step, "subtract"):
+        return None
+    base, other = step.args
+    product = m.producer(other, "multiply")
+    if product is None or len(product.args) != 2 or not _is_array(base):
+        return None
+    p, q = product.args
+    for x, alpha in ((p, q), (q, p)):
+        if _is_array(x) and _is_real_scalar(alpha):
+            return Step(
+                "axpy",
+                _fused_axpy,
+                (x, base, alpha),
+                {"subtract": True},
+                fused="subtract(y, multiply(x, s))",
+            )
+    if _is_array(p) and _is_array(q):
+        return Step(
+            "addcmul", _fused_addcmul, (base, p, q, -1.0), {}, fused="subtract(a, multiply(b, c))"
+        )
+    return None
+
+
+_RULES = (_match_hypot, _match_add, _match_subtract)
+
+
+def rewrite(plan) -> int:
+    """Replace fusable chains in *plan* in place; returns the number of rewrites."""
+    m = _Matcher(plan)
+    fired = 0
+    # Consumers first, so the outermost (largest) pattern claims a chain before its parts do.
+    for index in range(len(plan.steps) - 1, -1, -1):
+        if m.dead(index):
+            continue
+        for rule in _RULES:
+            fused = rule(plan.steps[index], m)
+            if fused is not None:
+                m.replace(index, fused)
+                fired += 1
+                break
+    return fired
+
+
+# ========== Explicit API ==========
+
+_UNTRACED = object()
+
+
+def _operands(args, kwargs) -> list:
+    return [*args, *(kwargs[name] for name in sorted(kwargs))]
+
+
+def _signature(args, kwargs) -> tuple | None:
+    """Cache key: shape and dtype of every array, value of everything else (None if unhashable).
+
+    Each array also records the first position it was passed at: a program traced with ``f(x, x)``
+    shares one placeholder between both arguments and must not be replayed for ``f(a, b)``.
+    """
+    key = [tuple(sorted(kwargs))]
+    first_seen: dict = {}
+    for position, value in enumerate(_operands(args, kwargs)):
+        if isinstance(value, _core_ndarray):
+            alias = first_seen.setdefault(id(value), position)
+            key.append(("array", tuple(value.shape), np.dtype(value.dtype), alias))
+            continue
+        try:
+            hash(value)
+        except TypeError:
+            return None
+        key.append(("const", type(value), value))
+    return tuple(key)
+
+
+def _arrays(args, kwargs) -> list:
+    return [value for value in _operands(args, kwargs) if isinstance(value, _core_ndarray)]
+
+
+class _FusedFunction:
+    """Callable returned by :func:`fuse`; holds one captured program per input signature."""
+
+    def __init__(self, func) -> None:
+        functools.update_wrapper(self, func)
+        self._func = func
+        # signature -> (Graph, returns_tuple), or None where the function cannot be captured
+        self._programs: dict = {}
+
+    def __call__(self, *args, **kwargs):
+        key = _signature(args, kwargs)
+        if key is None:
+            return self._evaluate(args, kwargs)
+        program = self._programs.get(key, _UNTRACED)
+        if program is _UNTRACED:
+            return self._trace(key, args, kwargs)
+        if program is None:
+            return self._evaluate(args, kwargs)
+        graph, returns_tuple = program
+        results = graph.run(*_arrays(args, kwargs))
+        return results if returns_tuple else results[0]
+
+    def _evaluate(self, args, kwargs):
+        """Run the function lazily and evaluate its results as one fused plan."""
+        with lazy():
+            result = self._func(*args, **kwargs)
+        values, _ = materialize(result if isinstance(result, tuple) else (result,))
+        return tuple(values) if isinstance(result, tuple) else values[0]
+
+    def _trace(self, key, args, kwargs):
+        from .array import ascontiguousarray
+        from .cann import graph
+        from .utils import ndarray
+
+        # Placeholders the program owns (the capture makes them exclusive); each call copies its
+        # arrays into them before replaying.
+        swap = {id(value): ndarray(ascontiguousarray(value)) for value in _arrays(args, kwargs)}
+        traced_args = tuple(swap.get(id(value), value) for value in args)
+        traced_kwargs = {name: swap.get(id(value), value) for name, value in kwargs.items()}
+
+        program = graph(*_arrays(traced_args, traced_kwargs))
+        try:
+            with program:
+                result = self._evaluate(traced_args, traced_kwargs)
+            outputs = result if isinstance(result, tuple) else (result,)
+            if not all(isinstance(output, _core_ndarray) for output in outputs):
+                raise TypeError("fused function returned a value that is not an array")
+        except Exception as exc:
+            # Not capturable (host round trips, scalar results, no graph support): run it as a
+            # fused plan on every call. Errors in the function itself surface from this run.
+            result = self._evaluate(args, kwargs)
+            logger.debug(f"fuse: {self.__name__} runs without a captured program: {exc}")
+            self._programs[key] = None
+            return result
+
+        program.set_outputs(*outputs)
+        self._programs[key] = (program, isinstance(result, tuple))
+        results = program.run()
+        return results if isinstance(result, tuple) else results[0]
+
+    def explain(self, *args, **kwargs) -> str:
+        """Return the fused plan a call with these arguments traces, without launching it."""
+        with lazy():
+            result = self._func(*args, **kwargs)
+        values = result if isinstance(result, tuple) else (result,)
+        return _Plan([value for value in values if isinstance(value, LazyArray)]).describe()
+
+    @property
+    def program_count(self) -> int:
+        """Number of input signatures with a captured program."""
+        return sum(program is not None for program in self._programs.values())
+
+    def clear_cache(self) -> None:
+        """Drop every captured program, releasing the buffers they hold."""
+        self._programs.clear()
+
+
+def fuse(func):
+    """Compile *func* into one cached op program per input signature.
+
+    Modeled on ``cupy.fuse``. The first call with a given set of shapes, dtypes and non-array
+    arguments traces *func* lazily, applies the fused-kernel rewrites and captures the launches
+    into an :class:`asnumpy.cann.Graph` over placeholder inputs. Later calls with the same
+    signature copy their arrays into the placeholders and replay the graph in a single call,
+    with no per-operator Python dispatch; results are fresh arrays.
+
+    Functions that cannot be captured (they read results back to the host, return scalars, or
+    the runtime lacks graph capture) are evaluated as a fused lazy plan instead.
+    ``fn.explain(*args)`` shows the traced plan.
+    """
+    return _FusedFunction(func)
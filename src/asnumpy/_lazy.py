@@ -0,0 +1,486 @@
+# *****************************************************************************
+# Copyright (c) 2025 ISE Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Deferred evaluation of element-wise expressions.
+
+Inside ``with asnumpy.lazy():`` the element-wise functions of :mod:`asnumpy.math` and the
+registered ufuncs return :class:`LazyArray` nodes instead of launching kernels. Nothing runs
+until a value is observed (``to_numpy()``, a scalar reduction, ``compute()``); the DAG
+reachable from the observed nodes is then planned once:
+
+- nodes nobody observes are never launched;
+- identical sub-expressions (same function, same operands, same arguments) run once;
+- each intermediate is released right after its last consumer, so the caching allocator
+  hands its block to the next kernel of the same size;
+- an element-wise step that is an intermediate's last consumer writes its result over that
+  intermediate when shape and dtype allow, so ``exp(a * b + c)`` allocates one result buffer.
+
+Operands are read when the plan runs, not when the node is built.
+"""
+
+from __future__ import annotations
+
+import contextlib
+import contextvars
+import functools
+
+import numpy as np
+
+_ENABLED: contextvars.ContextVar[bool] = contextvars.ContextVar("asnumpy_lazy", default=False)
+
+# Keyword arguments NumPy may forward through __array_ufunc__ that deferred nodes cannot honour.
+_UNSUPPORTED_UFUNC_KWARGS = frozenset(("where", "casting", "subok", "order", "signature", "extobj"))
+
+# Functions that run one element-wise kernel on their operands (after casts, if any). Only they
+# may be handed a dead operand's buffer: a function launching several kernels could read the
+# operand again after the first one wrote over it.
+_OVERWRITING_STEPS = frozenset((
+    "add", "subtract", "multiply", "divide", "true_divide", "negative", "reciprocal",
+    "exp", "exp2", "expm1", "log", "log2", "log10", "log1p", "sqrt",
+    "sin", "cos", "tan", "arcsin", "arccos", "arctan", "sinh", "cosh", "tanh",
+))
+
+
+@contextlib.contextmanager
+def lazy(enabled: bool = True):
+    """Defer element-wise operations issued inside the block (``enabled=False`` suspends it)."""
+    token = _ENABLED.set(enabled)
+    try:
+        yield
+    finally:
+        _ENABLED.reset(token)
+
+
+def is_lazy() -> bool:
+    """Return True when element-wise operations are currently deferred."""
+    return _ENABLED.get()
+
+
+def should_defer(args, kwargs) -> bool:
+    """Return True when a call with *args*/*kwargs* should build a node instead of running.
+
+    A call defers in lazy mode, or when any operand is already lazy so that expressions stay
+    deferred until observed. ``out=`` always runs eagerly.
+    """
+    if kwargs.get("out") is not None:
+        return False
+    if _ENABLED.get():
+        return True
+    return any(isinstance(arg, LazyArray) for arg in args) or any(
+        isinstance(value, LazyArray) for value in kwargs.values()
+    )
+
+
+def deferrable(func):
+    """Make an element-wise wrapper return a :class:`LazyArray` when :func:`should_defer`."""
+
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        if should_defer(args, kwargs):
+            return LazyArray(func, args, kwargs)
+        # Only an out= call gets here with lazy operands; it runs eagerly on their values.
+        args, kwargs = materialize(args, kwargs)
+        return func(*args, **kwargs)
+
+    return wrapper
+
+
+def materializes(func):
+    """Evaluate lazy operands before calling *func* (reductions and other non-element-wise ops)."""
+
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        args, kwargs = materialize(args, kwargs)
+        return func(*args, **kwargs)
+
+    return wrapper
+
+
+def materialize(args, kwargs=None, fuse: bool = True):
+    """Return *args* (and *kwargs*) with every :class:`LazyArray` replaced by its value.
+
+    All lazy operands are planned together so sub-expressions they share run once.
+    """
+    kwargs = {} if kwargs is None else kwargs
+    pending = [value for value in (*args, *kwargs.values()) if isinstance(value, LazyArray)]
+    if not pending:
+        return args, kwargs
+    _Plan(pending, fuse).run()
+    args = tuple(arg._value if isinstance(arg, LazyArray) else arg for arg in args)
+    kwargs = {k: v._value if isinstance(v, LazyArray) else v for k, v in kwargs.items()}
+    return args, kwargs
+
+
+def compute(*arrays, fuse: bool = True):
+    """Evaluate one or more lazy arrays in a single plan; other values pass through.
+
+    ``fuse=False`` skips the fused-kernel rewrites. Returns a single array for one argument
+    and a tuple otherwise.
+    """
+    values, _ = materialize(arrays, fuse=fuse)
+    return values[0] if len(values) == 1 else values
+
+
+def _dispatch(name: str, *args, **kwargs):
+    import asnumpy as anp
+
+    return getattr(anp, name)(*args, **kwargs)
+
+
+class LazyArray:
+    """A deferred call of an asnumpy function on (possibly lazy) operands.
+
+    Arithmetic operators and NumPy ufuncs build further nodes; :meth:`compute` evaluates the
+    expression and caches the result, after which the node behaves as a leaf.
+    """
+
+    __slots__ = ("_func", "_args", "_kwargs", "_value")
+
+    __array_priority__ = 200.0
+
+    def __init__(self, func, args, kwargs) -> None:
+        self._func = func
+        self._args = tuple(args)
+        self._kwargs = dict(kwargs)
+        self._value = None
+
+    @property
+    def name(self) -> str:
+        return getattr(self._func, "__name__", repr(self._func))
+
+    @property
+    def computed(self) -> bool:
+        return self._value is not None
+
+    def compute(self, fuse: bool = True):
+        """Evaluate the expression (once) and return the resulting ndarray."""
+        if self._value is None:
+            _Plan([self], fuse).run()
+        return self._value
+
+    def explain(self, fuse: bool = True) -> str:
+        """Return the launch plan evaluating this node would execute, one kernel per line."""
+        return _Plan([self], fuse).describe()
+
+    def to_numpy(self, out=None) -> np.ndarray:
+        return self.compute().to_numpy(out)
+
+    def __array__(self, dtype=None, copy=None) -> np.ndarray:
+        host = self.to_numpy()
+        return host if dtype is None else host.astype(dtype, copy=False)
+
+    @property
+    def shape(self) -> tuple:
+        return self.compute().shape
+
+    @property
+    def dtype(self) -> np.dtype:
+        return self.compute().dtype
+
+    @property
+    def ndim(self) -> int:
+        return self.compute().ndim
+
+    def __repr__(self) -> str:
+        state = "computed" if self._value is not None else "pending"
+        return f"LazyArray({_describe(self, depth=3)}, {state})"
+
+    def __add__(self, other):
+        return _dispatch("add", self, other)
+
+    def __radd__(self, other):
+        return _dispatch("add", other, self)
+
+    def __sub__(self, other):
+        return _dispatch("subtract", self, other)
+
+    def __rsub__(self, other):
+        return _dispatch("subtract", other, self)
+
+    def __mul__(self, other):
+        return _dispatch("multiply", self, other)
+
+    def __rmul__(self, other):
+        return _dispatch("multiply", other, self)
+
+    def __truediv__(self, other):
+        return _dispatch("true_divide", self, other)
+
+    def __rtruediv__(self, other):
+        return _dispatch("true_divide", other, self)
+
+    def __pow__(self, other):
+        return _dispatch("power", self, other)
+
+    def __rpow__(self, other):
+        return _dispatch("power", other, self)
+
+    def __neg__(self):
+        return _dispatch("negative", self)
+
+    def __array_ufunc__(self, ufunc_obj, method, *inputs, **kwargs):
+        """Route NumPy ufuncs (``np.sqrt(lazy)``) to the asnumpy function of the same name."""
+        import asnumpy as anp
+
+        if method != "__call__" or _UNSUPPORTED_UFUNC_KWARGS & kwargs.keys():
+            return NotImplemented
+        func = getattr(anp, getattr(ufunc_obj, "__name__", ""), None)
+        if func is None:
+            return NotImplemented
+        return func(*inputs, **{k: v for k, v in kwargs.items() if v is not None})
+
+
+def _describe(value, depth: int) -> str:
+    if isinstance(value, LazyArray):
+        if value._value is not None:
+            return _describe(value._value, depth)
+        if depth == 0:
+            return f"{value.name}(...)"
+        parts = [_describe(arg, depth - 1) for arg in value._args]
+        parts += [f"{k}={_describe(v, depth - 1)}" for k, v in value._kwargs.items()]
+        return f"{value.name}({', '.join(parts)})"
+    if hasattr(value, "shape") and hasattr(value, "dtype"):
+        return f"array{tuple(value.shape)}:{value.dtype}"
+    return repr(value)
+
+
+def _operands(node: LazyArray):
+    yield from node._args
+    yield from node._kwargs.values()
+
+
+def _is_pending(value) -> bool:
+    return isinstance(value, LazyArray) and value._value is None
+
+
+class Ref:
+    """Operand produced by step *index* of a plan."""
+
+    __slots__ = ("index",)
+
+    def __init__(self, index: int) -> None:
+        self.index = index
+
+
+class Step:
+    """One kernel call of a plan; operands produced by earlier steps are :class:`Ref`."""
+
+    __slots__ = ("name", "func", "args", "kwargs", "fused")
+
+    def __init__(
+        self, name: str, func, args: tuple, kwargs: dict, fused: str | None = None
+    ) -> None:
+        self.name = name
+        self.func = func
+        self.args = args
+        self.kwargs = kwargs
+        # The expression this step replaced, when a fusion rule produced it.
+        self.fused = fused
+
+    def refs(self):
+        for value in (*self.args, *self.kwargs.values()):
+            if isinstance(value, Ref):
+                yield value.index
+
+
+class _Plan:
+    """Topologically ordered, de-duplicated (and optionally fused) launch list below *roots*."""
+
+    def __init__(self, roots, fuse: bool = True) -> None:
+        self.roots = [root for root in roots if root._value is None]
+        self.steps: list[Step] = []
+        self.merged = 0
+        slot: dict[int, int] = {}
+        by_key: dict[tuple, int] = {}
+
+        def operand(value):
+            if isinstance(value, LazyArray):
+                return Ref(slot[id(value)]) if value._value is None else value._value
+            return value
+
+        # Iterative post-order walk: deep expressions must not hit the recursion limit.
+        stack = [(root, False) for root in reversed(self.roots)]
+        while stack:
+            node, expanded = stack.pop()
+            if id(node) in slot:
+                continue
+            if not expanded:
+                stack.append((node, True))
+                for child in reversed(list(_operands(node))):
+                    if _is_pending(child) and id(child) not in slot:
+                        stack.append((child, False))
+                continue
+            key = self._key(node, slot)
+            index = by_key.get(key)
+            if index is None:
+                index = by_key[key] = len(self.steps)
+                args = tuple(operand(arg) for arg in node._args)
+                kwargs = {k: operand(v) for k, v in node._kwargs.items()}
+                self.steps.append(Step(node.name, node._func, args, kwargs))
+            else:
+                self.merged += 1
+            slot[id(node)] = index
+
+        self.outputs = [slot[id(root)] for root in self.roots]
+        self.fused = 0
+        if fuse and self.steps:
+            from ._fusion import rewrite
+
+            self.fused = rewrite(self)
+        self._compact()
+
+    def consumers(self) -> list[int]:
+        """Number of operand slots reading each step's value."""
+        counts = [0] * len(self.steps)
+        for step in self.steps:
+            for producer in step.refs():
+                counts[producer] += 1
+        return counts
+
+    def _compact(self) -> None:
+        """Drop steps no output depends on (e.g. absorbed by fusion) and renumber the rest."""
+        needed = set(self.outputs)
+        for index in range(len(self.steps) - 1, -1, -1):
+            if index in needed:
+                needed.update(self.steps[index].refs())
+        renumber = {old: new for new, old in enumerate(sorted(needed))}
+
+        def operand(value):
+            return Ref(renumber[value.index]) if isinstance(value, Ref) else value
+
+        steps = []
+        for old in sorted(needed):
+            step = self.steps[old]
+            step.args = tuple(operand(arg) for arg in step.args)
+            step.kwargs = {k: operand(v) for k, v in step.kwargs.items()}
+            steps.append(step)
+        self.steps = steps
+        self.outputs = [renumber[index] for index in self.outputs]
+        self.live = set(self.outputs)
+        # The last step reading each intermediate; its value is dropped right after it.
+        self.last_use: dict[int, int] = {}
+        for index, step in enumerate(self.steps):
+            for producer in step.refs():
+                self.last_use[producer] = index
+
+    @staticmethod
+    def _key(node: LazyArray, slot: dict[int, int]) -> tuple:
+        def operand_key(value):
+            if isinstance(value, LazyArray):
+                if value._value is None:
+                    return ("step", slot[id(value)])
+                value = value._value
+            if isinstance(value, (tuple, list)):
+                return (type(value), tuple(operand_key(v) for v in value))
+            if hasattr(value, "shape"):
+                # Arrays compare by identity: equal contents are not the same operand.
+                return ("array", id(value))
+            try:
+                hash(value)
+            except TypeError:
+                return ("object", id(value))
+            return ("const", type(value), value)
+
+        args = tuple(operand_key(arg) for arg in node._args)
+        kwargs = tuple(sorted((k, operand_key(v)) for k, v in node._kwargs.items()))
+        return (node._func, args, kwargs)
+
+    def _frees(self, index: int) -> list[int]:
+        return [
+            producer
+            for producer in dict.fromkeys(self.steps[index].refs())
+            if self.last_use[producer] == index and producer not in self.live
+        ]
+
+    def _donor(self, index: int) -> int | None:
+        """The intermediate step *index* may write its result over, if any."""
+        step = self.steps[index]
+        if step.fused is not None or step.name not in _OVERWRITING_STEPS:
+            return None
+        return next(iter(self._frees(index)), None)
+
+    def run(self) -> None:
+        from ._core import ndarray as _core_ndarray
+        from ._core.cann import _donate, _reclaim
+
+        values: list = [None] * len(self.steps)
+
+        def resolve(value):
+            return values[value.index] if isinstance(value, Ref) else value
+
+        token = _ENABLED.set(False)
+        try:
+            for index, step in enumerate(self.steps):
+                args = [resolve(arg) for arg in step.args]
+                kwargs = {k: resolve(v) for k, v in step.kwargs.items()}
+                # The core only takes the buffer if nothing else refers to it and the result has
+                # its shape and dtype (asnumpy.cann.donation_stats() counts both outcomes).
+                donor = self._donor(index)
+                donated = (
+                    donor is not None
+                    and isinstance(values[donor], _core_ndarray)
+                    and _donate(values[donor])
+                )
+                try:
+                    values[index] = step.func(*args, **kwargs)
+                finally:
+                    if donated:
+                        _reclaim(values[donor])
+                del args, kwargs
+                for producer in self._frees(index):
+                    values[producer] = None
+        finally:
+            _ENABLED.reset(token)
+
+        claimed: set[int] = set()
+        for root, index in zip(self.roots, self.outputs):
+            value = values[index]
+            if index in claimed:
+                from .utils import ndarray
+
+                # Roots merged by CSE get copy-on-write copies, never the same object.
+                value = ndarray(value)
+            root._value = value
+            claimed.add(index)
+            # The value replaces the expression; release the operands it held.
+            root._args, root._kwargs = (), {}
+
+    def describe(self) -> str:
+        names: dict[int, str] = {}
+
+        def operand(value) -> str:
+            if isinstance(value, Ref):
+                return f"%{value.index}"
+            if hasattr(value, "shape"):
+                return names.setdefault(id(value), f"${len(names)}")
+            return repr(value)
+
+        lines = [f"# {len(self.steps)} kernel(s), {self.merged} merged, {self.fused} fused"]
+        for index, step in enumerate(self.steps):
+            parts = [operand(arg) for arg in step.args]
+            parts += [f"{k}={operand(v)}" for k, v in step.kwargs.items()]
+            notes = []
+            if step.fused is not None:
+                notes.append(f"fused {step.fused}")
+            frees = self._frees(index)
+            if frees:
+                notes.append("frees " + ", ".join(f"%{p}" for p in frees))
+            donor = self._donor(index)
+            if donor is not None:
+                notes.append(f"may write over %{donor}")
+            line = f"%{index} = {step.name}({', '.join(parts)})"
+            lines.append(line + ("  # " + "; ".join(notes) if notes else ""))
+        return "\n".join(lines)
@@ -19,12 +19,23 @@
 Provides a CuPy-style dtype loop table mechanism for dispatching to
 pre-compiled CANN ACLNN operators, replacing scattered if-chain dispatch
 with a declarative registration pattern.
+
+The tables are parsed here; :func:`create_ufunc` compiles each one into the
+C++ ``_core.ufunc`` type, whose ``__call__`` runs the whole dispatch (lazy
+deferral, dtype resolution, weak scalars, loop lookup, result wrapping and
+``out=``) without returning to Python. :class:`_PyUfunc` is the same
+dispatch in Python, used when this module is loaded without the extension.
 """
 
 from __future__ import annotations
 
 import numpy as np
 
+try:
+    from ._core import ufunc as _CoreUfunc
+except ImportError:  # loaded on its own, as the unit tests do
+    _CoreUfunc = None
+
 # Dtype char code -> np.dtype mapping
 _DTYPE_CHAR_MAP = {
     "?": np.bool_,
@@ -95,15 +106,15 @@ def _get_max_array_dtype(args: list) -> np.dtype | None:
     return max(array_dtypes, key=lambda d: (_dtype_kind(d), d.itemsize))
 
 
-def _coerce_weak_scalar(value, target_dtype: np.dtype) -> np.ndarray:
-    """Wrap a weak scalar as a 0-d NumPy array with *target_dtype*.
+def _weak_scalar_dtype(value, target_dtype: np.dtype) -> np.dtype:
+    """Return the dtype a weak scalar takes next to arrays of *target_dtype*.
 
     If *value* is complex and *target_dtype* is real, fall back to
     ``complex128`` to avoid a casting error.
     """
     if isinstance(value, complex) and not np.issubdtype(target_dtype, np.complexfloating):
-        target_dtype = np.dtype("complex128")
-    return np.array(value, dtype=target_dtype)
+        return np.dtype("complex128")
+    return target_dtype
 
 
 def _parse_type_sig(sig: str) -> tuple[list[np.dtype], list[np.dtype]]:
@@ -263,9 +274,12 @@ class Ops:
         return None
 
 
-class ufunc:
+class _PyUfunc:
     """AsNumpy ufunc object, modeled after numpy.ufunc.
 
+    Reference implementation of ``_core.ufunc``; the two must dispatch alike,
+    which ``TestDispatchParity`` in ``tests/asnumpy_tests/test_ufunc.py`` checks.
+
     Attributes:
         name: The ufunc name.
         nin: Number of input arguments.
@@ -280,6 +294,7 @@ class ufunc:
         doc: str = "",
         default_casting: str = "same_kind",
         fallback=None,
+        accepts_out: bool = False,
     ):
         self.name = name
         self.__name__ = name
@@ -289,17 +304,29 @@ class ufunc:
         self.__doc__ = doc
         self._default_casting = default_casting
         self._fallback = fallback
+        self._accepts_out = accepts_out
 
     def __repr__(self) -> str:
         return f"<ufunc '{self.name}'>"
 
     def __call__(self, *args, **kwargs):
+        from . import _lazy
         from .utils import ndarray as _ndarray
 
+        if _lazy.should_defer(args, kwargs):
+            return _lazy.LazyArray(self, args, kwargs)
+        args, kwargs = _lazy.materialize(args, kwargs)
+
         dtype = kwargs.pop("dtype", None)
         if dtype is not None and not isinstance(dtype, np.dtype):
             dtype = np.dtype(dtype)
         out = kwargs.pop("out", None)
+        if isinstance(out, tuple) and len(out) == 1:
+            # NumPy's __array_ufunc__ protocol always passes out= as a tuple.
+            out = out[0]
+        # Routines that take an output array write into it directly (or update it in place when
+        # it is also the first operand) instead of producing a temporary for _write_out to copy.
+        direct_out = self._accepts_out and isinstance(out, _ndarray)
 
         if kwargs:
             raise TypeError(
@@ -322,17 +349,17 @@ class ufunc:
 
         # --- Weak-scalar coercion ---
         # Python native scalars (int, float, complex) must NOT trigger dtype
-        # promotion.  Coerce them to match the highest-kind array dtype so
-        # that loop-table exact-match succeeds.
+        # promotion.  Match them against the loop table as the highest-kind
+        # array dtype, but hand the routine the scalar itself: its scalar
+        # overload passes the value to the kernel directly, where a 0-d array
+        # would cost a device allocation and upload.
         max_array_dtype = _get_max_array_dtype(processed_args)
         if max_array_dtype is not None:
             for i, arg in enumerate(processed_args):
                 if _is_weak_scalar(arg):
                     scalar_dtype = np.dtype(type(arg))
                     if _dtype_kind(scalar_dtype) <= _dtype_kind(max_array_dtype):
-                        coerced = _coerce_weak_scalar(arg, max_array_dtype)
-                        processed_args[i] = coerced
-                        in_dtypes[i] = coerced.dtype
+                        in_dtypes[i] = _weak_scalar_dtype(arg, max_array_dtype)
 
         # Dispatch to matching loop
         op = self._ops.guess_routine(in_dtypes, dtype)
@@ -341,6 +368,9 @@ class ufunc:
             # Try fallback if available
             fallback = self._fallback
             if fallback is not None:
+                if direct_out:
+                    fallback(*processed_args, dtype=dtype, out=out)
+                    return out
                 result = fallback(*processed_args, dtype=dtype)
                 return self._write_out(out, result)
 
@@ -354,6 +384,9 @@ class ufunc:
             raise TypeError(
                 f"ufunc '{self.name}' does not support the 'dtype' parameter"
             )
+        if direct_out and op.accepts_dtype:
+            op.routine(*processed_args, dtype, out)
+            return out
         if op.accepts_dtype:
             result = op.routine(*processed_args, dtype)
         else:
@@ -377,16 +410,20 @@ class ufunc:
         out_targets = out if isinstance(out, tuple) else (out,)
         results = result if isinstance(result, tuple) else (result,)
         for dst, src in zip(out_targets, results, strict=True):
-            dst[...] = src
+            dst._assign(src if src.dtype == dst.dtype else src.astype(dst.dtype))
         return out if not isinstance(out, tuple) else tuple(out)
 
 
+ufunc = _CoreUfunc if _CoreUfunc is not None else _PyUfunc
+
+
 def create_ufunc(
     name: str,
     loop_table: tuple,
     doc: str = "",
     default_casting: str = "same_kind",
     fallback=None,
+    accepts_out: bool = False,
 ) -> ufunc:
     """Create a ufunc from a declarative dtype loop table.
 
@@ -398,6 +435,8 @@ def create_ufunc(
         doc: Docstring for the ufunc.
         default_casting: NumPy casting rule (default: 'same_kind').
         fallback: Optional callable invoked when no loop matches.
+        accepts_out: Whether the routines (and fallback) take an ``out`` array
+            after ``dtype`` and write the result into it.
 
     Returns:
         A ufunc instance.
@@ -419,7 +458,31 @@ def create_ufunc(
     nin = len(in_str)
     nout = 1  # all current ops produce 1 output
 
-    ops_list = _parse_loop_table(loop_table, nin, nout)
-
-    u = ufunc(name, Ops(ops_list, nin, nout), doc, default_casting, fallback=fallback)
+    ops = Ops(_parse_loop_table(loop_table, nin, nout), nin, nout)
+
+    if _CoreUfunc is None:
+        return _PyUfunc(
+            name,
+            ops,
+            doc,
+            default_casting,
+            fallback=fallback,
+            accepts_out=accepts_out,
+        )
+
+    from . import _lazy
+    from .utils import ndarray as _ndarray
+
+    u = _CoreUfunc(
+        name,
+        ops,
+        fallback,
+        accepts_out,
+        default_casting,
+        lazy_enabled=_lazy._ENABLED,
+        lazy_array=_lazy.LazyArray,
+        materialize=_lazy.materialize,
+        wrapper=_ndarray,
+    )
+    u.__doc__ = doc
     return u
@@ -14,14 +14,25 @@
 # limitations under the License.
 # *****************************************************************************
 
+from collections.abc import Sequence
+
+import numpy as np
 from loguru import logger
 
+from ._core import from_dlpack as _from_dlpack
+
+from ._core.array import (
+    ascontiguousarray as _ascontiguousarray,
+)
 from ._core.array import (
     empty as _empty,
 )
 from ._core.array import (
     empty_like as _empty_like,
 )
+from ._core.array import (
+    expand_dims as _expand_dims,
+)
 from ._core.array import (
     eye as _eye,
 )
@@ -37,20 +48,35 @@ from ._core.array import (
 from ._core.array import (
     linspace as _linspace,
 )
+from ._core.array import (
+    may_share_memory as _may_share_memory,
+)
 from ._core.array import (
     ones as _ones,
 )
 from ._core.array import (
     ones_like as _ones_like,
 )
+from ._core.array import (
+    ravel as _ravel,
+)
+from ._core.array import (
+    reshape as _reshape,
+)
+from ._core.array import (
+    squeeze as _squeeze,
+)
+from ._core.array import (
+    transpose as _transpose,
+)
 from ._core.array import (
     zeros as _zeros,
 )
 from ._core.array import (
     zeros_like as _zeros_like,
 )
-from ._types import ArrayLike, DTypeLike, ScalarLike, ShapeLike
-from .utils import _convert_dtype, _normalize_shape, ndarray
+from ._types import ArrayLike, AxisLike, DTypeLike, ScalarLike, ShapeLike
+from .utils import _convert_dtype, _normalize_axes, _normalize_shape, ndarray
 
 
 @logger.catch(reraise=True)
@@ -122,3 +148,68 @@ def linspace(
 ) -> ndarray:
     logger.debug(f"Creating linspace array start={start}, end={end}, steps={steps}, dtype={dtype}")
     return ndarray(_linspace(start, end, steps, _convert_dtype(dtype)))
+
+
+@logger.catch(reraise=True)
+def reshape(a: ndarray, newshape: ShapeLike) -> ndarray:
+    """Give a new shape to an array; a view whenever its strides allow, like numpy.reshape."""
+    logger.debug(f"Reshaping array a={a}, newshape={newshape}")
+    return ndarray(_reshape(a, _normalize_axes(newshape)))
+
+
+@logger.catch(reraise=True)
+def transpose(a: ndarray, axes: AxisLike = None) -> ndarray:
+    """Permute the dimensions of an array (reversed when axes is None). Always a view."""
+    logger.debug(f"Transposing array a={a}, axes={axes}")
+    return ndarray(_transpose(a, _normalize_axes(axes)))
+
+
+@logger.catch(reraise=True)
+def expand_dims(a: ndarray, axis: int | Sequence[int]) -> ndarray:
+    """Insert dimensions of size 1 at the given positions. Always a view."""
+    logger.debug(f"Expanding dims of array a={a}, axis={axis}")
+    return ndarray(_expand_dims(a, _normalize_axes(axis)))
+
+
+@logger.catch(reraise=True)
+def squeeze(a: ndarray, axis: AxisLike = None) -> ndarray:
+    """Remove dimensions of size 1 (all of them when axis is None). Always a view."""
+    logger.debug(f"Squeezing array a={a}, axis={axis}")
+    return ndarray(_squeeze(a, _normalize_axes(axis)))
+
+
+@logger.catch(reraise=True)
+def ravel(a: ndarray) -> ndarray:
+    """Flatten an array to one dimension; a view whenever its strides allow."""
+    logger.debug(f"Raveling array a={a}")
+    return ndarray(_ravel(a))
+
+
+@logger.catch(reraise=True)
+def ascontiguousarray(a: ndarray) -> ndarray:
+    """Return a C-contiguous array: a view of a if it already is one, otherwise a copy."""
+    logger.debug(f"Making array contiguous a={a}")
+    return ndarray(_ascontiguousarray(a))
+
+
+@logger.catch(reraise=True)
+def may_share_memory(a: ndarray, b: ndarray) -> bool:
+    """Whether a and b are views of the same device buffer."""
+    logger.debug(f"Checking shared memory a={a}, b={b}")
+    return _may_share_memory(a, b)  # type: ignore[no-any-return]
+
+
+_DLPACK_CPU = 1
+
+
+@logger.catch(reraise=True)
+def from_dlpack(x) -> ndarray:
+    """Return an ndarray over the memory of a DLPack-compatible array (e.g. a torch_npu tensor).
+
+    NPU tensors on the current device are shared, not copied; the producer's memory stays alive
+    as long as the result or any view of it. Host arrays are copied to the device.
+    """
+    device_type, _ = x.__dlpack_device__()
+    if device_type == _DLPACK_CPU:
+        return ndarray.from_numpy(np.from_dlpack(x))
+    return ndarray(_from_dlpack(x.__dlpack__()))
@@ -14,23 +14,83 @@
 # limitations under the License.
 # *****************************************************************************
 
+from typing import Any
+
+import numpy
 from loguru import logger
 
+from ._core.cann import (
+    Graph as _Graph,
+)
+from ._core.cann import (
+    Stream as _Stream,
+)
+from ._core.cann import (
+    cast_stats as _cast_stats,
+)
+from ._core.cann import (
+    clear_executor_cache as _clear_executor_cache,
+)
+from ._core.cann import (
+    donation_stats as _donation_stats,
+)
+from ._core.cann import (
+    empty_cache as _empty_cache,
+)
+from ._core.cann import (
+    empty_pinned_cache as _empty_pinned_cache,
+)
+from ._core.cann import (
+    executor_cache_stats as _executor_cache_stats,
+)
 from ._core.cann import (
     finalize as _finalize,
 )
+from ._core.cann import (
+    get_execution_mode as _get_execution_mode,
+)
 from ._core.cann import (
     init as _init,
 )
+from ._core.cann import (
+    memory_stats as _memory_stats,
+)
+from ._core.cann import (
+    pinned_empty as _pinned_empty,
+)
+from ._core.cann import (
+    pinned_memory_stats as _pinned_memory_stats,
+)
 from ._core.cann import (
     reset_device as _reset_device,
 )
 from ._core.cann import (
     reset_device_force as _reset_device_force,
 )
+from ._core.cann import (
+    reserve_workspace as _reserve_workspace,
+)
+from ._core.cann import (
+    reset_peak_memory_stats as _reset_peak_memory_stats,
+)
 from ._core.cann import (
     set_device as _set_device,
 )
+from ._core.cann import (
+    set_executor_cache_capacity as _set_executor_cache_capacity,
+)
+from ._core.cann import (
+    set_execution_mode as _set_execution_mode,
+)
+from ._core.cann import (
+    synchronize as _synchronize,
+)
+from ._core.cann import (
+    transfer_stats as _transfer_stats,
+)
+from ._core.cann import (
+    workspace_stats as _workspace_stats,
+)
 
 
 @logger.catch
@@ -61,3 +121,245 @@ def init() -> None:
 def finalize() -> None:
     logger.info("Finalizing CANN backend")
     _finalize()
+
+
+@logger.catch
+def memory_stats() -> dict:
+    """Return the device caching allocator counters.
+
+    ``reserved_bytes`` is device memory held by the cache (live and free blocks),
+    ``allocated_bytes`` the part handed out to live arrays, and the ``peak_*`` entries their
+    high-water marks since start-up or the last :func:`reset_peak_memory_stats`.
+    """
+    return _memory_stats()  # type: ignore[no-any-return]
+
+
+@logger.catch
+def empty_cache() -> None:
+    """Release cached device memory that is not used by any live array."""
+    logger.info("Releasing cached device memory")
+    _empty_cache()
+
+
+@logger.catch
+def reset_peak_memory_stats() -> None:
+    """Reset the ``peak_*`` counters of :func:`memory_stats` to the current usage."""
+    _reset_peak_memory_stats()
+
+
+@logger.catch
+def workspace_stats(current_stream: bool = False) -> dict:
+    """Return the operator workspace arena counters.
+
+    ``high_water_bytes`` is the largest workspace any operator has requested so far; passing it
+    to :func:`reserve_workspace` at start-up makes later runs of the same workload allocate no
+    workspace at all. ``grow_count`` counts arena (re)allocations.
+
+    The counters are summed over the arenas of all streams (``high_water_bytes`` is their
+    maximum) unless *current_stream* is true, which reports the current stream's arena alone.
+    """
+    return _workspace_stats(current_stream)  # type: ignore[no-any-return]
+
+
+@logger.catch
+def reserve_workspace(nbytes: int) -> None:
+    """Grow the current stream's operator workspace arena to at least *nbytes* ahead of time."""
+    logger.info(f"Reserving {nbytes} bytes of operator workspace")
+    _reserve_workspace(nbytes)
+
+
+@logger.catch(reraise=True)
+def pinned_empty(shape, dtype=numpy.float32) -> numpy.ndarray:
+    """Return an uninitialized NumPy array backed by page-locked host memory.
+
+    Transfers to and from it skip the staging copy, e.g. ``a.to_numpy(out=buf)``. The memory
+    goes back to the pinned pool when the array is garbage collected.
+    """
+    if isinstance(shape, (int, numpy.integer)):
+        shape = (shape,)
+    return _pinned_empty([int(d) for d in shape], numpy.dtype(dtype))  # type: ignore[no-any-return]
+
+
+@logger.catch
+def pinned_memory_stats() -> dict:
+    """Return the pinned host pool counters.
+
+    ``reserved_bytes`` is page-locked memory held by the pool, ``allocated_bytes`` the part in
+    use; ``host_malloc_count`` stays flat once transfers of a given size are warm.
+    """
+    return _pinned_memory_stats()  # type: ignore[no-any-return]
+
+
+@logger.catch
+def transfer_stats() -> dict:
+    """Return throughput counters of staged host transfers (1 MiB and up).
+
+    Each transfer is timed on the device from its first chunk to its last. ``last_gbps`` is the
+    rate of the most recent completed transfer, ``average_gbps`` that over all of them.
+    """
+    stats = _transfer_stats()
+    last, total = stats["last_seconds"], stats["seconds"]
+    stats["last_gbps"] = stats["last_bytes"] / last / 1e9 if last else 0.0
+    stats["average_gbps"] = stats["bytes"] / total / 1e9 if total else 0.0
+    return stats  # type: ignore[no-any-return]
+
+
+@logger.catch
+def empty_pinned_cache() -> None:
+    """Release cached pinned host memory that is not in use."""
+    logger.info("Releasing cached pinned host memory")
+    _empty_pinned_cache()
+
+
+@logger.catch
+def cast_stats() -> dict:
+    """Return the counters of operand casts made for mixed-dtype binary operators.
+
+    ``avoided`` counts operands handed to the kernel in their own dtype because it promotes them
+    exactly as NumPy would; ``materialized`` counts operands that were cast to the common dtype
+    first, each costing a cast kernel and a temporary.
+    """
+    return _cast_stats()  # type: ignore[no-any-return]
+
+
+@logger.catch
+def donation_stats() -> dict:
+    """Return the counters of buffers donated by lazy plans to the operator reading them last.
+
+    ``elided`` counts results written over such a dead intermediate, each an allocation saved;
+    ``declined`` counts donations the operator could not use because its result differs in shape
+    or dtype, or its kernel may not overwrite an input.
+    """
+    return _donation_stats()  # type: ignore[no-any-return]
+
+
+@logger.catch
+def executor_cache_stats() -> dict:
+    """Return the operator executor cache counters.
+
+    A ``hit`` is a launch that reused the executor built for the same op, shapes, strides and
+    dtypes, only rebinding device addresses. ``uncacheable`` counts ops that refused to make
+    their executor repeatable.
+    """
+    return _executor_cache_stats()  # type: ignore[no-any-return]
+
+
+@logger.catch
+def clear_executor_cache() -> None:
+    """Drop every cached operator executor."""
+    logger.info("Clearing operator executor cache")
+    _clear_executor_cache()
+
+
+@logger.catch(reraise=True)
+def set_executor_cache_capacity(capacity: int) -> None:
+    """Keep at most *capacity* executors, least recently used first out; 0 disables the cache."""
+    _set_executor_cache_capacity(capacity)
+
+
+@logger.catch(reraise=True)
+def synchronize() -> None:
+    """Wait for all enqueued device work; raises if an enqueued operator failed."""
+    _synchronize()
+
+
+@logger.catch(reraise=True)
+def set_execution_mode(mode: str) -> None:
+    """Select ``"blocking"`` (default) or ``"async"`` operator execution.
+
+    In async mode operators are only enqueued; the host waits at ``to_numpy``, scalar results
+    and :func:`synchronize`, where the error of a failed operator is reported by name.
+    The mode can also be chosen at import time with ``ASNUMPY_EXECUTION_MODE=async``.
+    """
+    logger.info(f"Setting execution mode to {mode}")
+    _set_execution_mode(mode)
+
+
+@logger.catch
+def get_execution_mode() -> str:
+    """Return the current execution mode, ``"blocking"`` or ``"async"``."""
+    return _get_execution_mode()  # type: ignore[no-any-return]
+
+
+class Stream:
+    """A device stream taken from a fixed pool, used as a context manager.
+
+    Operators called inside ``with stream:`` are enqueued on it instead of the default stream.
+    In async mode, chains on different streams overlap; an operator that reads an array written on
+    another stream waits on the device for that write only. The host is not blocked.
+    """
+
+    def __init__(self) -> None:
+        self._stream = _Stream()
+
+    def __enter__(self) -> "Stream":
+        self._stream.enter()
+        return self
+
+    def __exit__(self, *exc_info: object) -> None:
+        self._stream.exit()
+
+    @logger.catch(reraise=True)
+    def synchronize(self) -> None:
+        """Wait until all work enqueued on this stream is done."""
+        self._stream.synchronize()
+
+
+class Graph:
+    """A sequence of operators captured once and replayed as a single launch.
+
+    Operators called inside ``with graph:`` are recorded, not run. :meth:`replay` runs the whole
+    sequence again with no Python dispatch, workspace query or allocation. Arrays the captured
+    operators read and write stay allocated while the graph lives and are reused by every replay.
+
+    Nothing inside the block may wait for the device: ``to_numpy``, ``synchronize`` and
+    operators that read results back to the host raise.
+    """
+
+    def __init__(self, *inputs: Any) -> None:
+        self._graph = _Graph(list(inputs))
+
+    def __enter__(self) -> "Graph":
+        self._graph.begin()
+        return self
+
+    def __exit__(self, exc_type: Any, *exc_info: object) -> None:
+        self._graph.end(exc_type is None)
+
+    @logger.catch(reraise=True)
+    def replay(self, *inputs: Any) -> None:
+        """Run the captured operators.
+
+        Passing arrays copies them into the inputs given to :func:`graph` first; each must
+        have the shape and dtype it was captured with.
+        """
+        self._graph.replay(list(inputs))
+
+    def set_outputs(self, *outputs: Any) -> None:
+        """Name the arrays, created inside the capture, that :meth:`run` returns."""
+        self._graph.set_outputs(list(outputs))
+
+    @logger.catch(reraise=True)
+    def run(self, *inputs: Any) -> tuple:
+        """Replay like :meth:`replay` and return fresh copies of the outputs, in one call."""
+        from .utils import ndarray
+
+        return tuple(ndarray(result) for result in self._graph.run(list(inputs)))
+
+    @property
+    def launch_count(self) -> int:
+        """Number of launches recorded by the capture."""
+        return self._graph.launch_count  # type: ignore[no-any-return]
+
+
+def graph(*inputs: Any) -> Graph:
+    """Return a :class:`Graph` to capture operators into, used as a context manager.
+
+    *inputs* are the arrays :meth:`Graph.replay` may refill; results created inside the block
+    are overwritten by each replay::
+
+        with asnumpy.cann.graph(x) as g:
+            y = asnumpy.sin(x) * x
+        g.replay(x_next)  # y now holds sin(x_next) * x_next
+    """
+    return Graph(*inputs)
@@ -0,0 +1,88 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+"""Element-wise operators over lists of arrays, batched onto the aclnn Foreach kernels.
+
+Every function takes lists (or other sequences) of arrays and returns a list of results in
+the same order. Non-empty, C-contiguous float16/bfloat16/float32 arrays -- pairs of them
+also agreeing in shape and dtype -- are batched, a few dozen per launch; any other array goes
+through the ordinary operator, so results match ``asnumpy.add`` and friends element for
+element. Lazy arrays in a list are evaluated together first.
+"""
+
+from collections.abc import Sequence
+
+from ._core.foreach import add as _add
+from ._core.foreach import add_scalar as _add_scalar
+from ._core.foreach import div as _div
+from ._core.foreach import exp as _exp
+from ._core.foreach import mul as _mul
+from ._core.foreach import mul_scalar as _mul_scalar
+from ._core.foreach import neg as _neg
+from ._core.foreach import norm as _norm
+from ._core.foreach import sqrt as _sqrt
+from ._core.foreach import sub as _sub
+from ._lazy import materialize as _materialize
+from .utils import ndarray
+
+
+def _arrays(xs: Sequence[ndarray]) -> list:
+    values, _ = _materialize(tuple(xs))
+    return list(values)
+
+
+def _wrap(results) -> list[ndarray]:
+    return [ndarray(r) for r in results]
+
+
+def add(x1: Sequence[ndarray], x2: Sequence[ndarray]) -> list[ndarray]:
+    return _wrap(_add(_arrays(x1), _arrays(x2)))
+
+
+def sub(x1: Sequence[ndarray], x2: Sequence[ndarray]) -> list[ndarray]:
+    return _wrap(_sub(_arrays(x1), _arrays(x2)))
+
+
+def mul(x1: Sequence[ndarray], x2: Sequence[ndarray]) -> list[ndarray]:
+    return _wrap(_mul(_arrays(x1), _arrays(x2)))
+
+
+def div(x1: Sequence[ndarray], x2: Sequence[ndarray]) -> list[ndarray]:
+    return _wrap(_div(_arrays(x1), _arrays(x2)))
+
+
+def add_scalar(x: Sequence[ndarray], value) -> list[ndarray]:
+    return _wrap(_add_scalar(_arrays(x), value))
+
+
+def mul_scalar(x: Sequence[ndarray], value) -> list[ndarray]:
+    return _wrap(_mul_scalar(_arrays(x), value))
+
+
+def exp(x: Sequence[ndarray]) -> list[ndarray]:
+    return _wrap(_exp(_arrays(x)))
+
+
+def sqrt(x: Sequence[ndarray]) -> list[ndarray]:
+    return _wrap(_sqrt(_arrays(x)))
+
+
+def neg(x: Sequence[ndarray]) -> list[ndarray]:
+    return _wrap(_neg(_arrays(x)))
+
+
+def norm(x: Sequence[ndarray], ord: float = 2) -> list[ndarray]:
+    """Vector ``ord``-norm of each array's elements, as 0-d arrays; only 1 and 2 are batched."""
+    return _wrap(_norm(_arrays(x), ord))
@@ -269,9 +269,11 @@ from ._core.math import (
 from ._core.math import (
     trunc as _trunc,
 )
+from ._lazy import deferrable as _deferrable
+from ._lazy import materializes as _materializes
 from ._types import ArrayLike, AxisOptional, DTypeLike
 from ._ufunc import create_ufunc as _create_ufunc
-from .utils import _convert_dtype, ndarray
+from .utils import _convert_dtype, _normalize_axes, _reduction_result, _reduction_where, ndarray
 
 
 # Trigonometric functions (ufunc-registered)
@@ -290,71 +292,88 @@ sin = _create_ufunc(
 )
 
 
+@_deferrable
 def cos(x: ArrayLike) -> ndarray:
     return ndarray(_cos(x))
 
 
+@_deferrable
 def tan(x: ArrayLike) -> ndarray:
     return ndarray(_tan(x))
 
 
+@_deferrable
 def arcsin(x: ArrayLike) -> ndarray:
     return ndarray(_arcsin(x))
 
 
+@_deferrable
 def arccos(x: ArrayLike) -> ndarray:
     return ndarray(_arccos(x))
 
 
+@_deferrable
 def arctan(x: ArrayLike) -> ndarray:
     return ndarray(_arctan(x))
 
 
+@_deferrable
 def arctan2(x1: ArrayLike, x2: ArrayLike) -> ndarray:
     return ndarray(_arctan2(x1, x2))
 
 
+@_deferrable
 def hypot(x1: ArrayLike, x2: ArrayLike) -> ndarray:
     return ndarray(_hypot(x1, x2))
 
 
+@_deferrable
 def radians(x: ArrayLike) -> ndarray:
     return ndarray(_radians(x))
 
 
+@_deferrable
 def deg2rad(x: ArrayLike) -> ndarray:
     return ndarray(_radians(x))
 
 
+@_deferrable
 def degrees(x: ArrayLike) -> ndarray:
     return ndarray(_degrees(x))
 
 
+@_deferrable
 def rad2deg(x: ArrayLike) -> ndarray:
     return ndarray(_rad2deg(x))
 
 
 # Miscellaneous functions
+@_deferrable
 def absolute(x: ArrayLike) -> ndarray:
     return ndarray(_absolute(x))
 
 
+@_deferrable
 def fabs(x: ArrayLike) -> ndarray:
     return ndarray(_fabs(x))
 
 
+@_deferrable
 def sign(x: ArrayLike) -> ndarray:
     return ndarray(_sign(x))
 
 
+@_deferrable
 def heaviside(x1: ArrayLike, x2: ArrayLike) -> ndarray:
     return ndarray(_heaviside(x1, x2))
 
 
+@_deferrable
 def clip(a: ArrayLike, a_min: ArrayLike | float, a_max: ArrayLike | float) -> ndarray:
     return ndarray(_clip(a, a_min, a_max))
 
 
+@_deferrable
 def nan_to_num(
     x: ArrayLike,
     nan: float = 0.0,
@@ -364,26 +383,35 @@ def nan_to_num(
     return ndarray(_nan_to_num(x, nan, posinf, neginf))
 
 
+@_deferrable
 def sqrt(x: ArrayLike) -> ndarray:
     return ndarray(_sqrt(x))
 
 
+@_deferrable
 def square(x: ArrayLike) -> ndarray:
     return ndarray(_square(x))
 
 
+@_deferrable
 def relu(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_relu(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def gelu(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_gelu(x, _convert_dtype(dtype)))
 
 
 # Arithmetic operations (ufunc-registered)
-def _add_fallback(x1, x2, dtype=None):
+def _into(result, out):
+    """Wrap a core result, or return *out* when the core routine wrote into it."""
+    return ndarray(result) if out is None else out
+
+
+def _add_fallback(x1, x2, dtype=None, out=None):
     """Fallback for add with dtypes not in loop table (e.g. int32)."""
-    return ndarray(_add(x1, x2, _convert_dtype(dtype)))
+    return _into(_add(x1, x2, _convert_dtype(dtype), out), out)
 
 
 add = _create_ufunc(
@@ -391,20 +419,23 @@ add = _create_ufunc(
     (('ff->f', _add), ('dd->d', _add)),
     fallback=_add_fallback,
     doc='Add arguments element-wise.',
+    accepts_out=True,
 )
 
 
+@_deferrable
 def reciprocal(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_reciprocal(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def positive(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_positive(x, _convert_dtype(dtype)))
 
 
-def _negative_fallback(x, dtype=None):
+def _negative_fallback(x, dtype=None, out=None):
     """Fallback for negative with dtypes not in loop table (e.g. int64, float16)."""
-    return ndarray(_negative(x, _convert_dtype(dtype)))
+    return _into(_negative(x, _convert_dtype(dtype), out), out)
 
 
 negative = _create_ufunc(
@@ -412,168 +443,225 @@ negative = _create_ufunc(
     (('f->f', _negative), ('d->d', _negative), ('i->i', _negative)),
     doc='Numerical negative, element-wise.',
     fallback=_negative_fallback,
+    accepts_out=True,
 )
 
 
-def multiply(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
-    return ndarray(_multiply(x1, x2, _convert_dtype(dtype)))
+@_deferrable
+def multiply(
+    x1: ArrayLike,
+    x2: ArrayLike,
+    dtype: DTypeLike = None,
+    out: ndarray | None = None,
+) -> ndarray:
+    return _into(_multiply(x1, x2, _convert_dtype(dtype), out), out)
 
 
-def divide(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
-    return ndarray(_divide(x1, x2, _convert_dtype(dtype)))
+@_deferrable
+def divide(
+    x1: ArrayLike,
+    x2: ArrayLike,
+    dtype: DTypeLike = None,
+    out: ndarray | None = None,
+) -> ndarray:
+    return _into(_divide(x1, x2, _convert_dtype(dtype), out), out)
 
 
-def true_divide(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
-    return ndarray(_true_divide(x1, x2, _convert_dtype(dtype)))
+@_deferrable
+def true_divide(
+    x1: ArrayLike,
+    x2: ArrayLike,
+    dtype: DTypeLike = None,
+    out: ndarray | None = None,
+) -> ndarray:
+    return _into(_true_divide(x1, x2, _convert_dtype(dtype), out), out)
 
 
-def subtract(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
-    return ndarray(_subtract(x1, x2, _convert_dtype(dtype)))
+@_deferrable
+def subtract(
+    x1: ArrayLike,
+    x2: ArrayLike,
+    dtype: DTypeLike = None,
+    out: ndarray | None = None,
+) -> ndarray:
+    return _into(_subtract(x1, x2, _convert_dtype(dtype), out), out)
 
 
+@_deferrable
 def floor_divide(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_floor_divide(x1, x2, _convert_dtype(dtype)))
 
 
+@_deferrable
 def float_power(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_float_power(x1, x2, _convert_dtype(dtype)))
 
 
+@_deferrable
 def fmod(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_fmod(x1, x2, _convert_dtype(dtype)))
 
 
+@_deferrable
 def mod(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_mod(x1, x2, _convert_dtype(dtype)))
 
 
+@_materializes
 def modf(x: ArrayLike) -> tuple:
     frac, inte = _modf(x)
     return (ndarray(frac), ndarray(inte))
 
 
+@_deferrable
 def remainder(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_remainder(x1, x2, _convert_dtype(dtype)))
 
 
+@_materializes
 def divmod(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> tuple:
     res1, res2 = _divmod(x1, x2)
     _type = _convert_dtype(dtype)
     return (ndarray(res1, _type), ndarray(res2, _type))
 
 
+@_deferrable
 def power(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_power(x1, x2, _convert_dtype(dtype)))
 
 
 # Sums, products, differences
+@_materializes
 def prod(
     a: ArrayLike,
     axis: AxisOptional = None,
     keepdims: bool = False,
     dtype: DTypeLike = None,
-) -> ndarray | float:
-    if axis is None:
-        return _prod(a)  # type: ignore[no-any-return]
-    return ndarray(_prod(a, axis, keepdims, _convert_dtype(dtype)))
+    where: ArrayLike | None = None,
+) -> ndarray:
+    return _reduction_result(
+        _prod(a, _normalize_axes(axis), keepdims, _convert_dtype(dtype), _reduction_where(where))
+    )
 
 
+@_materializes
 def sum(
     a: ArrayLike,
     axis: AxisOptional = None,
     keepdims: bool = False,
     dtype: DTypeLike = None,
-) -> ndarray | float:
-    if axis is None:
-        return _sum(a)  # type: ignore[no-any-return]
-    return ndarray(_sum(a, axis, keepdims, _convert_dtype(dtype)))
+    where: ArrayLike | None = None,
+) -> ndarray:
+    return _reduction_result(
+        _sum(a, _normalize_axes(axis), keepdims, _convert_dtype(dtype), _reduction_where(where))
+    )
 
 
+@_materializes
 def nanprod(
     a: ArrayLike,
     axis: AxisOptional = None,
     keepdims: bool = False,
     dtype: DTypeLike = None,
-) -> ndarray | float:
-    if axis is None:
-        return _nanprod(a)  # type: ignore[no-any-return]
-    return ndarray(_nanprod(a, axis, keepdims, _convert_dtype(dtype)))
+    where: ArrayLike | None = None,
+) -> ndarray:
+    return _reduction_result(
+        _nanprod(a, _normalize_axes(axis), keepdims, _convert_dtype(dtype), _reduction_where(where))
+    )
 
 
+@_materializes
 def nansum(
     a: ArrayLike,
     axis: AxisOptional = None,
     keepdims: bool = False,
     dtype: DTypeLike = None,
-) -> ndarray | float:
-    if axis is None:
-        return _nansum(a)  # type: ignore[no-any-return]
-    return ndarray(_nansum(a, axis, keepdims, _convert_dtype(dtype)))
+    where: ArrayLike | None = None,
+) -> ndarray:
+    return _reduction_result(
+        _nansum(a, _normalize_axes(axis), keepdims, _convert_dtype(dtype), _reduction_where(where))
+    )
 
 
+@_materializes
 def cumprod(a: ArrayLike, axis: AxisOptional = None, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_cumprod(a, axis, _convert_dtype(dtype)))
 
 
+@_materializes
 def cumsum(a: ArrayLike, axis: AxisOptional = None, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_cumsum(a, axis, _convert_dtype(dtype)))
 
 
+@_materializes
 def nancumprod(a: ArrayLike, axis: AxisOptional = None, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_nancumprod(a, axis, _convert_dtype(dtype)))
 
 
+@_materializes
 def nancumsum(a: ArrayLike, axis: AxisOptional = None, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_nancumsum(a, axis, _convert_dtype(dtype)))
 
 
+@_materializes
 def cross(a: ArrayLike, b: ArrayLike, axis: AxisOptional = None) -> ndarray:
     return ndarray(_cross(a, b, axis))
 
 
 # Exponents and logarithms
+@_deferrable
 def exp(x: ArrayLike) -> ndarray:
     return ndarray(_exp(x))
 
 
+@_deferrable
 def expm1(x: ArrayLike) -> ndarray:
     return ndarray(_expm1(x))
 
 
+@_deferrable
 def exp2(x: ArrayLike) -> ndarray:
     return ndarray(_exp2(x))
 
 
+@_deferrable
 def log(x: ArrayLike) -> ndarray:
     return ndarray(_log(x))
 
 
+@_deferrable
 def log10(x: ArrayLike) -> ndarray:
     return ndarray(_log10(x))
 
 
+@_deferrable
 def log2(x: ArrayLike) -> ndarray:
     return ndarray(_log2(x))
 
 
+@_deferrable
 def log1p(x: ArrayLike) -> ndarray:
     return ndarray(_log1p(x))
 
 
+@_deferrable
 def logaddexp(x1: ArrayLike, x2: ArrayLike) -> ndarray:
     return ndarray(_logaddexp(x1, x2))
 
 
+@_deferrable
 def logaddexp2(x1: ArrayLike, x2: ArrayLike) -> ndarray:
     return ndarray(_logaddexp2(x1, x2))
 
 
 # Handling complex numbers
+@_deferrable
 def real(x: ArrayLike) -> ndarray:
     return ndarray(_real(x))
 
 
 # Floating point routines
+@_materializes
 def signbit(x: ArrayLike) -> ndarray:
     result = ndarray(_signbit(x))
     # CANN's aclnnSignbit does not handle IEEE 754 negative zero (-0.0).
@@ -589,70 +677,86 @@ def signbit(x: ArrayLike) -> ndarray:
     return result
 
 
+@_deferrable
 def ldexp(x1: ArrayLike, x2: ArrayLike) -> ndarray:
     return ndarray(_ldexp(x1, x2))
 
 
+@_deferrable
 def copysign(x1: ArrayLike, x2: ArrayLike) -> ndarray:
     return ndarray(_copysign(x1, x2))
 
 
 # Hyperbolic functions
+@_deferrable
 def sinh(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_sinh(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def cosh(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_cosh(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def tanh(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_tanh(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def arcsinh(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_arcsinh(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def arccosh(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_arccosh(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def arctanh(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_arctanh(x, _convert_dtype(dtype)))
 
 
 # Other special functions
+@_deferrable
 def sinc(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_sinc(x, _convert_dtype(dtype)))
 
 
 # Rational routines
+@_deferrable
 def gcd(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_gcd(x1, x2, _convert_dtype(dtype)))
 
 
+@_deferrable
 def lcm(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_lcm(x1, x2, _convert_dtype(dtype)))
 
 
 # Rounding
+@_deferrable
 def around(x: ArrayLike, decimals: int = 0, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_around(x, decimals, _convert_dtype(dtype)))
 
 
+@_deferrable
 def round_(x: ArrayLike, decimals: int = 0, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_round_(x, decimals, _convert_dtype(dtype)))
 
 
+@_deferrable
 def rint(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_rint(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def fix(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_fix(x, _convert_dtype(dtype)))
 
 
+@_materializes
 def floor(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     converted_dtype = _convert_dtype(dtype)
     if converted_dtype is None:
@@ -662,56 +766,57 @@ def floor(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_floor(x, converted_dtype))
 
 
+@_deferrable
 def ceil(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_ceil(x, _convert_dtype(dtype)))
 
 
+@_deferrable
 def trunc(x: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_trunc(x, _convert_dtype(dtype)))
 
 
 # Extrema finding
+@_deferrable
 def maximum(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_maximum(x1, x2, _convert_dtype(dtype)))
 
 
+@_deferrable
 def minimum(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_minimum(x1, x2, _convert_dtype(dtype)))
 
 
+@_deferrable
 def fmax(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_fmax(x1, x2, _convert_dtype(dtype)))
 
 
+@_deferrable
 def fmin(x1: ArrayLike, x2: ArrayLike, dtype: DTypeLike = None) -> ndarray:
     return ndarray(_fmin(x1, x2, _convert_dtype(dtype)))
 
 
-def max(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray | float:
-    if axis is None:
-        return _max(a)  # type: ignore[no-any-return]
-    return ndarray(_max(a, axis, keepdims))
+@_materializes
+def max(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray:
+    return _reduction_result(_max(a, _normalize_axes(axis), keepdims))
 
 
-def amax(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray | float:
-    if axis is None:
-        return _amax(a)  # type: ignore[no-any-return]
-    return ndarray(_amax(a, axis, keepdims))
+@_materializes
+def amax(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray:
+    return _reduction_result(_amax(a, _normalize_axes(axis), keepdims))
 
 
-def nanmax(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray | float:
-    if axis is None:
-        return _nanmax(a)  # type: ignore[no-any-return]
-    return ndarray(_nanmax(a, axis, keepdims))
+@_materializes
+def nanmax(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray:
+    return _reduction_result(_nanmax(a, _normalize_axes(axis), keepdims))
 
 
-def min(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray | float:
-    if axis is None:
-        return _min(a)  # type: ignore[no-any-return]
-    return ndarray(_min(a, axis, keepdims))
+@_materializes
+def min(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray:
+    return _reduction_result(_min(a, _normalize_axes(axis), keepdims))
 
 
-def amin(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray | float:
-    if axis is None:
-        return _amin(a)  # type: ignore[no-any-return]
-    return ndarray(_amin(a, axis, keepdims))
+@_materializes
+def amin(a: ArrayLike, axis: AxisOptional = None, keepdims: bool = False) -> ndarray:
+    return _reduction_result(_amin(a, _normalize_axes(axis), keepdims))
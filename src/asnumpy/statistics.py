@@ -17,7 +17,7 @@
 
 from ._core.statistics import mean as _mean
 from ._types import ArrayLike, AxisLike, DTypeLike
-from .utils import _convert_dtype, ndarray
+from .utils import _convert_dtype, _normalize_axes, _reduction_result, _reduction_where, ndarray
 
 
 def mean(
@@ -25,7 +25,8 @@ def mean(
     axis: AxisLike = None,
     keepdims: bool = False,
     dtype: DTypeLike = None,
-) -> ndarray | float:
-    if axis is None:
-        return _mean(a, _convert_dtype(dtype))  # type: ignore[no-any-return]
-    return ndarray(_mean(a, axis, keepdims, _convert_dtype(dtype)))
+    where: ArrayLike | None = None,
+) -> ndarray:
+    return _reduction_result(
+        _mean(a, _normalize_axes(axis), keepdims, _convert_dtype(dtype), _reduction_where(where))
+    )
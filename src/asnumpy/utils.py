@@ -14,15 +14,24 @@
 # limitations under the License.
 # *****************************************************************************
 
+import asyncio
+import contextlib
 import operator
 from collections.abc import Sequence
-from typing import overload
+from typing import Any, Optional, overload
 
 import numpy as np
 from loguru import logger
 
+import asnumpy as anp
+
 from ._core import broadcast_shape as _broadcast_shape
 from ._core import ndarray as _ndarray
+from ._core.array import getitem as _getitem
+from ._core.array import ravel as _ravel
+from ._core.array import reshape as _reshape
+from ._core.array import squeeze as _squeeze
+from ._core.array import transpose as _transpose
 
 
 class ndarray(_ndarray):
@@ -34,8 +43,9 @@ class ndarray(_ndarray):
 
     def __init__(self, shape_or_array, dtype=None):
         if isinstance(shape_or_array, ndarray):
-            # Public ndarray and its subclasses retain deep-copy semantics, so an
-            # explicit ndarray(existing_array) never consumes the source array.
+            # Public ndarray and its subclasses retain copy semantics (copy-on-write: the
+            # device buffer is shared until either array is written), so an explicit
+            # ndarray(existing_array) never consumes the source array.
             super().__init__(shape_or_array)
         elif isinstance(shape_or_array, _ndarray):
             # A base _ndarray that is not a public ndarray is a private one-shot
@@ -88,8 +98,116 @@ class ndarray(_ndarray):
         base_obj = _ndarray.from_numpy(host_data)
         return cls(base_obj)
 
-    def to_numpy(self) -> np.ndarray:
-        return super().to_numpy()
+    def to_numpy(self, out: Optional[np.ndarray] = None) -> np.ndarray:
+        """Copy to host. *out*, if given, must match shape and dtype and be C-contiguous; an
+        array from :func:`asnumpy.cann.pinned_empty` receives the data without staging."""
+        return super().to_numpy(out)
+
+    def iter_numpy_chunks(self, chunk_bytes: Optional[int] = None):
+        """Copy to host in blocks of rows of about *chunk_bytes* (default 8 MiB), yielding each as a
+        NumPy array.
+
+        Later blocks are transferred while the caller works on the current one, and the host
+        never holds the whole array unless the caller keeps every block.
+        """
+        if chunk_bytes is None:
+            return super().iter_numpy_chunks()
+        return super().iter_numpy_chunks(chunk_bytes)
+
+    @classmethod
+    def from_numpy_async(cls, host_data: np.ndarray, stream: Any = None) -> "Transfer":
+        """Start copying *host_data* to the device and return a :class:`Transfer` at once.
+
+        The copy is queued on *stream* (an :class:`asnumpy.cann.Stream`, default: the current
+        stream). ``transfer.array`` can be passed to operators right away; they run after the copy.
+        """
+        with stream if stream is not None else contextlib.nullcontext():
+            handle = _ndarray.from_numpy_async(host_data)
+        return Transfer(handle, cls(handle.value))
+
+    def to_numpy_async(self, stream: Any = None) -> "Transfer":
+        """Start copying to a new pinned host array and return a :class:`Transfer` at once."""
+        with stream if stream is not None else contextlib.nullcontext():
+            handle = super().to_numpy_async()
+        return Transfer(handle, handle.value)
+
+    def __getitem__(self, key) -> "ndarray":
+        """Basic indexing (integers, slices, ``...``, ``None``); returns a view of this array.
+
+        Unlike NumPy, indexing every dimension with an integer gives a 0-d array, not a scalar.
+        """
+        return ndarray(_getitem(self, key))
+
+    def reshape(self, *shape) -> "ndarray":
+        """Same as :func:`asnumpy.reshape`; takes ``a.reshape(2, 3)`` or ``a.reshape((2, 3))``."""
+        if len(shape) == 1 and not isinstance(shape[0], (int, np.integer)):
+            shape = shape[0]
+        return ndarray(_reshape(self, _normalize_axes(shape)))
+
+    def transpose(self, *axes) -> "ndarray":
+        """Same as :func:`asnumpy.transpose`; accepts axes as separate arguments or one sequence."""
+        if len(axes) == 1 and not isinstance(axes[0], (int, np.integer)):
+            axes = axes[0]
+        return ndarray(_transpose(self, _normalize_axes(axes) if axes != () else None))
+
+    @property
+    def T(self) -> "ndarray":
+        return self.transpose()
+
+    def ravel(self) -> "ndarray":
+        return ndarray(_ravel(self))
+
+    def squeeze(self, axis=None) -> "ndarray":
+        return ndarray(_squeeze(self, _normalize_axes(axis)))
+
+    # Arithmetic operators go through the public functions, so they also defer under
+    # asnumpy.lazy() and build expressions such as ``np.sqrt(a * a + b * b) / c``.
+    def __add__(self, other):
+        return _call_public("add", self, other)
+
+    def __radd__(self, other):
+        return _call_public("add", other, self)
+
+    def __sub__(self, other):
+        return _call_public("subtract", self, other)
+
+    def __rsub__(self, other):
+        return _call_public("subtract", other, self)
+
+    def __mul__(self, other):
+        return _call_public("multiply", self, other)
+
+    def __rmul__(self, other):
+        return _call_public("multiply", other, self)
+
+    def __truediv__(self, other):
+        return _call_public("true_divide", self, other)
+
+    def __rtruediv__(self, other):
+        return _call_public("true_divide", other, self)
+
+    def __pow__(self, other):
+        return _call_public("power", self, other)
+
+    def __rpow__(self, other):
+        return _call_public("power", other, self)
+
+    def __neg__(self):
+        return _call_public("negative", self)
+
+    # In-place operators pass out=self, which the core runs on the aclnn Inplace* kernels: an
+    # update such as ``x -= alpha * p`` allocates nothing for the result.
+    def __iadd__(self, other):
+        return _call_public("add", self, other, out=self)
+
+    def __isub__(self, other):
+        return _call_public("subtract", self, other, out=self)
+
+    def __imul__(self, other):
+        return _call_public("multiply", self, other, out=self)
+
+    def __itruediv__(self, other):
+        return _call_public("true_divide", self, other, out=self)
 
     __array_priority__ = 100.0
 
@@ -108,8 +226,6 @@ class ndarray(_ndarray):
         Returns:
             Result from the asnumpy ufunc, or NotImplemented if unhandled.
         """
-        import asnumpy as anp
-
         if method not in ("__call__",):
             return NotImplemented
 
@@ -158,8 +274,6 @@ class ndarray(_ndarray):
         Returns:
             Result from the asnumpy function, or NotImplemented if unhandled.
         """
-        import asnumpy as anp
-
         name = func.__name__
         anp_func = getattr(anp, name, None)
 
@@ -188,8 +302,8 @@ class ndarray(_ndarray):
 
         Args:
             dtype: Target dtype.
-            order: Memory layout. Only ``"K"``/``"C"`` are meaningful: asnumpy arrays are always
-                dense and C-contiguous, so ``"F"``/``"A"`` raise rather than silently lie.
+            order: Memory layout. Only ``"K"``/``"C"`` are meaningful: the result is always a new
+                dense, C-contiguous array, so ``"F"``/``"A"`` raise rather than silently lie.
             casting: Casting rule, checked against :func:`numpy.can_cast`. Defaults to
                 ``"unsafe"``, matching NumPy.
             subok: Accepted for signature compatibility; asnumpy has no ndarray subclasses to
@@ -199,7 +313,7 @@ class ndarray(_ndarray):
         dtype = np.dtype(dtype)
         if order not in ("K", "C"):
             raise ValueError(
-                f"order={order!r} is not supported: asnumpy arrays are always C-contiguous"
+                f"order={order!r} is not supported: astype always returns a C-contiguous array"
             )
         if not subok:
             raise ValueError("subok=False is not supported")
@@ -209,12 +323,125 @@ class ndarray(_ndarray):
                 f"according to the rule '{casting}'"
             )
         if dtype == self.dtype:
-            # CastTo would deep-copy on a dtype match, and re-wrapping copies again -- two device
-            # copies for what is at most one. Short-circuit to a single copy (or none).
+            # ndarray(self) is a copy-on-write copy: no device memory is used until one of the
+            # two arrays is written. Skip CastTo, which would only add a second wrapper.
             return ndarray(self) if copy else self
         return ndarray(super().astype(dtype))
 
 
+class DeviceScalar(ndarray):
+    """0-d result of a whole-array reduction (``ap.sum(a)``, ``ap.max(a)``, ``ap.mean(a)``, ...).
+
+    The value stays on the device, so ``a / ap.sum(a)`` runs without a host round trip and keeps
+    the reduction's dtype (int64 and complex results are not squeezed through a double). Only
+    turning it into a host value -- ``float()``, ``int()``, ``complex()``, ``bool()``, a
+    comparison with a host value, formatting or ``np.asarray`` -- waits for the device and copies
+    the one element back. Nothing is cached: an in-place update of the scalar is seen by the next
+    read. Compared with an asnumpy array it gives an element-wise result on the device, as
+    ``ap.equal`` and friends do. Use ``item()`` for a hashable value.
+    """
+
+    def item(self):
+        """The value as a NumPy scalar of the array's dtype."""
+        return self.to_numpy()[()]
+
+    def __array__(self, dtype=None, copy=None):
+        return np.asarray(self.to_numpy(), dtype=dtype)
+
+    def __float__(self) -> float:
+        return float(self.item())
+
+    def __int__(self) -> int:
+        return int(self.item())
+
+    def __index__(self) -> int:
+        return operator.index(self.item())
+
+    def __complex__(self) -> complex:
+        return complex(self.item())
+
+    def __bool__(self) -> bool:
+        return bool(self.item())
+
+    def _compare(self, other, op, name: str):
+        if isinstance(other, DeviceScalar):
+            other = other.item()
+        elif isinstance(other, _ndarray):
+            # Against an array the comparison is element-wise and stays on the device.
+            return _call_public(name, self, other)
+        return op(self.item(), other)
+
+    def __eq__(self, other):
+        return self._compare(other, operator.eq, "equal")
+
+    def __ne__(self, other):
+        return self._compare(other, operator.ne, "not_equal")
+
+    def __lt__(self, other):
+        return self._compare(other, operator.lt, "less")
+
+    def __le__(self, other):
+        return self._compare(other, operator.le, "less_equal")
+
+    def __gt__(self, other):
+        return self._compare(other, operator.gt, "greater")
+
+    def __ge__(self, other):
+        return self._compare(other, operator.ge, "greater_equal")
+
+    # Unhashable like ndarray: the value can change in place, and hashing would sync the device.
+    __hash__ = None
+
+    def __format__(self, format_spec: str) -> str:
+        return format(self.item(), format_spec)
+
+    def __repr__(self) -> str:
+        return repr(self.item())
+
+    def __str__(self) -> str:
+        return str(self.item())
+
+
+class Transfer:
+    """Handle of a copy started by :meth:`ndarray.from_numpy_async` or
+    :meth:`ndarray.to_numpy_async`.
+
+    Poll it with :meth:`done`, block with :meth:`result`, or ``await`` it from asyncio. The host
+    array involved in the copy is kept alive until the copy has finished. In blocking execution
+    mode the copy has already finished when the handle is returned.
+    """
+
+    def __init__(self, handle, array) -> None:
+        self._handle = handle
+        self._array = array
+
+    @property
+    def array(self):
+        """The destination array. A device array can be used by operators before the copy is
+        done; a host array must not be read until :meth:`done` is true."""
+        return self._array
+
+    def done(self) -> bool:
+        return self._handle.done()  # type: ignore[no-any-return]
+
+    @logger.catch(reraise=True)
+    def result(self):
+        """Wait for the copy and return the destination array."""
+        self._handle.wait()
+        return self._array
+
+    def __await__(self):
+        if not self._handle.done():
+            # The wait releases the GIL, so a worker thread keeps the event loop responsive.
+            loop = asyncio.get_running_loop()
+            yield from loop.run_in_executor(None, self._handle.wait).__await__()
+        return self.result()
+
+
+def _call_public(name: str, *args, **kwargs):
+    return getattr(anp, name)(*args, **kwargs)
+
+
 @logger.catch(reraise=True)
 def broadcast_shape(shape_a: Sequence[int], shape_b: Sequence[int]) -> tuple:
     logger.debug(f"Broadcasting shapes {shape_a}, {shape_b}")
@@ -255,3 +482,28 @@ def _normalize_shape(shape: int | Sequence[int]) -> list[int]:
         raise ValueError("negative dimensions are not allowed")
 
     return normalized
+
+
+def _normalize_axes(axes: int | Sequence[int] | None) -> list[int] | None:
+    """Normalize an axis, axes or shape argument to a list of ints; negatives are kept."""
+    if axes is None:
+        return None
+    if isinstance(axes, (int, np.integer)):
+        return [operator.index(axes)]
+    return [operator.index(axis) for axis in axes]
+
+
+def _reduction_where(where: Any) -> Optional[_ndarray]:
+    """Normalize a reduction's where= mask to a boolean device array (None selects everything)."""
+    if where is None or where is True:
+        return None
+    if isinstance(where, _ndarray):
+        return where
+    return ndarray.from_numpy(np.asarray(where, dtype=np.bool_))
+
+
+def _reduction_result(result: _ndarray) -> ndarray:
+    """Wrap a reduction result; a 0-d one stays on the device as a DeviceScalar."""
+    if tuple(result.shape) == ():
+        return DeviceScalar(result)
+    return ndarray(result)
@@ -0,0 +1,123 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for the caching device allocator behind NPUArray."""
+
+import threading
+
+import numpy as np
+
+import asnumpy as ap
+
+
+def test_memory_stats_reports_allocator_counters():
+    stats = ap.cann.memory_stats()
+
+    for key in (
+        "reserved_bytes",
+        "allocated_bytes",
+        "peak_reserved_bytes",
+        "peak_allocated_bytes",
+        "device_malloc_count",
+        "device_free_count",
+    ):
+        assert key in stats
+    assert stats["allocated_bytes"] <= stats["reserved_bytes"]
+    assert stats["peak_allocated_bytes"] >= stats["allocated_bytes"]
+
+
+def test_freed_buffers_are_reused_without_device_malloc():
+    """Same-size temporaries in a loop must be served from the cache, not aclrtMalloc."""
+    x = ap.ndarray.from_numpy(np.ones((256, 256), dtype=np.float32))
+    ap.sin(x)  # warm the cache for this size class
+
+    before = ap.cann.memory_stats()["device_malloc_count"]
+    for _ in range(20):
+        y = ap.sin(x)
+        del y
+    after = ap.cann.memory_stats()["device_malloc_count"]
+
+    assert after == before
+
+
+def test_allocated_bytes_track_live_arrays():
+    before = ap.cann.memory_stats()["allocated_bytes"]
+    x = ap.zeros((1024, 1024), dtype=np.float32)
+    during = ap.cann.memory_stats()["allocated_bytes"]
+    del x
+    after = ap.cann.memory_stats()["allocated_bytes"]
+
+    assert during - before >= 1024 * 1024 * 4
+    assert after == before
+
+
+def test_empty_cache_releases_unused_segments():
+    x = ap.zeros((4096, 1024), dtype=np.float32)
+    del x
+    reserved = ap.cann.memory_stats()["reserved_bytes"]
+
+    ap.cann.empty_cache()
+
+    stats = ap.cann.memory_stats()
+    assert stats["reserved_bytes"] < reserved
+    assert stats["reserved_bytes"] >= stats["allocated_bytes"]
+
+
+def test_arrays_stay_valid_across_empty_cache():
+    host = np.arange(1000, dtype=np.float32)
+    x = ap.ndarray.from_numpy(host)
+
+    ap.cann.empty_cache()
+
+    np.testing.assert_array_equal(x.to_numpy(), host)
+
+
+def test_empty_cache_concurrent_with_allocation_does_not_deadlock():
+    """empty_cache waits for the device without the allocator lock, so a thread that holds the GIL
+    and is allocating cannot block it from taking the GIL back."""
+    ap.cann.set_execution_mode("async")
+    errors = []
+
+    def run(body):
+        def target():
+            try:
+                for _ in range(50):
+                    body()
+            except Exception as exc:  # surfaced by the assertion below
+                errors.append(exc)
+
+        return threading.Thread(target=target, daemon=True)
+
+    def release():
+        x = ap.zeros((2048, 1024), dtype=np.float32)
+        del x
+        ap.cann.empty_cache()
+
+    def allocate():
+        x = ap.ndarray.from_numpy(np.ones((512, 512), dtype=np.float32))
+        ap.add(ap.multiply(x, 0.5), 1.0)
+
+    threads = [run(release), run(allocate)]
+    try:
+        for thread in threads:
+            thread.start()
+        for thread in threads:
+            thread.join(timeout=120)
+    finally:
+        ap.cann.set_execution_mode("blocking")
+
+    assert not any(thread.is_alive() for thread in threads), "empty_cache deadlocked"
+    assert not errors
@@ -0,0 +1,96 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for the chunked host transfer pipeline and its throughput counters."""
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+
+
+@pytest.mark.parametrize("shape", [(1000, 37), (5, 4, 3), (7,)])
+def test_iter_numpy_chunks_reassembles_array(shape):
+    host = np.random.rand(*shape).astype(np.float32)
+    x = ap.ndarray.from_numpy(host)
+
+    chunks = list(x.iter_numpy_chunks(chunk_bytes=4096))
+
+    assert all(c.shape[1:] == host.shape[1:] for c in chunks)
+    np.testing.assert_array_equal(np.concatenate(chunks), host)
+
+
+def test_iter_numpy_chunks_keeps_whole_rows():
+    host = np.arange(64 * 100, dtype=np.int32).reshape(64, 100)  # 400-byte rows
+    x = ap.ndarray.from_numpy(host)
+
+    chunks = list(x.iter_numpy_chunks(chunk_bytes=1000))
+
+    assert [c.shape[0] for c in chunks[:-1]] == [2] * (len(chunks) - 1)
+    np.testing.assert_array_equal(np.concatenate(chunks), host)
+
+
+def test_iter_numpy_chunks_of_view():
+    host = np.arange(30 * 20, dtype=np.float32).reshape(30, 20)
+    x = ap.ndarray.from_numpy(host)
+
+    chunks = list(x.T.iter_numpy_chunks(chunk_bytes=256))
+
+    np.testing.assert_array_equal(np.concatenate(chunks), host.T)
+
+
+def test_iter_numpy_chunks_of_0d_and_empty():
+    scalar = ap.ndarray.from_numpy(np.array(3.5, dtype=np.float32))
+    empty = ap.ndarray.from_numpy(np.zeros((0, 4), dtype=np.float32))
+
+    assert [c.item() for c in scalar.iter_numpy_chunks()] == [3.5]
+    assert list(empty.iter_numpy_chunks()) == []
+
+
+def test_abandoned_iteration():
+    x = ap.ndarray.from_numpy(np.ones((4096, 1024), dtype=np.float32))
+
+    it = x.iter_numpy_chunks(chunk_bytes=1 << 20)
+    first = next(it)
+    del it
+
+    np.testing.assert_array_equal(first, np.ones((256, 1024), dtype=np.float32))
+
+
+def test_large_transfers_report_throughput():
+    host = np.random.rand(4 * 1024 * 1024 + 3).astype(np.float32)  # 16 MiB and a bit: 3 chunks
+    ap.cann.synchronize()  # settle transfers of earlier tests
+    before = ap.cann.transfer_stats()["transfer_count"]
+
+    x = ap.ndarray.from_numpy(host)
+    np.testing.assert_array_equal(x.to_numpy(), host)
+    ap.cann.synchronize()
+
+    stats = ap.cann.transfer_stats()
+    assert stats["transfer_count"] == before + 2
+    assert stats["last_bytes"] == host.nbytes
+    assert stats["last_direction"] == "device_to_host"
+    assert stats["last_gbps"] > 0
+    assert stats["average_gbps"] > 0
+
+
+def test_staging_memory_is_bounded_by_chunks():
+    """A transfer much larger than a chunk must not pin memory proportional to its size."""
+    host = np.zeros(64 * 1024 * 1024, dtype=np.uint8)
+    ap.cann.empty_pinned_cache()
+    ap.ndarray.from_numpy(host).to_numpy()
+
+    assert ap.cann.pinned_memory_stats()["reserved_bytes"] < host.nbytes
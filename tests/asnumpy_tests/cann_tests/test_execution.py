@@ -0,0 +1,111 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for blocking and asynchronous execution modes."""
+
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+
+
+@pytest.fixture
+def async_mode():
+    ap.cann.set_execution_mode("async")
+    yield
+    ap.cann.set_execution_mode("blocking")
+
+
+def test_default_mode_is_blocking():
+    assert ap.cann.get_execution_mode() == "blocking"
+
+
+def test_async_results_match_blocking(async_mode):
+    a = np.random.rand(64, 64).astype(np.float32)
+    b = np.random.rand(64, 64).astype(np.float32)
+    x = ap.ndarray.from_numpy(a)
+    y = ap.ndarray.from_numpy(b)
+
+    result = x
+    for _ in range(20):  # a chain of temporaries, none of them observed on the host
+        result = ap.add(ap.multiply(result, y), x)
+
+    expected = a
+    for _ in range(20):
+        expected = expected * b + a
+    np.testing.assert_allclose(result.to_numpy(), expected, rtol=1e-4)
+
+
+def test_async_sum_stays_on_device(async_mode):
+    a = np.random.rand(128).astype(np.float32)
+    x = ap.ndarray.from_numpy(a)
+
+    total = ap.sum(ap.exp(x))
+
+    assert isinstance(total, ap.ndarray) and total.shape == ()
+    np.testing.assert_allclose(float(total), np.exp(a).sum(), rtol=1e-4)
+
+
+def test_synchronize_and_mode_switch(async_mode):
+    x = ap.ndarray.from_numpy(np.ones((16, 16), dtype=np.float32))
+    y = ap.sin(x)
+    ap.cann.synchronize()
+    assert ap.cann.get_execution_mode() == "async"
+
+    ap.cann.set_execution_mode("blocking")
+
+    assert ap.cann.get_execution_mode() == "blocking"
+    np.testing.assert_allclose(y.to_numpy(), np.sin(np.ones((16, 16))), rtol=1e-5)
+
+
+def test_unknown_mode_is_rejected():
+    with pytest.raises(ValueError):
+        ap.cann.set_execution_mode("eager")
+    assert ap.cann.get_execution_mode() == "blocking"
+
+
+def _chain(seed, own_stream):
+    host = np.random.default_rng(seed).random((256, 256), dtype=np.float32)
+    if own_stream:
+        with ap.cann.Stream():
+            x = ap.ndarray.from_numpy(host)
+            for _ in range(10):
+                x = ap.add(ap.multiply(x, 0.5), 1.0)
+            return host, x.to_numpy()
+    x = ap.ndarray.from_numpy(host)
+    for _ in range(10):
+        x = ap.add(ap.multiply(x, 0.5), 1.0)
+    return host, x.to_numpy()
+
+
+@pytest.mark.parametrize("mode", ["blocking", "async"])
+@pytest.mark.parametrize("own_stream", [False, True])
+def test_concurrent_submitters_get_their_own_results(mode, own_stream):
+    """Worker threads never call set_device; each must still get exactly its own results."""
+    ap.cann.set_execution_mode(mode)
+    try:
+        with ThreadPoolExecutor(max_workers=4) as pool:
+            results = list(pool.map(lambda seed: _chain(seed, own_stream), range(16)))
+    finally:
+        ap.cann.set_execution_mode("blocking")
+
+    for host, got in results:
+        expected = host
+        for _ in range(10):
+            expected = expected * 0.5 + 1.0
+        np.testing.assert_allclose(got, expected, rtol=1e-5)
@@ -0,0 +1,128 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for the executor cache keyed on operator signature."""
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+
+
+@pytest.fixture
+def executor_cache():
+    """Start from an empty cache at its default capacity and restore it afterwards."""
+    capacity = ap.cann.executor_cache_stats()["capacity"]
+    ap.cann.clear_executor_cache()
+    yield
+    ap.cann.set_executor_cache_capacity(capacity)
+    ap.cann.clear_executor_cache()
+
+
+def _delta(before, after, key):
+    return after[key] - before[key]
+
+
+def test_repeated_unary_op_hits(executor_cache):
+    host = np.linspace(-3, 3, 1024, dtype=np.float32)
+    x = ap.ndarray.from_numpy(host)
+    ap.sin(x)
+    before = ap.cann.executor_cache_stats()
+
+    for _ in range(3):
+        result = ap.sin(x)
+
+    after = ap.cann.executor_cache_stats()
+    if after["uncacheable"] > before["uncacheable"]:
+        pytest.skip("aclnnSin executors are not repeatable on this CANN version")
+    assert _delta(before, after, "hits") == 3
+    assert _delta(before, after, "misses") == 0
+    np.testing.assert_allclose(result.to_numpy(), np.sin(host), rtol=1e-5, atol=1e-6)
+
+
+def test_hit_rebinds_new_operands(executor_cache):
+    """A hit with different arrays of the same layout must read and write the new addresses."""
+    a = np.arange(256, dtype=np.float32)
+    b = np.full(256, 2.0, dtype=np.float32)
+    ap.multiply(ap.ndarray.from_numpy(a), ap.ndarray.from_numpy(a))
+    before = ap.cann.executor_cache_stats()
+
+    result = ap.multiply(ap.ndarray.from_numpy(a), ap.ndarray.from_numpy(b))
+
+    after = ap.cann.executor_cache_stats()
+    assert _delta(before, after, "hits") + _delta(before, after, "uncacheable") == 1
+    np.testing.assert_array_equal(result.to_numpy(), a * b)
+
+
+def test_different_shape_misses(executor_cache):
+    x = ap.ndarray.from_numpy(np.ones(64, dtype=np.float32))
+    y = ap.ndarray.from_numpy(np.ones(65, dtype=np.float32))
+    ap.sin(x)
+    before = ap.cann.executor_cache_stats()
+
+    ap.sin(y)
+
+    after = ap.cann.executor_cache_stats()
+    assert _delta(before, after, "misses") == 1
+    assert _delta(before, after, "hits") == 0
+
+
+def test_view_layout_is_part_of_the_key(executor_cache):
+    host = np.arange(64, dtype=np.float32).reshape(8, 8)
+    x = ap.ndarray.from_numpy(host)
+    ap.sin(x)
+
+    before = ap.cann.executor_cache_stats()
+    result = ap.sin(x.T)
+    after = ap.cann.executor_cache_stats()
+
+    assert _delta(before, after, "misses") == 1
+    np.testing.assert_allclose(result.to_numpy(), np.sin(host.T), rtol=1e-5, atol=1e-6)
+
+
+def test_zero_capacity_disables_cache(executor_cache):
+    ap.cann.set_executor_cache_capacity(0)
+    x = ap.ndarray.from_numpy(np.ones(32, dtype=np.float32))
+    before = ap.cann.executor_cache_stats()
+
+    ap.sin(x)
+    ap.sin(x)
+
+    after = ap.cann.executor_cache_stats()
+    assert after["entries"] == 0
+    assert _delta(before, after, "hits") == 0
+    assert _delta(before, after, "misses") == 0
+
+
+def test_capacity_evicts_least_recently_used(executor_cache):
+    ap.cann.set_executor_cache_capacity(1)
+    x = ap.ndarray.from_numpy(np.ones(16, dtype=np.float32))
+    y = ap.ndarray.from_numpy(np.ones(17, dtype=np.float32))
+    ap.sin(x)
+    ap.sin(y)
+
+    stats = ap.cann.executor_cache_stats()
+    assert stats["entries"] <= 1
+    if stats["uncacheable"] == 0:
+        assert stats["evictions"] >= 1
+
+
+def test_clear_drops_entries(executor_cache):
+    ap.sin(ap.ndarray.from_numpy(np.ones(8, dtype=np.float32)))
+
+    ap.cann.clear_executor_cache()
+
+    assert ap.cann.executor_cache_stats()["entries"] == 0
@@ -0,0 +1,124 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for capturing operator sequences into a graph and replaying them."""
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+
+
+def _capture_or_skip(*inputs):
+    try:
+        with ap.cann.graph() as probe:
+            pass
+    except Exception as e:  # CannError when the runtime lacks aclmdlRICapture
+        pytest.skip(f"graph capture is not supported by this CANN runtime: {e}")
+    del probe
+    return ap.cann.graph(*inputs)
+
+
+def test_replay_runs_captured_sequence():
+    host = np.linspace(-2, 2, 512, dtype=np.float32)
+    x = ap.ndarray.from_numpy(host)
+
+    with _capture_or_skip(x) as g:
+        y = ap.multiply(ap.sin(x), x)
+    g.replay()
+
+    assert g.launch_count >= 2
+    np.testing.assert_allclose(y.to_numpy(), np.sin(host) * host, rtol=1e-5, atol=1e-6)
+
+
+def test_replay_with_new_inputs_overwrites_results():
+    first = np.arange(64, dtype=np.float32)
+    second = np.full(64, 0.5, dtype=np.float32)
+    x = ap.ndarray.from_numpy(first)
+
+    with _capture_or_skip(x) as g:
+        y = ap.sin(x)
+    g.replay()
+    np.testing.assert_allclose(y.to_numpy(), np.sin(first), rtol=1e-5, atol=1e-6)
+
+    g.replay(ap.ndarray.from_numpy(second))
+    np.testing.assert_allclose(y.to_numpy(), np.sin(second), rtol=1e-5, atol=1e-6)
+    np.testing.assert_array_equal(x.to_numpy(), second)
+
+
+def test_replay_rejects_different_shape():
+    x = ap.ndarray.from_numpy(np.ones((4, 8), dtype=np.float32))
+    with _capture_or_skip(x) as g:
+        ap.sin(x)
+
+    with pytest.raises(ValueError):
+        g.replay(ap.ndarray.from_numpy(np.ones((8, 4), dtype=np.float32)))
+
+
+def test_replay_rejects_different_dtype():
+    x = ap.ndarray.from_numpy(np.ones(16, dtype=np.float32))
+    with _capture_or_skip(x) as g:
+        ap.sin(x)
+
+    with pytest.raises(ValueError):
+        g.replay(ap.ndarray.from_numpy(np.ones(16, dtype=np.float16)))
+
+
+def test_replay_rejects_wrong_number_of_inputs():
+    x = ap.ndarray.from_numpy(np.ones(16, dtype=np.float32))
+    with _capture_or_skip(x) as g:
+        ap.sin(x)
+
+    with pytest.raises(ValueError):
+        g.replay(x, x)
+
+
+def test_waiting_for_the_device_inside_capture_raises():
+    x = ap.ndarray.from_numpy(np.ones(16, dtype=np.float32))
+
+    with pytest.raises(RuntimeError):
+        with _capture_or_skip(x):
+            ap.sin(x).to_numpy()
+
+    # The failed capture is discarded and the thread is back on its own stream.
+    np.testing.assert_allclose(ap.sin(x).to_numpy(), np.sin(np.ones(16, dtype=np.float32)), rtol=1e-6)
+
+
+def test_captured_results_are_not_shared_by_copies():
+    x = ap.ndarray.from_numpy(np.arange(8, dtype=np.float32))
+    with _capture_or_skip(x) as g:
+        y = ap.sin(x)
+    g.replay()
+    snapshot = ap.ndarray(y)
+
+    g.replay(ap.ndarray.from_numpy(np.zeros(8, dtype=np.float32)))
+
+    np.testing.assert_allclose(snapshot.to_numpy(), np.sin(np.arange(8, dtype=np.float32)), rtol=1e-6)
+
+
+def test_run_returns_fresh_outputs():
+    first = np.arange(32, dtype=np.float32)
+    second = np.full(32, 2.0, dtype=np.float32)
+    x = ap.ndarray.from_numpy(first)
+
+    with _capture_or_skip(x) as g:
+        y = ap.multiply(x, x)
+    g.set_outputs(y)
+
+    (out1,) = g.run()
+    (out2,) = g.run(ap.ndarray.from_numpy(second))
+    np.testing.assert_allclose(out1.to_numpy(), first * first)
+    np.testing.assert_allclose(out2.to_numpy(), second * second)
@@ -0,0 +1,102 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for the pinned host staging pool used by host <-> device transfers."""
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+
+
+def test_large_round_trip_through_staging():
+    """Above the staging threshold both directions are chunked through pinned buffers."""
+    host = np.random.rand(3 * 1024 * 1024 + 7).astype(np.float32)  # ~12 MiB, not chunk-aligned
+    x = ap.ndarray.from_numpy(host)
+
+    np.testing.assert_array_equal(x.to_numpy(), host)
+
+
+def test_to_numpy_into_pinned_out():
+    host = np.arange(4096 * 64, dtype=np.float32).reshape(4096, 64)
+    x = ap.ndarray.from_numpy(host)
+    buf = ap.cann.pinned_empty((4096, 64), np.float32)
+
+    result = x.to_numpy(out=buf)
+
+    assert result is buf
+    np.testing.assert_array_equal(buf, host)
+
+
+def test_to_numpy_into_pinned_out_from_view():
+    host = np.arange(24, dtype=np.int32).reshape(4, 6)
+    x = ap.ndarray.from_numpy(host)
+    buf = ap.cann.pinned_empty((6, 4), np.int32)
+
+    x.T.to_numpy(out=buf)
+
+    np.testing.assert_array_equal(buf, host.T)
+
+
+def test_from_pinned_numpy():
+    buf = ap.cann.pinned_empty(1000, np.float64)
+    buf[:] = np.linspace(0, 1, 1000)
+
+    np.testing.assert_array_equal(ap.ndarray.from_numpy(buf).to_numpy(), buf)
+
+
+def test_repeated_transfers_reuse_pinned_buffers():
+    host = np.ones((1024, 1024), dtype=np.float32)  # 4 MiB: staged
+    x = ap.ndarray.from_numpy(host)
+    x.to_numpy()  # warm the pool
+
+    before = ap.cann.pinned_memory_stats()["host_malloc_count"]
+    for _ in range(5):
+        ap.ndarray.from_numpy(host).to_numpy()
+    after = ap.cann.pinned_memory_stats()["host_malloc_count"]
+
+    assert after == before
+
+
+def test_pinned_buffers_return_to_pool():
+    stats = ap.cann.pinned_memory_stats()
+    assert stats["allocated_bytes"] <= stats["reserved_bytes"]
+
+    before = stats["allocated_bytes"]
+    buf = ap.cann.pinned_empty((1024, 1024), np.float32)
+    assert ap.cann.pinned_memory_stats()["allocated_bytes"] >= before + buf.nbytes
+    del buf
+    assert ap.cann.pinned_memory_stats()["allocated_bytes"] == before
+
+    ap.cann.empty_pinned_cache()
+    stats = ap.cann.pinned_memory_stats()
+    assert stats["reserved_bytes"] >= stats["allocated_bytes"]
+
+
+@pytest.mark.parametrize(
+    "out",
+    [
+        np.empty((3, 4), dtype=np.float32),
+        np.empty((4, 3), dtype=np.float64),
+        np.empty((4, 3), dtype=np.float32, order="F"),
+        [0.0] * 12,
+    ],
+)
+def test_to_numpy_rejects_mismatched_out(out):
+    x = ap.ndarray.from_numpy(np.zeros((4, 3), dtype=np.float32))
+
+    with pytest.raises(ValueError):
+        x.to_numpy(out=out)
@@ -0,0 +1,105 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for the stream pool and cross-stream dependencies."""
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+
+
+@pytest.fixture
+def async_mode():
+    ap.cann.set_execution_mode("async")
+    yield
+    ap.cann.set_execution_mode("blocking")
+
+
+def test_ops_inside_stream_blocking():
+    a = np.random.rand(32, 32).astype(np.float32)
+    x = ap.ndarray.from_numpy(a)
+
+    with ap.cann.Stream():
+        y = ap.sin(x)
+
+    np.testing.assert_allclose(y.to_numpy(), np.sin(a), rtol=1e-5)
+
+
+def test_independent_chains_on_two_streams(async_mode):
+    a = np.random.rand(256, 256).astype(np.float32)
+    b = np.random.rand(256, 256).astype(np.float32)
+    x = ap.ndarray.from_numpy(a)
+    y = ap.ndarray.from_numpy(b)
+    s1, s2 = ap.cann.Stream(), ap.cann.Stream()
+
+    with s1:
+        u = x
+        for _ in range(10):
+            u = ap.add(ap.multiply(u, x), x)
+    with s2:
+        v = y
+        for _ in range(10):
+            v = ap.subtract(ap.multiply(v, y), y)
+
+    eu, ev = a, b
+    for _ in range(10):
+        eu = eu * a + a
+        ev = ev * b - b
+    np.testing.assert_allclose(u.to_numpy(), eu, rtol=1e-4)
+    np.testing.assert_allclose(v.to_numpy(), ev, rtol=1e-4)
+
+
+def test_cross_stream_read_waits_for_writer(async_mode):
+    a = np.random.rand(512, 512).astype(np.float32)
+    x = ap.ndarray.from_numpy(a)
+    producer, consumer = ap.cann.Stream(), ap.cann.Stream()
+
+    with producer:
+        w = x
+        for _ in range(20):  # keep the producer busy so the consumer would otherwise run first
+            w = ap.add(w, x)
+    with consumer:
+        r = ap.multiply(w, x)
+
+    np.testing.assert_allclose(r.to_numpy(), (a * 21) * a, rtol=1e-4)
+
+
+def test_nested_streams_and_synchronize(async_mode):
+    x = ap.ndarray.from_numpy(np.ones((16, 16), dtype=np.float32))
+    outer, inner = ap.cann.Stream(), ap.cann.Stream()
+
+    with outer:
+        with inner:
+            y = ap.exp(x)
+        z = ap.add(y, x)
+        outer.synchronize()
+    inner.synchronize()
+
+    np.testing.assert_allclose(z.to_numpy(), np.e + 1, rtol=1e-5)
+
+
+def test_memory_used_across_streams_is_reclaimed(async_mode):
+    ap.cann.synchronize()
+    baseline = ap.cann.memory_stats()["allocated_bytes"]
+
+    t = ap.ndarray.from_numpy(np.ones((1024, 1024), dtype=np.float32))  # default stream
+    with ap.cann.Stream():
+        y = ap.sin(t)  # t is now also in use on the pooled stream
+    del t, y
+    ap.cann.empty_cache()  # waits for the device, then reclaims the deferred block
+
+    assert ap.cann.memory_stats()["allocated_bytes"] == baseline
@@ -0,0 +1,105 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for asynchronous host <-> device transfers."""
+
+import asyncio
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+
+
+@pytest.fixture(params=["blocking", "async"])
+def execution_mode(request):
+    ap.cann.set_execution_mode(request.param)
+    yield request.param
+    ap.cann.set_execution_mode("blocking")
+
+
+def test_from_numpy_async_result(execution_mode):
+    host = np.random.rand(512, 512).astype(np.float32)
+
+    transfer = ap.ndarray.from_numpy_async(host)
+
+    np.testing.assert_array_equal(transfer.result().to_numpy(), host)
+    assert transfer.done()
+
+
+def test_to_numpy_async_result(execution_mode):
+    host = np.arange(6 * 7, dtype=np.int32).reshape(6, 7)
+    x = ap.ndarray.from_numpy(host)
+
+    transfer = x.to_numpy_async()
+
+    np.testing.assert_array_equal(transfer.result(), host)
+    np.testing.assert_array_equal(x.T.to_numpy_async().result(), host.T)
+
+
+def test_uploaded_array_chains_into_ops_before_copy_completes(execution_mode):
+    host = np.random.rand(1024, 256).astype(np.float32)
+
+    transfer = ap.ndarray.from_numpy_async(host)
+    y = ap.sin(transfer.array)
+
+    np.testing.assert_allclose(y.to_numpy(), np.sin(host), rtol=1e-5)
+
+
+def test_upload_on_stream_is_seen_by_other_stream(execution_mode):
+    host = np.random.rand(256, 256).astype(np.float32)
+    copy_stream = ap.cann.Stream()
+
+    transfer = ap.ndarray.from_numpy_async(host, stream=copy_stream)
+    with ap.cann.Stream():
+        y = ap.multiply(transfer.array, transfer.array)
+
+    np.testing.assert_allclose(y.to_numpy(), host * host, rtol=1e-5)
+
+
+def test_host_source_may_be_reused_after_call(execution_mode):
+    host = np.ones(4096, dtype=np.float32)
+
+    transfer = ap.ndarray.from_numpy_async(host)
+    host[:] = 2.0
+
+    np.testing.assert_array_equal(transfer.result().to_numpy(), np.ones(4096, dtype=np.float32))
+
+
+def test_pinned_source(execution_mode):
+    buf = ap.cann.pinned_empty((128, 128), np.float32)
+    buf[:] = np.random.rand(128, 128)
+
+    transfer = ap.ndarray.from_numpy_async(buf)
+
+    np.testing.assert_array_equal(transfer.result().to_numpy(), buf)
+
+
+def test_await_transfers(execution_mode):
+    batches = [np.random.rand(64, 64).astype(np.float32) for _ in range(4)]
+
+    async def pipeline():
+        results = []
+        pending = ap.ndarray.from_numpy_async(batches[0])
+        for i in range(len(batches)):
+            x = await pending
+            if i + 1 < len(batches):
+                pending = ap.ndarray.from_numpy_async(batches[i + 1])  # overlaps the compute below
+            results.append(await ap.add(x, x).to_numpy_async())
+        return results
+
+    for result, batch in zip(asyncio.run(pipeline()), batches):
+        np.testing.assert_allclose(result, batch + batch, rtol=1e-6)
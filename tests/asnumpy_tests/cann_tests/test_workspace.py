@@ -0,0 +1,71 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for the per-stream operator workspace arena."""
+
+import numpy as np
+
+import asnumpy as ap
+
+
+def test_steady_state_ops_do_not_grow_the_arena():
+    """Once the arena covers the largest workspace, repeated ops must not allocate workspace."""
+    x = ap.ndarray.from_numpy(np.random.rand(128, 128).astype(np.float32))
+    y = ap.ndarray.from_numpy(np.random.rand(128, 128).astype(np.float32))
+    for _ in range(2):  # warm up every workspace size used below
+        ap.add(ap.sin(x), y)
+        ap.sum(x, axis=0)
+
+    before = ap.cann.workspace_stats()
+    for _ in range(10):
+        ap.add(ap.sin(x), y)
+        ap.sum(x, axis=0)
+    after = ap.cann.workspace_stats()
+
+    assert after["grow_count"] == before["grow_count"]
+    assert after["lease_count"] >= before["lease_count"]
+
+
+def test_high_water_mark_is_covered_by_capacity():
+    """A stream's own arena, not the sum over all arenas, must cover what was launched on it."""
+    host = np.random.rand(64, 64).astype(np.float32)
+    with ap.cann.Stream():
+        before = ap.cann.workspace_stats(current_stream=True)
+        target = max(before["capacity_bytes"], before["high_water_bytes"]) + (4 << 20)
+        ap.cann.reserve_workspace(target)
+        x = ap.ndarray.from_numpy(host)
+        result = ap.sum(ap.sin(x), axis=1).to_numpy()
+        after = ap.cann.workspace_stats(current_stream=True)
+
+    np.testing.assert_allclose(result, np.sin(host).sum(axis=1), rtol=1e-4)
+    assert after["capacity_bytes"] >= target
+    assert after["capacity_bytes"] >= after["high_water_bytes"]
+    # The reservation grew the arena once; the launches fit without growing it again.
+    assert after["grow_count"] == before["grow_count"] + 1
+
+
+def test_reserve_workspace_presizes_the_arena():
+    target = ap.cann.workspace_stats()["high_water_bytes"] + (4 << 20)
+
+    ap.cann.reserve_workspace(target)
+
+    stats = ap.cann.workspace_stats(current_stream=True)
+    assert stats["capacity_bytes"] >= target
+    grow_count = stats["grow_count"]
+    host = np.ones((32, 32), dtype=np.float32)
+    x = ap.ndarray.from_numpy(host)
+    np.testing.assert_allclose(ap.sin(x).to_numpy(), np.sin(host), rtol=1e-5)
+    assert ap.cann.workspace_stats()["grow_count"] == grow_count
@@ -0,0 +1,71 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for copy-on-write copies: ndarray(existing) and astype(copy=True)."""
+
+import numpy as np
+
+import asnumpy as ap
+
+
+def _allocated():
+    return ap.cann.memory_stats()["allocated_bytes"]
+
+
+def test_copy_shares_buffer_until_written():
+    x = np.arange(1 << 16, dtype=np.float32)
+    a = ap.ndarray.from_numpy(x)
+    before = _allocated()
+
+    b = ap.ndarray(a)
+    c = a.astype(np.float32, copy=True)
+
+    assert _allocated() == before
+    assert not ap.may_share_memory(a, b)
+    np.testing.assert_array_equal(b.to_numpy(), x)
+    np.testing.assert_array_equal(c.to_numpy(), x)
+
+
+def test_copy_outlives_source():
+    x = np.arange(10, dtype=np.int32)
+    a = ap.ndarray.from_numpy(x)
+    b = ap.ndarray(a)
+    del a
+    np.testing.assert_array_equal(b.to_numpy(), x)
+
+
+def test_copy_of_partial_view_is_compact():
+    a = ap.ndarray.from_numpy(np.arange(1 << 16, dtype=np.float32))
+    before = _allocated()
+
+    b = ap.ndarray(a[:16])
+
+    # Only the 16 elements are copied; the copy does not pin the 256 KiB source buffer.
+    assert before < _allocated() <= before + (1 << 16)
+    np.testing.assert_array_equal(b.to_numpy(), np.arange(16, dtype=np.float32))
+
+
+def test_read_only_ops_do_not_duplicate():
+    x = np.random.rand(64, 64).astype(np.float32)
+    a = ap.ndarray.from_numpy(x)
+    b = ap.ndarray(a)
+    before = _allocated()
+
+    y = ap.sin(b)
+
+    # The output alone; a duplicate of b would double it.
+    assert _allocated() - before < 2 * x.nbytes
+    np.testing.assert_allclose(y.to_numpy(), np.sin(x), rtol=1e-5)
@@ -29,6 +29,7 @@ import numpy as np
 import pytest
 
 import asnumpy as ap
+from asnumpy._core.testing import promote_types as _compiled_promote_types
 
 # dtypes that both map cleanly AND have working aclnn kernels for the ops exercised here
 PROMOTABLE = [
@@ -46,6 +47,9 @@ PROMOTABLE = [
 # every dtype the type layer claims to support, including ones whose kernels are missing
 ALL_SUPPORTED = PROMOTABLE + [np.uint16, np.uint32, np.uint64]
 
+# every dtype in the compiled promotion table
+ALL_NUMERIC = ALL_SUPPORTED + [np.complex64, np.complex128]
+
 
 def _arr(dtype, value=1):
     return ap.ndarray.from_numpy(np.full(4, value, dtype=dtype))
@@ -129,6 +133,36 @@ def test_mixed_dtype_binary_ops_match_numpy_values_and_dtype(op_name):
     np.testing.assert_allclose(got, want, rtol=1e-6)
 
 
+MIXED_PAIRS = [(d1, d2) for d1, d2 in itertools.product(PROMOTABLE, PROMOTABLE) if d1 is not d2]
+MIXED_OPS = ["add", "subtract", "multiply", "maximum", "greater", "less_equal"]
+
+
+@pytest.mark.parametrize("op_name", MIXED_OPS)
+@pytest.mark.parametrize("d1, d2", MIXED_PAIRS)
+def test_mixed_dtype_ops_match_numpy_with_or_without_casts(op_name, d1, d2):
+    """Every pair the kernel capability table leaves uncast, and the cast ones around them."""
+    host1 = np.array([0, 1, 2, 3]).astype(d1)
+    host2 = np.array([1, 1, 0, 1]).astype(d2)
+    got = getattr(ap, op_name)(ap.ndarray.from_numpy(host1), ap.ndarray.from_numpy(host2))
+    want = getattr(np, op_name)(host1, host2)
+    assert got.dtype == want.dtype
+    np.testing.assert_allclose(got.to_numpy(), want)
+
+
+def test_cast_stats_count_avoided_and_materialized_casts():
+    """float32 + int8 computes in float32 inside aclnnAdd; float32 + int32 needs float64 first."""
+    before = ap.cann.cast_stats()
+    ap.add(_arr(np.float32), _arr(np.int8))
+    after_native = ap.cann.cast_stats()
+    ap.add(_arr(np.float32), _arr(np.int32))
+    after_cast = ap.cann.cast_stats()
+
+    assert after_native["avoided"] == before["avoided"] + 1
+    assert after_native["materialized"] == before["materialized"]
+    assert after_cast["avoided"] == after_native["avoided"]
+    assert after_cast["materialized"] == after_native["materialized"] + 2
+
+
 def test_maximum_does_not_demote():
     """maximum used to take x2's dtype whenever x1 was int16/int32/int64, demoting the result."""
     got = ap.maximum(_arr(np.int32, 5), _arr(np.int8, 3))
@@ -219,6 +253,12 @@ def test_result_type_matches_numpy_for_dtypes_and_arrays(d1, d2):
     assert ap.result_type(_arr(d1), _arr(d2)) == want
 
 
+@pytest.mark.parametrize("d1, d2", list(itertools.product(ALL_NUMERIC, ALL_NUMERIC)))
+def test_compiled_promotion_table_matches_numpy(d1, d2):
+    """ResultType is a compiled table, not a call into NumPy; every cell must still agree."""
+    assert _compiled_promote_types(np.dtype(d1), np.dtype(d2)) == np.result_type(d1, d2)
+
+
 @pytest.mark.parametrize("casting", ["no", "equiv", "safe", "same_kind", "unsafe"])
 def test_can_cast_matches_numpy(casting):
     for d1, d2 in itertools.product(PROMOTABLE, PROMOTABLE):
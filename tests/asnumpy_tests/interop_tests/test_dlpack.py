@@ -0,0 +1,102 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for DLPack export (__dlpack__) and import (from_dlpack)."""
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+from asnumpy._core import from_dlpack as _core_from_dlpack
+
+from .helpers import assert_numpy_equal
+
+
+def test_dlpack_device_is_npu():
+    x = ap.zeros((2, 3), dtype=np.float32)
+
+    device_type, device_id = x.__dlpack_device__()
+
+    assert device_type == 12  # kDLExtDev
+    assert isinstance(device_id, int)
+
+
+@pytest.mark.parametrize("dtype", [np.bool_, np.int8, np.int32, np.int64, np.uint8, np.float16,
+                                   np.float32, np.float64, np.complex64])
+def test_round_trip_shares_memory(dtype):
+    host = (np.arange(24) % 5).astype(dtype).reshape(4, 6)
+    x = ap.ndarray.from_numpy(host)
+
+    y = ap.from_dlpack(x)
+
+    assert ap.may_share_memory(x, y)
+    assert_numpy_equal(y, host)
+
+
+def test_round_trip_of_view():
+    host = np.arange(60, dtype=np.float32).reshape(5, 12)
+    x = ap.ndarray.from_numpy(host)[1:, ::3].T
+
+    y = ap.from_dlpack(x)
+
+    assert y.shape == (4, 4)
+    assert_numpy_equal(y, host[1:, ::3].T)
+
+
+def test_export_breaks_copy_on_write_sharing():
+    x = ap.ndarray.from_numpy(np.ones(16, dtype=np.float32))
+    before = ap.ndarray(x)
+    assert ap.may_share_memory(x, before)
+
+    capsule = x.__dlpack__()
+    after = ap.ndarray(x)
+
+    assert not ap.may_share_memory(x, before)
+    assert not ap.may_share_memory(x, after)
+    assert_numpy_equal(_core_from_dlpack(capsule), np.ones(16, dtype=np.float32))
+
+
+def test_capsule_can_be_consumed_once():
+    capsule = ap.zeros(4, dtype=np.float32).__dlpack__()
+    _core_from_dlpack(capsule)
+
+    with pytest.raises(ValueError):
+        _core_from_dlpack(capsule)
+
+
+def test_unconsumed_capsule_releases_export():
+    x = ap.zeros((256, 256), dtype=np.float32)
+    for _ in range(10):
+        x.__dlpack__()
+
+    assert_numpy_equal(x, np.zeros((256, 256), dtype=np.float32))
+
+
+def test_copy_export_does_not_alias():
+    x = ap.ndarray.from_numpy(np.arange(8, dtype=np.int32))
+
+    y = ap.ndarray(_core_from_dlpack(x.__dlpack__(copy=True)))
+
+    assert not ap.may_share_memory(x, y)
+    assert_numpy_equal(y, np.arange(8, dtype=np.int32))
+
+
+def test_from_dlpack_of_host_array_copies():
+    host = np.arange(10, dtype=np.float64)
+
+    y = ap.from_dlpack(host)
+
+    assert_numpy_equal(y, host)
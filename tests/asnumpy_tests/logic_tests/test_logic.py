@@ -873,6 +873,24 @@ def test_not_equal_scalar(xp, dtype):
     return xp.not_equal(a, 2.0)
 
 
+@testing.for_dtypes([numpy.float32, numpy.int32])
+@testing.numpy_asnumpy_array_equal()
+def test_less_scalar_first(xp, dtype):
+    """标量在左侧：2 < a 等价于 a > 2"""
+    data = [1, 2, 3]
+    a = _create_array(xp, data, dtype)
+    return xp.less(2, a)
+
+
+@testing.for_dtypes([numpy.int32])
+@testing.numpy_asnumpy_array_equal()
+def test_greater_int_array_float_scalar(xp, dtype):
+    """int 数组与 float 标量比较按 float64 计算，不截断标量 (NEP 50)"""
+    data = [1, 2, 3]
+    a = _create_array(xp, data, dtype)
+    return xp.greater(a, 2.5)
+
+
 # ---------- 4.6 空数组 ----------
 @testing.for_dtypes([numpy.float32])
 @testing.numpy_asnumpy_array_equal()
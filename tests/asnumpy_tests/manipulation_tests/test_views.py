@@ -0,0 +1,96 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for zero-copy views: reshape, transpose, slicing, expand_dims, squeeze, ravel."""
+
+import numpy
+import pytest
+
+import asnumpy as ap
+from asnumpy import testing
+
+
+@testing.for_float_dtypes()
+@testing.numpy_asnumpy_array_equal()
+def test_reshape(xp, dtype):
+    a = testing.shaped_arange((2, 3, 4), dtype=dtype, xp=xp)
+    return a.reshape(4, -1)
+
+
+@testing.numpy_asnumpy_array_equal()
+def test_transpose_then_reshape_copies(xp):
+    a = testing.shaped_arange((3, 4), dtype=numpy.float32, xp=xp)
+    return a.T.reshape(12)
+
+
+@testing.numpy_asnumpy_array_equal()
+def test_transpose_axes(xp):
+    a = testing.shaped_arange((2, 3, 4), dtype=numpy.float32, xp=xp)
+    return xp.transpose(a, (1, 2, 0))
+
+
+@testing.numpy_asnumpy_array_equal()
+def test_basic_slicing(xp):
+    a = testing.shaped_arange((4, 5, 6), dtype=numpy.float32, xp=xp)
+    return a[1:, ..., ::2][:, None, 3]
+
+
+@testing.numpy_asnumpy_array_equal()
+def test_negative_step_slicing(xp):
+    a = testing.shaped_arange((4, 6), dtype=numpy.float32, xp=xp)
+    return a[::-1, 4:0:-2]
+
+
+@testing.numpy_asnumpy_array_equal()
+def test_expand_dims_squeeze_ravel(xp):
+    a = testing.shaped_arange((3, 4), dtype=numpy.int32, xp=xp)
+    b = xp.expand_dims(a, (0, 2))
+    return xp.ravel(xp.squeeze(b, axis=0)[1:])
+
+
+def test_views_do_not_allocate():
+    a = ap.ndarray.from_numpy(numpy.arange(1 << 16, dtype=numpy.float32).reshape(256, 256))
+    before = ap.cann.memory_stats()["allocated_bytes"]
+
+    views = [a.reshape(-1), a.T, a[10:20, ::4], ap.expand_dims(a, 0), a[3]]
+
+    assert ap.cann.memory_stats()["allocated_bytes"] == before
+    assert all(ap.may_share_memory(a, v) for v in views)
+
+
+def test_view_keeps_storage_alive():
+    a = ap.ndarray.from_numpy(numpy.arange(12, dtype=numpy.float32))
+    v = a[2:5]
+    del a
+    numpy.testing.assert_array_equal(v.to_numpy(), [2, 3, 4])
+
+
+def test_ops_accept_strided_views():
+    x = numpy.random.rand(8, 6).astype(numpy.float32)
+    a = ap.ndarray.from_numpy(x)
+    numpy.testing.assert_allclose(ap.sin(a.T[::2]).to_numpy(), numpy.sin(x.T[::2]), rtol=1e-5)
+
+
+def test_invalid_indices():
+    a = ap.ndarray.from_numpy(numpy.zeros((2, 3), dtype=numpy.float32))
+    with pytest.raises(IndexError):
+        a[2]
+    with pytest.raises(IndexError):
+        a[0, 0, 0]
+    with pytest.raises(ValueError):
+        a.reshape(4, 2)
+    with pytest.raises(ValueError):
+        ap.squeeze(a, axis=0)
@@ -22,7 +22,9 @@
 """
 
 import numpy
+import pytest
 
+import asnumpy as ap
 from asnumpy import testing
 
 
@@ -150,3 +152,146 @@ def test_arithmetic_broadcasting(xp, dtype):
     a = _create_array(xp, [[1, 2, 3], [4, 5, 6]], dtype)
     b = _create_array(xp, [1, 0, 1], dtype)
     return xp.add(a, b)
+
+
+# ========== 标量运算 (scalar overloads, NEP 50) ==========
+
+
+@testing.for_dtypes([numpy.float32, numpy.int32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_arithmetic_array_scalar(xp, dtype):
+    """数组与 Python 标量运算：同类标量不改变数组 dtype"""
+    a = _create_array(xp, [1, 2, 3], dtype)
+    return xp.subtract(xp.multiply(xp.add(a, 2), 3), 1)
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_arithmetic_scalar_array(xp, dtype):
+    """标量在左侧：subtract/divide 不可交换"""
+    a = _create_array(xp, [1, 2, 4], dtype)
+    return xp.add(xp.subtract(10, a), xp.divide(8.0, a))
+
+
+@testing.for_dtypes([numpy.float16, numpy.float32, numpy.float64, numpy.int32])
+@testing.numpy_asnumpy_array_equal()
+def test_one_divided_by_array_is_exact(xp, dtype):
+    """1 / 数组：一次舍入，与 NumPy 逐位一致（1/3、1/49 等）"""
+    a = _create_array(xp, [3, 7, 9, 49, 1000], dtype)
+    return xp.divide(1.0, a)
+
+
+@testing.for_dtypes([numpy.float16, numpy.float32, numpy.float64, numpy.int32])
+@testing.numpy_asnumpy_array_equal()
+def test_int_scalar_divided_by_array_is_exact(xp, dtype):
+    """整数标量 / 数组：7/7 恰为 1，7/3 与 NumPy 逐位一致"""
+    a = _create_array(xp, [7, 3, 49, 1, 6], dtype)
+    return xp.divide(7, a)
+
+
+@testing.for_dtypes([numpy.int32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_arithmetic_scalar_promotes_kind(xp, dtype):
+    """高类别标量提升 dtype：int32 数组 * 2.5 -> float64"""
+    a = _create_array(xp, [1, 2, 3], dtype)
+    return xp.multiply(a, 2.5)
+
+
+@testing.for_dtypes([numpy.int32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_true_divide_int_scalar(xp, dtype):
+    """整数数组除以整数标量 -> float64"""
+    a = _create_array(xp, [1, 2, 3], dtype)
+    return xp.true_divide(a, 2)
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_power_scalar_keeps_dtype(xp, dtype):
+    """power 标量重载遵循 NEP 50"""
+    a = _create_array(xp, [1, 2, 3], dtype)
+    return xp.add(xp.power(a, 2), xp.power(2, a))
+
+
+# ========== out= 与原地运算 ==========
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_arithmetic_out(xp, dtype):
+    """out= 直接写入已有数组，并返回该数组"""
+    a = _create_array(xp, [1, 2, 3], dtype)
+    b = _create_array(xp, [4, 5, 6], dtype)
+    out = _create_array(xp, [0, 0, 0], dtype)
+    result = xp.multiply(a, b, out=out)
+    assert result is out
+    xp.subtract(out, 1.5, out=out)
+    return out
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_arithmetic_out_casts(xp, dtype):
+    """out 的 dtype 与结果不同：按 same_kind 转换后写入"""
+    a = _create_array(xp, [1, 2, 3], dtype)
+    out = _create_array(xp, [0, 0, 0], numpy.float64)
+    xp.add(a, a, out=out)
+    return out
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_arithmetic_inplace_operators(xp, dtype):
+    """+=, -=, *=, /= 原地更新（含广播的数组操作数）"""
+    a = _create_array(xp, [[1, 2, 3], [4, 5, 6]], dtype)
+    b = _create_array(xp, [1, 0, 1], dtype)
+    a += b
+    a *= 2
+    a -= b
+    a /= 4
+    return a
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(atol=1e-5, rtol=1e-5)
+def test_add_out_is_input(xp, dtype):
+    """np.add(a, b, out=a) 等价于 a += b"""
+    a = _create_array(xp, [1, 2, 3], dtype)
+    b = _create_array(xp, [4, 5, 6], dtype)
+    xp.add(a, b, out=a)
+    xp.multiply(a, a, out=a)
+    return a
+
+
+@testing.for_dtypes([numpy.int32])
+@testing.numpy_asnumpy_array_equal(accept_error=True)
+def test_inplace_true_divide_int(xp, dtype):
+    """整数数组 /= 会得到 float64，不能按 same_kind 写回"""
+    a = _create_array(xp, [2, 4, 6], dtype)
+    a /= 2
+    return a
+
+
+@pytest.mark.parametrize("op", ["inplace", "out"])
+def test_signed_result_into_unsigned_raises(op):
+    """int8 -> uint8 不满足 same_kind（NumPy 抛出 UFuncTypeError），须抛出 TypeError"""
+    a = ap.ndarray.from_numpy(numpy.array([1, 2, 3], dtype=numpy.uint8))
+    b = ap.ndarray.from_numpy(numpy.array([1, -1, 2], dtype=numpy.int8))
+    with pytest.raises(TypeError):
+        numpy.add(a.to_numpy(), b.to_numpy(), out=a.to_numpy())
+    with pytest.raises(TypeError):
+        if op == "inplace":
+            a += b
+        else:
+            ap.add(b, b.astype(numpy.int64), out=a)
+    numpy.testing.assert_array_equal(a.to_numpy(), [1, 2, 3])
+
+
+def test_unsigned_result_into_signed_is_same_kind():
+    """uint8 -> int8 满足 same_kind，与 NumPy 一致"""
+    a = numpy.array([1, 2, 3], dtype=numpy.int8)
+    b = numpy.array([4, 5, 6], dtype=numpy.uint8)
+    x = ap.ndarray.from_numpy(a)
+    x += ap.ndarray.from_numpy(b)
+    a += b
+    numpy.testing.assert_array_equal(x.to_numpy(), a)
@@ -15,6 +15,7 @@
 # *****************************************************************************
 
 import numpy
+import pytest
 
 from asnumpy import testing
 
@@ -85,3 +86,91 @@ def test_min_dim(xp, dtype):
     """测试 min(a, axis, keepdims) - 数组沿特定维度的最大值"""
     a = testing.shaped_random((3, 4, 5), dtype=dtype, xp=xp, seed=42)
     return xp.min(a, axis=1, keepdims=True)
+
+
+@testing.for_all_dtypes(no_complex=True)
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_max_axis_tuple(xp, dtype):
+    """测试 max(a, axis=tuple) - 一次归约多个维度"""
+    a = testing.shaped_random((3, 4, 5), dtype=dtype, xp=xp, seed=42)
+    return xp.max(a, axis=(0, 2))
+
+
+@testing.for_all_dtypes(no_complex=True)
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_min_axis_none_keepdims(xp, dtype):
+    """测试 min(a, keepdims=True) - 全局归约保留维度"""
+    a = testing.shaped_random((3, 4, 5), dtype=dtype, xp=xp, seed=42)
+    return xp.min(a, keepdims=True)
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_nanmax_axis_tuple(xp, dtype):
+    """测试 nanmax(a, axis=tuple) - 忽略 NaN"""
+    a = numpy.array([[[1.0, numpy.nan], [3.0, -2.0]], [[numpy.nan, 0.5], [7.0, 4.0]]], dtype=dtype)
+    if xp is not numpy:
+        a = xp.ndarray.from_numpy(a)
+    return xp.nanmax(a, axis=(0, 1))
+
+
+@testing.for_dtypes([numpy.float64])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_max_normalize(xp, dtype):
+    """测试 a / max(a) - 全局归约结果留在设备上参与后续运算"""
+    a = testing.shaped_random((3, 4), dtype=dtype, xp=xp, seed=42)
+    return xp.divide(xp.subtract(a, xp.min(a)), xp.max(a))
+
+
+def test_max_device_scalar():
+    """测试 max(a) 的 0 维结果：保持 dtype，只在转换或比较时取回主机"""
+    import asnumpy as ap
+
+    a = ap.ndarray.from_numpy(numpy.array([[3, -7], [11, 2]], dtype=numpy.int64))
+    m = ap.max(a)
+
+    assert isinstance(m, ap.ndarray)
+    assert m.shape == () and m.dtype == numpy.int64
+    assert int(m) == 11 and float(m) == 11.0
+    assert m == 11 and m > ap.min(a) and not m < 0
+    assert list(range(20))[m] == 11
+    assert f"{m:>4}" == "  11"
+    assert hash(m.item()) == hash(11)
+    with pytest.raises(TypeError):
+        hash(m)
+
+
+def test_device_scalar_compares_with_arrays_elementwise():
+    """测试 0 维结果与数组比较：逐元素在设备上比较，而非按对象身份"""
+    import asnumpy as ap
+
+    host = numpy.array([3, 11, -7, 11], dtype=numpy.int64)
+    a = ap.ndarray.from_numpy(host)
+    m = ap.max(a)
+
+    numpy.testing.assert_array_equal((m == a).to_numpy(), host == 11)
+    numpy.testing.assert_array_equal((a == m).to_numpy(), host == 11)
+    numpy.testing.assert_array_equal((m != a).to_numpy(), host != 11)
+    numpy.testing.assert_array_equal((m > a).to_numpy(), host < 11)
+    numpy.testing.assert_array_equal((a < m).to_numpy(), host < 11)
+    numpy.testing.assert_array_equal((m <= a).to_numpy(), host >= 11)
+    numpy.testing.assert_array_equal((a >= m).to_numpy(), host >= 11)
+
+
+@testing.for_dtypes([numpy.float32, numpy.int32])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_maximum_minimum_scalar(xp, dtype):
+    """测试 maximum/minimum 与 Python 标量"""
+    a = numpy.array([-3, 0, 2, 5], dtype=dtype)
+    if xp is not numpy:
+        a = xp.ndarray.from_numpy(a)
+    return xp.add(xp.maximum(a, 1), xp.minimum(4, a))
+
+
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_fmax_fmin_scalar_nan(xp):
+    """测试 fmax/fmin 标量重载忽略 NaN"""
+    a = numpy.array([numpy.nan, -1.0, 3.0], dtype=numpy.float32)
+    if xp is not numpy:
+        a = xp.ndarray.from_numpy(a)
+    return xp.add(xp.fmax(a, 0.5), xp.fmin(2.0, a))
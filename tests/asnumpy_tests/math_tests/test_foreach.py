@@ -0,0 +1,114 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for the multi-tensor operators in asnumpy.foreach."""
+
+import numpy as np
+import pytest
+
+import asnumpy as ap
+
+
+def _hosts(count, dtype=np.float32, low=-2.0):
+    rng = np.random.default_rng(0)
+    return [rng.uniform(low, 2, (i % 5 + 1, 7)).astype(dtype) for i in range(count)]
+
+
+def _arrays(hosts):
+    return [ap.ndarray.from_numpy(h) for h in hosts]
+
+
+@pytest.mark.parametrize(
+    "name, expected",
+    [("add", np.add), ("sub", np.subtract), ("mul", np.multiply), ("div", np.divide)],
+)
+def test_binary_over_more_than_one_chunk(name, expected):
+    a, b = _hosts(130), _hosts(130, low=0.5)
+    results = getattr(ap.foreach, name)(_arrays(a), _arrays(b))
+    assert len(results) == 130
+    for r, x, y in zip(results, a, b):
+        assert r.dtype == np.float32
+        np.testing.assert_allclose(r.to_numpy(), expected(x, y), rtol=1e-5, atol=1e-6)
+
+
+@pytest.mark.parametrize("name, expected", [("exp", np.exp), ("neg", np.negative)])
+def test_unary(name, expected):
+    a = _hosts(20)
+    for r, x in zip(getattr(ap.foreach, name)(_arrays(a)), a):
+        np.testing.assert_allclose(r.to_numpy(), expected(x), rtol=1e-5, atol=1e-6)
+
+
+def test_sqrt():
+    a = _hosts(20, low=0.0)
+    for r, x in zip(ap.foreach.sqrt(_arrays(a)), a):
+        np.testing.assert_allclose(r.to_numpy(), np.sqrt(x), rtol=1e-5, atol=1e-6)
+
+
+def test_scalar_ops_keep_dtype_and_follow_weak_promotion():
+    a = _hosts(10) + [np.arange(6, dtype=np.int32)]
+    scaled = ap.foreach.mul_scalar(_arrays(a), 2.5)
+    shifted = ap.foreach.add_scalar(_arrays(a), 3)
+    for s, t, x in zip(scaled, shifted, a):
+        assert s.dtype == (x * 2.5).dtype
+        assert t.dtype == (x + 3).dtype
+        np.testing.assert_allclose(s.to_numpy(), x * 2.5, rtol=1e-5, atol=1e-6)
+        np.testing.assert_allclose(t.to_numpy(), x + 3, rtol=1e-5, atol=1e-6)
+
+
+def test_mixed_lists_fall_back_per_array():
+    a = [
+        np.ones((3, 4), np.float32),
+        np.arange(5, dtype=np.float64),
+        np.arange(6, dtype=np.int64).reshape(2, 3),
+        np.full((2, 2), 2, np.float16),
+    ]
+    b = [
+        np.full((3, 4), 2, np.float32),
+        np.arange(5, dtype=np.float32),
+        np.ones(3, np.int64),
+        np.full((2, 2), 3, np.float16),
+    ]
+    for r, x, y in zip(ap.foreach.add(_arrays(a), _arrays(b)), a, b):
+        assert r.dtype == (x + y).dtype
+        np.testing.assert_allclose(r.to_numpy(), x + y, rtol=1e-3)
+
+
+def test_non_contiguous_inputs():
+    a = _hosts(4)
+    views = [x.T for x in _arrays(a)]
+    for r, x in zip(ap.foreach.mul(views, views), a):
+        np.testing.assert_allclose(r.to_numpy(), x.T * x.T, rtol=1e-5, atol=1e-6)
+
+
+@pytest.mark.parametrize("order", [1, 2, 3])
+def test_norm(order):
+    a = _hosts(12) + [np.arange(4, dtype=np.int32)]
+    results = ap.foreach.norm(_arrays(a), order)
+    for r, x in zip(results, a):
+        assert r.shape == ()
+        assert r.dtype == (np.float32 if x.dtype == np.float32 else np.float64)
+        np.testing.assert_allclose(r.to_numpy(), np.linalg.norm(x.ravel(), order), rtol=1e-4)
+
+
+def test_empty_lists():
+    assert ap.foreach.add([], []) == []
+    assert ap.foreach.exp([]) == []
+
+
+def test_length_mismatch_raises():
+    a = _arrays(_hosts(3))
+    with pytest.raises(ValueError):
+        ap.foreach.add(a, a[:2])
@@ -0,0 +1,178 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for fused-kernel rewrites of lazy expressions and asnumpy.fuse."""
+
+import numpy as np
+
+import asnumpy as ap
+
+
+def _arrays(*hosts):
+    return tuple(ap.ndarray.from_numpy(h) for h in hosts)
+
+
+def _hosts(count, dtype=np.float32):
+    rng = np.random.default_rng(0)
+    return tuple(rng.uniform(-2, 2, 128).astype(dtype) for _ in range(count))
+
+
+def test_hypot_pattern_becomes_one_step():
+    a, b = _hosts(2)
+    x, y = _arrays(a, b)
+
+    with ap.lazy():
+        r = np.sqrt(x * x + y * y)
+
+    plan = r.explain()
+    assert plan.splitlines()[0] == "# 1 kernel(s), 0 merged, 1 fused"
+    assert "hypot" in plan
+    np.testing.assert_allclose(r.to_numpy(), np.hypot(a, b), rtol=1e-5, atol=1e-6)
+
+
+def test_lerp_pattern():
+    a, b, t = _hosts(3)
+    x, y, w = _arrays(a, b, t)
+
+    with ap.lazy():
+        r = x + w * (y - x)
+
+    assert "= lerp(" in r.explain()
+    np.testing.assert_allclose(r.to_numpy(), a + t * (b - a), rtol=1e-5, atol=1e-5)
+
+
+def test_addcmul_and_axpy_patterns():
+    a, b, c = _hosts(3)
+    x, y, z = _arrays(a, b, c)
+
+    with ap.lazy():
+        fma = x + y * z
+        scaled = y * 2.5 + x
+        diff = x - y * z
+
+    assert "= addcmul(" in fma.explain()
+    assert "= axpy(" in scaled.explain()
+    assert "= addcmul(" in diff.explain()
+    np.testing.assert_allclose(fma.to_numpy(), a + b * c, rtol=1e-5, atol=1e-5)
+    np.testing.assert_allclose(scaled.to_numpy(), b * 2.5 + a, rtol=1e-5, atol=1e-5)
+    np.testing.assert_allclose(diff.to_numpy(), a - b * c, rtol=1e-5, atol=1e-5)
+
+
+def test_axpy_keeps_the_unfused_dtype():
+    ints = np.arange(-4, 4, dtype=np.int32)
+    halves = np.linspace(-2, 2, 8, dtype=np.float16)
+    small = np.arange(8, dtype=np.uint8)
+    cases = [
+        # (x, y, alpha): python float is weak but of a higher kind than int32 -> float64
+        (ints, ints, 2.0),
+        # NumPy scalars are strong: float32 scalar against int32 arrays -> float64
+        (ints, ints, np.float32(2)),
+        # float16 product before a float32 addend: the chain rounds it in float16 first
+        (halves, halves.astype(np.float32), 0.1),
+        (small, small + 50, np.uint8(3)),
+    ]
+    for a, b, alpha in cases:
+        x, y = _arrays(a, b)
+        with ap.lazy():
+            added = x * alpha + y
+            subtracted = y - x * alpha
+        for got, expected in ((added, a * alpha + b), (subtracted, b - a * alpha)):
+            result = got.to_numpy()
+            assert result.dtype == expected.dtype, (a.dtype, b.dtype, type(alpha))
+            np.testing.assert_allclose(result, expected, rtol=1e-3, atol=1e-3)
+
+
+def test_shared_product_is_not_fused():
+    a, b, c = _hosts(3)
+    x, y, z = _arrays(a, b, c)
+
+    @ap.fuse
+    def both(p, q, r):
+        product = p * q
+        return product + r, ap.sin(product)
+
+    plan = both.explain(x, y, z)
+    assert "addcmul" not in plan
+    assert "= multiply(" in plan
+    first, second = both(x, y, z)
+    np.testing.assert_allclose(first.to_numpy(), a * b + c, rtol=1e-5, atol=1e-5)
+    np.testing.assert_allclose(second.to_numpy(), np.sin(a * b), rtol=1e-5, atol=1e-5)
+
+
+def test_fuse_decorator_and_unfused_plan():
+    a, b, c = _hosts(3)
+    x, y, z = _arrays(a, b, c)
+
+    @ap.fuse
+    def kernel(p, q, r):
+        return p + q * r
+
+    assert "addcmul" in kernel.explain(x, y, z)
+    result = kernel(x, y, z)
+    assert isinstance(result, ap.ndarray)
+    np.testing.assert_allclose(result.to_numpy(), a + b * c, rtol=1e-5, atol=1e-5)
+
+    with ap.lazy():
+        r = x + y * z
+    assert "0 fused" in r.explain(fuse=False).splitlines()[0]
+    np.testing.assert_allclose(r.compute(fuse=False).to_numpy(), a + b * c, rtol=1e-5, atol=1e-5)
+
+
+def test_hypot_matches_numpy():
+    a, b = _hosts(2)
+    x, y = _arrays(a, b)
+
+    np.testing.assert_allclose(ap.hypot(x, y).to_numpy(), np.hypot(a, b), rtol=1e-5, atol=1e-6)
+
+
+def test_fuse_caches_one_program_per_signature():
+    a, b, c = _hosts(3)
+
+    @ap.fuse
+    def features(p, q, r):
+        return np.sqrt(p * p + q * q) / r + p * q
+
+    def expected(p, q, r):
+        return np.sqrt(p * p + q * q) / r + p * q
+
+    first = features(*_arrays(a, b, c))
+    second = features(*_arrays(a + 1, b - 1, c))
+    # 0 where the runtime cannot capture graphs: the function then runs as a fused plan.
+    assert features.program_count in (0, 1)
+    np.testing.assert_allclose(second.to_numpy(), expected(a + 1, b - 1, c), rtol=1e-5, atol=1e-5)
+    # Each call returns its own arrays; replaying does not overwrite earlier results.
+    np.testing.assert_allclose(first.to_numpy(), expected(a, b, c), rtol=1e-5, atol=1e-5)
+
+    half = features(*_arrays(a[:64], b[:64], c[:64]))
+    assert features.program_count in (0, 2)
+    np.testing.assert_allclose(
+        half.to_numpy(), expected(a[:64], b[:64], c[:64]), rtol=1e-5, atol=1e-5
+    )
+
+
+def test_fuse_does_not_replay_aliased_trace_for_distinct_arrays():
+    a, b = _hosts(2)
+
+    @ap.fuse
+    def diff(p, q):
+        return p * 2 - q
+
+    x, y = _arrays(a, b)
+    np.testing.assert_allclose(diff(x, x).to_numpy(), a, rtol=1e-5, atol=1e-5)
+    # Same shapes and dtypes, different aliasing: a separate program, not f(y, y).
+    np.testing.assert_allclose(diff(x, y).to_numpy(), a * 2 - b, rtol=1e-5, atol=1e-5)
+    np.testing.assert_allclose(diff(y, y).to_numpy(), b, rtol=1e-5, atol=1e-5)
+    assert diff.program_count in (0, 2)
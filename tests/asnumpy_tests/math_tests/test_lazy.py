@@ -0,0 +1,132 @@
+# *****************************************************************************
+# Copyright (c) 2025 AISS Group at Harbin Institute of Technology. All Rights Reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# *****************************************************************************
+
+"""Tests for deferred (lazy) evaluation of element-wise expressions."""
+
+import numpy as np
+
+import asnumpy as ap
+
+
+def _inputs():
+    a = np.linspace(1, 2, 256, dtype=np.float32)
+    b = np.linspace(-3, 3, 256, dtype=np.float32)
+    c = np.full(256, 2.0, dtype=np.float32)
+    return (a, b, c), tuple(ap.ndarray.from_numpy(x) for x in (a, b, c))
+
+
+def test_expression_is_deferred_until_observed():
+    (a, b, c), (x, y, z) = _inputs()
+
+    with ap.lazy():
+        assert ap.is_lazy()
+        r = np.sqrt(x * x + y * y) / z
+
+    assert not ap.is_lazy()
+    assert isinstance(r, ap.LazyArray)
+    assert not r.computed
+    np.testing.assert_allclose(r.to_numpy(), np.sqrt(a * a + b * b) / c, rtol=1e-5, atol=1e-6)
+    assert r.computed
+
+
+def test_plan_merges_common_subexpressions_and_frees_temporaries():
+    _, (x, y, _) = _inputs()
+
+    with ap.lazy():
+        r = ap.add(ap.multiply(x, y), ap.multiply(x, y))
+
+    plan = r.explain()
+    assert plan.splitlines()[0] == "# 2 kernel(s), 1 merged, 0 fused"
+    assert "frees %0" in plan
+
+
+def test_unobserved_nodes_are_not_planned():
+    _, (x, y, _) = _inputs()
+
+    with ap.lazy():
+        ap.exp(x)
+        r = ap.sin(y)
+
+    assert r.explain().splitlines()[0] == "# 1 kernel(s), 0 merged, 0 fused"
+
+
+def test_scalar_reduction_forces_evaluation():
+    (a, b, _), (x, y, _) = _inputs()
+
+    with ap.lazy():
+        total = ap.sum(ap.multiply(x, y))
+
+    assert isinstance(total, ap.ndarray) and total.shape == ()
+    np.testing.assert_allclose(float(total), np.sum(a * b), rtol=1e-4)
+
+
+def test_compute_shares_work_across_roots():
+    (a, b, _), (x, y, _) = _inputs()
+
+    with ap.lazy():
+        t = ap.multiply(x, y)
+        first, second = ap.compute(ap.cos(t), ap.sin(t))
+
+    assert isinstance(first, ap.ndarray)
+    np.testing.assert_allclose(first.to_numpy(), np.cos(a * b), rtol=1e-5, atol=1e-6)
+    np.testing.assert_allclose(second.to_numpy(), np.sin(a * b), rtol=1e-5, atol=1e-6)
+
+
+def test_dead_intermediates_lend_their_buffers():
+    (a, b, c), (x, y, z) = _inputs()
+    before = ap.cann.donation_stats()
+
+    with ap.lazy():
+        r = ap.exp(ap.add(ap.multiply(x, y), z))
+    plan = r.explain(fuse=False)
+    result = ap.compute(r, fuse=False)
+
+    assert "may write over %0" in plan and "may write over %1" in plan
+    after = ap.cann.donation_stats()
+    assert after["elided"] - before["elided"] == 2
+    np.testing.assert_allclose(result.to_numpy(), np.exp(a * b + c), rtol=1e-5, atol=1e-6)
+    # The leaves were only read.
+    np.testing.assert_array_equal(x.to_numpy(), a)
+    np.testing.assert_array_equal(z.to_numpy(), c)
+
+
+def test_buffer_donation_is_declined_for_other_shapes_and_kept_roots():
+    (a, b, _), (x, y, _) = _inputs()
+    w = np.stack([a, b, a])
+    before = ap.cann.donation_stats()
+
+    with ap.lazy():
+        t = ap.multiply(x, y)
+        kept = ap.sqrt(x)
+        r = ap.add(t, ap.ndarray.from_numpy(w))
+        s = ap.sin(kept)
+    r, s, kept = ap.compute(r, s, kept, fuse=False)
+
+    after = ap.cann.donation_stats()
+    assert after["elided"] == before["elided"]
+    assert after["declined"] - before["declined"] == 1
+    np.testing.assert_allclose(r.to_numpy(), a * b + w, rtol=1e-5, atol=1e-6)
+    np.testing.assert_allclose(kept.to_numpy(), np.sqrt(a), rtol=1e-5, atol=1e-6)
+    np.testing.assert_allclose(s.to_numpy(), np.sin(np.sqrt(a)), rtol=1e-5, atol=1e-6)
+
+
+def test_eager_mode_is_unchanged():
+    (a, _, _), (x, _, _) = _inputs()
+
+    r = ap.cos(x)
+
+    assert isinstance(r, ap.ndarray)
+    np.testing.assert_allclose(r.to_numpy(), np.cos(a), rtol=1e-5, atol=1e-6)
@@ -53,6 +53,36 @@ def test_sum_axis_none_xfail(xp, dtype):
     return xp.sum(a)
 
 
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_sum_axis_none(xp, dtype):
+    """记录：axis=None 直接在原数组上归约所有维度，不经过 flatten"""
+    a = testing.shaped_random((4, 5, 6), dtype=dtype, xp=xp, seed=7)
+    return xp.sum(a)
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_sum_axis_tuple(xp, dtype):
+    a = testing.shaped_random((4, 5, 6), dtype=dtype, xp=xp, seed=7)
+    return xp.sum(a, axis=(0, -1))
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_sum_axis_none_keepdims(xp, dtype):
+    a = testing.shaped_random((4, 5, 6), dtype=dtype, xp=xp, seed=7)
+    return xp.sum(a, keepdims=True)
+
+
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_sum_where(xp, dtype):
+    """记录：where 掩码外的元素按 0 参与求和"""
+    a = _create_array(xp, [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], dtype)
+    return xp.sum(a, axis=0, where=numpy.array([[True, False, True], [False, True, True]]))
+
+
 # ========== 2. 乘积 (Prod) ==========
 
 
@@ -72,6 +102,22 @@ def test_prod_axis_none_xfail(xp, dtype):
     return xp.prod(a)
 
 
+@testing.for_dtypes([numpy.float32])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_prod_axis_tuple(xp, dtype):
+    """记录：aclnnProdDim 只接受单个维度，多个维度依次归约"""
+    a = testing.shaped_random((2, 3, 4), dtype=dtype, xp=xp, seed=7)
+    return xp.prod(a, axis=(0, 2), keepdims=True)
+
+
+@testing.for_dtypes([numpy.float64])
+@testing.numpy_asnumpy_allclose(rtol=1e-5)
+def test_prod_where(xp, dtype):
+    """记录：where 掩码外的元素按 1 参与求积"""
+    a = _create_array(xp, [[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], dtype)
+    return xp.prod(a, where=numpy.array([True, False, True]))
+
+
 # ========== 3. 归约 Dtype 限制 (XFAIL) ==========
 
 
@@ -90,9 +90,6 @@ def test_mean_basic_global_float32():
     _assert_mean_allclose(data)
 
 
-@pytest.mark.xfail(
-    reason="[FIXABLE] mean returns float64 scalar for float32 global reduction", strict=True
-)
 def test_mean_basic_global_float32_dtype():
     """测试 mean: 全局均值返回 dtype 与 NumPy 一致"""
     data = numpy.array([1.0, 2.0, 3.0, 4.0], dtype=numpy.float32)
@@ -142,6 +139,44 @@ def test_mean_keepdims_axis_none():
     _assert_mean_allclose(data, keepdims=True)
 
 
+def test_mean_axis_tuple():
+    """测试 mean: axis 为元组时一次归约多个维度"""
+    data = numpy.arange(24, dtype=numpy.float32).reshape(2, 3, 4)
+    _assert_mean_allclose(data, axis=(0, 2))
+
+
+def test_mean_axis_tuple_keepdims():
+    """测试 mean: axis 为元组且 keepdims=True"""
+    data = numpy.arange(24, dtype=numpy.float32).reshape(2, 3, 4)
+    _assert_mean_allclose(data, axis=(-1, 0), keepdims=True)
+
+
+def test_mean_where():
+    """测试 mean: where 掩码只统计选中的元素"""
+    import asnumpy as ap
+
+    data = numpy.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], dtype=numpy.float32)
+    mask = numpy.array([True, False, True])
+    ap_result = ap.mean(ap.ndarray.from_numpy(data), axis=1, where=mask)
+    numpy.testing.assert_allclose(
+        _to_numpy(ap_result), numpy.mean(data, axis=1, where=mask), rtol=1e-5
+    )
+
+
+def test_mean_where_broadcast_mask_keepdims():
+    """测试 mean: 广播的 where 掩码在每个切片上计数（按轴与全局，keepdims）"""
+    import asnumpy as ap
+
+    data = numpy.arange(24, dtype=numpy.float32).reshape(2, 3, 4)
+    mask = numpy.array([[True], [False], [True]])
+    for axis in (1, None, (1, 2)):
+        ap_result = ap.mean(ap.ndarray.from_numpy(data), axis=axis, keepdims=True, where=mask)
+        numpy.testing.assert_allclose(
+            _to_numpy(ap_result),
+            numpy.mean(data, axis=axis, keepdims=True, where=mask),
+            rtol=1e-5,
+        )
+
 # ---------- 1.3 dtype 参数 ----------
 def test_mean_dtype_axis0_float64():
     """测试 mean: axis=0 且 dtype=float64"""
@@ -221,3 +256,13 @@ def test_mean_invalid_axis_negative():
     a = ap.ndarray.from_numpy(data)
     with pytest.raises(Exception):
         ap.mean(a, axis=-3)
+
+
+def test_mean_duplicate_axis():
+    """测试 mean: 重复的 axis 应抛出 ValueError"""
+    import asnumpy as ap
+
+    data = numpy.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]], dtype=numpy.float32)
+    a = ap.ndarray.from_numpy(data)
+    with pytest.raises(ValueError):
+        ap.mean(a, axis=(0, -2))
@@ -344,6 +344,139 @@ class TestUfuncCorrectness:
 
 
 
+class TestCoreDispatch:
+    """Test the C++ dispatcher behind registered ufuncs."""
+
+    @staticmethod
+    def _make_array(data, dtype=numpy.float32):
+        import asnumpy as anp
+
+        return anp.ndarray.from_numpy(numpy.array(data, dtype=dtype))
+
+    @staticmethod
+    def test_registered_ufuncs_are_core_objects():
+        """create_ufunc compiles loop tables into _core.ufunc."""
+        import asnumpy as anp
+        from asnumpy._core import ufunc as core_ufunc
+
+        assert isinstance(anp.add, core_ufunc)
+        assert repr(anp.add) == "<ufunc 'add'>"
+        assert anp.add.__doc__ == "Add arguments element-wise."
+
+    @staticmethod
+    def test_weak_scalar_keeps_array_dtype():
+        """A Python float next to a float32 array matches the float32 loop."""
+        import asnumpy as anp
+
+        a = TestCoreDispatch._make_array([1.0, 2.0])
+        result = anp.add(a, 0.5)
+        assert isinstance(result, anp.ndarray)
+        assert result.dtype == numpy.float32
+        numpy.testing.assert_allclose(result.to_numpy(), [1.5, 2.5])
+
+    @staticmethod
+    def test_fallback_for_unregistered_dtype():
+        """Dtypes without a loop go to the fallback."""
+        import asnumpy as anp
+
+        a = TestCoreDispatch._make_array([1, 2], dtype=numpy.int32)
+        result = anp.add(a, a)
+        assert result.dtype == numpy.int32
+        numpy.testing.assert_array_equal(result.to_numpy(), [2, 4])
+
+    @staticmethod
+    def test_out_and_dtype_keywords():
+        """out= is written and returned; dtype= selects the loop."""
+        import asnumpy as anp
+
+        a = TestCoreDispatch._make_array([1.0, 2.0])
+        out = TestCoreDispatch._make_array([0.0, 0.0])
+        assert anp.add(a, a, out=out) is out
+        numpy.testing.assert_allclose(out.to_numpy(), [2.0, 4.0])
+        assert anp.add(a, a, dtype=numpy.float32).dtype == numpy.float32
+
+    @staticmethod
+    def test_unexpected_keyword_raises_type_error():
+        import asnumpy as anp
+
+        a = TestCoreDispatch._make_array([1.0])
+        with pytest.raises(TypeError, match="unexpected keyword"):
+            anp.add(a, a, where=True)
+
+    @staticmethod
+    def test_lazy_mode_defers():
+        """Inside asnumpy.lazy() a call builds a node instead of running."""
+        import asnumpy as anp
+
+        a = TestCoreDispatch._make_array([1.0, 2.0])
+        with anp.lazy():
+            node = anp.sin(anp.add(a, a))
+        assert isinstance(node, anp.LazyArray)
+        numpy.testing.assert_allclose(node.to_numpy(), numpy.sin([2.0, 4.0]), atol=1e-5)
+
+
+class TestDispatchParity:
+    """_PyUfunc and _core.ufunc dispatch the same ops to the same results."""
+
+    @staticmethod
+    def _outcome(u, name, dtype, scalar, use_out):
+        import asnumpy as anp
+
+        data = numpy.array([1, 2, 3], dtype=dtype)
+        args = [anp.ndarray.from_numpy(data)]
+        if getattr(anp, name).nin == 2:
+            args.append(scalar if scalar is not None else anp.ndarray.from_numpy(data))
+        kwargs = {}
+        if use_out:
+            kwargs["out"] = anp.ndarray.from_numpy(numpy.zeros(3, dtype=dtype))
+        try:
+            result = u(*args, **kwargs)
+        except Exception as e:  # both dispatchers must reject alike
+            return type(e)
+        if use_out:
+            assert result is kwargs["out"]
+        return result.dtype, result.to_numpy()
+
+    @staticmethod
+    @pytest.mark.parametrize("use_out", [False, True])
+    @pytest.mark.parametrize(
+        "name, dtype, scalar",
+        [
+            ("add", numpy.float32, None),
+            ("add", numpy.float32, 0.5),
+            ("add", numpy.float32, 2),
+            ("add", numpy.float64, 0.5),
+            ("add", numpy.int32, None),
+            ("add", numpy.int32, 3),
+            ("add", numpy.int32, 0.5),
+            ("add", numpy.float32, 1.0 + 2.0j),
+            ("negative", numpy.float32, None),
+            ("negative", numpy.int32, None),
+            ("sin", numpy.float16, None),
+        ],
+    )
+    def test_same_dtype_and_values(name, dtype, scalar, use_out):
+        import asnumpy as anp
+        from asnumpy._ufunc import _PyUfunc
+
+        core = getattr(anp, name)
+        py = _PyUfunc(
+            core.name,
+            core._ops,
+            core.__doc__,
+            core._default_casting,
+            fallback=core._fallback,
+            accepts_out=core._accepts_out,
+        )
+        expected = TestDispatchParity._outcome(core, name, dtype, scalar, use_out)
+        actual = TestDispatchParity._outcome(py, name, dtype, scalar, use_out)
+        if isinstance(expected, type):
+            assert actual is expected
+            return
+        assert actual[0] == expected[0]
+        numpy.testing.assert_array_equal(actual[1], expected[1])
+
+
 class TestArrayUfuncProtocol:
     """Test __array_ufunc__ dispatch from NumPy to AsNumpy."""
 
@@ -383,6 +516,15 @@ class TestArrayUfuncProtocol:
         result = numpy.negative(arr)
         assert isinstance(result, type(arr))
 
+    @staticmethod
+    def test_numpy_add_out_dispatches():
+        """np.add(a, b, out=a) updates a and returns it, not a tuple."""
+        a = TestArrayUfuncProtocol._make_array([1.0, 2.0])
+        b = TestArrayUfuncProtocol._make_array([3.0, 4.0])
+        result = numpy.add(a, b, out=a)
+        assert result is a
+        numpy.testing.assert_allclose(a.to_numpy(), [4.0, 6.0])
+
     @staticmethod
     def test_result_consistency():
         """np.sin(asnumpy_arr) should match anp.sin(asnumpy_arr)."""
@@ -472,23 +614,19 @@ class TestWeakScalar:
 
     @staticmethod
     def test_coerce_float_to_float32():
-        """_coerce_weak_scalar converts Python float to float32."""
-        result = _mod._coerce_weak_scalar(1.5, numpy.dtype("float32"))
-        assert isinstance(result, numpy.ndarray)
-        assert result.dtype == numpy.dtype("float32")
-        assert result == 1.5
+        """_weak_scalar_dtype matches a Python float as float32."""
+        assert _mod._weak_scalar_dtype(1.5, numpy.dtype("float32")) == numpy.dtype("float32")
 
     @staticmethod
     def test_coerce_int_to_float32():
-        """_coerce_weak_scalar converts Python int to float32."""
-        result = _mod._coerce_weak_scalar(42, numpy.dtype("float32"))
-        assert result.dtype == numpy.dtype("float32")
+        """_weak_scalar_dtype matches a Python int as float32."""
+        assert _mod._weak_scalar_dtype(42, numpy.dtype("float32")) == numpy.dtype("float32")
 
     @staticmethod
     def test_coerce_complex_to_float_promotes_to_complex128():
         """Complex scalar coerced to real dtype promotes to complex128."""
-        result = _mod._coerce_weak_scalar(1.0 + 0j, numpy.dtype("float32"))
-        assert numpy.issubdtype(result.dtype, numpy.complexfloating)
+        result = _mod._weak_scalar_dtype(1.0 + 0j, numpy.dtype("float32"))
+        assert numpy.issubdtype(result, numpy.complexfloating)
 
     # ---------- ufunc dispatch with weak scalars (needs _ndarray mock) ----------
 
@@ -504,8 +642,7 @@ class TestWeakScalar:
         max_dtype = _get_max_array_dtype([arr, 0.5])
         assert max_dtype == numpy.dtype("float32")
         # After coercion, the scalar should have float32 dtype
-        coerced = _mod._coerce_weak_scalar(0.5, max_dtype)
-        assert coerced.dtype == numpy.dtype("float32")
+        assert _mod._weak_scalar_dtype(0.5, max_dtype) == numpy.dtype("float32")
 
     @staticmethod
     def test_ufunc_int_scalar_kind_le_float():